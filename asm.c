@@ -75,6 +75,28 @@
 //          E
 //      Lend:
 //
+//  - switch statement
+//      Dense case values dispatch through a jump table in .rodata which holds
+//      offsets to case labels, and sparse ones through binary search over the
+//      sorted case values.
+//
+//  - for statement (while statement as well)
+//      for (A; B; C) D
+//
+//          A
+//          if (B == 0)
+//              goto Lend;
+//      Lbegin:
+//          D
+//      Literator:
+//          C
+//          if (B)
+//              goto Lbegin;
+//      Lend:
+//
+//      When B defines labels and cannot be emitted twice, the guard at the
+//      top is replaced with the jump to the check at the bottom.
+//
 //  Stack state at the head of function:
 //  (When function has 8 arguments)
 //
@@ -109,6 +131,11 @@
 typedef struct {
     Obj *currentFunc;
     int loopBlockID;
+    // Arguments of the current function held in registers instead of stack.
+    Obj *regArgs[REG_ARGS_MAX_COUNT];
+    RegKind regArgHomes[REG_ARGS_MAX_COUNT];
+    int regArgsCount;
+    int tailCalls; // TRUE if calls in return statements may jump to callee.
 } DumpEnv;
 
 typedef struct {
@@ -116,17 +143,36 @@ typedef struct {
     AsmInst *tail;
 } AsmInstList;
 
+// A value living from AsmPush to the AsmPop which takes it.
+typedef struct LiveRange LiveRange;
+struct LiveRange {
+    LiveRange *next;  // Next range in order of AsmPush.
+    LiveRange *outer; // Range pushed just before this and still alive.
+    AsmInst *push;
+    AsmInst *pop;
+    int start;        // Position of `push` in instruction list.
+    int end;          // Position of `pop` in instruction list.
+    int pinned;       // TRUE if this value must stay on stack.
+    int touched;      // Bit set of registers used between `push` and `pop`.
+    int reg;          // Index of allocatableRegs[], or -1 when on stack.
+};
+
 static DumpEnv dumpEnv;
-static AsmInst *genCodeInitVarArray(const Node *n, TypeInfo *varType);
-static AsmInst *genCodeInitVarStruct(const Node *n, TypeInfo *varType);
-static AsmInst *genCodeInitVar(const Node *n, TypeInfo *varType);
+static AsmInstList *genCodeInitVarArray(const Node *n, TypeInfo *varType);
+static AsmInstList *genCodeInitVarStruct(const Node *n, TypeInfo *varType);
+static AsmInstList *genCodeInitVar(const Node *n, TypeInfo *varType);
+static AsmInstList *genCodeNode(const Node *n);
+static AsmInstList *genCodeTailCall(const Node *n);
+static int canTailCall(const Node *n);
+static int allocateRegisters(AsmInst *inst);
+static void alignStackForCalls(AsmInst *inst);
 
 static int isEqualRegister(const Register *a, const Register *b) {
     return a->kind == b->kind && a->size == b->size;
 }
 
 static int isEqualRegisterOperand(const AsmInstOperand *a, const AsmInstOperand *b) {
-    return a->mode == AsmAddressingModeRegister && a->mode == AsmAddressingModeRegister &&
+    return a->mode == AsmAddressingModeRegister && b->mode == AsmAddressingModeRegister &&
            isEqualRegister(&a->src.reg, &b->src.reg);
 }
 
@@ -156,12 +202,6 @@ static AsmInst *newAsmInst(AsmInstKind kind) {
     return inst;
 }
 
-static AsmInst *newAsmInstMov(AsmInstDataMov *mov) {
-    AsmInst *inst = newAsmInst(AsmMov);
-    inst->data.mov = *mov;
-    return inst;
-}
-
 static AsmInst *newAsmInstAnyText(char *text) {
     AsmInst *inst = newAsmInst(AsmAnyText);
     inst->text = text;
@@ -175,6 +215,11 @@ static void freeAsmInst(AsmInst *inst) {
         // statically stored string.
         // safeFree(inst->text);
         break;
+    case AsmLabel:
+    case AsmJmp:
+    case AsmJcc:
+        safeFree(inst->text);
+        break;
     default:
         break;
     }
@@ -199,6 +244,8 @@ static void initAsmInstList(AsmInstList *list) {
 /**
  * Append given AsmInst object at the end of AsmInst-list.
  * Do nothing when the given AsmInst object is NULL.
+ * This walks through the all instructions chained after `inst`; use
+ * appendAsmInstList() to append a list generated by genCode*() functions.
  */
 static void appendAsmInst(AsmInstList *list, AsmInst *inst) {
     if (!inst) {
@@ -228,8 +275,144 @@ static void appendAsmInstPop(AsmInstList *list, Register *r) {
     appendAsmInst(list, inst);
 }
 
-static void appendAsmInstMov(AsmInstList *list, AsmInstDataMov *mov) {
-    appendAsmInst(list, newAsmInstMov(mov));
+/**
+ * Append new instruction taking two operands, like AsmMov, AsmAdd, etc., after
+ * `list`.  `dst` and `src` must be ones made by newOperand*() functions, and
+ * they're freed here.
+ */
+static void appendAsmInstBinOp(
+        AsmInstList *list, AsmInstKind kind, AsmInstOperand *dst, AsmInstOperand *src) {
+    AsmInst *inst = newAsmInst(kind);
+    inst->data.binop.dst = *dst;
+    inst->data.binop.src = *src;
+    safeFree(dst);
+    safeFree(src);
+    appendAsmInst(list, inst);
+}
+
+/**
+ * Append new instruction taking one operand, AsmIdiv or AsmCall, after `list`.
+ * `operand` must be one made by newOperand*() functions, and it's freed here.
+ */
+static void appendAsmInstUnOp(
+        AsmInstList *list, AsmInstKind kind, AsmInstOperand *operand) {
+    AsmInst *inst = newAsmInst(kind);
+    inst->data.unary = *operand;
+    safeFree(operand);
+    appendAsmInst(list, inst);
+}
+
+/**
+ * Append new AsmLabel-typed instruction after `list`.  The label name is
+ * made from `fmt` like printf().
+ */
+static void appendAsmInstLabel(AsmInstList *list, const char *fmt, ...) {
+    va_list ap;
+    AsmInst *inst = newAsmInst(AsmLabel);
+
+    va_start(ap, fmt);
+    inst->text = vformat(fmt, ap);
+    va_end(ap);
+
+    appendAsmInst(list, inst);
+}
+
+/**
+ * Append new AsmJmp-typed instruction after `list`.  The label to jump is
+ * made from `fmt` like printf().
+ */
+static void appendAsmInstJmp(AsmInstList *list, const char *fmt, ...) {
+    va_list ap;
+    AsmInst *inst = newAsmInst(AsmJmp);
+
+    va_start(ap, fmt);
+    inst->text = vformat(fmt, ap);
+    va_end(ap);
+
+    appendAsmInst(list, inst);
+}
+
+/**
+ * Append new AsmJcc-typed instruction, which jumps when `cond` is satisfied,
+ * after `list`.  The label to jump is made from `fmt` like printf().
+ */
+static void appendAsmInstJcc(AsmInstList *list, AsmCondKind cond, const char *fmt, ...) {
+    va_list ap;
+    AsmInst *inst = newAsmInst(AsmJcc);
+
+    va_start(ap, fmt);
+    inst->text = vformat(fmt, ap);
+    va_end(ap);
+    inst->data.cond.cond = cond;
+
+    appendAsmInst(list, inst);
+}
+
+/**
+ * Append new AsmSetcc-typed instruction after `list`.  Set 1 to `reg` when
+ * `cond` is satisfied, otherwise 0.
+ */
+static void appendAsmInstSetcc(AsmInstList *list, AsmCondKind cond, Register *reg) {
+    AsmInst *inst = newAsmInst(AsmSetcc);
+    inst->data.cond.cond = cond;
+    inst->data.cond.reg = *reg;
+    appendAsmInst(list, inst);
+}
+
+static AsmInstOperand *newOperandReg(RegKind kind, OperandSize size) {
+    AsmInstOperand *op = safeAlloc(sizeof(AsmInstOperand));
+    op->mode = AsmAddressingModeRegister;
+    op->src.reg.kind = kind;
+    op->src.reg.size = size;
+    return op;
+}
+
+static AsmInstOperand *newOperandImm(int value) {
+    AsmInstOperand *op = safeAlloc(sizeof(AsmInstOperand));
+    op->mode = AsmAddressingModeImm;
+    op->src.imm.value = value;
+    return op;
+}
+
+// Make an operand refers address of label.  `label` is used as is.
+static AsmInstOperand *newOperandLabel(char *label) {
+    AsmInstOperand *op = safeAlloc(sizeof(AsmInstOperand));
+    op->mode = AsmAddressingModeImm;
+    op->src.imm.isLabel = 1;
+    op->src.imm.label = label;
+    return op;
+}
+
+// Make an operand refers memory at `offset` bytes from the address in `base`.
+static AsmInstOperand *newOperandMem(OperandSize size, RegKind base, int offset) {
+    AsmInstOperand *op = safeAlloc(sizeof(AsmInstOperand));
+    op->mode = AsmAddressingModeMemory;
+    op->src.mem.isRelative = 1;
+    op->src.mem.size = size;
+    op->src.mem.base.kind = base;
+    op->src.mem.base.size = OpSize64;
+    op->src.mem.offset.value = offset;
+    return op;
+}
+
+// Make an operand refers memory at `offset` bytes from the address in `base`
+// plus `index` multiplied by `scale`.
+static AsmInstOperand *newOperandMemIndex(
+        OperandSize size, RegKind base, RegKind index, int scale, int offset) {
+    AsmInstOperand *op = newOperandMem(size, base, offset);
+    op->src.mem.hasIndex = 1;
+    op->src.mem.index.kind = index;
+    op->src.mem.index.size = OpSize64;
+    op->src.mem.scale = scale;
+    return op;
+}
+
+// Make an operand refers memory at `label`, relative to RIP.
+static AsmInstOperand *newOperandMemRIP(OperandSize size, char *label) {
+    AsmInstOperand *op = newOperandMem(size, RIP, 0);
+    op->src.mem.offset.isLabel = 1;
+    op->src.mem.offset.label = label;
+    return op;
 }
 
 /**
@@ -248,6 +431,45 @@ static void appendAsmInstAnyText(AsmInstList *list, const char *fmt, ...) {
     appendAsmInst(list, newInst);
 }
 
+/**
+ * Append all instructions in `sublist` at the end of `list` in constant time.
+ * `sublist` must be one returned from takeAsmInstList(), and it's freed here.
+ */
+static void appendAsmInstList(AsmInstList *list, AsmInstList *sublist) {
+    if (list->tail->next)
+        error("Internal error: Given asm list already has next element.");
+    if (sublist->head.next) {
+        list->tail->next = sublist->head.next;
+        list->tail = sublist->tail;
+    }
+    safeFree(sublist);
+}
+
+/**
+ * Move instructions in `list` into newly allocated AsmInstList object so that
+ * they can be returned from functions with their tail.  `list` becomes empty.
+ */
+static AsmInstList *takeAsmInstList(AsmInstList *list) {
+    AsmInstList *taken = safeAlloc(sizeof(AsmInstList));
+    initAsmInstList(taken);
+    if (list->head.next) {
+        taken->head.next = list->head.next;
+        taken->tail = list->tail;
+    }
+    initAsmInstList(list);
+    return taken;
+}
+
+/**
+ * Free an AsmInstList object returned from takeAsmInstList(), and return the
+ * instructions it had.
+ */
+static AsmInst *releaseAsmInstList(AsmInstList *list) {
+    AsmInst *inst = list->head.next;
+    safeFree(list);
+    return inst;
+}
+
 static AsmInst *getRawAsmInstList(AsmInstList *list) { return list->head.next; }
 
 static int isExprNode(const Node *n) {
@@ -339,6 +561,36 @@ static int isRegisterStorableValue(const Node *n) {
     }
 }
 
+static int isCompareNode(const Node *n) {
+    return n->kind == NodeEq || n->kind == NodeNeq || n->kind == NodeLT ||
+           n->kind == NodeLE;
+}
+
+/**
+ * Returns TRUE if the value of node `n` can be embedded into an instruction as
+ * an immediate operand.
+ */
+static int isImmediateNode(const Node *n) { return n->kind == NodeNum; }
+
+/**
+ * Returns TRUE if `val` scaled by `scale` still fits in an immediate operand.
+ */
+static int isScaledImmediate(int val, int scale) { return val * scale / scale == val; }
+
+/**
+ * Returns k when `val` is 2^k, otherwise -1.
+ */
+static int exactLog2(int val) {
+    int k = 0;
+    if (val <= 0)
+        return -1;
+    while (val % 2 == 0) {
+        val /= 2;
+        ++k;
+    }
+    return val == 1 ? k : -1;
+}
+
 static void fillNodeNum(Node *n, int val) {
     n->kind = NodeNum;
     n->val = val;
@@ -360,6 +612,9 @@ static void fillNodeInitVar(Node *n, Token *token, Node *var, Node *init) {
     n->type = &Types.Void;
 }
 
+// Round up `n` to multiple of `align`.
+static int alignTo(int n, int align) { return (n + align - 1) / align * align; }
+
 // Return an integer corresponding to 1 for given type.
 // In concrate explanation, return
 // - sizeof(type) for "type *" and "type[]"
@@ -371,42 +626,6 @@ static int getAlternativeOfOneForType(const TypeInfo *ti) {
     return 1;
 }
 
-// clang-format off
-static const char *RegTable[RegCount][4] = {
-    {"rax", "eax",  "ax",   "al"},
-    {"rdi", "edi",  "di",   "dil"},
-    {"rsi", "esi",  "si",   "sil"},
-    {"rdx", "edx",  "dx",   "dl"},
-    {"rcx", "ecx",  "cx",   "cl"},
-    {"rbp", "ebp",  "bp",   "bpl"},
-    {"rsp", "esp",  "sp",   "spl"},
-    {"rbx", "ebx",  "bx",   "bl"},
-    {"r8",  "r8d",  "r8w",  "r8b"},
-    {"r9",  "r9d",  "r9w",  "r9b"},
-    {"r10", "r10d", "r10w", "r10b"},
-    {"r11", "r11d", "r11w", "r11b"},
-    {"r12", "r12d", "r12w", "r12b"},
-    {"r13", "r13d", "r13w", "r13b"},
-    {"r14", "r14d", "r14w", "r14b"},
-    {"r15", "r15d", "r15w", "r15b"},
-};
-// clang-format on
-
-static const char *getReg(RegKind reg, int size) {
-    switch (size) {
-    case 1:
-        return RegTable[reg][3];
-    case 2:
-        return RegTable[reg][2];
-    case 4:
-        return RegTable[reg][1];
-    case 8:
-        return RegTable[reg][0];
-    }
-    errorUnreachable();
-    return "";
-}
-
 /*
 static const char *argRegs[REG_ARGS_MAX_COUNT] = {
     "rdi", "rsi", "rdx", "rcx", "r8", "r9"
@@ -415,6 +634,42 @@ static const char *argRegs[REG_ARGS_MAX_COUNT] = {
 
 static const RegKind argRegs[REG_ARGS_MAX_COUNT] = {RDI, RSI, RDX, RCX, R8, R9};
 
+// Switch statements with at least SWITCH_JUMP_TABLE_MIN_CASES cases whose
+// values cover at least 1/SWITCH_JUMP_TABLE_DENSITY of their range dispatch
+// through a jump table.  Others dispatch by binary search, which falls back to
+// linear search for up to SWITCH_LINEAR_SEARCH_MAX_CASES cases.
+#define SWITCH_JUMP_TABLE_MIN_CASES (4)
+#define SWITCH_JUMP_TABLE_DENSITY (3)
+#define SWITCH_JUMP_TABLE_MAX_SIZE (4096)
+#define SWITCH_LINEAR_SEARCH_MAX_CASES (3)
+
+// Bytes below RSP which leaf functions may use without moving RSP.
+#define RED_ZONE_SIZE (128)
+
+// Registers which hold values instead of stack.  Caller-saved registers come
+// first since they cost no save and restore, but they can hold only values
+// whose push and pop have no function call or no use of the register between.
+// Generated code never touches callee-saved registers otherwise and function
+// calls preserve them, so they can hold values across any instructions.
+#define CALLER_SAVED_REGS_COUNT (8)
+#define CALLEE_SAVED_REGS_COUNT (5)
+#define ALLOCATABLE_REGS_COUNT (CALLER_SAVED_REGS_COUNT + CALLEE_SAVED_REGS_COUNT)
+static const RegKind calleeSavedRegs[CALLEE_SAVED_REGS_COUNT] = {RBX, R12, R13, R14, R15};
+static const RegKind allocatableRegs[ALLOCATABLE_REGS_COUNT] = {
+        RAX, RDI, RSI, RCX, R8, R9, R10, R11, RBX, R12, R13, R14, R15};
+
+// Returns TRUE and sets the register holding `obj` to `reg` if `obj` is an
+// argument of the current function held in register.
+static int findRegisterArg(const Obj *obj, RegKind *reg) {
+    for (int i = 0; i < dumpEnv.regArgsCount; ++i) {
+        if (dumpEnv.regArgs[i] == obj) {
+            *reg = dumpEnv.regArgHomes[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
 #define regobj(kind, size) ((Register){(kind), (size)})
 #define reg64obj(kind) regobj(kind, OpSize64)
 #define asmPushReg(pushreg)                                                              \
@@ -424,11 +679,28 @@ static const RegKind argRegs[REG_ARGS_MAX_COUNT] = {RDI, RSI, RDX, RCX, R8, R9};
         operand.src.reg = (pushreg);                                                     \
         appendAsmInstPush(&asmlist, &operand);                                           \
     } while (0)
+#define asmPushImm(pushval)                                                              \
+    do {                                                                                 \
+        AsmInstOperand operand;                                                          \
+        operand.mode = AsmAddressingModeImm;                                             \
+        operand.src.imm.isLabel = 0;                                                     \
+        operand.src.imm.value = (pushval);                                               \
+        appendAsmInstPush(&asmlist, &operand);                                           \
+    } while (0)
 #define asmPushRax() asmPushReg(reg64obj(RAX))
 #define asmPopRax() appendAsmInstPop(&asmlist, &reg64obj(RAX))
+#define regop(kind, size) newOperandReg((kind), (size))
+#define reg64op(kind) regop(kind, OpSize64)
+#define immop(val) newOperandImm(val)
+#define memop(size, base, offset) newOperandMem((size), (base), (offset))
+#define memidxop(size, base, index, scale, offset)                                       \
+    newOperandMemIndex((size), (base), (index), (scale), (offset))
+#define asmBinOp(kind, dst, src) appendAsmInstBinOp(&asmlist, (kind), (dst), (src))
+#define asmUnOp(kind, operand) appendAsmInstUnOp(&asmlist, (kind), (operand))
+#define asmNoOperand(kind) appendAsmInst(&asmlist, newAsmInst(kind))
 #define asmPrintPosition() appendAsmInstAnyText(&asmlist, "  # %s:%d", __FILE__, __LINE__)
 
-static AsmInst *genCodeGVarInit(GVarInit *initializer) {
+static AsmInstList *genCodeGVarInit(GVarInit *initializer) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
@@ -450,20 +722,24 @@ static AsmInst *genCodeGVarInit(GVarInit *initializer) {
                 errorUnreachable();
             }
         } else if (elem->kind == GVarInitString) {
-            appendAsmInstAnyText(
-                    &asmlist, "  .string \"%s\"", elem->rhs->token->literalStr->string);
+            appendAsmInstAnyText(&asmlist, "  .string \"%s\"",
+                    elem->rhs->token->data.literalStr->string);
         } else if (elem->kind == GVarInitPointer) {
             if (elem->rhs->kind == NodeLiteralString) {
                 appendAsmInstAnyText(&asmlist, "  .quad .LiteralString%d",
-                        elem->rhs->token->literalStr->id);
+                        elem->rhs->token->data.literalStr->id);
             } else if (elem->rhs->kind == NodeGVar) {
                 Token *token = initializer->rhs->token;
                 appendAsmInstAnyText(&asmlist, "  .quad %.*s", token->len, token->str);
+            } else if (elem->rhs->kind == NodeLVar &&
+                       elem->rhs->obj->type->type == TypeFunction) {
+                Token *token = elem->rhs->token;
+                appendAsmInstAnyText(&asmlist, "  .quad %.*s", token->len, token->str);
             } else if (elem->rhs->kind == NodeLVar) {
                 appendAsmInstAnyText(
                         &asmlist, "  .quad .StaticVar%d", elem->rhs->obj->staticVarID);
             } else if (elem->rhs->kind == NodeNum) {
-                appendAsmInstAnyText(&asmlist, "  .long %d", elem->rhs->val);
+                appendAsmInstAnyText(&asmlist, "  .quad %d", elem->rhs->val);
             } else {
                 errorUnreachable();
             }
@@ -472,7 +748,7 @@ static AsmInst *genCodeGVarInit(GVarInit *initializer) {
         }
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
 AsmInst *genAsmGlobals(void) {
@@ -510,27 +786,27 @@ AsmInst *genAsmGlobals(void) {
             appendAsmInstAnyText(&asmlist, ".globl %.*s", v->token->len, v->token->str);
         }
         appendAsmInstAnyText(&asmlist, "%.*s:", v->token->len, v->token->str);
-        appendAsmInst(&asmlist, genCodeGVarInit(gvar->initializer));
+        appendAsmInstList(&asmlist, genCodeGVarInit(gvar->initializer));
     }
     for (GVar *v = globals.staticVars; v; v = v->next) {
         appendAsmInstAnyText(&asmlist, ".StaticVar%d:", v->obj->staticVarID);
-        appendAsmInst(&asmlist, genCodeGVarInit(v->initializer));
+        appendAsmInstList(&asmlist, genCodeGVarInit(v->initializer));
     }
 
     return getRawAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeLVal(const Node *n) {
+static AsmInstList *genCodeLVal(const Node *n) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     if (n->kind == NodeDeref) {
-        appendAsmInst(&asmlist, genAsm(n->rhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
         // Address for variable must be on the top of the stack.
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
     } else if (n->kind == NodeExprList) {
         Node *expr = n->body;
         if (!expr)
@@ -539,8 +815,8 @@ static AsmInst *genCodeLVal(const Node *n) {
             expr = expr->next;
         if (!isLvalue(expr))
             errorAt(expr->token, "Not a lvalue");
-        appendAsmInst(&asmlist, genAsm(n));
-        return getRawAsmInstList(&asmlist);
+        appendAsmInstList(&asmlist, genCodeNode(n));
+        return takeAsmInstList(&asmlist);
     } else if (!isLvalue(n)) {
         errorAt(n->token, "Not a lvalue");
     }
@@ -552,83 +828,169 @@ static AsmInst *genCodeLVal(const Node *n) {
     // not on rbp, because rbp must NOT be changed until exiting from a
     // function.
     if (n->kind == NodeGVar || (n->kind == NodeLVar && n->obj->isExtern)) {
-        appendAsmInstAnyText(
-                &asmlist, "  lea rax, %.*s[rip]", n->token->len, n->token->str);
+        asmBinOp(AsmLea, reg64op(RAX),
+                newOperandMemRIP(OpSize64, format("%.*s", n->token->len, n->token->str)));
         asmPushRax();
     } else if (n->kind == NodeMemberAccess) {
         StructOrUnion *objdef = n->lhs->type->type == TypeStruct ? n->lhs->type->structDef
                                                                  : n->lhs->type->unionDef;
-        Obj *m = findStructOrUnionMember(objdef, n->token->str, n->token->len);
-        appendAsmInst(&asmlist, genCodeLVal(n->lhs));
+        Obj *m = findStructOrUnionMember(objdef, n->token->data.atom);
+        appendAsmInstList(&asmlist, genCodeLVal(n->lhs));
         asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  add rax, %d", m->offset);
-        asmPushRax();
-    } else if (n->kind == NodeLVar && n->obj->isStatic) {
-        appendAsmInstAnyText(
-                &asmlist, "  lea rax, .StaticVar%d[rip]", n->obj->staticVarID);
+        asmBinOp(AsmAdd, reg64op(RAX), immop(m->offset));
         asmPushRax();
     } else if (n->obj->type->type == TypeFunction) {
-        appendAsmInstAnyText(&asmlist, "  mov rax, QWORD PTR %.*s@GOTPCREL[rip]",
-                n->token->len, n->token->str);
+        asmBinOp(AsmMov, reg64op(RAX),
+                newOperandMemRIP(OpSize64,
+                        format("%.*s@GOTPCREL", n->token->len, n->token->str)));
+        asmPushRax();
+    } else if (n->kind == NodeLVar && n->obj->isStatic) {
+        asmBinOp(AsmLea, reg64op(RAX),
+                newOperandMemRIP(OpSize64, format(".StaticVar%d", n->obj->staticVarID)));
         asmPushRax();
     } else {
-        appendAsmInstAnyText(&asmlist, "  mov rax, rbp");
-        appendAsmInstAnyText(&asmlist, "  sub rax, %d", n->obj->offset);
+        asmBinOp(AsmMov, reg64op(RAX), reg64op(RBP));
+        asmBinOp(AsmSub, reg64op(RAX), immop(n->obj->offset));
         asmPushRax();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
+}
+
+// Returns TRUE if `n` is an array placed on the stack frame, whose address is
+// known as an offset from RBP.
+static int isFrameArray(const Node *n) {
+    return n->kind == NodeLVar && n->type->type == TypeArray && !n->obj->isStatic &&
+           !n->obj->isExtern;
+}
+
+/**
+ * Generate code computing the address `n` points, and make a memory operand
+ * of `size` referring it into `*op`.  Addition of a pointer and an integer is
+ * folded into the operand as [base + index * scale + displacement] when the
+ * element size is 1, 2, 4 or 8.  The operand uses RAX and RSI.
+ */
+static AsmInstList *genCodeMemOperand(
+        const Node *n, OperandSize size, AsmInstOperand **op) {
+    int scale = getAlternativeOfOneForType(n->type);
+    const Node *ptr = NULL;
+    const Node *index = NULL;
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (n->kind == NodeAdd && isWorkLikePointer(n->type)) {
+        ptr = isWorkLikePointer(n->lhs->type) ? n->lhs : n->rhs;
+        index = ptr == n->lhs ? n->rhs : n->lhs;
+    }
+
+    if (ptr && isImmediateNode(index) && isScaledImmediate(index->val, scale)) {
+        if (isFrameArray(ptr)) {
+            *op = memop(size, RBP, index->val * scale - ptr->obj->offset);
+        } else {
+            appendAsmInstList(&asmlist, genCodeNode(ptr));
+            asmPopRax();
+            *op = memop(size, RAX, index->val * scale);
+        }
+    } else if (ptr && (scale == 1 || scale == 2 || scale == 4 || scale == 8)) {
+        if (isFrameArray(ptr)) {
+            appendAsmInstList(&asmlist, genCodeNode(index));
+            asmPopRax();
+            *op = memidxop(size, RBP, RAX, scale, -ptr->obj->offset);
+        } else {
+            appendAsmInstList(&asmlist, genCodeNode(ptr));
+            appendAsmInstList(&asmlist, genCodeNode(index));
+            asmPopRax();
+            appendAsmInstPop(&asmlist, &reg64obj(RSI));
+            *op = memidxop(size, RSI, RAX, scale, 0);
+        }
+    } else {
+        appendAsmInstList(&asmlist, genCodeNode(n));
+        asmPopRax();
+        *op = memop(size, RAX, 0);
+    }
+
+    return takeAsmInstList(&asmlist);
 }
 
 // Generate code for dereferencing variables as rvalue.  If you need code for
 // dereferencing variables as lvalue, use genCodeLVal() instead.
-static AsmInst *genCodeDeref(const Node *n) {
+static AsmInstList *genCodeDeref(const Node *n) {
+    AsmInstOperand *src = NULL;
+    OperandSize size;
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
-
-    appendAsmInst(&asmlist, genCodeLVal(n));
+        return takeAsmInstList(&asmlist);
 
     // Even when a value is treated as rvalue, we should left a memory address
     // on stack for values that cannot always assign to a register like struct,
     // array or function.
-    if (!isRegisterStorableValue(n))
-        return getRawAsmInstList(&asmlist);
+    if (!isRegisterStorableValue(n)) {
+        appendAsmInstList(&asmlist, genCodeLVal(n));
+        return takeAsmInstList(&asmlist);
+    }
 
-    appendAsmInstAnyText(&asmlist, "  mov rax, [rsp]");
+    size = getOperandSizeFromByteSize(sizeOf(n->type));
+    if (n->kind == NodeDeref) {
+        appendAsmInstList(&asmlist, genCodeMemOperand(n->rhs, size, &src));
+    } else {
+        appendAsmInstList(&asmlist, genCodeLVal(n));
+        asmPopRax();
+        src = memop(size, RAX, 0);
+    }
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(&asmlist, "  mov rax, [rax]");
+        asmBinOp(AsmMov, reg64op(RAX), src);
         break;
     case 4:
-        appendAsmInstAnyText(&asmlist, "  mov eax, DWORD PTR [rax]");
-        appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+        asmBinOp(AsmMov, regop(RAX, OpSize32), src);
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(&asmlist, "  mov al, BYTE PTR [rax]");
-        appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+        asmBinOp(AsmMov, regop(RAX, OpSize8), src);
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
         break;
     default:
-        // appendAsmInstAnyText(&asmlist, "  lea rax, [rax]");
+        // asmBinOp(AsmLea, reg64op(RAX), memop(OpSize64, RAX, 0));
         // break;
         errorUnreachable();
     }
-    appendAsmInstAnyText(&asmlist, "  mov [rsp], rax");
+    asmPushRax();
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeAssign(const Node *n) {
+static AsmInstList *genCodeAssign(const Node *n) {
+    RegKind reg;
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
+
+    if (n->lhs->kind == NodeLVar && findRegisterArg(n->lhs->obj, &reg)) {
+        OperandSize size = getOperandSizeFromByteSize(sizeOf(n->type));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+        appendAsmInstPop(&asmlist, &reg64obj(RDI));
+        asmBinOp(AsmMov, regop(reg, size), regop(RDI, size));
+        asmPushReg(reg64obj(RDI));
+        return takeAsmInstList(&asmlist);
+    }
+
+    if (n->lhs->kind == NodeDeref) {
+        AsmInstOperand *dst = NULL;
+        OperandSize size = getOperandSizeFromByteSize(sizeOf(n->type));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+        appendAsmInstList(&asmlist, genCodeMemOperand(n->lhs->rhs, size, &dst));
+        appendAsmInstPop(&asmlist, &reg64obj(RDI));
+        asmBinOp(AsmMov, dst, regop(RDI, size));
+        asmPushReg(reg64obj(RDI));
+        return takeAsmInstList(&asmlist);
+    }
 
-    appendAsmInst(&asmlist, genAsm(n->rhs));
-    appendAsmInst(&asmlist, genCodeLVal(n->lhs));
+    appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+    appendAsmInstList(&asmlist, genCodeLVal(n->lhs));
     // Stack before assign:
     // |                     |
     // |       ......        |
@@ -648,299 +1010,855 @@ static AsmInst *genCodeAssign(const Node *n) {
     appendAsmInstPop(&asmlist, &reg64obj(RDI));
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(&asmlist, "  mov [rax], rdi");
+        asmBinOp(AsmMov, memop(OpSize64, RAX, 0), reg64op(RDI));
         break;
     case 4:
-        appendAsmInstAnyText(&asmlist, "  mov DWORD PTR [rax], edi");
+        asmBinOp(AsmMov, memop(OpSize32, RAX, 0), regop(RDI, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(&asmlist, "  mov BYTE PTR [rax], dil");
+        asmBinOp(AsmMov, memop(OpSize8, RAX, 0), regop(RDI, OpSize8));
         break;
     default:
         errorUnreachable();
     }
     asmPushReg(reg64obj(RDI));
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeReturn(const Node *n) {
+static AsmInstList *genCodeReturn(const Node *n) {
+    TypeInfo *retType = NULL;
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
-    if (n->lhs) {
+    if (n->lhs && canTailCall(n->lhs)) {
+        appendAsmInstList(&asmlist, genCodeTailCall(n->lhs));
+        return takeAsmInstList(&asmlist);
+    } else if (n->lhs) {
         if (!isExprNode(n->lhs))
             errorAt(n->lhs->token, "Expression doesn't leave value.");
-        appendAsmInst(&asmlist, genAsm(n->lhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
         asmPopRax();
+
+        // Truncate the value to the return type as inlined calls do.
+        retType = dumpEnv.currentFunc->func->retType;
+        if ((retType->type == TypeInt || retType->type == TypeChar ||
+                    retType->type == TypeEnum) &&
+                sizeOf(n->lhs->type) > sizeOf(retType))
+            asmBinOp(AsmMovsx, reg64op(RAX),
+                    regop(RAX, getOperandSizeFromByteSize(sizeOf(retType))));
     }
-    appendAsmInstAnyText(&asmlist, "  jmp .Lreturn_%.*s", dumpEnv.currentFunc->token->len,
+    appendAsmInstJmp(&asmlist, ".Lreturn_%.*s", dumpEnv.currentFunc->token->len,
             dumpEnv.currentFunc->token->str);
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
+}
+
+static AsmCondKind negateCond(AsmCondKind cond) {
+    switch (cond) {
+    case AsmCondE:
+        return AsmCondNE;
+    case AsmCondNE:
+        return AsmCondE;
+    case AsmCondL:
+        return AsmCondGE;
+    case AsmCondLE:
+        return AsmCondG;
+    case AsmCondG:
+        return AsmCondLE;
+    case AsmCondGE:
+        return AsmCondL;
+    case AsmCondB:
+        return AsmCondAE;
+    case AsmCondBE:
+        return AsmCondA;
+    case AsmCondA:
+        return AsmCondBE;
+    case AsmCondAE:
+        return AsmCondB;
+    }
+    errorUnreachable();
+    return AsmCondE;
+}
+
+/**
+ * Returns the condition to use when operands of a comparison are swapped.
+ */
+static AsmCondKind swapCond(AsmCondKind cond) {
+    switch (cond) {
+    case AsmCondE:
+    case AsmCondNE:
+        return cond;
+    case AsmCondL:
+        return AsmCondG;
+    case AsmCondLE:
+        return AsmCondGE;
+    case AsmCondG:
+        return AsmCondL;
+    case AsmCondGE:
+        return AsmCondLE;
+    case AsmCondB:
+        return AsmCondA;
+    case AsmCondBE:
+        return AsmCondAE;
+    case AsmCondA:
+        return AsmCondB;
+    case AsmCondAE:
+        return AsmCondBE;
+    }
+    errorUnreachable();
+    return AsmCondE;
+}
+
+/**
+ * Generate code that compares the operands of a comparison node `n` and sets
+ * the condition which is satisfied when the comparison is true to `cond`.  A
+ * constant operand is embedded into the cmp instruction as an immediate.
+ */
+static AsmInstList *genCodeCompare(const Node *n, AsmCondKind *cond) {
+    AsmCondKind cc;
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (n->kind == NodeEq)
+        cc = AsmCondE;
+    else if (n->kind == NodeNeq)
+        cc = AsmCondNE;
+    else if (n->kind == NodeLT)
+        cc = AsmCondL;
+    else if (n->kind == NodeLE)
+        cc = AsmCondLE;
+    else
+        errorUnreachable();
+
+    if (isImmediateNode(n->rhs)) {
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+        asmPopRax();
+        asmBinOp(AsmCmp, reg64op(RAX), immop(n->rhs->val));
+    } else if (isImmediateNode(n->lhs)) {
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+        asmPopRax();
+        asmBinOp(AsmCmp, reg64op(RAX), immop(n->lhs->val));
+        cc = swapCond(cc);
+    } else {
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+        appendAsmInstPop(&asmlist, &reg64obj(RDI));
+        asmPopRax();
+        asmBinOp(AsmCmp, reg64op(RAX), reg64op(RDI));
+    }
+    *cond = cc;
+
+    return takeAsmInstList(&asmlist);
+}
+
+/**
+ * Generate code that jumps to the label made from `fmt` when truthiness of
+ * `cond` equals to `jumpIf`, and otherwise falls through.  Comparisons are
+ * lowered directly into cmp + jcc, and '&&', '||' and '!' into control flow,
+ * so conditions never materialize 0/1 values on stack.
+ */
+static AsmInstList *genCodeCondJump(
+        const Node *cond, int jumpIf, const char *fmt, ...) {
+    va_list ap;
+    char *label;
+    AsmCondKind cc;
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    va_start(ap, fmt);
+    label = vformat(fmt, ap);
+    va_end(ap);
+
+    if (cond->kind == NodeNot) {
+        appendAsmInstList(&asmlist, genCodeCondJump(cond->rhs, !jumpIf, "%s", label));
+    } else if (cond->kind == NodeLogicalAND || cond->kind == NodeLogicalOR) {
+        // "a && b" is false as soon as "a" is false, and "a || b" is true as
+        // soon as "a" is true.  When the short-circuit result is the one we're
+        // jumping for, both operands jump to the label directly; otherwise the
+        // short-circuit skips over the check of "b".
+        int shortCircuit = cond->kind == NodeLogicalOR;
+        if (shortCircuit == jumpIf) {
+            appendAsmInstList(&asmlist, genCodeCondJump(cond->lhs, jumpIf, "%s", label));
+            appendAsmInstList(&asmlist, genCodeCondJump(cond->rhs, jumpIf, "%s", label));
+        } else {
+            const char *skip =
+                    cond->kind == NodeLogicalAND ? ".Llogicaland%d" : ".Llogicalor%d";
+            appendAsmInstList(&asmlist,
+                    genCodeCondJump(cond->lhs, shortCircuit, skip, cond->blockID));
+            appendAsmInstList(&asmlist, genCodeCondJump(cond->rhs, jumpIf, "%s", label));
+            appendAsmInstLabel(&asmlist, skip, cond->blockID);
+        }
+    } else if (cond->kind == NodeNum) {
+        if ((cond->val != 0) == jumpIf)
+            appendAsmInstJmp(&asmlist, "%s", label);
+    } else {
+        if (isCompareNode(cond)) {
+            appendAsmInstList(&asmlist, genCodeCompare(cond, &cc));
+        } else {
+            if (!isExprNode(cond))
+                errorAt(cond->token, "Expression doesn't leave value.");
+            appendAsmInstList(&asmlist, genCodeNode(cond));
+            asmPopRax();
+            asmBinOp(AsmCmp, reg64op(RAX), immop(0));
+            cc = AsmCondNE;
+        }
+        if (!jumpIf)
+            cc = negateCond(cc);
+        appendAsmInstJcc(&asmlist, cc, "%s", label);
+    }
+
+    safeFree(label);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeIf(const Node *n) {
+static AsmInstList *genCodeIf(const Node *n) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     int elseblockCount = 0;
-    appendAsmInst(&asmlist, genAsm(n->condition));
-    asmPopRax();
-    appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
     if (n->elseblock) {
-        appendAsmInstAnyText(&asmlist, "  je .Lelse%d_%d", n->blockID, elseblockCount);
+        appendAsmInstList(&asmlist, genCodeCondJump(n->condition, 0, ".Lelse%d_%d",
+                                            n->blockID, elseblockCount));
     } else {
-        appendAsmInstAnyText(&asmlist, "  je .Lend%d", n->blockID);
+        appendAsmInstList(
+                &asmlist, genCodeCondJump(n->condition, 0, ".Lend%d", n->blockID));
     }
-    appendAsmInst(&asmlist, genAsm(n->body));
+    appendAsmInstList(&asmlist, genCodeNode(n->body));
     if (isExprNode(n->body)) {
         asmPopRax();
     }
 
     if (n->elseblock) {
-        appendAsmInstAnyText(&asmlist, "  jmp .Lend%d", n->blockID);
+        appendAsmInstJmp(&asmlist, ".Lend%d", n->blockID);
     }
     if (n->elseblock) {
         for (Node *e = n->elseblock; e; e = e->next) {
-            appendAsmInstAnyText(&asmlist, ".Lelse%d_%d:", n->blockID, elseblockCount);
+            appendAsmInstLabel(&asmlist, ".Lelse%d_%d", n->blockID, elseblockCount);
             ++elseblockCount;
             if (e->kind == NodeElseif) {
-                appendAsmInst(&asmlist, genAsm(e->condition));
-                asmPopRax();
-                appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
                 if (e->next)
-                    appendAsmInstAnyText(
-                            &asmlist, "  je .Lelse%d_%d", n->blockID, elseblockCount);
+                    appendAsmInstList(&asmlist, genCodeCondJump(e->condition, 0,
+                                                        ".Lelse%d_%d", n->blockID,
+                                                        elseblockCount));
                 else // Last 'else' is omitted.
-                    appendAsmInstAnyText(&asmlist, "  je .Lend%d", n->blockID);
+                    appendAsmInstList(&asmlist,
+                            genCodeCondJump(e->condition, 0, ".Lend%d", n->blockID));
             }
-            appendAsmInst(&asmlist, genAsm(e->body));
+            appendAsmInstList(&asmlist, genCodeNode(e->body));
             if (isExprNode(e->body)) {
                 asmPopRax();
             }
-            appendAsmInstAnyText(&asmlist, "  jmp .Lend%d", n->blockID);
+            appendAsmInstJmp(&asmlist, ".Lend%d", n->blockID);
         }
     }
-    appendAsmInstAnyText(&asmlist, ".Lend%d:", n->blockID);
+    appendAsmInstLabel(&asmlist, ".Lend%d", n->blockID);
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeSwitch(const Node *n) {
-    int haveDefaultLabel = 0;
-    int loopBlockIDSave;
+/**
+ * Returns TRUE if sorted case values `values` are dense enough to dispatch
+ * through a jump table.
+ */
+static int isDenseSwitch(const int *values, int count) {
+    int first, last;
+
+    if (count < SWITCH_JUMP_TABLE_MIN_CASES)
+        return 0;
 
+    // Reject too wide range first, in the way that "last - first" never
+    // overflows.
+    first = values[0];
+    last = values[count - 1];
+    if (first < 0 ? last > first + SWITCH_JUMP_TABLE_MAX_SIZE
+                  : last - first > SWITCH_JUMP_TABLE_MAX_SIZE)
+        return 0;
+    return last - first + 1 <= count * SWITCH_JUMP_TABLE_DENSITY;
+}
+
+/**
+ * Generate dispatch through a jump table for the value in RAX.  The table
+ * holds offsets from itself to case labels so that it needs no relocation.
+ */
+static AsmInstList *genCodeSwitchJumpTable(
+        const Node *n, const int *values, int count, const char *defaultLabel) {
+    int first = values[0];
+    int range = values[count - 1] - first + 1;
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
-    if (!n)
-        return getRawAsmInstList(&asmlist);
-
-    loopBlockIDSave = dumpEnv.loopBlockID;
-    dumpEnv.loopBlockID = n->blockID;
-    appendAsmInst(&asmlist, genAsm(n->condition));
-    asmPopRax();
-    for (SwitchCase *c = n->cases; c; c = c->next) {
-        if (!c->node->condition) {
-            haveDefaultLabel = 1;
-            continue;
+    if (first)
+        asmBinOp(AsmSub, reg64op(RAX), immop(first));
+    asmBinOp(AsmCmp, reg64op(RAX), immop(range - 1));
+    appendAsmInstJcc(&asmlist, AsmCondA, "%s", defaultLabel);
+    asmBinOp(AsmLea, reg64op(RDI),
+            newOperandMemRIP(OpSize64, format(".Lswitch_table_%d", n->blockID)));
+    asmBinOp(AsmSal, reg64op(RAX), immop(2));
+    asmBinOp(AsmAdd, reg64op(RAX), reg64op(RDI));
+    asmBinOp(AsmMovsx, reg64op(RAX), memop(OpSize32, RAX, 0));
+    asmBinOp(AsmAdd, reg64op(RAX), reg64op(RDI));
+    asmUnOp(AsmJmpIndirect, reg64op(RAX));
+
+    appendAsmInstAnyText(&asmlist, ".section .rodata");
+    appendAsmInstAnyText(&asmlist, "  .align 4");
+    appendAsmInstLabel(&asmlist, ".Lswitch_table_%d", n->blockID);
+    for (int i = 0, j = 0; i < range; ++i) {
+        if (values[j] == first + i) {
+            appendAsmInstAnyText(&asmlist,
+                    "  .long .Lswitch_case_%d_%x - .Lswitch_table_%d", n->blockID,
+                    values[j], n->blockID);
+            ++j;
+        } else {
+            appendAsmInstAnyText(&asmlist, "  .long %s - .Lswitch_table_%d",
+                    defaultLabel, n->blockID);
         }
-        appendAsmInstAnyText(&asmlist, "  mov rdi, %d", c->node->condition->val);
-        appendAsmInstAnyText(&asmlist, "  cmp rax, rdi");
-        appendAsmInstAnyText(&asmlist, "  je .Lswitch_case_%d_%d", n->blockID,
-                c->node->condition->val);
     }
-    if (haveDefaultLabel)
-        appendAsmInstAnyText(&asmlist, "  jmp .Lswitch_default_%d", n->blockID);
-    else
-        appendAsmInstAnyText(&asmlist, "  jmp .Lend%d", n->blockID);
-
-    appendAsmInst(&asmlist, genAsm(n->body));
-
-    appendAsmInstAnyText(&asmlist, ".Lend%d:", n->blockID);
-
-    dumpEnv.loopBlockID = loopBlockIDSave;
+    appendAsmInstAnyText(&asmlist, ".previous");
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeSwitchCase(const Node *n) {
+/**
+ * Generate a balanced binary search over sorted case values
+ * `values[lo..hi]` for the value in RAX.  Jumps to `defaultLabel` when no case
+ * matches.
+ */
+static AsmInstList *genCodeSwitchBinarySearch(
+        const Node *n, const int *values, int lo, int hi, const char *defaultLabel) {
+    int mid;
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (hi - lo < SWITCH_LINEAR_SEARCH_MAX_CASES) {
+        for (int i = lo; i <= hi; ++i) {
+            asmBinOp(AsmCmp, reg64op(RAX), immop(values[i]));
+            appendAsmInstJcc(&asmlist, AsmCondE, ".Lswitch_case_%d_%x", n->blockID,
+                    values[i]);
+        }
+        appendAsmInstJmp(&asmlist, "%s", defaultLabel);
+        return takeAsmInstList(&asmlist);
+    }
+
+    mid = (lo + hi) / 2;
+    asmBinOp(AsmCmp, reg64op(RAX), immop(values[mid]));
+    appendAsmInstJcc(&asmlist, AsmCondE, ".Lswitch_case_%d_%x", n->blockID, values[mid]);
+    appendAsmInstJcc(&asmlist, AsmCondG, ".Lswitch_upper_%d_%d", n->blockID, mid);
+    appendAsmInstList(
+            &asmlist, genCodeSwitchBinarySearch(n, values, lo, mid - 1, defaultLabel));
+    appendAsmInstLabel(&asmlist, ".Lswitch_upper_%d_%d", n->blockID, mid);
+    appendAsmInstList(
+            &asmlist, genCodeSwitchBinarySearch(n, values, mid + 1, hi, defaultLabel));
+
+    return takeAsmInstList(&asmlist);
+}
+
+static AsmInstList *genCodeSwitch(const Node *n) {
+    int haveDefaultLabel = 0;
+    int loopBlockIDSave;
+    int count = 0;
+    int *values = NULL;
+    char *defaultLabel = NULL;
+
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
+
+    loopBlockIDSave = dumpEnv.loopBlockID;
+    dumpEnv.loopBlockID = n->blockID;
+    appendAsmInstList(&asmlist, genCodeNode(n->condition));
+    asmPopRax();
+
+    // Collect case values and sort them for dispatch.
+    for (SwitchCase *c = n->cases; c; c = c->next) {
+        if (c->node->condition)
+            ++count;
+        else
+            haveDefaultLabel = 1;
+    }
+    if (count) {
+        values = (int *)safeAlloc(count * sizeof(int));
+        count = 0;
+        for (SwitchCase *c = n->cases; c; c = c->next) {
+            int val, i;
+            if (!c->node->condition)
+                continue;
+            val = c->node->condition->val;
+            for (i = count; i > 0 && values[i - 1] > val; --i)
+                values[i] = values[i - 1];
+            values[i] = val;
+            ++count;
+        }
+    }
+
+    if (haveDefaultLabel)
+        defaultLabel = format(".Lswitch_default_%d", n->blockID);
+    else
+        defaultLabel = format(".Lend%d", n->blockID);
+
+    if (count == 0)
+        appendAsmInstJmp(&asmlist, "%s", defaultLabel);
+    else if (isDenseSwitch(values, count))
+        appendAsmInstList(
+                &asmlist, genCodeSwitchJumpTable(n, values, count, defaultLabel));
+    else
+        appendAsmInstList(&asmlist,
+                genCodeSwitchBinarySearch(n, values, 0, count - 1, defaultLabel));
+    safeFree(values);
+    safeFree(defaultLabel);
+
+    appendAsmInstList(&asmlist, genCodeNode(n->body));
+
+    appendAsmInstLabel(&asmlist, ".Lend%d", n->blockID);
 
+    dumpEnv.loopBlockID = loopBlockIDSave;
+
+    return takeAsmInstList(&asmlist);
+}
+
+static AsmInstList *genCodeSwitchCase(const Node *n) {
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (!n)
+        return takeAsmInstList(&asmlist);
+
+    // Case value is printed in hex so that negative values make valid label
+    // names.
     if (n->condition)
-        appendAsmInstAnyText(
-                &asmlist, ".Lswitch_case_%d_%d:", n->blockID, n->condition->val);
+        appendAsmInstLabel(
+                &asmlist, ".Lswitch_case_%d_%x", n->blockID, n->condition->val);
     else
-        appendAsmInstAnyText(&asmlist, ".Lswitch_default_%d:", n->blockID);
+        appendAsmInstLabel(&asmlist, ".Lswitch_default_%d", n->blockID);
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
+}
+
+// Returns TRUE if code for expression `n` defines labels, so that the code
+// cannot be emitted twice.
+static int hasLabel(const Node *n) {
+    for (; n; n = n->next) {
+        if (n->kind == NodeLogicalAND || n->kind == NodeLogicalOR ||
+                n->kind == NodeConditional)
+            return 1;
+        if (n->kind == NodeFCall && hasLabel(n->fcall->args))
+            return 1;
+        if (hasLabel(n->lhs) || hasLabel(n->rhs) || hasLabel(n->condition) ||
+                hasLabel(n->body) || hasLabel(n->elseblock))
+            return 1;
+    }
+    return 0;
 }
 
-static AsmInst *genCodeFor(const Node *n) {
+static AsmInstList *genCodeFor(const Node *n) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     int loopBlockIDSave = dumpEnv.loopBlockID;
     dumpEnv.loopBlockID = n->blockID;
     if (n->initializer) {
-        appendAsmInst(&asmlist, genAsm(n->initializer));
+        appendAsmInstList(&asmlist, genCodeNode(n->initializer));
 
         // Not always initializer statement left a value on stack.  E.g.
         // Variable declarations won't leave values on stack.
         if (isExprNode(n->initializer))
             asmPopRax();
     }
-    appendAsmInstAnyText(&asmlist, ".Lbegin%d:", n->blockID);
-    if (n->condition) {
-        appendAsmInst(&asmlist, genAsm(n->condition));
-    } else {
-        appendAsmInstAnyText(&asmlist, "  push 1");
-    }
-    asmPopRax();
-    appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-    appendAsmInstAnyText(&asmlist, "  je .Lend%d", n->blockID);
-    appendAsmInst(&asmlist, genAsm(n->body));
+    if (n->condition && hasLabel(n->condition))
+        appendAsmInstJmp(&asmlist, ".Lcond%d", n->blockID);
+    else if (n->condition)
+        appendAsmInstList(
+                &asmlist, genCodeCondJump(n->condition, 0, ".Lend%d", n->blockID));
+    appendAsmInstAnyText(&asmlist, "  .p2align 4");
+    appendAsmInstLabel(&asmlist, ".Lbegin%d", n->blockID);
+    appendAsmInstList(&asmlist, genCodeNode(n->body));
     if (n->body && isExprNode(n->body)) {
         asmPopRax();
     }
-    appendAsmInstAnyText(&asmlist, ".Literator%d:", n->blockID);
+    appendAsmInstLabel(&asmlist, ".Literator%d", n->blockID);
     if (n->iterator) {
-        appendAsmInst(&asmlist, genAsm(n->iterator));
+        appendAsmInstList(&asmlist, genCodeNode(n->iterator));
         asmPopRax();
     }
-    appendAsmInstAnyText(&asmlist, "  jmp .Lbegin%d", n->blockID);
-    appendAsmInstAnyText(&asmlist, ".Lend%d:", n->blockID);
+    if (n->condition) {
+        if (hasLabel(n->condition))
+            appendAsmInstLabel(&asmlist, ".Lcond%d", n->blockID);
+        appendAsmInstList(
+                &asmlist, genCodeCondJump(n->condition, 1, ".Lbegin%d", n->blockID));
+    } else {
+        appendAsmInstJmp(&asmlist, ".Lbegin%d", n->blockID);
+    }
+    appendAsmInstLabel(&asmlist, ".Lend%d", n->blockID);
     dumpEnv.loopBlockID = loopBlockIDSave;
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeDoWhile(const Node *n) {
+static AsmInstList *genCodeDoWhile(const Node *n) {
     int loopBlockIDSave = dumpEnv.loopBlockID;
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     dumpEnv.loopBlockID = n->blockID;
-    appendAsmInstAnyText(&asmlist, ".Lbegin%d:", n->blockID);
+    appendAsmInstAnyText(&asmlist, "  .p2align 4");
+    appendAsmInstLabel(&asmlist, ".Lbegin%d", n->blockID);
 
-    appendAsmInst(&asmlist, genAsm(n->body));
+    appendAsmInstList(&asmlist, genCodeNode(n->body));
     if (isExprNode(n->body)) {
         asmPopRax();
     }
-    appendAsmInstAnyText(&asmlist, ".Literator%d:", n->blockID);
-    appendAsmInst(&asmlist, genAsm(n->condition));
-    asmPopRax();
-    appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-    appendAsmInstAnyText(&asmlist, "  jne .Lbegin%d", n->blockID);
-    appendAsmInstAnyText(&asmlist, ".Lend%d:", n->blockID);
+    appendAsmInstLabel(&asmlist, ".Literator%d", n->blockID);
+    appendAsmInstList(
+            &asmlist, genCodeCondJump(n->condition, 1, ".Lbegin%d", n->blockID));
+    appendAsmInstLabel(&asmlist, ".Lend%d", n->blockID);
 
     dumpEnv.loopBlockID = loopBlockIDSave;
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeFCall(const Node *n) {
+static AsmInstList *genCodeFCall(const Node *n) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
-    static int stackAlignState = -1; // RSP % 16
-    int stackAlignStateSave = 0;
-    int stackVarSize = 0;    // Size of local variables on stack.
-    int stackArgSize = 0;    // Size of arguments (passed to function) on stack.
-    int exCapToAlignRSP = 0; // Extra memory size to capture in order to align RSP.
+    AsmInst *align = NULL;
+    AsmInst *restore = NULL;
     int regargs = n->fcall->argsCount;
     int isSimpleFuncCall =
             n->body->type->type == TypeFunction; // TRUE if simple function call.
 
-    if (!isSimpleFuncCall)
-        appendAsmInst(&asmlist, genAsm(n->body));
-
-    stackAlignStateSave = stackAlignState;
-
     if (regargs > REG_ARGS_MAX_COUNT)
         regargs = REG_ARGS_MAX_COUNT;
 
-    if (stackAlignState == -1) {
-        stackAlignState = 0;
-        stackVarSize = dumpEnv.currentFunc->func->capStackSize;
+    // Padding to align RSP to multiple of 16 is inserted here.  How much is
+    // needed is determined after register allocation.
+    align = newAsmInst(AsmStackAlign);
+    align->data.stackAlign.argsSize = (n->fcall->argsCount - regargs) * ONE_WORD_BYTES;
+    appendAsmInst(&asmlist, align);
+
+    for (Node *c = n->fcall->args; c; c = c->next)
+        appendAsmInstList(&asmlist, genCodeNode(c));
+
+    // Evaluate function pointer after arguments so that arguments passed on
+    // stack are kept on the top of the stack.
+    if (!isSimpleFuncCall) {
+        appendAsmInstList(&asmlist, genCodeNode(n->body));
+        appendAsmInstPop(&asmlist, &reg64obj(R10));
     }
 
-    if ((n->fcall->argsCount - regargs) > 0) {
-        stackArgSize += (n->fcall->argsCount - regargs) * ONE_WORD_BYTES;
-        stackVarSize += stackArgSize;
+    for (int i = 0; i < regargs; ++i)
+        appendAsmInstPop(&asmlist,
+                &regobj(argRegs[i], getOperandSizeFromByteSize(ONE_WORD_BYTES)));
+
+    // Set AL to count of float arguments in variadic arguments area.  This is
+    // always 0 now.
+    asmBinOp(AsmMov, regop(RAX, OpSize8), immop(0));
+    if (isSimpleFuncCall) {
+        asmUnOp(AsmCall,
+                newOperandLabel(format("%.*s", n->fcall->len, n->fcall->name)));
+    } else {
+        asmUnOp(AsmCall, reg64op(R10));
     }
 
-    if (!isSimpleFuncCall)
-        stackVarSize += ONE_WORD_BYTES; // Capacity for function pointer on stack
+    // Throw away the alignment padding and the arguments passed on stack.
+    restore = newAsmInst(AsmStackRestore);
+    restore->data.stackAlign.argsSize = align->data.stackAlign.argsSize;
+    restore->data.stackAlign.align = align;
+    appendAsmInst(&asmlist, restore);
 
-    stackAlignState = (stackAlignState + stackVarSize) % 16;
-    if (stackAlignState)
-        exCapToAlignRSP = 16 - stackAlignState;
-    stackAlignState = 0;
+    asmPushRax();
 
-    if (exCapToAlignRSP)
-        // Align RSP to multiple of 16.
-        appendAsmInstAnyText(
-                &asmlist, "  sub rsp, %d /* RSP alignment */", exCapToAlignRSP);
+    return takeAsmInstList(&asmlist);
+}
+
+/**
+ * Returns TRUE if the call `n` in a return statement can jump to the callee
+ * reusing the current frame.  Arguments passed on stack are stored into the
+ * area of the current function's ones, so they must fit there.
+ */
+static int canTailCall(const Node *n) {
+    Function *caller = dumpEnv.currentFunc->func;
+    TypeKind retType = caller->retType->type;
+
+    if (!dumpEnv.tailCalls || n->kind != NodeFCall)
+        return 0;
+    if (n->fcall->argsCount > REG_ARGS_MAX_COUNT &&
+            n->fcall->argsCount > caller->argsCount)
+        return 0;
+    // Return value must not need truncation.
+    if ((retType == TypeInt || retType == TypeChar || retType == TypeEnum) &&
+            n->type->type != TypeVoid && sizeOf(n->type) > sizeOf(caller->retType))
+        return 0;
+    return 1;
+}
+
+/**
+ * Generate code for a call in tail position.  The frame is torn down after
+ * arguments are set, and then jump to the callee instead of calling it, so
+ * the callee returns to the caller of the current function directly.
+ */
+static AsmInstList *genCodeTailCall(const Node *n) {
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
 
-    for (Node *c = n->fcall->args; c; c = c->next) {
-        appendAsmInst(&asmlist, genAsm(c));
-        if (isExprNode(c))
-            stackAlignState += 8;
+    int regargs = n->fcall->argsCount;
+    int isSimpleFuncCall = n->body->type->type == TypeFunction;
+
+    if (regargs > REG_ARGS_MAX_COUNT)
+        regargs = REG_ARGS_MAX_COUNT;
+
+    for (Node *c = n->fcall->args; c; c = c->next)
+        appendAsmInstList(&asmlist, genCodeNode(c));
+
+    if (!isSimpleFuncCall) {
+        appendAsmInstList(&asmlist, genCodeNode(n->body));
+        appendAsmInstPop(&asmlist, &reg64obj(R10));
     }
+
     for (int i = 0; i < regargs; ++i)
         appendAsmInstPop(&asmlist,
                 &regobj(argRegs[i], getOperandSizeFromByteSize(ONE_WORD_BYTES)));
 
-    // Set AL to count of float arguments in variadic arguments area.  This is
-    // always 0 now.
-    appendAsmInstAnyText(&asmlist, "  mov al, 0");
-    if (isSimpleFuncCall) {
-        appendAsmInstAnyText(&asmlist, "  call %.*s", n->fcall->len, n->fcall->name);
+    // Overwrite arguments passed to the current function on stack.  They are
+    // just above the return address.
+    for (int i = 0; i < n->fcall->argsCount - regargs; ++i) {
+        asmPopRax();
+        asmBinOp(AsmMov, memop(OpSize64, RBP, (i + 2) * ONE_WORD_BYTES), reg64op(RAX));
+    }
+
+    // Which registers to restore is unknown until register allocation, so
+    // genCodeFunction() fills the epilogue later.
+    appendAsmInst(&asmlist, newAsmInst(AsmEpilogue));
+
+    asmBinOp(AsmMov, regop(RAX, OpSize8), immop(0));
+    if (isSimpleFuncCall)
+        appendAsmInstJmp(&asmlist, "%.*s", n->fcall->len, n->fcall->name);
+    else
+        asmUnOp(AsmJmpIndirect, reg64op(R10));
+
+    return takeAsmInstList(&asmlist);
+}
+
+/**
+ * Generate code multiplying RAX by `val`.  Powers of two become a shift, 3, 5
+ * and 9 become a lea, and 2^k+1 and 2^k-1 become a shift and an addition or a
+ * subtraction.
+ */
+static AsmInstList *genCodeMulImm(int val) {
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (exactLog2(val) >= 0) {
+        asmBinOp(AsmSal, reg64op(RAX), immop(exactLog2(val)));
+    } else if (val == 3 || val == 5 || val == 9) {
+        asmBinOp(AsmLea, reg64op(RAX), memidxop(OpSize64, RAX, RAX, val - 1, 0));
+    } else if (val > 2 && exactLog2(val - 1) >= 0) {
+        asmBinOp(AsmMov, reg64op(RDI), reg64op(RAX));
+        asmBinOp(AsmSal, reg64op(RAX), immop(exactLog2(val - 1)));
+        asmBinOp(AsmAdd, reg64op(RAX), reg64op(RDI));
+    } else if (val > 2 && exactLog2(val + 1) >= 0) {
+        asmBinOp(AsmMov, reg64op(RDI), reg64op(RAX));
+        asmBinOp(AsmSal, reg64op(RAX), immop(exactLog2(val + 1)));
+        asmBinOp(AsmSub, reg64op(RAX), reg64op(RDI));
     } else {
-        appendAsmInstAnyText(
-                &asmlist, "  mov r10, QWORD PTR %d[rsp]", exCapToAlignRSP + stackArgSize);
-        appendAsmInstAnyText(&asmlist, "  call r10");
-        appendAsmInstAnyText(&asmlist, "  add rsp, %d /* Throw away function pointer */",
-                ONE_WORD_BYTES);
+        asmBinOp(AsmImul, reg64op(RAX), immop(val));
     }
 
-    stackAlignState = stackAlignStateSave;
-    if (exCapToAlignRSP)
-        appendAsmInstAnyText(
-                &asmlist, "  add rsp, %d /* RSP alignment */", exCapToAlignRSP);
+    return takeAsmInstList(&asmlist);
+}
 
-    // Adjust RSP value when we used stack to pass arguments.
-    if (stackArgSize)
-        appendAsmInstAnyText(
-                &asmlist, "  add rsp, %d /* Pop overflow args */", stackArgSize);
+// Max divisor genCodeDivImm() can handle.  Computing its magic number must not
+// overflow int.
+#define DIVISOR_IMM_MAX (1 << 30)
 
-    asmPushRax();
+/**
+ * Generate code dividing RAX by constant `divisor`, or taking remainder of it
+ * when `rem` is TRUE, without idiv.  `divisor` must be in range of
+ * [1, DIVISOR_IMM_MAX].
+ *
+ * Division by 2^k is a shift, with 2^k-1 added to negative dividends so that
+ * the quotient is rounded toward zero.  Division by others is a multiplication
+ * by magic number m = 1 + floor(2^(31+l) / divisor) where 2^l is the smallest
+ * power of two above the divisor.  For any int n, floor(n * m / 2^(31+l)) is
+ * floor(n / divisor), and it's rounded toward zero by adding 1 when n is
+ * negative.  See "Division by Invariant Integers using Multiplication" by
+ * Granlund and Montgomery.
+ */
+static AsmInstList *genCodeDivImm(int divisor, int rem) {
+    int k = exactLog2(divisor);
+    int l = 0;
+    int r = 1;
+    int magicHigh = 0, magicLow = 0; // Upper and lower 16 bits of magic number.
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
 
-    return getRawAsmInstList(&asmlist);
+    if (divisor == 1) {
+        if (rem)
+            asmBinOp(AsmMov, reg64op(RAX), immop(0));
+        return takeAsmInstList(&asmlist);
+    } else if (k >= 0) {
+        asmBinOp(AsmMov, reg64op(RDI), reg64op(RAX));
+        asmBinOp(AsmSar, reg64op(RDI), immop(63));
+        asmBinOp(AsmAnd, reg64op(RDI), immop(divisor - 1));
+        if (rem) {
+            // n % 2^k == n - ((n + bias) & -2^k)
+            asmBinOp(AsmAdd, reg64op(RDI), reg64op(RAX));
+            asmBinOp(AsmAnd, reg64op(RDI), immop(-divisor));
+            asmBinOp(AsmSub, reg64op(RAX), reg64op(RDI));
+        } else {
+            asmBinOp(AsmAdd, reg64op(RAX), reg64op(RDI));
+            asmBinOp(AsmSar, reg64op(RAX), immop(k));
+        }
+        return takeAsmInstList(&asmlist);
+    }
+
+    while ((1 << l) < divisor)
+        ++l;
+
+    // Long division of 2^(31+l) by the divisor bit by bit.  The quotient is
+    // less than 2^32, so hold it in two halves.
+    for (int i = 0; i < 31 + l; ++i) {
+        r *= 2;
+        magicHigh = magicHigh * 2 + magicLow / 0x8000;
+        magicLow = magicLow * 2 % 0x10000;
+        if (r >= divisor) {
+            r -= divisor;
+            ++magicLow;
+        }
+    }
+    if (++magicLow == 0x10000) {
+        magicLow = 0;
+        ++magicHigh;
+    }
+
+    asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
+    if (magicHigh < 0x8000) {
+        asmBinOp(AsmMov, reg64op(RDI), immop(magicHigh * 0x10000 + magicLow));
+    } else {
+        // The magic number doesn't fit in int.  Write it in hex and let it be
+        // zero-extended by 32-bit mov.
+        asmBinOp(AsmMov, regop(RDI, OpSize32),
+                newOperandLabel(format("0x%04x%04x", magicHigh, magicLow)));
+    }
+    asmBinOp(AsmImul, reg64op(RDI), reg64op(RAX));
+    asmBinOp(AsmSar, reg64op(RDI), immop(31 + l));
+    asmBinOp(AsmMov, reg64op(RDX), reg64op(RAX));
+    asmBinOp(AsmSar, reg64op(RDX), immop(63));
+    asmBinOp(AsmSub, reg64op(RDI), reg64op(RDX));
+    if (rem) {
+        asmBinOp(AsmImul, reg64op(RDI), immop(divisor));
+        asmBinOp(AsmSub, reg64op(RAX), reg64op(RDI));
+    } else {
+        asmBinOp(AsmMov, reg64op(RAX), reg64op(RDI));
+    }
+
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeVaStart(const Node *n) {
+// Blocks of this size or larger are copied or cleared through XMM registers.
+#define BLOCK_SSE_MIN (16)
+// Blocks of this size or larger are copied or cleared by "rep movsq" or
+// "rep stosq".  Below this, startup cost of "rep" exceeds unrolled moves.
+#define BLOCK_REP_MIN (256)
+
+/**
+ * Generate code copying or clearing the tail of block, `size` bytes from
+ * `offset`, 8, 4 and 1 bytes at a time.  Clear the block if `src` is RegCount,
+ * otherwise copy from the address in `src` via RDX.
+ */
+static AsmInstList *genCodeMoveBlockTail(RegKind dst, RegKind src, int offset, int size) {
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    while (offset < size) {
+        int chunk = 1;
+        OperandSize opsize;
+        if (size - offset >= 8)
+            chunk = 8;
+        else if (size - offset >= 4)
+            chunk = 4;
+        opsize = getOperandSizeFromByteSize(chunk);
+        if (src == RegCount) {
+            asmBinOp(AsmMov, memop(opsize, dst, offset), immop(0));
+        } else {
+            asmBinOp(AsmMov, regop(RDX, opsize), memop(opsize, src, offset));
+            asmBinOp(AsmMov, memop(opsize, dst, offset), regop(RDX, opsize));
+        }
+        offset += chunk;
+    }
+
+    return takeAsmInstList(&asmlist);
+}
+
+/**
+ * Generate code filling `size` bytes from the address in RDI with 0.  Breaks
+ * RAX, RCX, RDI and XMM0.
+ */
+static AsmInstList *genCodeClearBlock(int size) {
+    int offset = 0;
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (size >= BLOCK_REP_MIN) {
+        // RDI points just after the cleared area when "rep stosq" finished.
+        asmBinOp(AsmMov, reg64op(RCX), immop(size / ONE_WORD_BYTES));
+        asmBinOp(AsmMov, reg64op(RAX), immop(0));
+        asmNoOperand(AsmRepStosq);
+        size = size % ONE_WORD_BYTES;
+    } else if (size >= BLOCK_SSE_MIN) {
+        asmBinOp(AsmPxor, regop(XMM0, OpSize128), regop(XMM0, OpSize128));
+        for (; size - offset >= 16; offset += 16)
+            asmBinOp(AsmMovdqu, memop(OpSize128, RDI, offset), regop(XMM0, OpSize128));
+    }
+    appendAsmInstList(&asmlist, genCodeMoveBlockTail(RDI, RegCount, offset, size));
+
+    return takeAsmInstList(&asmlist);
+}
+
+/**
+ * Generate code copying `size` bytes from the address in RSI to the address
+ * in RDI.  Breaks RCX, RDX, RSI, RDI and XMM0.
+ */
+static AsmInstList *genCodeCopyBlock(int size) {
+    int offset = 0;
+    AsmInstList asmlist;
+    initAsmInstList(&asmlist);
+
+    if (size >= BLOCK_REP_MIN) {
+        // RSI and RDI point just after the copied area when "rep movsq"
+        // finished.
+        asmBinOp(AsmMov, reg64op(RCX), immop(size / ONE_WORD_BYTES));
+        asmNoOperand(AsmRepMovsq);
+        size = size % ONE_WORD_BYTES;
+    } else if (size >= BLOCK_SSE_MIN) {
+        for (; size - offset >= 16; offset += 16) {
+            asmBinOp(AsmMovdqu, regop(XMM0, OpSize128), memop(OpSize128, RSI, offset));
+            asmBinOp(AsmMovdqu, memop(OpSize128, RDI, offset), regop(XMM0, OpSize128));
+        }
+    }
+    appendAsmInstList(&asmlist, genCodeMoveBlockTail(RDI, RSI, offset, size));
+
+    return takeAsmInstList(&asmlist);
+}
+
+static AsmInstList *genCodeVaStart(const Node *n) {
     Obj *lastArg = NULL;
     int offset = 0; // va_list member's offset currently watching
     int argsOverflows = 0;
@@ -952,68 +1870,378 @@ static AsmInst *genCodeVaStart(const Node *n) {
         if (!arg->next)
             lastArg = arg;
 
-    appendAsmInst(&asmlist, genCodeLVal(n->fcall->args->next));
+    appendAsmInstList(&asmlist, genCodeLVal(n->fcall->args->next));
     asmPopRax();
 
     if (n->parentFunc->func->argsCount < REG_ARGS_MAX_COUNT) {
-        appendAsmInstAnyText(&asmlist, "  mov DWORD PTR %d[rax], %d", offset,
-                ONE_WORD_BYTES * (REG_ARGS_MAX_COUNT + 1) - lastArg->offset);
+        asmBinOp(AsmMov, memop(OpSize32, RAX, offset),
+                immop(ONE_WORD_BYTES * (REG_ARGS_MAX_COUNT + 1) - lastArg->offset));
     } else {
-        appendAsmInstAnyText(&asmlist, "  mov DWORD PTR %d[rax], %d", offset,
-                ONE_WORD_BYTES * REG_ARGS_MAX_COUNT);
+        asmBinOp(AsmMov, memop(OpSize32, RAX, offset),
+                immop(ONE_WORD_BYTES * REG_ARGS_MAX_COUNT));
     }
 
     offset += sizeOf(&Types.Int);
-    appendAsmInstAnyText(&asmlist, "  mov DWORD PTR %d[rax], %d", offset,
-            REG_ARGS_MAX_COUNT * ONE_WORD_BYTES);
+    asmBinOp(AsmMov, memop(OpSize32, RAX, offset),
+            immop(REG_ARGS_MAX_COUNT * ONE_WORD_BYTES));
 
     offset += sizeOf(&Types.Int);
     if (n->parentFunc->func->argsCount <= REG_ARGS_MAX_COUNT) {
-        appendAsmInstAnyText(&asmlist, "  lea rdi, %d[rbp]", ONE_WORD_BYTES * 2);
+        asmBinOp(AsmLea, reg64op(RDI), memop(OpSize64, RBP, ONE_WORD_BYTES * 2));
     } else {
         int overflow_reg_offset = -lastArg->offset + ONE_WORD_BYTES;
-        appendAsmInstAnyText(&asmlist, "  lea rdi, %d[rbp]", overflow_reg_offset);
+        asmBinOp(AsmLea, reg64op(RDI), memop(OpSize64, RBP, overflow_reg_offset));
     }
-    appendAsmInstAnyText(&asmlist, "  mov %d[rax], rdi", offset);
+    asmBinOp(AsmMov, memop(OpSize64, RAX, offset), reg64op(RDI));
 
     offset += ONE_WORD_BYTES;
-    appendAsmInstAnyText(
-            &asmlist, "  lea rdi, %d[rbp]", -n->parentFunc->func->args->offset);
-    appendAsmInstAnyText(&asmlist, "  mov %d[rax], rdi", offset);
+    asmBinOp(AsmLea, reg64op(RDI),
+            memop(OpSize64, RBP, -n->parentFunc->func->args->offset));
+    asmBinOp(AsmMov, memop(OpSize64, RAX, offset), reg64op(RDI));
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
+}
+
+// Returns TRUE if `n` or nodes following it contain function calls.
+static int hasFunctionCall(const Node *n) {
+    for (; n; n = n->next) {
+        if (n->kind == NodeFCall || n->kind == NodeVaStart)
+            return 1;
+        if (hasFunctionCall(n->lhs) || hasFunctionCall(n->rhs) ||
+                hasFunctionCall(n->condition) || hasFunctionCall(n->body) ||
+                hasFunctionCall(n->elseblock) || hasFunctionCall(n->initializer) ||
+                hasFunctionCall(n->iterator))
+            return 1;
+    }
+    return 0;
+}
+
+// Returns TRUE if `n` is a variable on the stack frame or a member of it.
+static int isFrameObject(const Node *n) {
+    while (n->kind == NodeMemberAccess)
+        n = n->lhs;
+    return n->kind == NodeLVar && !n->obj->isStatic && !n->obj->isExtern &&
+           n->obj->type->type != TypeFunction;
+}
+
+// Returns TRUE if `n` or nodes following it may take address of variables on
+// the stack frame.  Such addresses must not outlive the frame, so tail calls
+// are not allowed in that case.
+static int takesFrameAddress(const Node *n) {
+    for (; n; n = n->next) {
+        if (n->kind == NodeAddress && isFrameObject(n->rhs))
+            return 1;
+        // Arrays are converted into the address of their head.
+        if (n->type && n->type->type == TypeArray && isFrameObject(n))
+            return 1;
+        if (n->kind == NodeFCall && takesFrameAddress(n->fcall->args))
+            return 1;
+        if (takesFrameAddress(n->lhs) || takesFrameAddress(n->rhs) ||
+                takesFrameAddress(n->condition) || takesFrameAddress(n->body) ||
+                takesFrameAddress(n->elseblock) ||
+                takesFrameAddress(n->initializer) || takesFrameAddress(n->iterator))
+            return 1;
+    }
+    return 0;
+}
+
+// Drop the variable lvalue `n` refers from candidates of register arguments,
+// since its memory address is needed.
+static void keepArgOnStack(const Node *n) {
+    if (n->kind == NodeExprList && n->body)
+        for (n = n->body; n->next; n = n->next)
+            ;
+    if (n->kind != NodeLVar)
+        return;
+    for (int i = 0; i < dumpEnv.regArgsCount; ++i)
+        if (dumpEnv.regArgs[i] == n->obj)
+            dumpEnv.regArgs[i] = NULL;
+}
+
+// Drop arguments used as lvalue in `n` from candidates of register arguments.
+// Plain assignment is the exception; it can store a value into register.
+static void findStackArgs(const Node *n) {
+    for (; n; n = n->next) {
+        switch (n->kind) {
+        case NodeAddress:
+        case NodePreIncl:
+        case NodePreDecl:
+            keepArgOnStack(n->rhs);
+            break;
+        case NodePostIncl:
+        case NodePostDecl:
+        case NodeMemberAccess:
+        case NodeAssignStruct:
+        case NodeAssignUnion:
+            keepArgOnStack(n->lhs);
+            break;
+        case NodeAssign:
+            if (n->lhs->kind != NodeLVar)
+                keepArgOnStack(n->lhs);
+            break;
+        default:
+            break;
+        }
+        findStackArgs(n->lhs);
+        findStackArgs(n->rhs);
+        findStackArgs(n->condition);
+        findStackArgs(n->body);
+        findStackArgs(n->elseblock);
+        findStackArgs(n->initializer);
+        findStackArgs(n->iterator);
+    }
+}
+
+/**
+ * Choose arguments of leaf function `n` held in registers instead of stack.
+ * Leaf functions never use R8-R11 except for receiving arguments, so scalar
+ * arguments whose address is never taken are moved into them.
+ */
+static void assignRegisterArgs(const Node *n, int regargs) {
+    RegKind pool[4];
+    int poolSize = 0;
+    int poolUsed = 0;
+    int count = 0;
+    Obj *arg = n->obj->func->args;
+
+    pool[poolSize++] = R10;
+    pool[poolSize++] = R11;
+    if (regargs <= 4)
+        pool[poolSize++] = R8;
+    if (regargs <= 5)
+        pool[poolSize++] = R9;
+
+    for (int i = 0; i < regargs; ++i, arg = arg->next) {
+        TypeKind type = arg->type->type;
+        if (type == TypeInt || type == TypeChar || type == TypePointer ||
+                type == TypeEnum)
+            dumpEnv.regArgs[i] = arg;
+        else
+            dumpEnv.regArgs[i] = NULL;
+    }
+    dumpEnv.regArgsCount = regargs;
+    findStackArgs(n->body);
+
+    for (int i = 0; i < regargs; ++i) {
+        RegKind home;
+        if (!dumpEnv.regArgs[i])
+            continue;
+        if (argRegs[i] == R8 || argRegs[i] == R9)
+            home = argRegs[i];
+        else if (poolUsed < poolSize)
+            home = pool[poolUsed++];
+        else
+            continue;
+        dumpEnv.regArgs[count] = dumpEnv.regArgs[i];
+        dumpEnv.regArgHomes[count] = home;
+        ++count;
+    }
+    dumpEnv.regArgsCount = count;
+}
+
+static int isFrameRegisterOperand(const AsmInstOperand *op) {
+    if (op->mode == AsmAddressingModeRegister)
+        return op->src.reg.kind == RBP || op->src.reg.kind == RSP;
+    else if (op->mode == AsmAddressingModeMemory)
+        return op->src.mem.isRelative && op->src.mem.base.kind == RSP;
+    return 0;
+}
+
+// Returns TRUE if `inst` moves RSP or refers to RBP or RSP other than as a
+// base of local variables, which needs the frame to be set up.
+static int needsFrame(const AsmInst *inst) {
+    for (; inst; inst = inst->next) {
+        switch (inst->kind) {
+        case AsmPush:
+        case AsmPop:
+        case AsmCall:
+        case AsmStackAlign:
+        case AsmStackRestore:
+            return 1;
+        case AsmMov:
+        case AsmAdd:
+        case AsmSub:
+        case AsmImul:
+        case AsmAnd:
+        case AsmOr:
+        case AsmXor:
+        case AsmSal:
+        case AsmSar:
+        case AsmCmp:
+        case AsmTest:
+        case AsmLea:
+        case AsmMovsx:
+        case AsmMovzx:
+        case AsmMovdqu:
+        case AsmPxor:
+            if (isFrameRegisterOperand(&inst->data.binop.dst) ||
+                    isFrameRegisterOperand(&inst->data.binop.src))
+                return 1;
+            break;
+        case AsmIdiv:
+        case AsmJmpIndirect:
+            if (isFrameRegisterOperand(&inst->data.unary))
+                return 1;
+            break;
+        default:
+            break;
+        }
+    }
+    return 0;
+}
+
+static void rebaseOperandToRSP(AsmInstOperand *op) {
+    if (op->mode != AsmAddressingModeMemory || !op->src.mem.isRelative ||
+            op->src.mem.base.kind != RBP)
+        return;
+    // RBP would point just below the return address if it were set up.
+    op->src.mem.base.kind = RSP;
+    op->src.mem.offset.value -= ONE_WORD_BYTES;
+}
+
+// Rewrite RBP relative memory accesses in `inst` into RSP relative ones for
+// functions without frame.
+static void rebaseFrameToRSP(AsmInst *inst) {
+    for (; inst; inst = inst->next) {
+        switch (inst->kind) {
+        case AsmMov:
+        case AsmAdd:
+        case AsmSub:
+        case AsmImul:
+        case AsmAnd:
+        case AsmOr:
+        case AsmXor:
+        case AsmSal:
+        case AsmSar:
+        case AsmCmp:
+        case AsmTest:
+        case AsmLea:
+        case AsmMovsx:
+        case AsmMovzx:
+        case AsmMovdqu:
+        case AsmPxor:
+            rebaseOperandToRSP(&inst->data.binop.dst);
+            rebaseOperandToRSP(&inst->data.binop.src);
+            break;
+        case AsmIdiv:
+        case AsmJmpIndirect:
+            rebaseOperandToRSP(&inst->data.unary);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// Append code restoring callee-saved registers in `usedRegs` and tearing down
+// the frame.
+static void appendEpilogue(
+        AsmInstList *list, int usedRegs, int savedRegsTop, int omitFrame) {
+    for (int i = 0, offset = savedRegsTop; i < CALLEE_SAVED_REGS_COUNT; ++i) {
+        if (usedRegs & (1 << calleeSavedRegs[i])) {
+            offset += ONE_WORD_BYTES;
+            appendAsmInstBinOp(list, AsmMov, reg64op(calleeSavedRegs[i]),
+                    memop(OpSize64, RBP, -offset));
+        }
+    }
+    if (!omitFrame) {
+        appendAsmInstBinOp(list, AsmMov, reg64op(RSP), reg64op(RBP));
+        appendAsmInstPop(list, &reg64obj(RBP));
+    }
 }
 
-static AsmInst *genCodeFunction(const Node *n) {
+// Replace AsmEpilogue placeholders left by tail calls in `inst` with the real
+// epilogue.
+static void expandEpilogues(AsmInst *inst, int usedRegs, int savedRegsTop) {
+    for (; inst; inst = inst->next) {
+        AsmInst *next = inst->next;
+        AsmInst *head = NULL;
+        AsmInstList epilogue;
+
+        if (inst->kind != AsmEpilogue)
+            continue;
+        initAsmInstList(&epilogue);
+        appendEpilogue(&epilogue, usedRegs, savedRegsTop, 0);
+        head = getRawAsmInstList(&epilogue);
+        *inst = *head;
+        safeFree(head);
+        inst = getLastAsmInst(inst);
+        inst->next = next;
+    }
+}
+
+static AsmInstList *genCodeFunction(const Node *n) {
     int regargs = 0;
+    int usedRegs = 0;    // Bit set of callee-saved registers used in function.
+    int savedRegsTop = 0; // Offset from RBP to the area saving registers.
+    int frameSize = 0;
+    int isLeaf = 0;
+    int omitFrame = 0;
+    AsmInst *body = NULL;
 
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
     else if (dumpEnv.currentFunc)
         errorUnreachable();
 
     dumpEnv.currentFunc = n->obj;
+    dumpEnv.regArgsCount = 0;
 
     regargs = n->obj->func->argsCount;
     if (regargs > REG_ARGS_MAX_COUNT)
         regargs = REG_ARGS_MAX_COUNT;
 
+    isLeaf = !n->obj->func->haveVaArgs && !hasFunctionCall(n->body);
+    if (isLeaf)
+        assignRegisterArgs(n, regargs);
+    dumpEnv.tailCalls = globals.tailCalls && !isLeaf &&
+                        !n->obj->func->haveVaArgs && !takesFrameAddress(n->body);
+
     // asmDumpc('\n');
     appendAsmInstAnyText(&asmlist, ".section .text.startup,\"ax\",@progbits");
     if (!n->obj->isStatic) {
         appendAsmInstAnyText(
                 &asmlist, ".globl %.*s", n->obj->token->len, n->obj->token->str);
     }
-    appendAsmInstAnyText(&asmlist, "%.*s:", n->obj->token->len, n->obj->token->str);
+    appendAsmInstLabel(&asmlist, "%.*s", n->obj->token->len, n->obj->token->str);
+
+    body = releaseAsmInstList(genCodeNode(n->body));
+    optimizeAsm(body);
+    usedRegs = allocateRegisters(body);
+
+    // Registers used by register allocation are saved just below local
+    // variables.  Keep the frame size multiple of 16 so that RSP is aligned
+    // when no values are pushed.
+    savedRegsTop = alignTo(n->obj->func->capStackSize, ONE_WORD_BYTES);
+    frameSize = savedRegsTop;
+    for (int i = 0; i < CALLEE_SAVED_REGS_COUNT; ++i)
+        if (usedRegs & (1 << calleeSavedRegs[i]))
+            frameSize += ONE_WORD_BYTES;
+
+    // Leaf functions which never move RSP can place the whole frame in the red
+    // zone and skip setting up RBP.
+    omitFrame = isLeaf && ONE_WORD_BYTES + frameSize <= RED_ZONE_SIZE &&
+                !needsFrame(body);
+    frameSize = alignTo(frameSize, 16);
+    alignStackForCalls(body);
+    expandEpilogues(body, usedRegs, savedRegsTop);
 
     // Prologue.
-    asmPushReg(reg64obj(RBP));
-    appendAsmInstAnyText(&asmlist, "  mov rbp, rsp");
-    if (n->obj->func->capStackSize)
-        appendAsmInstAnyText(&asmlist, "  sub rsp, %d", n->obj->func->capStackSize);
+    if (!omitFrame) {
+        asmPushReg(reg64obj(RBP));
+        asmBinOp(AsmMov, reg64op(RBP), reg64op(RSP));
+        if (frameSize)
+            asmBinOp(AsmSub, reg64op(RSP), immop(frameSize));
+    }
+    for (int i = 0, offset = savedRegsTop; i < CALLEE_SAVED_REGS_COUNT; ++i) {
+        if (usedRegs & (1 << calleeSavedRegs[i])) {
+            offset += ONE_WORD_BYTES;
+            asmBinOp(AsmMov, memop(OpSize64, RBP, -offset), reg64op(calleeSavedRegs[i]));
+        }
+    }
 
     // Push arguments onto stacks from registers.
     if (regargs) {
@@ -1021,23 +2249,15 @@ static AsmInst *genCodeFunction(const Node *n) {
         Obj *arg = n->obj->func->args;
 
         for (; count < regargs; ++count, arg = arg->next) {
-            int size = sizeOf(arg->type);
-            char *fmt;
-            switch (sizeOf(arg->type)) {
-            case 8:
-                fmt = "  mov %d[rbp], %s";
-                break;
-            case 4:
-                fmt = "  mov DWORD PTR %d[rbp], %s";
-                break;
-            case 1:
-                fmt = "  mov BYTE PTR %d[rbp], %s";
-                break;
-            default:
-                errorUnreachable();
+            OperandSize size;
+            RegKind home;
+            if (findRegisterArg(arg, &home)) {
+                if (home != argRegs[count])
+                    asmBinOp(AsmMov, reg64op(home), reg64op(argRegs[count]));
+                continue;
             }
-            appendAsmInstAnyText(
-                    &asmlist, fmt, -arg->offset, getReg(argRegs[count], size));
+            size = getOperandSizeFromByteSize(sizeOf(arg->type));
+            asmBinOp(AsmMov, memop(size, RBP, -arg->offset), regop(argRegs[count], size));
         }
     }
 
@@ -1048,50 +2268,54 @@ static AsmInst *genCodeFunction(const Node *n) {
                 offset = -arg->offset;
         for (int i = regargs; i < REG_ARGS_MAX_COUNT; ++i) {
             offset += ONE_WORD_BYTES;
-            appendAsmInstAnyText(&asmlist, "  mov %d[rbp], %s", offset,
-                    getReg(argRegs[i], ONE_WORD_BYTES));
+            asmBinOp(AsmMov, memop(OpSize64, RBP, offset), reg64op(argRegs[i]));
         }
     }
 
-    appendAsmInst(&asmlist, genAsm(n->body));
+    // Optimizations above may drop the tail of the body, so find the tail
+    // again here.
+    appendAsmInst(&asmlist, body);
 
     // Epilogue
     if (n->obj->token->len == 4 && memcmp(n->obj->token->str, "main", 4) == 0)
-        appendAsmInstAnyText(&asmlist, "  mov rax, 0");
-    appendAsmInstAnyText(
-            &asmlist, ".Lreturn_%.*s:", n->obj->token->len, n->obj->token->str);
-    appendAsmInstAnyText(&asmlist, "  mov rsp, rbp");
-    appendAsmInstAnyText(&asmlist, "  pop rbp");
-    appendAsmInstAnyText(&asmlist, "  ret");
+        asmBinOp(AsmMov, reg64op(RAX), immop(0));
+    appendAsmInstLabel(
+            &asmlist, ".Lreturn_%.*s", n->obj->token->len, n->obj->token->str);
+    appendEpilogue(&asmlist, usedRegs, savedRegsTop, omitFrame);
+    if (omitFrame)
+        rebaseFrameToRSP(getRawAsmInstList(&asmlist));
+    asmNoOperand(AsmRet);
     appendAsmInstAnyText(&asmlist, ".section .note.GNU-stack,\"\",@progbits");
 
     dumpEnv.currentFunc = NULL;
+    dumpEnv.regArgsCount = 0;
+    dumpEnv.tailCalls = 0;
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeIncrement(const Node *n, int prefix) {
+static AsmInstList *genCodeIncrement(const Node *n, int prefix) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     Node *expr = prefix ? n->rhs : n->lhs;
-    appendAsmInst(&asmlist, genCodeLVal(expr));
+    appendAsmInstList(&asmlist, genCodeLVal(expr));
     asmPopRax();
-    appendAsmInstAnyText(&asmlist, "  mov rdi, rax");
+    asmBinOp(AsmMov, reg64op(RDI), reg64op(RAX));
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(&asmlist, "  mov rax, [rax]");
+        asmBinOp(AsmMov, reg64op(RAX), memop(OpSize64, RAX, 0));
         break;
     case 4:
-        appendAsmInstAnyText(&asmlist, "  mov eax, DWORD PTR [rax]");
-        appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+        asmBinOp(AsmMov, regop(RAX, OpSize32), memop(OpSize32, RAX, 0));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(&asmlist, "  mov al, BYTE PTR [rax]");
-        appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+        asmBinOp(AsmMov, regop(RAX, OpSize8), memop(OpSize8, RAX, 0));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
         break;
     default:
         errorUnreachable();
@@ -1103,18 +2327,16 @@ static AsmInst *genCodeIncrement(const Node *n, int prefix) {
 
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(
-                &asmlist, "  add rax, %d", getAlternativeOfOneForType(n->type));
+        asmBinOp(AsmAdd, reg64op(RAX), immop(getAlternativeOfOneForType(n->type)));
         break;
     case 4:
-        appendAsmInstAnyText(
-                &asmlist, "  add eax, %d", getAlternativeOfOneForType(n->type));
-        appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+        asmBinOp(AsmAdd, regop(RAX, OpSize32),
+                immop(getAlternativeOfOneForType(n->type)));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(
-                &asmlist, "  add al, %d", getAlternativeOfOneForType(n->type));
-        appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+        asmBinOp(AsmAdd, regop(RAX, OpSize8), immop(getAlternativeOfOneForType(n->type)));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
         break;
     default:
         errorUnreachable();
@@ -1127,43 +2349,43 @@ static AsmInst *genCodeIncrement(const Node *n, int prefix) {
     // Reflect the expression result on variable.
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(&asmlist, "  mov [rdi], rax");
+        asmBinOp(AsmMov, memop(OpSize64, RDI, 0), reg64op(RAX));
         break;
     case 4:
-        appendAsmInstAnyText(&asmlist, "  mov DWORD PTR [rdi], eax");
+        asmBinOp(AsmMov, memop(OpSize32, RDI, 0), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(&asmlist, "  mov BYTE PTR [rdi], al");
+        asmBinOp(AsmMov, memop(OpSize8, RDI, 0), regop(RAX, OpSize8));
         break;
     default:
         errorUnreachable();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeDecrement(const Node *n, int prefix) {
+static AsmInstList *genCodeDecrement(const Node *n, int prefix) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     Node *expr = prefix ? n->rhs : n->lhs;
-    appendAsmInst(&asmlist, genCodeLVal(expr));
+    appendAsmInstList(&asmlist, genCodeLVal(expr));
     asmPopRax();
-    appendAsmInstAnyText(&asmlist, "  mov rdi, rax");
+    asmBinOp(AsmMov, reg64op(RDI), reg64op(RAX));
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(&asmlist, "  mov rax, [rax]");
+        asmBinOp(AsmMov, reg64op(RAX), memop(OpSize64, RAX, 0));
         break;
     case 4:
-        appendAsmInstAnyText(&asmlist, "  mov eax, DWORD PTR [rax]");
-        appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+        asmBinOp(AsmMov, regop(RAX, OpSize32), memop(OpSize32, RAX, 0));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(&asmlist, "  mov al, BYTE PTR [rax]");
-        appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+        asmBinOp(AsmMov, regop(RAX, OpSize8), memop(OpSize8, RAX, 0));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
         break;
     default:
         errorUnreachable();
@@ -1175,18 +2397,16 @@ static AsmInst *genCodeDecrement(const Node *n, int prefix) {
 
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(
-                &asmlist, "  sub rax, %d", getAlternativeOfOneForType(n->type));
+        asmBinOp(AsmSub, reg64op(RAX), immop(getAlternativeOfOneForType(n->type)));
         break;
     case 4:
-        appendAsmInstAnyText(
-                &asmlist, "  sub eax, %d", getAlternativeOfOneForType(n->type));
-        appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+        asmBinOp(AsmSub, regop(RAX, OpSize32),
+                immop(getAlternativeOfOneForType(n->type)));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(
-                &asmlist, "  sub al, %d", getAlternativeOfOneForType(n->type));
-        appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+        asmBinOp(AsmSub, regop(RAX, OpSize8), immop(getAlternativeOfOneForType(n->type)));
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
         break;
     default:
         errorUnreachable();
@@ -1199,33 +2419,74 @@ static AsmInst *genCodeDecrement(const Node *n, int prefix) {
     // Reflect the expression result on variable.
     switch (sizeOf(n->type)) {
     case 8:
-        appendAsmInstAnyText(&asmlist, "  mov [rdi], rax");
+        asmBinOp(AsmMov, memop(OpSize64, RDI, 0), reg64op(RAX));
         break;
     case 4:
-        appendAsmInstAnyText(&asmlist, "  mov DWORD PTR [rdi], eax");
+        asmBinOp(AsmMov, memop(OpSize32, RDI, 0), regop(RAX, OpSize32));
         break;
     case 1:
-        appendAsmInstAnyText(&asmlist, "  mov BYTE PTR [rdi], al");
+        asmBinOp(AsmMov, memop(OpSize8, RDI, 0), regop(RAX, OpSize8));
         break;
     default:
         errorUnreachable();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeAdd(const Node *n) {
+static AsmInstList *genCodeAdd(const Node *n) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     int altOne = getAlternativeOfOneForType(n->type);
-    appendAsmInst(&asmlist, genAsm(n->lhs));
-    appendAsmInst(&asmlist, genAsm(n->rhs));
+    int ptrAdd = isWorkLikePointer(n->lhs->type) || isWorkLikePointer(n->rhs->type);
+    const Node *var = n->lhs;
+    const Node *imm = NULL;
+
+    // Addition is commutative, so a constant operand on either side can be
+    // embedded as an immediate operand.
+    if (isImmediateNode(n->rhs)) {
+        imm = n->rhs;
+    } else if (isImmediateNode(n->lhs)) {
+        var = n->rhs;
+        imm = n->lhs;
+    }
+    if (imm && ptrAdd && !isScaledImmediate(imm->val, altOne))
+        imm = NULL;
+
+    if (imm) {
+        appendAsmInstList(&asmlist, genCodeNode(var));
+        asmPopRax();
+        if (ptrAdd) {
+            asmBinOp(AsmAdd, reg64op(RAX), immop(imm->val * altOne));
+        } else {
+            switch (sizeOf(n->lhs->type)) {
+            case 8:
+                asmBinOp(AsmAdd, reg64op(RAX), immop(imm->val));
+                break;
+            case 4:
+                asmBinOp(AsmAdd, regop(RAX, OpSize32), immop(imm->val));
+                asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
+                break;
+            case 1:
+                asmBinOp(AsmAdd, regop(RAX, OpSize8), immop((char)imm->val));
+                asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
+                break;
+            default:
+                errorUnreachable();
+            }
+        }
+        asmPushRax();
+        return takeAsmInstList(&asmlist);
+    }
 
-    if (isWorkLikePointer(n->lhs->type) || isWorkLikePointer(n->rhs->type)) {
+    appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+    appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+
+    if (ptrAdd) {
         // Load integer to RAX and pointer to RDI in either case.
         if (isWorkLikePointer(n->lhs->type)) { // ptr + num
             asmPopRax();
@@ -1234,24 +2495,28 @@ static AsmInst *genCodeAdd(const Node *n) {
             appendAsmInstPop(&asmlist, &reg64obj(RDI));
             asmPopRax();
         }
-        appendAsmInstAnyText(&asmlist, "  mov rsi, %d", altOne);
-        appendAsmInstAnyText(&asmlist, "  imul rax, rsi");
-        appendAsmInstAnyText(&asmlist, "  add rax, rdi");
+        if (altOne == 1 || altOne == 2 || altOne == 4 || altOne == 8) {
+            asmBinOp(AsmLea, reg64op(RAX), memidxop(OpSize64, RDI, RAX, altOne, 0));
+        } else {
+            asmBinOp(AsmMov, reg64op(RSI), immop(altOne));
+            asmBinOp(AsmImul, reg64op(RAX), reg64op(RSI));
+            asmBinOp(AsmAdd, reg64op(RAX), reg64op(RDI));
+        }
         asmPushRax();
     } else {
         appendAsmInstPop(&asmlist, &reg64obj(RDI));
         asmPopRax();
         switch (sizeOf(n->lhs->type)) {
         case 8:
-            appendAsmInstAnyText(&asmlist, "  add rax, rdi");
+            asmBinOp(AsmAdd, reg64op(RAX), reg64op(RDI));
             break;
         case 4:
-            appendAsmInstAnyText(&asmlist, "  add eax, edi");
-            appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+            asmBinOp(AsmAdd, regop(RAX, OpSize32), regop(RDI, OpSize32));
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
             break;
         case 1:
-            appendAsmInstAnyText(&asmlist, "  add al, dil");
-            appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+            asmBinOp(AsmAdd, regop(RAX, OpSize8), regop(RDI, OpSize8));
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
             break;
         default:
             errorUnreachable();
@@ -1259,18 +2524,50 @@ static AsmInst *genCodeAdd(const Node *n) {
         asmPushRax();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeSub(const Node *n) {
+static AsmInstList *genCodeSub(const Node *n) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
+
+    // A constant rhs is never a pointer, so this is either "ptr - num" or
+    // "num - num".
+    if (isImmediateNode(n->rhs)) {
+        int isPtr = n->lhs->type->type == TypePointer;
+        int altOne = isPtr ? getAlternativeOfOneForType(n->lhs->type) : 1;
+        if (isScaledImmediate(n->rhs->val, altOne)) {
+            appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+            asmPopRax();
+            if (isPtr) {
+                asmBinOp(AsmSub, reg64op(RAX), immop(n->rhs->val * altOne));
+            } else {
+                switch (sizeOf(n->type)) {
+                case 8:
+                    asmBinOp(AsmSub, reg64op(RAX), immop(n->rhs->val));
+                    break;
+                case 4:
+                    asmBinOp(AsmSub, regop(RAX, OpSize32), immop(n->rhs->val));
+                    asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
+                    break;
+                case 1:
+                    asmBinOp(AsmSub, regop(RAX, OpSize8), immop((char)n->rhs->val));
+                    asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
+                    break;
+                default:
+                    errorUnreachable();
+                }
+            }
+            asmPushRax();
+            return takeAsmInstList(&asmlist);
+        }
+    }
 
-    appendAsmInst(&asmlist, genAsm(n->lhs));
-    appendAsmInst(&asmlist, genAsm(n->rhs));
+    appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+    appendAsmInstList(&asmlist, genCodeNode(n->rhs));
 
     appendAsmInstPop(&asmlist, &reg64obj(RDI));
     asmPopRax();
@@ -1278,14 +2575,18 @@ static AsmInst *genCodeSub(const Node *n) {
         int altOne = getAlternativeOfOneForType(n->lhs->type);
         int subBetweenPtr = n->type->type == TypePtrdiff_t;
         if (!subBetweenPtr) {
-            appendAsmInstAnyText(&asmlist, "  mov rsi, %d", altOne);
-            appendAsmInstAnyText(&asmlist, "  imul rdi, rsi");
+            asmBinOp(AsmMov, reg64op(RSI), immop(altOne));
+            asmBinOp(AsmImul, reg64op(RDI), reg64op(RSI));
         }
-        appendAsmInstAnyText(&asmlist, "  sub rax, rdi");
-        if (subBetweenPtr) {
-            appendAsmInstAnyText(&asmlist, "  mov rsi, %d", altOne);
-            appendAsmInstAnyText(&asmlist, "  cqo");
-            appendAsmInstAnyText(&asmlist, "  idiv rsi");
+        asmBinOp(AsmSub, reg64op(RAX), reg64op(RDI));
+        if (subBetweenPtr && exactLog2(altOne) >= 0) {
+            // The difference is always a multiple of the element size.
+            if (altOne > 1)
+                asmBinOp(AsmSar, reg64op(RAX), immop(exactLog2(altOne)));
+        } else if (subBetweenPtr) {
+            asmBinOp(AsmMov, reg64op(RSI), immop(altOne));
+            asmNoOperand(AsmCqo);
+            asmUnOp(AsmIdiv, reg64op(RSI));
         }
         asmPushRax();
     } else {
@@ -1293,15 +2594,15 @@ static AsmInst *genCodeSub(const Node *n) {
         // It should be that lhs, rhs, and result have all the same type.
         switch (sizeOf(n->type)) {
         case 8:
-            appendAsmInstAnyText(&asmlist, "  sub rax, rdi");
+            asmBinOp(AsmSub, reg64op(RAX), reg64op(RDI));
             break;
         case 4:
-            appendAsmInstAnyText(&asmlist, "  sub eax, edi");
-            appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+            asmBinOp(AsmSub, regop(RAX, OpSize32), regop(RDI, OpSize32));
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
             break;
         case 1:
-            appendAsmInstAnyText(&asmlist, "  sub al, dil");
-            appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+            asmBinOp(AsmSub, regop(RAX, OpSize8), regop(RDI, OpSize8));
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
             break;
         default:
             errorUnreachable();
@@ -1309,15 +2610,15 @@ static AsmInst *genCodeSub(const Node *n) {
         asmPushRax();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeInitVarArray(const Node *n, TypeInfo *varType) {
+static AsmInstList *genCodeInitVarArray(const Node *n, TypeInfo *varType) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     Node *var = n->lhs;
 
@@ -1334,11 +2635,11 @@ static AsmInst *genCodeInitVarArray(const Node *n, TypeInfo *varType) {
                 fillNodeAdd(&elem, var, &constNum, varType);
                 fillNodeInitVar(&initNode, var->token, &elem, initVal);
 
-                appendAsmInst(
+                appendAsmInstList(
                         &asmlist, genCodeInitVarArray(&initNode, varType->baseType));
             }
         } else if (n->rhs->kind == NodeLiteralString) {
-            LiteralString *string = n->rhs->token->literalStr;
+            LiteralString *string = n->rhs->token->data.literalStr;
             int len = 0;
             int elemIdx = 0;
 
@@ -1380,7 +2681,7 @@ static AsmInst *genCodeInitVarArray(const Node *n, TypeInfo *varType) {
 
                 elemIdx++;
 
-                appendAsmInst(&asmlist, genCodeAssign(&initNode));
+                appendAsmInstList(&asmlist, genCodeAssign(&initNode));
                 asmPopRax();
             }
         } else {
@@ -1398,13 +2699,13 @@ static AsmInst *genCodeInitVarArray(const Node *n, TypeInfo *varType) {
 
         fillNodeInitVar(&init, var->token, &deref, n->rhs);
 
-        appendAsmInst(&asmlist, genCodeInitVar(&init, deref.type));
+        appendAsmInstList(&asmlist, genCodeInitVar(&init, deref.type));
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeInitVarStruct(const Node *n, TypeInfo *varType) {
+static AsmInstList *genCodeInitVarStruct(const Node *n, TypeInfo *varType) {
     if (varType->type != TypeStruct)
         errorUnreachable();
 
@@ -1416,7 +2717,7 @@ static AsmInst *genCodeInitVarStruct(const Node *n, TypeInfo *varType) {
         Node initNode = *n;
         initNode.kind = NodeAssignStruct;
         initNode.type = n->lhs->type;
-        appendAsmInst(&asmlist, genAsm(&initNode));
+        appendAsmInstList(&asmlist, genCodeNode(&initNode));
         asmPopRax();
     } else {
         Node *initVal = n->rhs->body;
@@ -1433,14 +2734,14 @@ static AsmInst *genCodeInitVarStruct(const Node *n, TypeInfo *varType) {
 
             fillNodeInitVar(&initNode, var->token, &access, initVal);
 
-            appendAsmInst(&asmlist, genAsm(&initNode));
+            appendAsmInstList(&asmlist, genCodeNode(&initNode));
         }
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeInitVarUnion(const Node *n, TypeInfo *varType) {
+static AsmInstList *genCodeInitVarUnion(const Node *n, TypeInfo *varType) {
     if (varType->type != TypeUnion)
         errorUnreachable();
 
@@ -1452,7 +2753,7 @@ static AsmInst *genCodeInitVarUnion(const Node *n, TypeInfo *varType) {
         Node initNode = *n;
         initNode.kind = NodeAssignUnion;
         initNode.type = n->lhs->type;
-        appendAsmInst(&asmlist, genAsm(&initNode));
+        appendAsmInstList(&asmlist, genCodeNode(&initNode));
         asmPopRax();
     } else if (var->type->unionDef->members) {
         Node *initVal = n->rhs->body;
@@ -1467,96 +2768,81 @@ static AsmInst *genCodeInitVarUnion(const Node *n, TypeInfo *varType) {
 
         fillNodeInitVar(&initNode, var->token, &access, initVal);
 
-        appendAsmInst(&asmlist, genAsm(&initNode));
+        appendAsmInstList(&asmlist, genCodeNode(&initNode));
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-static AsmInst *genCodeInitVar(const Node *n, TypeInfo *varType) {
+static AsmInstList *genCodeInitVar(const Node *n, TypeInfo *varType) {
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (varType->type == TypeArray) {
-        appendAsmInst(&asmlist, genCodeInitVarArray(n, varType));
+        appendAsmInstList(&asmlist, genCodeInitVarArray(n, varType));
     } else if (varType->type == TypeStruct) {
-        appendAsmInst(&asmlist, genCodeInitVarStruct(n, varType));
+        appendAsmInstList(&asmlist, genCodeInitVarStruct(n, varType));
     } else if (varType->type == TypeUnion) {
-        appendAsmInst(&asmlist, genCodeInitVarUnion(n, varType));
+        appendAsmInstList(&asmlist, genCodeInitVarUnion(n, varType));
     } else {
         // TODO: Support this: char *str = "...";
         Node copy = *n;
         copy.kind = NodeAssign;
         copy.type = varType;
-        appendAsmInst(&asmlist, genCodeAssign(&copy));
+        appendAsmInstList(&asmlist, genCodeAssign(&copy));
         asmPopRax();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-AsmInst *genAsm(const Node *n) {
+static AsmInstList *genCodeNode(const Node *n) {
+    RegKind reg;
     AsmInstList asmlist;
     initAsmInstList(&asmlist);
 
     if (!n)
-        return getRawAsmInstList(&asmlist);
+        return takeAsmInstList(&asmlist);
 
     if (n->kind == NodeNop) {
         // Do nothing.
     } else if (n->kind == NodeInitVar) {
-        appendAsmInst(&asmlist, genCodeInitVar(n, n->lhs->type));
+        appendAsmInstList(&asmlist, genCodeInitVar(n, n->lhs->type));
     } else if (n->kind == NodeClearStack) {
-        int entire, rest;
-        entire = rest = sizeOf(n->rhs->type);
-        appendAsmInstAnyText(&asmlist, "  mov rax, rbp");
-        appendAsmInstAnyText(&asmlist, "  sub rax, %d", n->rhs->obj->offset);
-        while (rest) {
-            if (rest >= 8) {
-                appendAsmInstAnyText(
-                        &asmlist, "  mov QWORD PTR %d[rax], 0", entire - rest);
-                rest -= 8;
-            } else if (rest >= 4) {
-                appendAsmInstAnyText(
-                        &asmlist, "  mov DWORD PTR %d[rax], 0", entire - rest);
-                rest -= 4;
-            } else {
-                appendAsmInstAnyText(
-                        &asmlist, "  mov BYTE PTR %d[rax], 0", entire - rest);
-                rest -= 1;
-            }
-        }
+        asmBinOp(AsmMov, reg64op(RDI), reg64op(RBP));
+        asmBinOp(AsmSub, reg64op(RDI), immop(n->rhs->obj->offset));
+        appendAsmInstList(&asmlist, genCodeClearBlock(sizeOf(n->rhs->type)));
     } else if (n->kind == NodeTypeCast) {
         int destSize;
         destSize = sizeOf(n->type);
 
-        appendAsmInst(&asmlist, genAsm(n->rhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
 
         // Currently, cast is needed only when destSize < 8.
         if (destSize >= 8)
-            return getRawAsmInstList(&asmlist);
+            return takeAsmInstList(&asmlist);
 
         asmPopRax();
         switch (destSize) {
         case 4:
-            appendAsmInstAnyText(
-                    &asmlist, "  movsx rax, eax"); // We only have signed variables yet.
+            // We only have signed variables yet.
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
             break;
         case 1:
-            appendAsmInstAnyText(
-                    &asmlist, "  movsx rax, al"); // We only have signed variable yet.
+            // We only have signed variable yet.
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
             break;
         default:
             errorUnreachable();
         }
         asmPushRax();
     } else if (n->kind == NodeAddress) {
-        appendAsmInst(&asmlist, genCodeLVal(n->rhs));
+        appendAsmInstList(&asmlist, genCodeLVal(n->rhs));
     } else if (n->kind == NodeDeref) {
-        appendAsmInst(&asmlist, genCodeDeref(n));
+        appendAsmInstList(&asmlist, genCodeDeref(n));
     } else if (n->kind == NodeBlock) {
         for (Node *c = n->body; c; c = c->next) {
-            appendAsmInst(&asmlist, genAsm(c));
+            appendAsmInstList(&asmlist, genCodeNode(c));
             // Statement lefts a value on the top of the stack, and it should
             // be thrown away. (But Block node does not put any value, so do
             // not pop value.)
@@ -1566,11 +2852,11 @@ AsmInst *genAsm(const Node *n) {
         }
     } else if (n->kind == NodeExprList) {
         if (!n->body) {
-            appendAsmInstAnyText(&asmlist, "  push 0  /* Represents NOP */");
-            return getRawAsmInstList(&asmlist);
+            asmPushImm(0); // Represents NOP
+            return takeAsmInstList(&asmlist);
         }
         for (Node *c = n->body; c; c = c->next) {
-            appendAsmInst(&asmlist, genAsm(c));
+            appendAsmInstList(&asmlist, genCodeNode(c));
             // Throw away values that expressions left on stack, but the last
             // expression is the exception and its result value may be used in
             // next statement.
@@ -1581,78 +2867,85 @@ AsmInst *genAsm(const Node *n) {
         errorUnreachable();
     } else if (n->kind == NodeNot) {
         // TODO: Make sure n->rhs lefts a value on stack
-        appendAsmInst(&asmlist, genAsm(n->rhs));
-        asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-        appendAsmInstAnyText(&asmlist, "  sete al");
-        appendAsmInstAnyText(&asmlist, "  movzb rax, al");
-        asmPushRax();
-    } else if (n->kind == NodeLogicalAND) {
-        // TODO: Make sure n->rhs lefts a value on stack
-        appendAsmInst(&asmlist, genAsm(n->lhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
         asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-        appendAsmInstAnyText(&asmlist, "  je .Llogicaland%d", n->blockID);
-        appendAsmInst(&asmlist, genAsm(n->rhs));
-        asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-        appendAsmInstAnyText(&asmlist, ".Llogicaland%d:", n->blockID);
-        appendAsmInstAnyText(&asmlist, "  setne al");
-        appendAsmInstAnyText(&asmlist, "  movzb rax, al");
+        asmBinOp(AsmCmp, reg64op(RAX), immop(0));
+        appendAsmInstSetcc(&asmlist, AsmCondE, &regobj(RAX, OpSize8));
+        asmBinOp(AsmMovzx, reg64op(RAX), regop(RAX, OpSize8));
         asmPushRax();
-    } else if (n->kind == NodeLogicalOR) {
-        appendAsmInst(&asmlist, genAsm(n->lhs));
-        asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-        appendAsmInstAnyText(&asmlist, "  jne .Llogicalor%d", n->blockID);
-        appendAsmInst(&asmlist, genAsm(n->rhs));
-        asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-        appendAsmInstAnyText(&asmlist, ".Llogicalor%d:", n->blockID);
-        appendAsmInstAnyText(&asmlist, "  setne al");
-        appendAsmInstAnyText(&asmlist, "  movzb rax, al");
+    } else if (n->kind == NodeLogicalAND || n->kind == NodeLogicalOR) {
+        // Branch on the whole condition once and materialize the result at the
+        // end, so that comparisons inside it are lowered into jumps as well.
+        appendAsmInstList(
+                &asmlist, genCodeCondJump(n, 0, ".Llogical_false%d", n->blockID));
+        asmBinOp(AsmMov, reg64op(RAX), immop(1));
+        appendAsmInstJmp(&asmlist, ".Llogical_end%d", n->blockID);
+        appendAsmInstLabel(&asmlist, ".Llogical_false%d", n->blockID);
+        asmBinOp(AsmMov, reg64op(RAX), immop(0));
+        appendAsmInstLabel(&asmlist, ".Llogical_end%d", n->blockID);
         asmPushRax();
     } else if (n->kind == NodeArithShiftL || n->kind == NodeArithShiftR) {
-        char *op = n->kind == NodeArithShiftL ? "sal" : "sar";
-        appendAsmInst(&asmlist, genAsm(n->lhs));
-        appendAsmInst(&asmlist, genAsm(n->rhs));
-        appendAsmInstAnyText(&asmlist, "  pop rcx");
-        asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  %s eax, cl", op);
-        appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+        AsmInstKind op = n->kind == NodeArithShiftL ? AsmSal : AsmSar;
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+        if (isImmediateNode(n->rhs)) {
+            asmPopRax();
+            asmBinOp(op, regop(RAX, OpSize32), immop(n->rhs->val));
+        } else {
+            appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+            appendAsmInstPop(&asmlist, &reg64obj(RCX));
+            asmPopRax();
+            asmBinOp(op, regop(RAX, OpSize32), regop(RCX, OpSize8));
+        }
+        asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
         asmPushRax();
     } else if (n->kind == NodeNum) {
-        appendAsmInstAnyText(&asmlist, "  push %d", n->val);
+        asmPushImm(n->val);
     } else if (n->kind == NodeLiteralString) {
-        appendAsmInstAnyText(
-                &asmlist, "  lea rax, .LiteralString%d[rip]", n->token->literalStr->id);
+        asmBinOp(AsmLea, reg64op(RAX),
+                newOperandMemRIP(OpSize64,
+                        format(".LiteralString%d", n->token->data.literalStr->id)));
+        asmPushRax();
+    } else if (n->kind == NodeLVar && findRegisterArg(n->obj, &reg)) {
+        switch (sizeOf(n->type)) {
+        case 8:
+            asmBinOp(AsmMov, reg64op(RAX), reg64op(reg));
+            break;
+        case 4:
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(reg, OpSize32));
+            break;
+        case 1:
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(reg, OpSize8));
+            break;
+        default:
+            errorUnreachable();
+        }
         asmPushRax();
     } else if (n->kind == NodeLVar || n->kind == NodeGVar ||
                n->kind == NodeMemberAccess) {
         // When NodeLVar appears with itself alone, it should be treated as a
         // rvalue, not a lvalue.
-        appendAsmInst(&asmlist, genCodeLVal(n));
+        appendAsmInstList(&asmlist, genCodeLVal(n));
 
         // But, array, struct, and function are exceptions.  They work like
         // pointers even when they're being rvalues since they cannot always be
         // stored on register.
         if (!isRegisterStorableValue(n))
-            return getRawAsmInstList(&asmlist);
+            return takeAsmInstList(&asmlist);
 
         // In order to change this lvalue into rvalue, push a value of a
         // variable to the top of the stack.
         asmPopRax();
         switch (sizeOf(n->type)) {
         case 8:
-            appendAsmInstAnyText(&asmlist, "  mov rax, [rax]");
+            asmBinOp(AsmMov, reg64op(RAX), memop(OpSize64, RAX, 0));
             break;
         case 4:
-            appendAsmInstAnyText(&asmlist, "  mov eax, DWORD PTR [rax]");
-            appendAsmInstAnyText(&asmlist, "  movsx rax, eax");
+            asmBinOp(AsmMov, regop(RAX, OpSize32), memop(OpSize32, RAX, 0));
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize32));
             break;
         case 1:
-            appendAsmInstAnyText(&asmlist, "  mov al, BYTE PTR [rax]");
-            appendAsmInstAnyText(&asmlist, "  movsx rax, al");
+            asmBinOp(AsmMov, regop(RAX, OpSize8), memop(OpSize8, RAX, 0));
+            asmBinOp(AsmMovsx, reg64op(RAX), regop(RAX, OpSize8));
             break;
         default:
             errorUnreachable();
@@ -1660,116 +2953,125 @@ AsmInst *genAsm(const Node *n) {
         asmPushRax();
 
     } else if (n->kind == NodeAssign) {
-        appendAsmInst(&asmlist, genCodeAssign(n));
+        appendAsmInstList(&asmlist, genCodeAssign(n));
     } else if (n->kind == NodeAssignStruct || n->kind == NodeAssignUnion) {
-        int total, rest;
-        total = rest = sizeOf(n->type);
-        appendAsmInst(&asmlist, genCodeLVal(n->lhs));
-        appendAsmInst(&asmlist, genAsm(n->rhs));
-        appendAsmInstPop(&asmlist, &reg64obj(RDI));
+        appendAsmInstList(&asmlist, genCodeLVal(n->lhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+        appendAsmInstPop(&asmlist, &reg64obj(RSI));
         asmPopRax();
-        while (rest) {
-            if (rest >= 8) {
-                appendAsmInstAnyText(
-                        &asmlist, "  mov rsi, QWORD PTR %d[rdi]", total - rest);
-                appendAsmInstAnyText(
-                        &asmlist, "  mov QWORD PTR %d[rax], rsi", total - rest);
-                rest -= 8;
-            } else if (rest >= 4) {
-                appendAsmInstAnyText(
-                        &asmlist, "  mov esi, DWORD PTR %d[rdi]", total - rest);
-                appendAsmInstAnyText(
-                        &asmlist, "  mov DWORD PTR %d[rax], esi", total - rest);
-                rest -= 4;
-            } else {
-                appendAsmInstAnyText(
-                        &asmlist, "  mov sil, BYTE PTR %d[rdi]", total - rest);
-                appendAsmInstAnyText(
-                        &asmlist, "  mov BYTE PTR %d[rax], sil", total - rest);
-                rest -= 1;
-            }
-        }
+        asmBinOp(AsmMov, reg64op(RDI), reg64op(RAX));
+        appendAsmInstList(&asmlist, genCodeCopyBlock(sizeOf(n->type)));
         asmPushRax();
     } else if (n->kind == NodeBreak) {
-        appendAsmInstAnyText(&asmlist, "  jmp .Lend%d", dumpEnv.loopBlockID);
+        appendAsmInstJmp(&asmlist, ".Lend%d", dumpEnv.loopBlockID);
     } else if (n->kind == NodeContinue) {
-        appendAsmInstAnyText(&asmlist, "  jmp .Literator%d", dumpEnv.loopBlockID);
+        appendAsmInstJmp(&asmlist, ".Literator%d", dumpEnv.loopBlockID);
     } else if (n->kind == NodeReturn) {
-        appendAsmInst(&asmlist, genCodeReturn(n));
+        appendAsmInstList(&asmlist, genCodeReturn(n));
     } else if (n->kind == NodeConditional) {
-        appendAsmInst(&asmlist, genAsm(n->condition));
-        asmPopRax();
-        appendAsmInstAnyText(&asmlist, "  cmp rax, 0");
-        appendAsmInstAnyText(&asmlist, "  je .Lcond_falsy_%d", n->blockID);
-        appendAsmInst(&asmlist, genAsm(n->lhs));
-        appendAsmInstAnyText(&asmlist, "  jmp .Lcond_end_%d", n->blockID);
-        appendAsmInstAnyText(&asmlist, ".Lcond_falsy_%d:", n->blockID);
-        appendAsmInst(&asmlist, genAsm(n->rhs));
-        appendAsmInstAnyText(&asmlist, ".Lcond_end_%d:", n->blockID);
+        appendAsmInstList(&asmlist,
+                genCodeCondJump(n->condition, 0, ".Lcond_falsy_%d", n->blockID));
+        // Move the result into RAX in each branch and push it after they join,
+        // so that the stack depth is the same on both paths.
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+        if (isExprNode(n->lhs))
+            asmPopRax();
+        appendAsmInstJmp(&asmlist, ".Lcond_end_%d", n->blockID);
+        appendAsmInstLabel(&asmlist, ".Lcond_falsy_%d", n->blockID);
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
+        if (isExprNode(n->rhs))
+            asmPopRax();
+        appendAsmInstLabel(&asmlist, ".Lcond_end_%d", n->blockID);
+        if (isExprNode(n))
+            asmPushRax();
     } else if (n->kind == NodeIf) {
-        appendAsmInst(&asmlist, genCodeIf(n));
+        appendAsmInstList(&asmlist, genCodeIf(n));
     } else if (n->kind == NodeSwitch) {
-        appendAsmInst(&asmlist, genCodeSwitch(n));
+        appendAsmInstList(&asmlist, genCodeSwitch(n));
     } else if (n->kind == NodeSwitchCase) {
-        appendAsmInst(&asmlist, genCodeSwitchCase(n));
+        appendAsmInstList(&asmlist, genCodeSwitchCase(n));
     } else if (n->kind == NodeFor) {
-        appendAsmInst(&asmlist, genCodeFor(n));
+        appendAsmInstList(&asmlist, genCodeFor(n));
     } else if (n->kind == NodeDoWhile) {
-        appendAsmInst(&asmlist, genCodeDoWhile(n));
+        appendAsmInstList(&asmlist, genCodeDoWhile(n));
     } else if (n->kind == NodeFCall) {
-        appendAsmInst(&asmlist, genCodeFCall(n));
+        appendAsmInstList(&asmlist, genCodeFCall(n));
     } else if (n->kind == NodeVaStart) {
-        appendAsmInst(&asmlist, genCodeVaStart(n));
+        appendAsmInstList(&asmlist, genCodeVaStart(n));
     } else if (n->kind == NodeFunction) {
-        appendAsmInst(&asmlist, genCodeFunction(n));
+        appendAsmInstList(&asmlist, genCodeFunction(n));
     } else if (n->kind == NodePreIncl || n->kind == NodePostIncl) {
-        appendAsmInst(&asmlist, genCodeIncrement(n, n->kind == NodePreIncl));
+        appendAsmInstList(&asmlist, genCodeIncrement(n, n->kind == NodePreIncl));
     } else if (n->kind == NodePreDecl || n->kind == NodePostDecl) {
-        appendAsmInst(&asmlist, genCodeDecrement(n, n->kind == NodePreDecl));
+        appendAsmInstList(&asmlist, genCodeDecrement(n, n->kind == NodePreDecl));
     } else if (n->kind == NodeAdd) {
-        appendAsmInst(&asmlist, genCodeAdd(n));
+        appendAsmInstList(&asmlist, genCodeAdd(n));
     } else if (n->kind == NodeSub) {
-        appendAsmInst(&asmlist, genCodeSub(n));
+        appendAsmInstList(&asmlist, genCodeSub(n));
+    } else if (isCompareNode(n)) {
+        AsmCondKind cond;
+        appendAsmInstList(&asmlist, genCodeCompare(n, &cond));
+        appendAsmInstSetcc(&asmlist, cond, &regobj(RAX, OpSize8));
+        asmBinOp(AsmMovzx, reg64op(RAX), regop(RAX, OpSize8));
+        asmPushRax();
+    } else if ((n->kind == NodeMul || n->kind == NodeBitwiseAND ||
+                       n->kind == NodeBitwiseOR || n->kind == NodeBitwiseXOR) &&
+               (isImmediateNode(n->lhs) || isImmediateNode(n->rhs))) {
+        // These operators are commutative, so the constant operand can always
+        // be the immediate operand of the instruction.
+        const Node *var = n->lhs;
+        const Node *imm = n->rhs;
+        AsmInstKind op;
+        if (isImmediateNode(n->lhs)) {
+            var = n->rhs;
+            imm = n->lhs;
+        }
+        if (n->kind == NodeMul)
+            op = AsmImul;
+        else if (n->kind == NodeBitwiseAND)
+            op = AsmAnd;
+        else if (n->kind == NodeBitwiseOR)
+            op = AsmOr;
+        else
+            op = AsmXor;
+        appendAsmInstList(&asmlist, genCodeNode(var));
+        asmPopRax();
+        if (op == AsmImul)
+            appendAsmInstList(&asmlist, genCodeMulImm(imm->val));
+        else
+            asmBinOp(op, reg64op(RAX), immop(imm->val));
+        asmPushRax();
+    } else if ((n->kind == NodeDiv || n->kind == NodeDivRem) &&
+               isImmediateNode(n->rhs) && n->rhs->val > 0 &&
+               n->rhs->val <= DIVISOR_IMM_MAX) {
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+        asmPopRax();
+        appendAsmInstList(&asmlist, genCodeDivImm(n->rhs->val, n->kind == NodeDivRem));
+        asmPushRax();
     } else {
-        appendAsmInst(&asmlist, genAsm(n->lhs));
-        appendAsmInst(&asmlist, genAsm(n->rhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->lhs));
+        appendAsmInstList(&asmlist, genCodeNode(n->rhs));
 
         appendAsmInstPop(&asmlist, &reg64obj(RDI));
         asmPopRax();
 
         // Maybe these oprands should use only 8bytes registers.
         if (n->kind == NodeMul) {
-            appendAsmInstAnyText(&asmlist, "  imul rax, rdi");
+            asmBinOp(AsmImul, reg64op(RAX), reg64op(RDI));
         } else if (n->kind == NodeDiv) {
-            appendAsmInstAnyText(&asmlist, "  cqo");
-            appendAsmInstAnyText(&asmlist, "  idiv rdi");
+            asmNoOperand(AsmCqo);
+            asmUnOp(AsmIdiv, reg64op(RDI));
         } else if (n->kind == NodeDivRem) {
-            appendAsmInstAnyText(&asmlist, "  cqo");
-            appendAsmInstAnyText(&asmlist, "  idiv rdi");
+            asmNoOperand(AsmCqo);
+            asmUnOp(AsmIdiv, reg64op(RDI));
             asmPushReg(reg64obj(RDX));
-            return getRawAsmInstList(&asmlist);
-        } else if (n->kind == NodeEq) {
-            appendAsmInstAnyText(&asmlist, "  cmp rax, rdi");
-            appendAsmInstAnyText(&asmlist, "  sete al");
-            appendAsmInstAnyText(&asmlist, "  movzb rax, al");
-        } else if (n->kind == NodeNeq) {
-            appendAsmInstAnyText(&asmlist, "  cmp rax, rdi");
-            appendAsmInstAnyText(&asmlist, "  setne al");
-            appendAsmInstAnyText(&asmlist, "  movzb rax, al");
-        } else if (n->kind == NodeLT) {
-            appendAsmInstAnyText(&asmlist, "  cmp rax, rdi");
-            appendAsmInstAnyText(&asmlist, "  setl al");
-            appendAsmInstAnyText(&asmlist, "  movzb rax, al");
-        } else if (n->kind == NodeLE) {
-            appendAsmInstAnyText(&asmlist, "  cmp rax, rdi");
-            appendAsmInstAnyText(&asmlist, "  setle al");
-            appendAsmInstAnyText(&asmlist, "  movzb rax, al");
+            return takeAsmInstList(&asmlist);
         } else if (n->kind == NodeBitwiseAND) {
-            appendAsmInstAnyText(&asmlist, "  and rax, rdi");
+            asmBinOp(AsmAnd, reg64op(RAX), reg64op(RDI));
         } else if (n->kind == NodeBitwiseOR) {
-            appendAsmInstAnyText(&asmlist, "  or rax, rdi");
+            asmBinOp(AsmOr, reg64op(RAX), reg64op(RDI));
         } else if (n->kind == NodeBitwiseXOR) {
-            appendAsmInstAnyText(&asmlist, "  xor rax, rdi");
+            asmBinOp(AsmXor, reg64op(RAX), reg64op(RDI));
         } else {
             errorUnreachable();
         }
@@ -1777,51 +3079,454 @@ AsmInst *genAsm(const Node *n) {
         asmPushRax();
     }
 
-    return getRawAsmInstList(&asmlist);
+    return takeAsmInstList(&asmlist);
 }
 
-/**
- * Optimize the given assembly instructions.
- * Returns TRUE if the given insturctions are modified.
- */
-void optimizeAsm(AsmInst *inst) {
-    int modified = 0;
-    AsmInst *top = inst;
-    for (; inst; inst = inst->next) {
-        switch (inst->kind) {
-        case AsmMov:
-            if (isEqualRegisterOperand(&inst->data.mov.src, &inst->data.mov.dst)) {
-                AsmInst *next = inst->next;
+// Return bit set of registers `op` refers.
+static int getOperandRegs(const AsmInstOperand *op) {
+    int regs = 0;
+    if (op->mode == AsmAddressingModeRegister) {
+        regs |= 1 << op->src.reg.kind;
+    } else if (op->mode == AsmAddressingModeMemory && op->src.mem.isRelative) {
+        regs |= 1 << op->src.mem.base.kind;
+        if (op->src.mem.hasIndex)
+            regs |= 1 << op->src.mem.index.kind;
+    }
+    return regs;
+}
 
-                *inst = *inst->next;
-                freeAsmInst(next);
+// Return bit set of registers which `inst` reads or writes.  All bits are set
+// for instructions which may break any register, like function calls.
+static int getTouchedRegs(const AsmInst *inst) {
+    switch (inst->kind) {
+    case AsmPush:
+        return getOperandRegs(&inst->data.push);
+    case AsmPop:
+        return 1 << inst->data.pop.kind;
+    case AsmMov:
+    case AsmAdd:
+    case AsmSub:
+    case AsmImul:
+    case AsmAnd:
+    case AsmOr:
+    case AsmXor:
+    case AsmSal:
+    case AsmSar:
+    case AsmCmp:
+    case AsmTest:
+    case AsmLea:
+    case AsmMovsx:
+    case AsmMovzx:
+    case AsmMovdqu:
+    case AsmPxor:
+        return getOperandRegs(&inst->data.binop.dst) |
+               getOperandRegs(&inst->data.binop.src);
+    case AsmIdiv:
+        return getOperandRegs(&inst->data.unary) | (1 << RAX) | (1 << RDX);
+    case AsmCqo:
+        return (1 << RAX) | (1 << RDX);
+    case AsmJmpIndirect:
+        return getOperandRegs(&inst->data.unary);
+    case AsmRepMovsq:
+    case AsmRepStosq:
+        return (1 << RAX) | (1 << RCX) | (1 << RSI) | (1 << RDI);
+    case AsmSetcc:
+        return 1 << inst->data.cond.reg.kind;
+    case AsmLabel:
+    case AsmJmp:
+    case AsmJcc:
+    case AsmStackAlign:
+    case AsmStackRestore:
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+// Finish live range `r`, and let the range enclosing it know registers used in
+// `r`.
+static void closeLiveRange(LiveRange *r) {
+    if (!r->outer)
+        return;
+    r->outer->touched |= r->touched | getTouchedRegs(r->push);
+    if (r->pop)
+        r->outer->touched |= getTouchedRegs(r->pop);
+}
+
+// Return TRUE if allocatableRegs[reg] can hold the value of `r`.  `reserved`
+// is bit set of registers which must not be used through the function.
+static int canHoldLiveRange(const LiveRange *r, int reg, int reserved) {
+    if (reg >= CALLER_SAVED_REGS_COUNT)
+        return 1;
+    return !((r->touched | reserved) & (1 << allocatableRegs[reg]));
+}
 
-                modified = 1;
+/**
+ * Move values passed via push/pop into registers instead of stack.  `inst`
+ * must be a body of a function.  Pushes and pops always pair in LIFO order in
+ * a function body, so live ranges are nested each other and the outermost one
+ * is spilled when registers run out.  Returns bit set of registers used.
+ */
+static int allocateRegisters(AsmInst *inst) {
+    LiveRange *ranges = NULL;
+    LiveRange *tail = NULL;
+    LiveRange *stack = NULL;
+    LiveRange *active[ALLOCATABLE_REGS_COUNT];
+    int reserved = 0; // Registers holding arguments of the function.
+    int usedRegs = 0;
+    int pos = 0;
+
+    for (int i = 0; i < dumpEnv.regArgsCount; ++i)
+        reserved |= 1 << dumpEnv.regArgHomes[i];
+
+    // Pair each push with the pop which takes its value.
+    for (; inst; inst = inst->next, ++pos) {
+        if (inst->kind == AsmPush) {
+            LiveRange *r = safeAlloc(sizeof(LiveRange));
+            r->push = inst;
+            r->start = pos;
+            r->reg = -1;
+            r->outer = stack;
+            stack = r;
+            if (tail)
+                tail->next = r;
+            else
+                ranges = r;
+            tail = r;
+        } else if (inst->kind == AsmPop) {
+            if (!stack)
+                errorUnreachable();
+            stack->pop = inst;
+            stack->end = pos;
+            closeLiveRange(stack);
+            stack = stack->outer;
+        } else if (inst->kind == AsmStackRestore) {
+            // Arguments passed on stack must be on stack.
+            for (int n = inst->data.stackAlign.argsSize / ONE_WORD_BYTES; n > 0; --n) {
+                if (!stack)
+                    errorUnreachable();
+                stack->pinned = 1;
+                closeLiveRange(stack);
+                stack = stack->outer;
             }
-            break;
-        case AsmPush:
-            if (inst->next && inst->next->kind == AsmPop) {
-                AsmInstOperand *src = &inst->data.push;
-                AsmInst *next = inst->next;
+        } else if (stack) {
+            stack->touched |= getTouchedRegs(inst);
+        }
+    }
 
-                inst->kind = AsmMov;
-                inst->data.mov.src = *src;
-                inst->data.mov.dst.mode = AsmAddressingModeRegister;
-                inst->data.mov.dst.src.reg = next->data.pop;
+    // Linear scan.
+    for (int i = 0; i < ALLOCATABLE_REGS_COUNT; ++i)
+        active[i] = NULL;
+    for (LiveRange *r = ranges; r; r = r->next) {
+        int victim = -1;
+        if (r->pinned || !r->pop)
+            continue;
+        for (int i = 0; i < ALLOCATABLE_REGS_COUNT; ++i)
+            if (active[i] && active[i]->end < r->start)
+                active[i] = NULL;
+        for (int i = 0; i < ALLOCATABLE_REGS_COUNT; ++i) {
+            if (!active[i] && canHoldLiveRange(r, i, reserved)) {
+                r->reg = i;
+                break;
+            }
+        }
+        if (r->reg < 0) {
+            // Every active range encloses `r`.  Spill the one ends last.
+            for (int i = 0; i < ALLOCATABLE_REGS_COUNT; ++i)
+                if (active[i] && canHoldLiveRange(r, i, reserved) &&
+                        (victim < 0 || active[i]->end > active[victim]->end))
+                    victim = i;
+            if (victim < 0)
+                continue;
+            active[victim]->reg = -1;
+            r->reg = victim;
+        }
+        active[r->reg] = r;
+    }
 
-                inst->next = next->next;
+    // Rewrite push/pop into mov.
+    while (ranges) {
+        LiveRange *r = ranges;
+        ranges = r->next;
+        if (r->reg >= 0) {
+            AsmInstDataBinOp mov;
+            Register reg = reg64obj(allocatableRegs[r->reg]);
+
+            mov.dst.mode = AsmAddressingModeRegister;
+            mov.dst.src.reg = reg;
+            mov.src = r->push->data.push;
+            r->push->kind = AsmMov;
+            r->push->data.binop = mov;
+
+            mov.dst.src.reg = r->pop->data.pop;
+            mov.src.mode = AsmAddressingModeRegister;
+            mov.src.src.reg = reg;
+            r->pop->kind = AsmMov;
+            r->pop->data.binop = mov;
+
+            usedRegs |= 1 << allocatableRegs[r->reg];
+        }
+        safeFree(r);
+    }
 
-                freeAsmInst(next);
+    return usedRegs;
+}
 
-                modified = 1;
-            }
+/**
+ * Fill paddings of AsmStackAlign so that RSP is aligned to 16 bytes at every
+ * function call.  This must be done after register allocation since it
+ * changes what values are on stack.
+ */
+static void alignStackForCalls(AsmInst *inst) {
+    int depth = 0; // Bytes pushed on stack since the head of function body.
+    for (; inst; inst = inst->next) {
+        switch (inst->kind) {
+        case AsmPush:
+            depth += ONE_WORD_BYTES;
+            break;
+        case AsmPop:
+            depth -= ONE_WORD_BYTES;
+            break;
+        case AsmStackAlign:
+            inst->data.stackAlign.padding = 0;
+            if ((depth + inst->data.stackAlign.argsSize) % 16)
+                inst->data.stackAlign.padding = ONE_WORD_BYTES;
+            depth += inst->data.stackAlign.padding;
+            break;
+        case AsmStackRestore:
+            depth -= inst->data.stackAlign.argsSize +
+                     inst->data.stackAlign.align->data.stackAlign.padding;
             break;
         default:
             break;
         }
     }
+}
+
+AsmInst *genAsm(const Node *n) { return releaseAsmInstList(genCodeNode(n)); }
 
-    if (modified) {
-        optimizeAsm(top);
+// Peephole optimization rules.  Each rule looks at `inst` and the instruction
+// following it, and returns TRUE when it rewrites them.  `prev` is the one
+// before `inst`, or NULL when `inst` is the first one; a rule must not remove
+// `inst` in that case.  A rule must not remove or overwrite instructions other
+// than `inst` and `inst->next`, and must make the list shorter or make
+// `inst` cheaper so that optimization always ends.
+typedef struct {
+    AsmInstKind kind;     // Kind of `inst`.
+    AsmInstKind nextKind; // Kind of `inst->next`, or AsmAnyKind.
+    int (*rewrite)(AsmInst *prev, AsmInst *inst);
+} PeepholeRule;
+
+// Return TRUE if `op` reads register `reg` when used as source operand.
+static int isOperandUsingReg(const AsmInstOperand *op, RegKind reg) {
+    if (op->mode == AsmAddressingModeRegister)
+        return op->src.reg.kind == reg;
+    else if (op->mode == AsmAddressingModeMemory)
+        return op->src.mem.isRelative &&
+               (op->src.mem.base.kind == reg ||
+                       (op->src.mem.hasIndex && op->src.mem.index.kind == reg));
+    return 0;
+}
+
+static int isOperandReg64(const AsmInstOperand *op) {
+    return op->mode == AsmAddressingModeRegister && op->src.reg.size == OpSize64;
+}
+
+// Remove `inst` from list.
+static void unlinkAsmInst(AsmInst *prev, AsmInst *inst) {
+    prev->next = inst->next;
+    freeAsmInst(inst);
+}
+
+// push X; pop R  =>  mov R, X
+static int peepholeFoldPushPop(AsmInst *prev, AsmInst *inst) {
+    AsmInst *next = inst->next;
+    AsmInstDataBinOp mov;
+
+    (void)prev; // Never removes `inst`.
+    mov.src = inst->data.push;
+    mov.dst.mode = AsmAddressingModeRegister;
+    mov.dst.src.reg = next->data.pop;
+    inst->kind = AsmMov;
+    inst->data.binop = mov;
+    unlinkAsmInst(inst, next);
+    return 1;
+}
+
+// mov R, R  =>  (removed)
+static int peepholeRemoveSelfMov(AsmInst *prev, AsmInst *inst) {
+    if (!prev || !isEqualRegisterOperand(&inst->data.binop.src, &inst->data.binop.dst))
+        return 0;
+    // "mov eax, eax" clears upper 32 bits of RAX.
+    if (inst->data.binop.dst.src.reg.size == OpSize32)
+        return 0;
+    unlinkAsmInst(prev, inst);
+    return 1;
+}
+
+// mov R, X; mov R, Y  =>  mov R, Y  (when Y doesn't use R)
+static int peepholeRemoveDeadMov(AsmInst *prev, AsmInst *inst) {
+    AsmInstDataBinOp *mov = &inst->data.binop;
+    AsmInstDataBinOp *nextMov = &inst->next->data.binop;
+
+    if (!prev || !isOperandReg64(&mov->dst) || !isOperandReg64(&nextMov->dst))
+        return 0;
+    if (mov->dst.src.reg.kind != nextMov->dst.src.reg.kind ||
+            isOperandUsingReg(&nextMov->src, mov->dst.src.reg.kind))
+        return 0;
+    unlinkAsmInst(prev, inst);
+    return 1;
+}
+
+// mov R1, R2; mov R2, R1  =>  mov R1, R2
+static int peepholeRemoveMovBack(AsmInst *prev, AsmInst *inst) {
+    AsmInstDataBinOp *mov = &inst->data.binop;
+    AsmInstDataBinOp *nextMov = &inst->next->data.binop;
+
+    (void)prev; // Never removes `inst`.
+    if (!isOperandReg64(&mov->dst) || !isOperandReg64(&mov->src))
+        return 0;
+    if (!isEqualRegisterOperand(&mov->dst, &nextMov->src) ||
+            !isEqualRegisterOperand(&mov->src, &nextMov->dst))
+        return 0;
+    unlinkAsmInst(inst, inst->next);
+    return 1;
+}
+
+// Rules below rewrite arithmetic instructions into ones which don't update
+// flags or remove them.  It's safe since generated code only refers flags set
+// by AsmCmp or AsmTest.
+
+// mov R, rbp; sub R, imm  =>  lea R, -imm[rbp]
+static int peepholeFoldFrameAddress(AsmInst *prev, AsmInst *inst) {
+    AsmInstDataBinOp *mov = &inst->data.binop;
+    AsmInstDataBinOp *sub = &inst->next->data.binop;
+    AsmInstOperand *lea = NULL;
+
+    (void)prev; // Never removes `inst`.
+    if (!isOperandReg64(&mov->dst) || !isOperandReg64(&mov->src) ||
+            mov->src.src.reg.kind != RBP)
+        return 0;
+    if (!isEqualRegisterOperand(&mov->dst, &sub->dst) ||
+            sub->src.mode != AsmAddressingModeImm || sub->src.src.imm.isLabel)
+        return 0;
+
+    lea = newOperandMem(OpSize64, RBP, -sub->src.src.imm.value);
+    inst->kind = AsmLea;
+    mov->src = *lea;
+    safeFree(lea);
+    unlinkAsmInst(inst, inst->next);
+    return 1;
+}
+
+// lea R, off[B]; add R, imm  =>  lea R, (off+imm)[B]
+static int peepholeFoldLeaAdd(AsmInst *prev, AsmInst *inst) {
+    AsmInstDataBinOp *lea = &inst->data.binop;
+    AsmInstDataBinOp *add = &inst->next->data.binop;
+
+    (void)prev; // Never removes `inst`.
+    if (!isOperandReg64(&lea->dst) || lea->src.src.mem.offset.isLabel)
+        return 0;
+    if (!isEqualRegisterOperand(&lea->dst, &add->dst) ||
+            add->src.mode != AsmAddressingModeImm || add->src.src.imm.isLabel)
+        return 0;
+
+    lea->src.src.mem.offset.value += add->src.src.imm.value;
+    unlinkAsmInst(inst, inst->next);
+    return 1;
+}
+
+// add R, 0  =>  (removed)
+static int peepholeRemoveAddZero(AsmInst *prev, AsmInst *inst) {
+    AsmInstOperand *src = &inst->data.binop.src;
+    if (!prev || inst->data.binop.dst.mode != AsmAddressingModeRegister ||
+            src->mode != AsmAddressingModeImm || src->src.imm.isLabel ||
+            src->src.imm.value != 0)
+        return 0;
+    // "add eax, 0" clears upper 32 bits of RAX.
+    if (inst->data.binop.dst.src.reg.size == OpSize32)
+        return 0;
+    unlinkAsmInst(prev, inst);
+    return 1;
+}
+
+// lea R, 0[R]  =>  (removed)
+static int peepholeRemoveSelfLea(AsmInst *prev, AsmInst *inst) {
+    AsmInstDataBinOp *lea = &inst->data.binop;
+    if (!prev || !isOperandReg64(&lea->dst) || lea->src.src.mem.offset.isLabel ||
+            lea->src.src.mem.offset.value != 0 || lea->src.src.mem.hasIndex ||
+            lea->src.src.mem.base.kind != lea->dst.src.reg.kind)
+        return 0;
+    unlinkAsmInst(prev, inst);
+    return 1;
+}
+
+// cmp R, 0  =>  test R, R
+static int peepholeCmpZeroToTest(AsmInst *prev, AsmInst *inst) {
+    AsmInstDataBinOp *cmp = &inst->data.binop;
+    (void)prev; // Never removes `inst`.
+    if (cmp->dst.mode != AsmAddressingModeRegister ||
+            cmp->src.mode != AsmAddressingModeImm || cmp->src.src.imm.isLabel ||
+            cmp->src.src.imm.value != 0)
+        return 0;
+    inst->kind = AsmTest;
+    cmp->src = cmp->dst;
+    return 1;
+}
+
+/**
+ * Apply peephole optimization rules to `inst` until no rule matches.  After
+ * a rewrite, only the instruction before the rewritten one is checked again
+ * since rules see just two instructions.  Returns how many times rules are
+ * applied.
+ */
+int optimizeAsm(AsmInst *inst) {
+    PeepholeRule rules[] = {
+        {AsmPush, AsmPop, peepholeFoldPushPop},
+        {AsmMov, AsmAnyKind, peepholeRemoveSelfMov},
+        {AsmMov, AsmMov, peepholeRemoveDeadMov},
+        {AsmMov, AsmMov, peepholeRemoveMovBack},
+        {AsmMov, AsmSub, peepholeFoldFrameAddress},
+        {AsmLea, AsmAdd, peepholeFoldLeaAdd},
+        {AsmAdd, AsmAnyKind, peepholeRemoveAddZero},
+        {AsmLea, AsmAnyKind, peepholeRemoveSelfLea},
+        {AsmCmp, AsmAnyKind, peepholeCmpZeroToTest},
+    };
+    int rulesCount = sizeof(rules) / sizeof(rules[0]);
+    AsmInst **visited = NULL; // Instructions before `inst`, for going back.
+    int depth = 0;
+    int count = 0;
+    int rewritten = 0;
+
+    for (AsmInst *i = inst; i; i = i->next)
+        ++depth;
+    visited = safeAlloc((depth + 1) * sizeof(AsmInst *));
+    depth = 0;
+
+    while (inst) {
+        AsmInst *prev = depth ? visited[depth - 1] : NULL;
+
+        rewritten = 0;
+        for (int i = 0; i < rulesCount && !rewritten; ++i) {
+            if (rules[i].kind != inst->kind)
+                continue;
+            if (rules[i].nextKind != AsmAnyKind &&
+                    !(inst->next && rules[i].nextKind == inst->next->kind))
+                continue;
+            rewritten = rules[i].rewrite(prev, inst);
+        }
+
+        if (rewritten) {
+            ++count;
+            // `inst` may be removed, so go back to the previous one.
+            if (depth)
+                inst = visited[--depth];
+        } else {
+            visited[depth++] = inst;
+            inst = inst->next;
+        }
     }
+
+    safeFree(visited);
+    return count;
 }
@@ -23,6 +23,8 @@ static const char *getRegName(const Register *r) {
         {"r13", "r13d", "r13w", "r13b"},
         {"r14", "r14d", "r14w", "r14b"},
         {"r15", "r15d", "r15w", "r15b"},
+        {"xmm0", "xmm0", "xmm0", "xmm0"},
+        {"rip", "eip",  "ip",   "ip"},
     };
     // clang-format on
 
@@ -38,6 +40,7 @@ static const char *getRegName(const Register *r) {
         index = 1;
         break;
     case OpSize64:
+    case OpSize128:
         index = 0;
         break;
     default:
@@ -56,7 +59,7 @@ static char *stringifyOperand(const AsmInstOperand *operand) {
         return format("%s", getRegName(&operand->src.reg));
     case AsmAddressingModeImm:
         if (operand->src.imm.isLabel) {
-            return format(".%s", operand->src.imm.label);
+            return format("%s", operand->src.imm.label);
         } else {
             return format("%d", operand->src.imm.value);
         }
@@ -91,11 +94,26 @@ static char *stringifyOperand(const AsmInstOperand *operand) {
             case OpSize64:
                 size = "QWORD";
                 break;
+            case OpSize128:
+                size = "XMMWORD";
+                break;
             }
             if (size == NULL)
                 errorUnreachable();
 
-            retval = format("%s PTR %s[%s]", size, offset, base);
+            if (mem->hasIndex) {
+                AsmInstOperand opindex;
+                char *index = NULL;
+
+                opindex.mode = AsmAddressingModeRegister;
+                opindex.src.reg = mem->index;
+                index = stringifyOperand(&opindex);
+                retval = format(
+                        "%s PTR %s[%s+%s*%d]", size, offset, base, index, mem->scale);
+                safeFree(index);
+            } else {
+                retval = format("%s PTR %s[%s]", size, offset, base);
+            }
         } else {
             retval = format("%s", offset);
         }
@@ -108,6 +126,87 @@ static char *stringifyOperand(const AsmInstOperand *operand) {
     errorUnreachable();
 }
 
+// Get mnemonic of instruction taking zero, one or two operands.
+static const char *getMnemonic(AsmInstKind kind) {
+    switch (kind) {
+    case AsmMov:
+        return "mov";
+    case AsmAdd:
+        return "add";
+    case AsmSub:
+        return "sub";
+    case AsmImul:
+        return "imul";
+    case AsmAnd:
+        return "and";
+    case AsmOr:
+        return "or";
+    case AsmXor:
+        return "xor";
+    case AsmSal:
+        return "sal";
+    case AsmSar:
+        return "sar";
+    case AsmCmp:
+        return "cmp";
+    case AsmTest:
+        return "test";
+    case AsmLea:
+        return "lea";
+    case AsmMovsx:
+        return "movsx";
+    case AsmMovzx:
+        return "movzx";
+    case AsmIdiv:
+        return "idiv";
+    case AsmCall:
+        return "call";
+    case AsmJmpIndirect:
+        return "jmp";
+    case AsmCqo:
+        return "cqo";
+    case AsmMovdqu:
+        return "movdqu";
+    case AsmPxor:
+        return "pxor";
+    case AsmRepMovsq:
+        return "rep movsq";
+    case AsmRepStosq:
+        return "rep stosq";
+    case AsmRet:
+        return "ret";
+    default:
+        errorUnreachable();
+    }
+}
+
+// Get suffix of jcc and setcc instructions for given condition.
+static const char *getCondSuffix(AsmCondKind cond) {
+    switch (cond) {
+    case AsmCondE:
+        return "e";
+    case AsmCondNE:
+        return "ne";
+    case AsmCondL:
+        return "l";
+    case AsmCondLE:
+        return "le";
+    case AsmCondG:
+        return "g";
+    case AsmCondGE:
+        return "ge";
+    case AsmCondB:
+        return "b";
+    case AsmCondBE:
+        return "be";
+    case AsmCondA:
+        return "a";
+    case AsmCondAE:
+        return "ae";
+    }
+    errorUnreachable();
+}
+
 static void genCodeOne(const AsmInst *inst) {
     switch (inst->kind) {
     case AsmAnyText:
@@ -123,17 +222,72 @@ static void genCodeOne(const AsmInst *inst) {
         dumpf("  pop %s\n", getRegName(&inst->data.pop));
         break;
     case AsmLabel:
-        todo();
+        dumpf("%s:\n", inst->text);
         break;
-    case AsmMov: {
+    case AsmMov:
+    case AsmAdd:
+    case AsmSub:
+    case AsmImul:
+    case AsmAnd:
+    case AsmOr:
+    case AsmXor:
+    case AsmSal:
+    case AsmSar:
+    case AsmCmp:
+    case AsmTest:
+    case AsmLea:
+    case AsmMovsx:
+    case AsmMovzx:
+    case AsmMovdqu:
+    case AsmPxor: {
         char *src, *dst;
-        src = stringifyOperand(&inst->data.mov.src);
-        dst = stringifyOperand(&inst->data.mov.dst);
-        dumpf("  mov %s, %s\n", dst, src);
+        src = stringifyOperand(&inst->data.binop.src);
+        dst = stringifyOperand(&inst->data.binop.dst);
+        dumpf("  %s %s, %s\n", getMnemonic(inst->kind), dst, src);
         safeFree(src);
         safeFree(dst);
         break;
     }
+    case AsmIdiv:
+    case AsmCall:
+    case AsmJmpIndirect: {
+        char *op = stringifyOperand(&inst->data.unary);
+        dumpf("  %s %s\n", getMnemonic(inst->kind), op);
+        safeFree(op);
+        break;
+    }
+    case AsmCqo:
+    case AsmRepMovsq:
+    case AsmRepStosq:
+    case AsmRet:
+        dumpf("  %s\n", getMnemonic(inst->kind));
+        break;
+    case AsmJmp:
+        dumpf("  jmp %s\n", inst->text);
+        break;
+    case AsmJcc:
+        dumpf("  j%s %s\n", getCondSuffix(inst->data.cond.cond), inst->text);
+        break;
+    case AsmSetcc:
+        dumpf("  set%s %s\n", getCondSuffix(inst->data.cond.cond),
+                getRegName(&inst->data.cond.reg));
+        break;
+    case AsmStackAlign:
+        if (inst->data.stackAlign.padding)
+            dumpf("  sub rsp, %d /* RSP alignment */\n", inst->data.stackAlign.padding);
+        break;
+    case AsmStackRestore: {
+        int size = inst->data.stackAlign.argsSize +
+                   inst->data.stackAlign.align->data.stackAlign.padding;
+        if (size)
+            dumpf("  add rsp, %d\n", size);
+        break;
+    }
+    case AsmEpilogue:
+        // Must be expanded by genCodeFunction().
+        errorUnreachable();
+    case AsmAnyKind:
+        errorUnreachable();
     }
 }
 
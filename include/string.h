@@ -5,6 +5,7 @@
 
 int memcmp(const void *s1, const void *s2, size_t size);
 void *memcpy(void *s1, const void *s2, size_t size);
+void *memmove(void *s1, const void *s2, size_t size);
 void *memset(void *s, int c, size_t size);
 char *strchr(const char *s, int c);
 char *strstr(const char *s1, const char *s2);
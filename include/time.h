@@ -0,0 +1,10 @@
+#ifndef __MIMICC_TIME_H
+#define __MIMICC_TIME_H
+
+#define CLOCKS_PER_SEC 1000000
+
+typedef int clock_t;
+
+clock_t clock(void);
+
+#endif
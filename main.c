@@ -4,6 +4,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#define BENCH_TOKENIZE_ROUNDS (10)
 
 struct Types Types;
 Globals globals;
@@ -70,6 +73,8 @@ void error(const char *fmt, ...) {
 _Noreturn void errorAt(Token *loc, const char *fmt, ...) {
     char *head = NULL; // Head of error line
     char *tail = NULL; // Tail of error line
+    FilePath *file = NULL;
+    int column = 0;
     int indent = 0;
     va_list ap;
 
@@ -84,16 +89,18 @@ _Noreturn void errorAt(Token *loc, const char *fmt, ...) {
 
     va_start(ap, fmt);
 
-    head = (char *)(loc->str - loc->column);
-    tail = loc->str;
-    while (*tail != '\n')
+    file = tokenFile(loc);
+    column = tokenColumn(loc);
+    head = file->source + (loc->offset - file->base) - column;
+    tail = head;
+    while (*tail && *tail != '\n')
         tail++;
 
-    indent = fprintf(stderr, "%s:%d: ", loc->file->display, loc->line);
+    indent = fprintf(stderr, "%s:%d: ", file->display, tokenLine(loc));
     fprintf(stderr, "%.*s\n", (int)(tail - head), head);
 
-    if (loc->column + indent) {
-        fprintf(stderr, "%*s", loc->column + indent, " ");
+    if (column + indent) {
+        fprintf(stderr, "%*s", column + indent, " ");
     }
     fprintf(stderr, "^ ");
     vfprintf(stderr, fmt, ap);
@@ -177,7 +184,9 @@ char *readFile(const char *path) {
         error("%s: fseek: %s\n", path, strerror(errno));
     }
 
-    buf = (char *)safeAlloc((size + 2) * sizeof(char));
+    // The tokenizer may read a few bytes past the NUL at once, so keep zeros
+    // there.
+    buf = (char *)safeAlloc((size + 2 + SOURCE_PADDING_BYTES) * sizeof(char));
     fread(buf, size, 1, fp);
     fclose(fp);
 
@@ -198,10 +207,40 @@ _Noreturn void cmdlineArgsError(int argc, char *argv[], int at, const char *msg)
     exit(1);
 }
 
+// Tokenize file `path` some times and report the throughput of tokenizer.
+static void benchmarkTokenize(const char *path) {
+    char *source = readFile(path);
+    int size = strlen(source);
+    char *buf = (char *)safeAlloc(size + 1 + SOURCE_PADDING_BYTES);
+    FilePath *file = analyzeFilepath(path, path);
+    int tokenCount = 0;
+    int usec = 0;
+    clock_t start;
+
+    start = clock();
+    for (int i = 0; i < BENCH_TOKENIZE_ROUNDS; ++i) {
+        memcpy(buf, source, size + 1);
+        tokenCount = 0;
+        for (Token *t = tokenize(buf, file); t; t = t->next)
+            tokenCount++;
+    }
+    usec = (clock() - start) / (CLOCKS_PER_SEC / 1000000);
+    if (usec == 0)
+        usec = 1;
+
+    printf("%s: %d bytes, %d tokens, %d us/round, %d MB/s (%s)\n", path, size,
+            tokenCount, usec / BENCH_TOKENIZE_ROUNDS,
+            size * BENCH_TOKENIZE_ROUNDS / usec, globals.fastLexing ? "fast" : "scalar");
+}
+
 int main(int argc, char *argv[]) {
     char *inFile = NULL;
     char *outFile = NULL;
     char *source = NULL;
+    int inlineLimit = INLINE_LIMIT_DEFAULT;
+    int tailCalls = 1;
+    int fastLexing = 0;
+    int benchTokenize = 0;
     AsmInst *asmcode, *asmglobals;
 
     for (int i = 1; i < argc; ++i) {
@@ -211,6 +250,20 @@ int main(int argc, char *argv[]) {
             outFile = argv[i];
         } else if (strcmp(argv[i], "-S") == 0) {
             // Just ignore
+        } else if (strcmp(argv[i], "-fno-inline") == 0) {
+            inlineLimit = 0;
+        } else if (strncmp(argv[i], "-finline-limit=", 15) == 0) {
+            inlineLimit = strtol(&argv[i][15], NULL, 10);
+        } else if (strcmp(argv[i], "-foptimize-sibling-calls") == 0) {
+            tailCalls = 1;
+        } else if (strcmp(argv[i], "-fno-optimize-sibling-calls") == 0) {
+            tailCalls = 0;
+        } else if (strcmp(argv[i], "-ffast-lex") == 0) {
+            fastLexing = 1;
+        } else if (strcmp(argv[i], "-fno-fast-lex") == 0) {
+            fastLexing = 0;
+        } else if (strcmp(argv[i], "--bench-tokenize") == 0) {
+            benchTokenize = 1;
         } else if (!inFile) {
             inFile = argv[i];
         } else {
@@ -220,7 +273,7 @@ int main(int argc, char *argv[]) {
 
     if (!inFile)
         cmdlineArgsError(argc, argv, argc, "No input file is specified");
-    else if (!outFile)
+    else if (!outFile && !benchTokenize)
         cmdlineArgsError(argc, argv, argc, "No output file is specified");
 
 #define PrimitiveType(type) (TypeInfo){NULL, type}
@@ -233,20 +286,30 @@ int main(int argc, char *argv[]) {
 
     memset(&globals, 0, sizeof(globals));
     globals.currentEnv = &globals.globalEnv;
+    globals.inlineLimit = inlineLimit;
+    globals.tailCalls = tailCalls;
+    globals.fastLexing = fastLexing;
     globals.ccFile = analyzeFilepath(argv[0], argv[0]);
 
     globals.includePath = (char *)safeAlloc(strlen(globals.ccFile->dirname) + 9);
     sprintf(globals.includePath, "%sinclude/", globals.ccFile->dirname);
 
+    if (benchTokenize) {
+        benchmarkTokenize(inFile);
+        return 0;
+    }
+
     source = readFile(inFile);
     globals.token = tokenize(source, analyzeFilepath(inFile, inFile));
     preprocess(globals.token);
-    removeAllNewLineToken(globals.token);
     program();
 
     verifyType(globals.code);
     verifyFlow(globals.code);
 
+    inlineFunctions(globals.code);
+    foldConstants(globals.code);
+
     globals.destFile = fopen(outFile, "wb");
     if (!globals.destFile)
         error("Failed to open file: %s", outFile);
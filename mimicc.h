@@ -8,6 +8,8 @@
 
 #define REG_ARGS_MAX_COUNT (6)
 #define ONE_WORD_BYTES (8)
+#define INLINE_LIMIT_DEFAULT (24)
+#define SOURCE_PADDING_BYTES (16)
 #define errorUnreachable() error("%s:%d: Internal error: unreachable", __FILE__, __LINE__)
 #define runtimeAssert(expr)                                                              \
     do {                                                                                 \
@@ -75,6 +77,7 @@ typedef enum {
     TokenStatic,
     TokenExtern,
     TokenTypedef,
+    TokenInline,
     TokenIf,
     TokenElseif,
     TokenElse,
@@ -92,29 +95,68 @@ typedef enum {
     TokenStruct,
     TokenUnion,
     TokenEnum,
-    TokenNewLine,
     TokenSOF, // Start of file.
     TokenEOF, // End of file.
 } TokenType;
 
+// Interned spelling of identifiers and keywords.  There's only one atom for
+// each spelling, so names can be compared by pointer.
+typedef struct Atom Atom;
+struct Atom {
+    Atom *next; // Next atom in the same hash bucket.
+    const char *str;
+    int len;
+    int id;            // Serial number of this atom.
+    int isMacro;       // TRUE while a macro of this name is defined.
+    TokenType keyword; // Token type for this spelling; TokenIdent if not keyword.
+    TypeKind varType;  // Type when this is a type name keyword.
+    int isIgnored;     // TRUE for keywords which are just skipped now.
+};
+
+// Members are ordered so that no padding is needed between them.
 struct Token {
-    TokenType type;
     Token *prev;
     Token *next;
-    int val;                   // Number valid when type is TokenNumber.
-    TypeKind varType;          // Variable type valid when type is TokenTypeName.
-    LiteralString *literalStr; // Reference to literal string when type is
-                               // TokenLiteralString.
-    FilePath *file;            // File path information
-    char *str;                 // The token string.
-    int len;                   // The token length.
-    int line;                  // Line number in file.
-    int column;                // Column number in line.
+    char *str; // The token string.
+    union {
+        int val;                   // TokenNumber
+        LiteralString *literalStr; // TokenLiteralString
+        Atom *atom;                // Identifiers and keywords.  Type of
+                                   // TokenTypeName is in "atom->varType".
+    } data;
+    TokenType type;
+    int len;         // The token length.
+    int offset;      // Position of the token; see tokenFile().  Tokens made by
+                     // macro expansion take the position of the macro.
+    int atLineStart; // TRUE if this is the first token of a line.
+};
+
+typedef enum {
+    SymbolVar,
+    SymbolStruct,
+    SymbolUnion,
+    SymbolEnum,
+    SymbolEnumItem,
+    SymbolTypedef,
+    SymbolFunction,
+    SymbolGlobalVar,
+} SymbolKind;
+
+// An entry of the parser's symbol table.
+typedef struct Symbol Symbol;
+struct Symbol {
+    Symbol *next;    // Next symbol in the same hash bucket.
+    Symbol *envNext; // Next symbol declared in the same env.
+    SymbolKind kind;
+    int hash;
+    Atom *name;
+    void *entity; // Obj, StructOrUnion, Enum, EnumItem, Typedef or GVar.
 };
 
 typedef struct Env Env;
 struct Env {
     Env *outer;
+    Symbol *symbols; // Symbols declared in this env, newest first.
     StructOrUnion *structs;
     StructOrUnion *unions;
     Enum *enums;
@@ -232,6 +274,7 @@ struct ObjAttr {
     int isStatic;
     int isExtern;
     int isTypedef;
+    int isInline;
 };
 
 // Struct for objects; variables and functions.
@@ -243,6 +286,7 @@ struct Obj {
                      // as RBP - offset.
     int isExtern;    // TRUE if object is declared with "extern".
     int isStatic;    // TRUE if object is declared with "static".
+    int isInline;    // TRUE if function is declared with "inline".
     int staticVarID; // ID for static local variables.
     Function *func;  // Valid when object holds function.
 };
@@ -307,10 +351,16 @@ struct Typedef {
 
 struct FilePath {
     char *basename;
-    char *dirname; // Parent directory name with '/' at the end.
+    char *dirname;        // Parent directory name with '/' at the end.
     char *path;
-    char *display; // File path for display (error message, __FILE__ macro,
-                   // etc.)
+    char *display;        // File path for display (error message, __FILE__
+                          // macro, etc.)
+    char *source;         // Source text which tokens of this file are made from.
+    int base;             // Offset of "source" among all the sources tokenized.
+    FilePath *prevSource; // File tokenized before this one.
+    int *lineHeads;       // Offsets where each line begins in "source".  Built
+                          // when a line number is required for the first time.
+    int lineCount;        // Number of entries in "lineHeads".
 };
 
 typedef struct Globals Globals;
@@ -334,6 +384,11 @@ struct Globals {
     FILE *destFile;           // The output file.
     FilePath *ccFile;         // The binary file path infomation.
     char *includePath;        // The include path.
+    int inlineLimit;          // Max size of function bodies to inline.  0
+                              // disables inlining.
+    int tailCalls;            // TRUE if calls in tail position jump to the
+                              // callee reusing the caller's frame.
+    int fastLexing;           // TRUE if the tokenizer uses its SIMD fast paths.
 };
 extern Globals globals;
 
@@ -354,6 +409,8 @@ typedef enum {
     R13,
     R14,
     R15,
+    XMM0,
+    RIP,
     RegCount,
 } RegKind;
 
@@ -362,6 +419,7 @@ typedef enum {
     OpSize16,
     OpSize32,
     OpSize64,
+    OpSize128, // Only for XMM registers.
 } OperandSize;
 
 typedef struct Register Register;
@@ -376,8 +434,51 @@ typedef enum {
     AsmPop,
     AsmMov,
     AsmLabel,
+    AsmStackAlign,   // Align RSP before pushing arguments of a function call.
+    AsmStackRestore, // Release stack used by a function call.
+    AsmEpilogue,     // Tear down the frame before a tail call.
+    AsmAdd,
+    AsmSub,
+    AsmImul,
+    AsmAnd,
+    AsmOr,
+    AsmXor,
+    AsmSal,
+    AsmSar,
+    AsmCmp,
+    AsmTest,
+    AsmLea,
+    AsmMovsx,
+    AsmMovzx,
+    AsmIdiv,
+    AsmCall,
+    AsmJmpIndirect,
+    AsmCqo,
+    AsmMovdqu,
+    AsmPxor,
+    AsmRepMovsq,
+    AsmRepStosq,
+    AsmRet,
+    AsmJmp,
+    AsmJcc,
+    AsmSetcc,
+    AsmAnyKind, // Matches any kind in peephole rules.  Never emitted.
 } AsmInstKind;
 
+// Condition of AsmJcc and AsmSetcc.
+typedef enum {
+    AsmCondE,
+    AsmCondNE,
+    AsmCondL,
+    AsmCondLE,
+    AsmCondG,
+    AsmCondGE,
+    AsmCondB, // Unsigned comparisons.
+    AsmCondBE,
+    AsmCondA,
+    AsmCondAE,
+} AsmCondKind;
+
 typedef enum {
     AsmAddressingModeRegister,
     AsmAddressingModeImm,
@@ -394,6 +495,9 @@ typedef struct {
     int isRelative;   // Specify whether addressing mode is relative or absolute.
     OperandSize size; // How many bytes to use as this operand.
     Register base;    // Valid only when `isRelative` is TRUE.
+    int hasIndex;     // TRUE if `index` is added to `base`.
+    Register index;   // Valid only when `hasIndex` is TRUE.
+    int scale;        // Multiplier of `index`, 1, 2, 4 or 8.
     AsmInstImmValue offset;
 } AsmInstOperandMem;
 
@@ -406,24 +510,39 @@ typedef struct {
     } src;
 } AsmInstOperand;
 
-// TODO: Support these:
-// - Use memory address as `dst` and `src`
-// - Use immediate value as `src`
+// Operands of instructions taking two operands like AsmMov, AsmAdd, etc.
 typedef struct {
     AsmInstOperand dst;
     AsmInstOperand src;
-} AsmInstDataMov;
+} AsmInstDataBinOp;
+
+typedef struct {
+    AsmCondKind cond;
+    Register reg; // Target register.  Valid in AsmSetcc.
+} AsmInstDataCond;
 
 typedef struct AsmInst AsmInst;
+
+// Padding to align RSP is unknown until register allocation determines which
+// values stay on stack, so it's filled later by the allocator.
+typedef struct {
+    int argsSize;   // Bytes of arguments passed on stack.
+    int padding;    // Bytes of padding for alignment.  Valid in AsmStackAlign.
+    AsmInst *align; // AsmStackAlign paired with this.  Valid in AsmStackRestore.
+} AsmInstStackAlign;
+
 struct AsmInst {
     AsmInst *next;
     AsmInstKind kind;
 
-    char *text; //  AsmAnyText, AsmLabel, etc.
+    char *text; //  AsmAnyText, AsmLabel, AsmJmp, AsmJcc
     union {
-        Register pop;        // Target register of AsmPop.
-        AsmInstOperand push; // AsmPush
-        AsmInstDataMov mov;  // AsmMov
+        Register pop;                 // Target register of AsmPop.
+        AsmInstOperand push;          // AsmPush
+        AsmInstOperand unary;         // AsmIdiv, AsmCall, AsmJmpIndirect
+        AsmInstDataBinOp binop;       // AsmMov, AsmAdd, ..., AsmMovzx, AsmMovdqu, AsmPxor
+        AsmInstDataCond cond;         // AsmJcc, AsmSetcc
+        AsmInstStackAlign stackAlign; // AsmStackAlign, AsmStackRestore
     } data;
 };
 
@@ -442,7 +561,7 @@ char *readFile(const char *path);
 // asm.c
 AsmInst *genAsm(const Node *n);
 AsmInst *genAsmGlobals(void);
-void optimizeAsm(AsmInst *inst);
+int optimizeAsm(AsmInst *inst);
 
 // codegen.c
 void genCode(const AsmInst *inst);
@@ -450,8 +569,13 @@ void genCode(const AsmInst *inst);
 // tokenizer.c
 int isSpace(char c);
 int checkEscapeChar(char c, char *decoded);
+Atom *internAtom(const char *str, int len);
+Token *newToken(void);
+Atom *tokenAtom(const Token *token);
+FilePath *tokenFile(const Token *token);
+int tokenLine(const Token *token);
+int tokenColumn(const Token *token);
 void popTokenRange(Token *begin, Token *end);
-void removeAllNewLineToken(Token *token);
 void printToken(Token *token);
 void printTokenList(Token *token);
 Token *tokenize(char *source, FilePath *file);
@@ -461,10 +585,10 @@ void preprocess(Token *token);
 
 // parser.c
 void program(void);
-Obj *findFunction(const char *name, int len);
-Obj *findStructOrUnionMember(const StructOrUnion *s, const char *name, int len);
-GVar *findGlobalVar(char *name, int len);
-Obj *findLVar(char *name, int len);
+Obj *findFunction(const Atom *name);
+Obj *findStructOrUnionMember(const StructOrUnion *s, const Atom *name);
+GVar *findGlobalVar(const Atom *name);
+Obj *findLVar(const Atom *name);
 int sizeOf(const TypeInfo *ti);
 int matchToken(const Token *token, const char *name, const int len);
 Node *evalConstantExpr(Node *n);
@@ -477,4 +601,8 @@ int checkAssignable(const TypeInfo *lhs, const TypeInfo *rhs);
 int isLvalue(const Node *n);
 int isWorkLikePointer(const TypeInfo *t);
 const TypeInfo *getBaseType(const TypeInfo *t);
+
+// optimizer.c
+void inlineFunctions(Node *n);
+void foldConstants(Node *n);
 #endif // HEADER_MIMICC_H
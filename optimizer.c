@@ -0,0 +1,727 @@
+#include "mimicc.h"
+#include <stddef.h>
+#include <string.h>
+
+static void foldConstantsNode(Node *n);
+
+static void foldConstantsList(Node *n) {
+    for (; n; n = n->next)
+        foldConstantsNode(n);
+}
+
+// Return TRUE if `n` is an integer constant.
+static int isConstNode(const Node *n) { return n && n->kind == NodeNum; }
+
+// Return TRUE if given type is arithmetic type.
+static int isArithmeticType(const TypeInfo *t) {
+    return t->type == TypeChar || t->type == TypeInt || t->type == TypeNumber ||
+           t->type == TypeEnum;
+}
+
+// Return TRUE if "case" or "default" label of an outer switch statement
+// appears in `n` or in nodes following `n`.  Such code can be reached by
+// jumping into it, so it must not be removed even if it looks dead.
+static int hasSwitchCase(const Node *n) {
+    for (; n; n = n->next) {
+        if (n->kind == NodeSwitchCase)
+            return 1;
+        else if (n->kind == NodeSwitch)
+            continue; // Labels inside belong to this switch.
+        if (hasSwitchCase(n->lhs) || hasSwitchCase(n->rhs) ||
+                hasSwitchCase(n->condition) || hasSwitchCase(n->body) ||
+                hasSwitchCase(n->elseblock) || hasSwitchCase(n->initializer) ||
+                hasSwitchCase(n->iterator))
+            return 1;
+    }
+    return 0;
+}
+
+// Turn `n` into NodeNum holding `val`.  The type of `n` is kept, and `val` is
+// truncated to fit it.
+static void replaceWithNum(Node *n, int val) {
+    if (sizeOf(n->type) == 1)
+        val = (char)val;
+    n->kind = NodeNum;
+    n->val = val;
+    n->lhs = NULL;
+    n->rhs = NULL;
+    n->condition = NULL;
+}
+
+// Replace `n` with `with` in place so that `n` stays linked from its parent
+// and list.  When `with` is NULL, `n` becomes a no-op statement.
+static void replaceNode(Node *n, Node *with) {
+    Node *next = n->next;
+    if (with) {
+        *n = *with;
+    } else {
+        Token *token = n->token;
+        memset(n, 0, sizeof(Node));
+        n->kind = NodeNop;
+        n->type = &Types.None;
+        n->token = token;
+    }
+    n->next = next;
+}
+
+// Compute "lhs op rhs" into `result`.  Returns FALSE when the result is not
+// computable at compile time, e.g. division by zero.
+static int evalBinaryOperator(NodeKind kind, int lhs, int rhs, int *result) {
+    switch (kind) {
+    case NodeBitwiseXOR:
+        *result = lhs ^ rhs;
+        return 1;
+    case NodeBitwiseOR:
+        *result = lhs | rhs;
+        return 1;
+    case NodeBitwiseAND:
+        *result = lhs & rhs;
+        return 1;
+    case NodeEq:
+        *result = lhs == rhs;
+        return 1;
+    case NodeNeq:
+        *result = lhs != rhs;
+        return 1;
+    case NodeLT:
+        *result = lhs < rhs;
+        return 1;
+    case NodeLE:
+        *result = lhs <= rhs;
+        return 1;
+    case NodeArithShiftL:
+        if (rhs < 0 || rhs >= 32)
+            return 0;
+        *result = lhs << rhs;
+        return 1;
+    case NodeArithShiftR:
+        if (rhs < 0 || rhs >= 32)
+            return 0;
+        *result = lhs >> rhs;
+        return 1;
+    case NodeAdd:
+        *result = lhs + rhs;
+        return 1;
+    case NodeSub:
+        *result = lhs - rhs;
+        return 1;
+    case NodeMul:
+        *result = lhs * rhs;
+        return 1;
+    case NodeDiv:
+    case NodeDivRem:
+        // Leave division by zero and overflow to runtime.
+        if (rhs == 0 || rhs == -1)
+            return 0;
+        *result = kind == NodeDiv ? lhs / rhs : lhs % rhs;
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Fold if statement whose condition is constant into the taken branch.
+static void foldConstantsIf(Node *n) {
+    Node head;
+    Node *prev = &head;
+
+    // Drop "else if" branches never taken, and make a branch always taken the
+    // last "else".
+    head.next = n->elseblock;
+    while (prev->next) {
+        Node *e = prev->next;
+        if (e->kind != NodeElseif || !isConstNode(e->condition)) {
+            prev = e;
+        } else if (e->condition->val) {
+            if (hasSwitchCase(e->next))
+                break;
+            e->kind = NodeElse;
+            e->condition = NULL;
+            e->next = NULL;
+        } else if (hasSwitchCase(e->body)) {
+            prev = e;
+        } else {
+            prev->next = e->next;
+        }
+    }
+    n->elseblock = head.next;
+
+    while (n->kind == NodeIf && isConstNode(n->condition)) {
+        Node *e = n->elseblock;
+        if (n->condition->val) {
+            if (hasSwitchCase(e))
+                return;
+            replaceNode(n, n->body);
+        } else {
+            if (hasSwitchCase(n->body))
+                return;
+            if (!e) {
+                replaceNode(n, NULL);
+            } else if (e->kind == NodeElse) {
+                replaceNode(n, e->body);
+            } else {
+                n->condition = e->condition;
+                n->body = e->body;
+                n->elseblock = e->next;
+            }
+        }
+    }
+}
+
+static void foldConstantsNode(Node *n) {
+    if (!n)
+        return;
+
+    foldConstantsList(n->lhs);
+    foldConstantsList(n->rhs);
+    foldConstantsList(n->condition);
+    foldConstantsList(n->body);
+    foldConstantsList(n->elseblock);
+    foldConstantsList(n->initializer);
+    foldConstantsList(n->iterator);
+    if (n->kind == NodeFCall)
+        foldConstantsList(n->fcall->args);
+
+    switch (n->kind) {
+    case NodeIf:
+        foldConstantsIf(n);
+        break;
+    case NodeConditional:
+        if (isConstNode(n->condition)) {
+            // Type of conditional operator is the one of lhs, so rhs can be
+            // substituted only when it has the same value representation.
+            Node *taken = n->condition->val ? n->lhs : n->rhs;
+            if (taken->type == n->type ||
+                    (isArithmeticType(taken->type) && isArithmeticType(n->type) &&
+                            sizeOf(taken->type) == sizeOf(n->type)))
+                replaceNode(n, taken);
+        }
+        break;
+    case NodeFor:
+        // The body of a loop whose condition is false from the first is never
+        // executed.
+        if (isConstNode(n->condition) && !n->condition->val &&
+                !hasSwitchCase(n->body)) {
+            n->body = NULL;
+            n->iterator = NULL;
+        }
+        break;
+    case NodeLogicalAND:
+    case NodeLogicalOR:
+        if (isConstNode(n->lhs)) {
+            int isAND = n->kind == NodeLogicalAND;
+            if ((n->lhs->val != 0) != isAND)
+                replaceWithNum(n, !isAND);
+            else if (isConstNode(n->rhs))
+                replaceWithNum(n, n->rhs->val != 0);
+        }
+        break;
+    case NodeNot:
+        if (isConstNode(n->rhs))
+            replaceWithNum(n, !n->rhs->val);
+        break;
+    case NodeTypeCast:
+        if (isConstNode(n->rhs) && isArithmeticType(n->type) &&
+                isArithmeticType(n->rhs->type))
+            replaceWithNum(n, n->rhs->val);
+        break;
+    case NodeBitwiseXOR:
+    case NodeBitwiseOR:
+    case NodeBitwiseAND:
+    case NodeEq:
+    case NodeNeq:
+    case NodeLT:
+    case NodeLE:
+    case NodeArithShiftL:
+    case NodeArithShiftR:
+    case NodeAdd:
+    case NodeSub:
+    case NodeMul:
+    case NodeDiv:
+    case NodeDivRem: {
+        int result;
+        if (!isConstNode(n->lhs) || !isConstNode(n->rhs))
+            break;
+        if (!isArithmeticType(n->type) || !isArithmeticType(n->lhs->type) ||
+                !isArithmeticType(n->rhs->type))
+            break;
+        if (evalBinaryOperator(n->kind, n->lhs->val, n->rhs->val, &result))
+            replaceWithNum(n, result);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * Collapse constant subtrees in the program `n` into NodeNum, and remove
+ * branches of if statements and conditional operators never taken.  Must be
+ * called after type verification since types of nodes are referred.
+ */
+void foldConstants(Node *n) { foldConstantsList(n); }
+
+// Calls nested deeper than this in inlined bodies are left as calls.  This
+// also stops expanding recursive functions.
+#define INLINE_DEPTH_MAX (4)
+
+// Argument of an inlined call.  References to `param` are replaced with
+// `value` if given, otherwise with `temp` holding the argument.  Local
+// variables of inlined bodies are replaced in the same way.
+typedef struct InlineArg InlineArg;
+struct InlineArg {
+    InlineArg *next;
+    Obj *param;
+    Obj *temp;
+    Node *value;
+};
+
+// Function whose calls are replaced with its body.
+typedef struct InlineCandidate InlineCandidate;
+struct InlineCandidate {
+    InlineCandidate *next;
+    Obj *func;         // Function object which call sites refer.
+    Obj *args;         // Arguments of the function definition.
+    InlineArg *locals; // Local variables of the body.  Each expansion gives
+                       // them new temporaries.
+    Node *exprs;       // Expressions of the body in order.  The last one gives
+                       // the return value of non-void functions.
+};
+
+static struct {
+    InlineCandidate *candidates;
+    Obj *currentFunc; // Function which calls are inlined into.
+    int tempTop;      // Stack used by temporaries of inlined arguments.
+} inliner;
+
+static int isScalarType(const TypeInfo *t) {
+    return t->type == TypeInt || t->type == TypeChar || t->type == TypePointer ||
+           t->type == TypeEnum;
+}
+
+static int isArg(const Obj *obj, const Obj *args) {
+    for (; args; args = args->next)
+        if (args == obj)
+            return 1;
+    return 0;
+}
+
+static int isInlinableExpr(const Node *n, const Obj *args);
+
+static int isInlinableExprList(const Node *n, const Obj *args) {
+    for (; n; n = n->next)
+        if (!isInlinableExpr(n, args))
+            return 0;
+    return 1;
+}
+
+// Return TRUE if `obj` lives in the frame of the function.
+static int isFrameVar(const Obj *obj) {
+    return !(obj->type->type == TypeFunction || obj->isStatic || obj->isExtern);
+}
+
+// Return TRUE if expression `n` can be copied into other functions.  The callee
+// has no frame after inlining, so its local variables must be scalars which
+// temporaries in the frame of the caller can take over.
+static int isInlinableExpr(const Node *n, const Obj *args) {
+    if (!n)
+        return 1;
+    switch (n->kind) {
+    case NodeLVar:
+        if (isFrameVar(n->obj) && !isArg(n->obj, args) && !isScalarType(n->obj->type))
+            return 0;
+        break;
+    case NodeConditional:
+        // Void conditional leaves no value, which the last expression of an
+        // inlined body must do.
+        if (n->type->type == TypeVoid)
+            return 0;
+        break;
+    case NodeFCall:
+        if (!isInlinableExprList(n->fcall->args, args))
+            return 0;
+        break;
+    case NodeVaStart:
+    case NodeInitVar:
+    case NodeInitList:
+    case NodeClearStack:
+    case NodeIf:
+    case NodeElseif:
+    case NodeElse:
+    case NodeSwitch:
+    case NodeSwitchCase:
+    case NodeFor:
+    case NodeDoWhile:
+    case NodeBlock:
+    case NodeBreak:
+    case NodeContinue:
+    case NodeReturn:
+    case NodeFunction:
+    case NodeNop:
+        return 0;
+    default:
+        break;
+    }
+    return isInlinableExpr(n->lhs, args) && isInlinableExpr(n->rhs, args) &&
+           isInlinableExpr(n->condition, args) && isInlinableExprList(n->body, args);
+}
+
+// Count nodes in `n` and nodes following it.
+static int countNodes(const Node *n) {
+    int count = 0;
+    for (; n; n = n->next) {
+        count += 1 + countNodes(n->lhs) + countNodes(n->rhs) +
+                 countNodes(n->condition) + countNodes(n->body) +
+                 countNodes(n->elseblock) + countNodes(n->initializer) +
+                 countNodes(n->iterator);
+        if (n->kind == NodeFCall)
+            count += countNodes(n->fcall->args);
+    }
+    return count;
+}
+
+static Node *newInlineNode(NodeKind kind, TypeInfo *type, Token *token) {
+    Node *n = safeAlloc(sizeof(Node));
+    n->kind = kind;
+    n->type = type;
+    n->token = token;
+    return n;
+}
+
+// Wrap `n` with a cast to `type` when `n` may have bits `type` doesn't have.
+static Node *castForInline(Node *n, TypeInfo *type) {
+    Node *cast;
+    if (n->type->type == TypeArray || sizeOf(n->type) <= sizeOf(type))
+        return n;
+    cast = newInlineNode(NodeTypeCast, type, n->token);
+    cast->rhs = n;
+    return cast;
+}
+
+static Node *cloneNodeList(const Node *n, InlineArg *args);
+
+// Copy `n` with references to arguments in `args` replaced.  Labels of
+// copied nodes get new IDs so that they don't conflict with the original.
+static Node *cloneNode(const Node *n, InlineArg *args) {
+    Node *clone = NULL;
+
+    if (n->kind == NodeLVar) {
+        for (InlineArg *a = args; a; a = a->next) {
+            if (a->param != n->obj)
+                continue;
+            if (a->value)
+                return cloneNode(a->value, NULL);
+            clone = newInlineNode(NodeLVar, n->type, n->token);
+            clone->obj = a->temp;
+            return clone;
+        }
+    }
+
+    clone = safeAlloc(sizeof(Node));
+    *clone = *n;
+    clone->next = NULL;
+    clone->lhs = cloneNodeList(n->lhs, args);
+    clone->rhs = cloneNodeList(n->rhs, args);
+    clone->condition = cloneNodeList(n->condition, args);
+    clone->body = cloneNodeList(n->body, args);
+    if (n->kind == NodeFCall) {
+        clone->fcall = safeAlloc(sizeof(FCall));
+        *clone->fcall = *n->fcall;
+        clone->fcall->args = cloneNodeList(n->fcall->args, args);
+    }
+    if (n->kind == NodeConditional || n->kind == NodeLogicalAND ||
+            n->kind == NodeLogicalOR)
+        clone->blockID = globals.blockCount++;
+    return clone;
+}
+
+static Node *cloneNodeList(const Node *n, InlineArg *args) {
+    Node head;
+    Node *tail = &head;
+    head.next = NULL;
+    for (; n; n = n->next) {
+        tail->next = cloneNode(n, args);
+        tail = tail->next;
+    }
+    return head.next;
+}
+
+// Add local variables referred in `n` and nodes following it to the candidate.
+static void addInlineLocals(InlineCandidate *candidate, const Node *n) {
+    for (; n; n = n->next) {
+        if (n->kind == NodeLVar && isFrameVar(n->obj) &&
+                !isArg(n->obj, candidate->args)) {
+            InlineArg *local = candidate->locals;
+            while (local && local->param != n->obj)
+                local = local->next;
+            if (!local) {
+                local = safeAlloc(sizeof(InlineArg));
+                local->param = n->obj;
+                local->next = candidate->locals;
+                candidate->locals = local;
+            }
+        }
+        addInlineLocals(candidate, n->lhs);
+        addInlineLocals(candidate, n->rhs);
+        addInlineLocals(candidate, n->condition);
+        addInlineLocals(candidate, n->body);
+        if (n->kind == NodeFCall)
+            addInlineLocals(candidate, n->fcall->args);
+    }
+}
+
+// Turn local variable declaration `decl` into assignments of the initial values
+// and append them to `tail`.  Return the new tail, or NULL if the declaration
+// cannot be inlined.
+static Node *appendInlineDecl(Node *tail, const Node *decl, const Obj *args) {
+    for (Node *init = decl->body; init; init = init->next) {
+        Node *assign = NULL;
+        if (init->kind == NodeClearStack)
+            continue; // Scalars are overwritten by the initial values.
+        if (init->kind != NodeInitVar || init->rhs->kind == NodeInitList)
+            return NULL;
+        assign = newInlineNode(NodeAssign, init->lhs->type, init->token);
+        assign->lhs = init->lhs;
+        assign->rhs = init->rhs;
+        if (!isInlinableExpr(assign, args)) {
+            safeFree(assign);
+            return NULL;
+        }
+        tail->next = cloneNode(assign, NULL);
+        tail = tail->next;
+        safeFree(assign);
+    }
+    return tail;
+}
+
+// Check if function definition `def` can be inlined, and make it a candidate
+// if so.
+static void addInlineCandidate(Node *def) {
+    Obj *func = def->obj;
+    Obj *decl = findFunction(func->token->data.atom);
+    Function *f = func->func;
+    Node head;
+    Node *tail = &head;
+    InlineCandidate *candidate = NULL;
+
+    if (!(func->isStatic || func->isInline || decl->isStatic || decl->isInline))
+        return;
+    if (f->haveVaArgs || def->body->kind != NodeBlock)
+        return;
+    if (f->retType->type != TypeVoid && !isScalarType(f->retType))
+        return;
+    for (Obj *arg = f->args; arg; arg = arg->next)
+        if (!isScalarType(arg->type))
+            return;
+
+    head.next = NULL;
+    for (Node *s = def->body->body; s; s = s->next) {
+        Node *e = s;
+        if (s->kind == NodeReturn) {
+            if (s->next || (!s->lhs && f->retType->type != TypeVoid))
+                return;
+            if (!s->lhs)
+                break;
+            e = s->lhs;
+        } else if (!s->next && f->retType->type != TypeVoid) {
+            return; // Falls off the end.
+        } else if (s->kind == NodeBlock) {
+            // Only declarations of local variables come as blocks here.
+            tail = appendInlineDecl(tail, s, f->args);
+            if (!tail)
+                return;
+            continue;
+        }
+        if (!isInlinableExpr(e, f->args))
+            return;
+        tail->next = cloneNode(e, NULL);
+        if (e != s)
+            tail->next = castForInline(tail->next, f->retType);
+        tail = tail->next;
+    }
+    if (countNodes(head.next) > globals.inlineLimit)
+        return;
+
+    candidate = safeAlloc(sizeof(InlineCandidate));
+    candidate->func = decl;
+    candidate->args = f->args;
+    candidate->exprs = head.next;
+    addInlineLocals(candidate, head.next);
+    candidate->next = inliner.candidates;
+    inliner.candidates = candidate;
+}
+
+static InlineCandidate *findInlineCandidate(const Node *call) {
+    if (call->body->kind != NodeLVar || call->body->type->type != TypeFunction)
+        return NULL;
+    for (InlineCandidate *c = inliner.candidates; c; c = c->next)
+        if (c->func == call->body->obj)
+            return c;
+    return NULL;
+}
+
+// Return TRUE if `n` or nodes following it may modify `param`.
+static int isArgModified(const Node *n, const Obj *param) {
+    for (; n; n = n->next) {
+        const Node *target = NULL;
+        if (n->kind == NodeAddress || n->kind == NodePreIncl || n->kind == NodePreDecl)
+            target = n->rhs;
+        else if (n->kind == NodeAssign || n->kind == NodePostIncl ||
+                 n->kind == NodePostDecl)
+            target = n->lhs;
+        if (target && target->kind == NodeLVar && target->obj == param)
+            return 1;
+        if (isArgModified(n->lhs, param) || isArgModified(n->rhs, param) ||
+                isArgModified(n->condition, param) || isArgModified(n->body, param))
+            return 1;
+        if (n->kind == NodeFCall && isArgModified(n->fcall->args, param))
+            return 1;
+    }
+    return 0;
+}
+
+// Allocate a variable to take over argument or local variable `param` of an
+// inlined body in the frame of the caller.
+static Obj *newInlineTemp(Obj *param, Env *env) {
+    Obj *temp = safeAlloc(sizeof(Obj));
+    Function *caller = inliner.currentFunc->func;
+    int size = sizeOf(param->type);
+
+    inliner.tempTop = (inliner.tempTop + size + size - 1) / size * size;
+    if (caller->capStackSize < inliner.tempTop)
+        caller->capStackSize = inliner.tempTop;
+
+    temp->token = param->token;
+    temp->type = param->type;
+    temp->offset = inliner.tempTop;
+    temp->next = env->vars;
+    env->vars = temp;
+    return temp;
+}
+
+static void inlineCalls(Node *n, int depth);
+
+static void inlineCallsList(Node *n, int depth) {
+    for (; n; n = n->next)
+        inlineCalls(n, depth);
+}
+
+// Replace call `n` to `candidate` with expressions which assign arguments to
+// temporaries and then evaluate the body.
+static void expandInlineCall(Node *n, InlineCandidate *candidate, int depth) {
+    InlineArg *args = NULL;
+    Node head;
+    Node *tail = &head;
+    Node *list = NULL;
+    Node *arg = n->fcall->args;
+
+    // Arguments are given in reversed order.  Evaluate them in that order as
+    // function calls do.
+    head.next = NULL;
+    for (int i = n->fcall->argsCount - 1; i >= 0; --i) {
+        InlineArg *a = safeAlloc(sizeof(InlineArg));
+        Node *value = arg;
+        Node *assign = NULL;
+
+        // Detach the argument from the argument list.
+        arg = arg->next;
+        value->next = NULL;
+
+        a->param = candidate->args;
+        for (int j = 0; j < i; ++j)
+            a->param = a->param->next;
+        a->next = args;
+        args = a;
+
+        if (value->kind == NodeNum && a->param->type->type != TypePointer &&
+                !isArgModified(candidate->exprs, a->param)) {
+            a->value = castForInline(value, a->param->type);
+            continue;
+        }
+
+        a->temp = newInlineTemp(a->param, n->env);
+        assign = newInlineNode(NodeAssign, a->param->type, value->token);
+        assign->lhs = newInlineNode(NodeLVar, a->param->type, value->token);
+        assign->lhs->obj = a->temp;
+        assign->rhs = value;
+        tail->next = assign;
+        tail = tail->next;
+    }
+
+    for (InlineArg *local = candidate->locals; local; local = local->next) {
+        InlineArg *a = safeAlloc(sizeof(InlineArg));
+        a->param = local->param;
+        a->temp = newInlineTemp(local->param, n->env);
+        a->next = args;
+        args = a;
+    }
+
+    tail->next = cloneNodeList(candidate->exprs, args);
+    inlineCallsList(tail->next, depth + 1);
+
+    while (args) {
+        InlineArg *a = args;
+        args = a->next;
+        safeFree(a);
+    }
+
+    list = newInlineNode(NodeExprList, n->type, n->token);
+    list->body = head.next;
+    replaceNode(n, list);
+    safeFree(list);
+}
+
+static void inlineCalls(Node *n, int depth) {
+    InlineCandidate *candidate = NULL;
+
+    if (n->kind == NodeFunction) {
+        inliner.currentFunc = n->obj;
+        inliner.tempTop = n->obj->func->capStackSize;
+        inlineCalls(n->body, depth);
+        inliner.currentFunc = NULL;
+        return;
+    } else if (n->kind == NodeBlock) {
+        // Temporaries of a statement are dead after it, so the next statement
+        // can reuse their stack.
+        int tempTop = inliner.tempTop;
+        for (Node *c = n->body; c; c = c->next) {
+            inlineCalls(c, depth);
+            inliner.tempTop = tempTop;
+        }
+        return;
+    }
+
+    inlineCallsList(n->lhs, depth);
+    inlineCallsList(n->rhs, depth);
+    inlineCallsList(n->condition, depth);
+    inlineCallsList(n->body, depth);
+    inlineCallsList(n->elseblock, depth);
+    inlineCallsList(n->initializer, depth);
+    inlineCallsList(n->iterator, depth);
+    if (n->kind != NodeFCall)
+        return;
+
+    inlineCallsList(n->fcall->args, depth);
+    if (!inliner.currentFunc || depth >= INLINE_DEPTH_MAX)
+        return;
+    candidate = findInlineCandidate(n);
+    if (candidate && candidate->func->func->argsCount == n->fcall->argsCount)
+        expandInlineCall(n, candidate, depth);
+}
+
+/**
+ * Replace calls to small static or inline functions in program `n` with their
+ * bodies.  Functions whose body is a sequence of expressions ending with a
+ * return statement, and whose size is within globals.inlineLimit nodes, are
+ * inlined.  Arguments are evaluated into new variables in the caller's frame,
+ * except for constants which are substituted directly.
+ */
+void inlineFunctions(Node *n) {
+    if (globals.inlineLimit <= 0)
+        return;
+    for (Node *c = n->body; c; c = c->next)
+        if (c->kind == NodeFunction)
+            addInlineCandidate(c);
+    if (inliner.candidates)
+        inlineCalls(n, 0);
+}
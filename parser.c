@@ -135,7 +135,7 @@ static int consumeNumber(int *val) {
     abortIfEOF();
 
     if (globals.token->type == TokenNumber) {
-        *val = globals.token->val;
+        *val = globals.token->data.val;
         globals.token = globals.token->next;
         return 1;
     }
@@ -168,7 +168,7 @@ static void expectReserved(char *op) {
 static int expectNumber(void) {
     abortIfEOF();
     if (globals.token->type == TokenNumber) {
-        int val = globals.token->val;
+        int val = globals.token->data.val;
         globals.token = globals.token->next;
         return val;
     }
@@ -198,7 +198,7 @@ static int atEOF(void) { return globals.token->type == TokenEOF; }
 static Token *buildTagNameForAnonymousObject(int id) {
     static const char prefix[] = "anonymous-object-";
     static const int prefix_size = sizeof(prefix);
-    Token *tagName = (Token *)safeAlloc(sizeof(Token));
+    Token *tagName = newToken();
     int suffix_len = 1;
 
     for (int tmp = id / 10; tmp; tmp /= 10)
@@ -208,10 +208,44 @@ static Token *buildTagNameForAnonymousObject(int id) {
     tagName->str = (char *)safeAlloc(tagName->len + 1);
 
     sprintf(tagName->str, "%s%d", prefix, id);
+    tagName->data.atom = internAtom(tagName->str, tagName->len);
 
     return tagName;
 }
 
+// Every name visible from the current env, including global functions and
+// variables, hashed by its namespace and atom.  New symbols are pushed onto the
+// head of their bucket, so the innermost declaration shadows outer ones, and
+// since symbols are only ever added to the current env, leaving an env finds
+// each of its symbols at the head of its bucket again.
+#define SYMBOL_TABLE_SIZE (4096)
+static Symbol *symbolTable[SYMBOL_TABLE_SIZE];
+
+static int hashSymbol(SymbolKind kind, const Atom *name) {
+    return (name->id * 31 + kind) & (SYMBOL_TABLE_SIZE - 1);
+}
+
+static void registerSymbol(SymbolKind kind, Token *name, void *entity) {
+    Symbol *sym = (Symbol *)safeAlloc(sizeof(Symbol));
+    sym->kind = kind;
+    sym->hash = hashSymbol(kind, name->data.atom);
+    sym->name = name->data.atom;
+    sym->entity = entity;
+
+    sym->next = symbolTable[sym->hash];
+    symbolTable[sym->hash] = sym;
+    sym->envNext = globals.currentEnv->symbols;
+    globals.currentEnv->symbols = sym;
+}
+
+static void *findSymbol(SymbolKind kind, const Atom *name) {
+    for (Symbol *sym = symbolTable[hashSymbol(kind, name)]; sym; sym = sym->next) {
+        if (sym->name == name && sym->kind == kind)
+            return sym->entity;
+    }
+    return NULL;
+}
+
 static void enterNewEnv(void) {
     Env *env = (Env *)safeAlloc(sizeof(Env));
     env->outer = globals.currentEnv;
@@ -221,6 +255,11 @@ static void enterNewEnv(void) {
 static void exitCurrentEnv(void) {
     if (!globals.currentEnv->outer)
         errorUnreachable();
+    for (Symbol *sym = globals.currentEnv->symbols; sym; sym = sym->envNext) {
+        if (symbolTable[sym->hash] != sym)
+            errorUnreachable();
+        symbolTable[sym->hash] = sym->next;
+    }
     globals.currentEnv = globals.currentEnv->outer;
 }
 
@@ -316,103 +355,51 @@ static Node *newNodeFunction(Token *t) {
 
 // Find global variable by name. Return LVar* when variable is found. Returns
 // NULL when not.
-GVar *findGlobalVar(char *name, int len) {
-    for (GVar *v = globals.globalVars; v; v = v->next) {
-        if (matchToken(v->obj->token, name, len))
-            return v;
-    }
-    return NULL;
+GVar *findGlobalVar(const Atom *name) {
+    return findSymbol(SymbolGlobalVar, name);
 }
 
 // Find local variable in current block by name. Return LVar* when variable
 // found. When not, returns NULL.
 // Note that this function does NOT search global variables.
-Obj *findLVar(char *name, int len) {
-    for (Env *env = globals.currentEnv; env; env = env->outer) {
-        for (Obj *v = env->vars; v; v = v->next) {
-            if (matchToken(v->token, name, len))
-                return v;
-        }
-    }
-    if (globals.currentFunction) {
-        for (Obj *v = globals.currentFunction->func->args; v; v = v->next) {
-            if (matchToken(v->token, name, len))
-                return v;
-        }
-    }
-    return NULL;
+Obj *findLVar(const Atom *name) {
+    return findSymbol(SymbolVar, name);
 }
 
-Obj *findFunction(const char *name, int len) {
-    for (Obj *obj = globals.functions; obj; obj = obj->next) {
-        if (matchToken(obj->token, name, len))
-            return obj;
-    }
-    return NULL;
+Obj *findFunction(const Atom *name) {
+    return findSymbol(SymbolFunction, name);
 }
 
 // Look up structure and return it.  If structure didn't found, returns NULL.
-static StructOrUnion *findStruct(const char *name, int len) {
-    for (Env *env = globals.currentEnv; env; env = env->outer) {
-        for (StructOrUnion *s = env->structs; s; s = s->next) {
-            if (matchToken(s->tagName, name, len))
-                return s;
-        }
-    }
-    return NULL;
+static StructOrUnion *findStruct(const Atom *name) {
+    return findSymbol(SymbolStruct, name);
 }
 
 // Look up structure and return it.  If structure didn't found, returns NULL.
-static StructOrUnion *findUnion(const char *name, int len) {
-    for (Env *env = globals.currentEnv; env; env = env->outer) {
-        for (StructOrUnion *s = env->unions; s; s = s->next) {
-            if (matchToken(s->tagName, name, len))
-                return s;
-        }
-    }
-    return NULL;
+static StructOrUnion *findUnion(const Atom *name) {
+    return findSymbol(SymbolUnion, name);
 }
 
 // Search member in struct or union.  Returns the member if found, otherwise
 // NULL.
-Obj *findStructOrUnionMember(const StructOrUnion *s, const char *name, int len) {
+Obj *findStructOrUnionMember(const StructOrUnion *s, const Atom *name) {
     for (Obj *m = s->members; m; m = m->next) {
-        if (matchToken(m->token, name, len))
+        if (m->token->data.atom == name)
             return m;
     }
     return NULL;
 }
 
-static Enum *findEnum(const char *name, int len) {
-    for (Env *env = globals.currentEnv; env; env = env->outer) {
-        for (Enum *e = env->enums; e; e = e->next) {
-            if (matchToken(e->tagName, name, len))
-                return e;
-        }
-    }
-    return NULL;
+static Enum *findEnum(const Atom *name) {
+    return findSymbol(SymbolEnum, name);
 }
 
-static EnumItem *findEnumItem(const char *name, int len) {
-    for (Env *env = globals.currentEnv; env; env = env->outer) {
-        for (Enum *e = env->enums; e; e = e->next) {
-            for (EnumItem *item = e->items; item; item = item->next) {
-                if (matchToken(item->token, name, len))
-                    return item;
-            }
-        }
-    }
-    return NULL;
+static EnumItem *findEnumItem(const Atom *name) {
+    return findSymbol(SymbolEnumItem, name);
 }
 
-static Typedef *findTypedef(const char *name, int len) {
-    for (Env *env = globals.currentEnv; env; env = env->outer) {
-        for (Typedef *def = env->typedefs; def; def = def->next) {
-            if (matchToken(def->name, name, len))
-                return def;
-        }
-    }
-    return NULL;
+static Typedef *findTypedef(const Atom *name) {
+    return findSymbol(SymbolTypedef, name);
 }
 
 static TypeInfo *newTypeInfo(TypeKind kind) {
@@ -449,6 +436,8 @@ static TypeInfo *parseBaseType(ObjAttr *attr) {
                 attr->isExtern = 1;
             } else if (consumeCertainTokenType(TokenTypedef)) {
                 attr->isTypedef = 1;
+            } else if (consumeCertainTokenType(TokenInline)) {
+                attr->isInline = 1;
             } else {
                 break;
             }
@@ -460,7 +449,7 @@ static TypeInfo *parseBaseType(ObjAttr *attr) {
 
     type = consumeTypeName();
     if (type) {
-        return newTypeInfo(type->varType);
+        return newTypeInfo(type->data.atom->varType);
     } else if (matchCertainTokenType(TokenStruct)) {
         StructOrUnion *s = structOrUnionDeclaration(attr, 1);
         TypeInfo *typeInfo = newTypeInfo(TypeStruct);
@@ -481,7 +470,7 @@ static TypeInfo *parseBaseType(ObjAttr *attr) {
         Token *ident = consumeIdent();
 
         if (ident) {
-            Typedef *def = findTypedef(ident->str, ident->len);
+            Typedef *def = findTypedef(ident->data.atom);
 
             if (def) {
                 return def->type;
@@ -623,11 +612,12 @@ static Function *parseFuncArgDeclaration(void) {
 }
 
 static void registerTypedef(Typedef *def) {
-    if (findTypedef(def->name->str, def->name->len)) {
+    if (findTypedef(def->name->data.atom)) {
         errorAt(def->name, "Redefinition of typedef name.");
     }
     def->next = globals.currentEnv->typedefs;
     globals.currentEnv->typedefs = def;
+    registerSymbol(SymbolTypedef, def->name, def);
 }
 
 // Return size of given type.  Return negative value for incomplete types.  If
@@ -725,7 +715,7 @@ static GVarInit *buildGVarInitSection(TypeInfo *varType, Node *initializer) {
                initializer->kind == NodeLiteralString) {
         GVarInit head = {};
         GVarInit *init = &head;
-        int strSize = initializer->token->literalStr->len;
+        int strSize = initializer->token->data.literalStr->len;
         int arraySize = varType->arraySize;
 
         if (arraySize < 0)
@@ -782,8 +772,7 @@ static GVarInit *buildGVarInitSection(TypeInfo *varType, Node *initializer) {
 
             if (tmpObj->isStatic && isAnonymousObject(tmpObj)) {
                 for (GVar *var = globals.staticVars; var; var = var->next) {
-                    if (matchToken(
-                                var->obj->token, tmpObj->token->str, tmpObj->token->len))
+                    if (var->obj->token->data.atom == tmpObj->token->data.atom)
                         return var->initializer;
                 }
             }
@@ -840,8 +829,7 @@ static GVarInit *buildGVarInitSection(TypeInfo *varType, Node *initializer) {
 
             if (tmpObj->isStatic && isAnonymousObject(tmpObj)) {
                 for (GVar *var = globals.staticVars; var; var = var->next) {
-                    if (matchToken(
-                                var->obj->token, tmpObj->token->str, tmpObj->token->len))
+                    if (var->obj->token->data.atom == tmpObj->token->data.atom)
                         return var->initializer;
                 }
             }
@@ -986,6 +974,7 @@ static Node *decl(void) {
         obj = parseAdvancedTypeDeclaration(baseType, 1);
         obj->isStatic = attr.isStatic;
         obj->isExtern = attr.isExtern;
+        obj->isInline = attr.isInline;
 
         if (!obj->token) {
             errorAt(tokenObjHead, "Missing variable/function name.");
@@ -1016,7 +1005,7 @@ static Node *decl(void) {
                             "Cannot declare function argument with type \"void\"");
             }
 
-            funcFound = findFunction(obj->token->str, obj->token->len);
+            funcFound = findFunction(obj->token->data.atom);
             if (funcFound) {
                 if (funcFound->func->haveImpl) {
                     errorAt(tokenObjHead, "Redefinition of function.");
@@ -1050,6 +1039,7 @@ static Node *decl(void) {
                 // Register function
                 obj->next = globals.functions;
                 globals.functions = obj;
+                registerSymbol(SymbolFunction, obj->token, obj);
             }
             // TODO: Free n->func
             enterNewEnv();
@@ -1057,6 +1047,10 @@ static Node *decl(void) {
             n->obj = obj;
 
             globals.currentFunction = obj;
+            for (Obj *v = obj->func->args; v; v = v->next) {
+                if (v->token)
+                    registerSymbol(SymbolVar, v->token, v);
+            }
 
             // Compute argument variables' offset.
             // Note that arguments are all copied onto stack at the head of
@@ -1100,7 +1094,7 @@ static Node *decl(void) {
         } else if (obj->type->type == TypeFunction) {
             // Function declaration
             Obj *funcFound = NULL;
-            funcFound = findFunction(obj->token->str, obj->token->len);
+            funcFound = findFunction(obj->token->data.atom);
             if (funcFound) {
                 // Check types are same with previous declaration.
                 if (!checkTypeEqual(funcFound->func->retType, obj->func->retType)) {
@@ -1124,12 +1118,13 @@ static Node *decl(void) {
                 obj->func->haveImpl = 0;
                 obj->next = globals.functions;
                 globals.functions = obj;
+                registerSymbol(SymbolFunction, obj->token, obj);
             }
         } else {
             // Global variable declaration
             GVar *gvar = NULL;
             GVar *existingVar = NULL;
-            existingVar = findGlobalVar(obj->token->str, obj->token->len);
+            existingVar = findGlobalVar(obj->token->data.atom);
             if (existingVar && !existingVar->obj->isExtern)
                 errorAt(obj->token, "Redefinition of variable.");
             else if (obj->type->type == TypeVoid)
@@ -1163,6 +1158,7 @@ static Node *decl(void) {
             if (!existingVar) {
                 gvar->next = globals.globalVars;
                 globals.globalVars = gvar;
+                registerSymbol(SymbolGlobalVar, obj->token, gvar);
             }
         }
 
@@ -1413,12 +1409,12 @@ static StructOrUnion *structOrUnionDeclaration(const ObjAttr *attr, int isStruct
         StructOrUnion *s = NULL;
         if (tagName) {
             if (isStruct) {
-                s = findStruct(tagName->str, tagName->len);
+                s = findStruct(tagName->data.atom);
                 if (s && s->hasImpl) {
                     errorAt(tokenStruct, "Redefinition of struct.");
                 }
             } else {
-                s = findUnion(tagName->str, tagName->len);
+                s = findUnion(tagName->data.atom);
                 if (s && s->hasImpl) {
                     errorAt(tokenStruct, "Redefinition of union");
                 }
@@ -1437,6 +1433,7 @@ static StructOrUnion *structOrUnionDeclaration(const ObjAttr *attr, int isStruct
             // Register struct or union
             s->next = *holder;
             *holder = s;
+            registerSymbol(isStruct ? SymbolStruct : SymbolUnion, tagName, s);
         }
         s->tagName = tagName;
         s->hasImpl = 1;
@@ -1446,9 +1443,9 @@ static StructOrUnion *structOrUnionDeclaration(const ObjAttr *attr, int isStruct
     } else if (tagName) {
         StructOrUnion *s;
         if (isStruct)
-            s = findStruct(tagName->str, tagName->len);
+            s = findStruct(tagName->data.atom);
         else
-            s = findUnion(tagName->str, tagName->len);
+            s = findUnion(tagName->data.atom);
 
         if (allowUndefinedStruct) {
             if (!s) {
@@ -1459,6 +1456,7 @@ static StructOrUnion *structOrUnionDeclaration(const ObjAttr *attr, int isStruct
                 s->hasImpl = 0;
                 s->next = *holder;
                 *holder = s;
+                registerSymbol(isStruct ? SymbolStruct : SymbolUnion, tagName, s);
             }
         } else if (!(s && s->hasImpl)) {
             errorAt(tokenStruct, "Undefiend %s.", isStruct ? "struct" : "union");
@@ -1493,7 +1491,7 @@ static void structorUnionBody(StructOrUnion *s, int isStruct) {
             }
 
             for (Obj *m = memberHead.next; m; m = m->next) {
-                if (matchToken(m->token, member->token->str, member->token->len))
+                if (m->token->data.atom == member->token->data.atom)
                     errorAt(member->token, "Duplicate member name.");
             }
 
@@ -1569,7 +1567,7 @@ static Enum *enumDeclaration(const ObjAttr *attr) {
         Enum *e = NULL;
         int registerEnum = 0;
         if (tagName) {
-            e = findEnum(tagName->str, tagName->len);
+            e = findEnum(tagName->data.atom);
             if (e && e->hasImpl)
                 errorAt(tokenEnum, "Redefinition of enum.");
         } else {
@@ -1585,10 +1583,11 @@ static Enum *enumDeclaration(const ObjAttr *attr) {
         if (registerEnum) {
             e->next = globals.currentEnv->enums;
             globals.currentEnv->enums = e;
+            registerSymbol(SymbolEnum, tagName, e);
         }
         return e;
     } else if (tagName) {
-        Enum *e = findEnum(tagName->str, tagName->len);
+        Enum *e = findEnum(tagName->data.atom);
         if (allowUndefinedEnum) {
             if (!e) {
                 e = (Enum *)safeAlloc(sizeof(Enum));
@@ -1596,6 +1595,7 @@ static Enum *enumDeclaration(const ObjAttr *attr) {
                 e->hasImpl = 0;
                 e->next = globals.currentEnv->enums;
                 globals.currentEnv->enums = e;
+                registerSymbol(SymbolEnum, tagName, e);
             }
         } else if (!(e && e->hasImpl)) {
             errorAt(tokenEnum, "Undefined enum.");
@@ -1618,18 +1618,15 @@ static void enumBody(Enum *e) {
         if (!itemToken)
             break;
 
-        previous = findEnumItem(itemToken->str, itemToken->len);
+        previous = findEnumItem(itemToken->data.atom);
         if (previous)
             errorAt(itemToken, "Duplicate enum item.");
 
-        for (EnumItem *p = head.next; p; p = p->next)
-            if (matchToken(p->token, itemToken->str, itemToken->len))
-                errorAt(itemToken, "Duplicate enum item.");
-
         item->next = (EnumItem *)safeAlloc(sizeof(EnumItem));
         item = item->next;
         item->token = itemToken;
         item->value = value++;
+        registerSymbol(SymbolEnumItem, itemToken, item);
 
         if (!consumeReserved(","))
             break;
@@ -1695,7 +1692,7 @@ static Node *varDeclaration(void) {
             errorAt(varObj->token, "Cannot declare variable with type \"void\"");
         }
 
-        existingVar = findLVar(varObj->token->str, varObj->token->len);
+        existingVar = findLVar(varObj->token->data.atom);
         if (existingVar) {
             errorAt(varObj->token, "Redefinition of variable");
         }
@@ -1735,7 +1732,7 @@ static Node *varDeclaration(void) {
                             size++;
                         varType->arraySize = size;
                     } else if (initializer->kind == NodeLiteralString) {
-                        LiteralString *string = initializer->token->literalStr;
+                        LiteralString *string = initializer->token->data.literalStr;
                         if (!string)
                             errorUnreachable();
                         varType->arraySize = string->len;
@@ -1780,6 +1777,7 @@ static Node *varDeclaration(void) {
         // Register variable.
         varObj->next = globals.currentEnv->vars;
         globals.currentEnv->vars = varObj;
+        registerSymbol(SymbolVar, varObj->token, varObj);
 
         if (!consumeReserved(","))
             break;
@@ -2078,7 +2076,6 @@ static Node *assign(void) {
 static Node *constant(void) { return evalConstantExpr(conditional()); }
 
 static Node *conditional(void) {
-    static int condOpCount = 0;
     Node *n = logicalOR();
 
     if (consumeReserved("?")) {
@@ -2094,7 +2091,7 @@ static Node *conditional(void) {
         n->condition = cond;
         n->lhs = lhs;
         n->rhs = rhs;
-        n->blockID = condOpCount++;
+        n->blockID = globals.blockCount++;
     }
 
     return n;
@@ -2499,6 +2496,10 @@ static Node *postfix(void) {
                 exprType = exprType->baseType;
                 if (!consumeReserved("["))
                     break;
+                // An element of array is the address of its head as is, but
+                // pointer elements must be loaded to subscript them.
+                if (exprType->type != TypeArray)
+                    n = newNodeBinary(NodeDeref, NULL, n, exprType);
             }
             n = newNodeBinary(NodeDeref, NULL, n, exprType);
         } else if (matchReserved("(")) {
@@ -2556,12 +2557,12 @@ static Node *postfix(void) {
             memberToken = expectIdent();
             if (n->type->type == TypeStruct) {
                 member = findStructOrUnionMember(
-                        n->type->structDef, memberToken->str, memberToken->len);
+                        n->type->structDef, memberToken->data.atom);
                 if (!member)
                     errorAt(memberToken, "No such struct member.");
             } else { // TypeUnion
                 member = findStructOrUnionMember(
-                        n->type->unionDef, memberToken->str, memberToken->len);
+                        n->type->unionDef, memberToken->data.atom);
                 if (!member)
                     errorAt(memberToken, "No such union member.");
             }
@@ -2604,18 +2605,18 @@ static Node *primary(void) {
 
     ident = consumeIdent();
     if (ident) {
-        Obj *lvar = findLVar(ident->str, ident->len);
+        Obj *lvar = findLVar(ident->data.atom);
         GVar *gvar = NULL;
         EnumItem *enumItem = NULL;
         Obj *func = NULL;
         if (lvar) {
             n = newNodeLVar(lvar);
-        } else if ((gvar = findGlobalVar(ident->str, ident->len)) != NULL) {
+        } else if ((gvar = findGlobalVar(ident->data.atom)) != NULL) {
             n = newNode(NodeGVar, gvar->obj->type);
             n->obj = gvar->obj;
-        } else if ((enumItem = findEnumItem(ident->str, ident->len)) != NULL) {
+        } else if ((enumItem = findEnumItem(ident->data.atom)) != NULL) {
             n = newNodeNum(enumItem->value);
-        } else if ((func = findFunction(ident->str, ident->len)) != NULL) {
+        } else if ((func = findFunction(ident->data.atom)) != NULL) {
             n = newNodeLVar(func);
         } else if (matchToken(ident, "__builtin_va_start", 18)) {
             n = newNode(NodeVaStart, &Types.Void);
@@ -2629,7 +2630,7 @@ static Node *primary(void) {
         expectReserved(")");
     } else if ((string = consumeLiteralString())) {
         TypeInfo *type = newTypeInfo(TypeArray);
-        type->arraySize = string->literalStr->len;
+        type->arraySize = string->data.literalStr->len;
         type->baseType = &Types.Char;
 
         n = newNode(NodeLiteralString, type);
@@ -5,7 +5,7 @@ typedef struct Macro Macro;
 struct Macro {
     Macro *next;
     Token *token;   // Macro name.
-    Token *replace; // Replacement-list is tokens, until "TokenNewLine" appears.
+    Token *replace; // Replacement-list is tokens, until the next line starts.
     int isFunc;     // TRUE if macro is function-like macro.
     Token *args;    // Argument list of function-like macro.
 };
@@ -26,10 +26,12 @@ struct Range {
     Token *end;
 };
 
+#define MACRO_TABLE_SIZE (1024)
+
 typedef struct Preproc Preproc;
 struct Preproc {
-    Macro *macros;     // All macro list.
-    int expandDefined; // If TRUE, expand "define(macro)" macro.
+    Macro *macros[MACRO_TABLE_SIZE]; // All macros, hashed by atom of the name.
+    int expandDefined;               // If TRUE, expand "define(macro)" macro.
 };
 
 static Preproc preproc;
@@ -41,11 +43,20 @@ static Macro *newMacro(Token *token, Token *replace) {
     return macro;
 }
 
+static Macro **macroBucket(const Atom *name) {
+    return &preproc.macros[name->id & (MACRO_TABLE_SIZE - 1)];
+}
+
 // Search for macro named "name" in all macro list, and returns the matched
 // macro object if found.  If macro not found, returns NULL instead.
 static Macro *findMacro(Token *name) {
-    for (Macro *macro = preproc.macros; macro; macro = macro->next) {
-        if (matchToken(macro->token, name->str, name->len)) {
+    Atom *atom = tokenAtom(name);
+
+    // Most identifiers are not macro names; atoms know it without hashing.
+    if (!(atom && atom->isMacro))
+        return NULL;
+    for (Macro *macro = *macroBucket(atom); macro; macro = macro->next) {
+        if (macro->token->data.atom == atom) {
             return macro;
         }
     }
@@ -94,19 +105,19 @@ static int consumeTokenCertainType(Token **token, TokenType type) {
 }
 
 static Token *newTokenSOF(void) {
-    Token *token = (Token *)safeAlloc(sizeof(Token));
+    Token *token = newToken();
     token->type = TokenSOF;
     return token;
 }
 
 static Token *newTokenEOF(void) {
-    Token *token = (Token *)safeAlloc(sizeof(Token));
+    Token *token = newToken();
     token->type = TokenEOF;
     return token;
 }
 
 static Token *newTokenDummyReserved(char *op) {
-    Token *token = (Token *)safeAlloc(sizeof(Token));
+    Token *token = newToken();
     token->type = TokenReserved;
     token->str = op;
     token->len = strlen(op);
@@ -115,7 +126,7 @@ static Token *newTokenDummyReserved(char *op) {
 
 // Clone token, but clears "next" and "prev" entry with NULL.
 static Token *cloneToken(Token *token) {
-    Token *clone = (Token *)safeAlloc(sizeof(Token));
+    Token *clone = newToken();
     *clone = *token;
     clone->next = clone->prev = NULL;
     return clone;
@@ -162,9 +173,17 @@ static void insertToken(Token *pos, Token *token) {
     next->prev = token;
 }
 
-// Skip tokens until "TokenNewLine" appears, and returns the pointer to it.
-static Token *skipUntilNewline(Token *token) {
-    while (token->type != TokenNewLine)
+// Return TRUE if "token" begins a new line, that is, no more tokens of the
+// line before it follow.
+static int isLineHead(Token *token) {
+    return token->atLineStart || token->type == TokenEOF;
+}
+
+// Skip tokens until the next line starts, and returns the pointer to the first
+// token of it.  Note that "token" itself is never taken as the next line.
+static Token *skipLine(Token *token) {
+    token = token->next;
+    while (!isLineHead(token))
         token = token->next;
     return token;
 }
@@ -192,8 +211,9 @@ static Token *parseDefineDirective(Token *token) {
     }
 
     macro = newMacro(macroName, macroName->next);
-    macro->next = preproc.macros;
-    preproc.macros = macro;
+    macro->next = *macroBucket(macroName->data.atom);
+    *macroBucket(macroName->data.atom) = macro;
+    macroName->data.atom->isMacro = 1;
 
     // Check for function-like macro.  Function-like macro doesn't allow any
     // white-spaces between identifier and lbrace, e.g.:
@@ -227,7 +247,7 @@ static Token *parseDefineDirective(Token *token) {
         macro->replace = token;
     }
 
-    nextLine = skipUntilNewline(token)->next;
+    nextLine = skipLine(tokenHash);
     popTokenRange(tokenHash, nextLine->prev);
     return nextLine;
 }
@@ -252,24 +272,16 @@ static Token *parseUndefDirective(Token *token) {
     if (!macro)
         errorAt(name, "Undefined macro.");
 
-    if (macro->next) {
-        Macro *tofree = macro->next;
-        *macro = *macro->next;
-        safeFree(tofree);
-    } else {
-        // Macro is at the end of entry.
-        if (preproc.macros != macro) {
-            Macro *prev = preproc.macros;
-            while (prev->next != macro)
-                prev = prev->next;
-            prev->next = NULL;
-        } else {
-            preproc.macros = NULL;
+    for (Macro **link = macroBucket(name->data.atom); *link; link = &(*link)->next) {
+        if (*link == macro) {
+            *link = macro->next;
+            break;
         }
-        safeFree(macro);
     }
+    name->data.atom->isMacro = 0;
+    safeFree(macro);
 
-    nextLine = skipUntilNewline(head)->next;
+    nextLine = skipLine(head);
     popTokenRange(head, nextLine->prev);
     return nextLine;
 }
@@ -285,7 +297,7 @@ static Token *parseIncludeDirective(Token *token) {
     char *source = NULL;
 
     src.begin = token;
-    src.end = skipUntilNewline(token);
+    src.end = skipLine(token)->prev;
 
     if (!(consumeTokenReserved(&token, "#") && consumeTokenIdent(&token, "include")))
         errorUnreachable();
@@ -297,13 +309,13 @@ static Token *parseIncludeDirective(Token *token) {
 
     if (token->type == TokenLiteralString) {
         // #include "..."
-        char *header = token->literalStr->string;
+        char *header = token->data.literalStr->string;
         if (header[0] == '/') { // Full path
             file = analyzeFilepath(header, header);
         } else {
-            char *path =
-                    (char *)safeAlloc(strlen(token->file->dirname) + strlen(header) + 1);
-            sprintf(path, "%s%s", token->file->dirname, header);
+            char *dirname = tokenFile(token)->dirname;
+            char *path = (char *)safeAlloc(strlen(dirname) + strlen(header) + 1);
+            sprintf(path, "%s%s", dirname, header);
             file = analyzeFilepath(path, header);
         }
     } else if (consumeTokenReserved(&token, "<")) {
@@ -321,10 +333,10 @@ static Token *parseIncludeDirective(Token *token) {
                     errorAt(token->prev, "Missing file name.");
                 header.end = cur->prev;
                 break;
-            } else if (cur->type == TokenNewLine) {
-                errorAt(cur, "\"#include <FILENAME>\" directive not terminated.");
             } else if (cur->type == TokenEOF) {
                 errorAt(cur, "Unexpected EOF.");
+            } else if (cur->atLineStart) {
+                errorAt(cur, "\"#include <FILENAME>\" directive not terminated.");
             }
         }
 
@@ -378,7 +390,7 @@ static Node *parseIfCondPrimary(Token **token) {
         return n;
     } else if ((*token)->type == TokenNumber) {
         Node *n = newNode(NodeNum, *token);
-        n->val = (*token)->val;
+        n->val = (*token)->data.val;
         *token = (*token)->next;
         return n;
     } else {
@@ -654,8 +666,6 @@ static int evalIfCondition(Range *cond) {
     preproc.expandDefined++;
     preprocess(wrap.begin);
     preproc.expandDefined--;
-    safeFree(wrap.begin);
-    safeFree(wrap.end);
 
     // Parse tokens
     node = parseIfCond(&cond->begin);
@@ -698,40 +708,39 @@ static Token *parseIfDirective(Token *token) {
         errorUnreachable();
 
     entire.cond.begin = token;
-    if (entire.cond.begin->type == TokenNewLine)
+    if (isLineHead(entire.cond.begin))
         errorAt(entire.cond.begin, "An expression is expected.");
-    token = skipUntilNewline(token)->next;
+    token = skipLine(entire.directive.begin);
 
-    entire.cond.end = token->prev->prev;
+    entire.cond.end = token->prev;
     entire.body.begin = token;
     curBody = &entire.body;
 
     for (int depth = 0, sawElse = 0;;) {
-        if (consumeTokenReserved(&token, "#")) {
+        Token *line = token;
+        if (consumeTokenReserved(&token, "#") && !isLineHead(token)) {
             if (consumeTokenCertainType(&token, TokenIf)) {
                 depth++;
             } else if (depth == 0 && consumeTokenIdent(&token, "elif")) {
                 if (sawElse)
                     errorAt(token, "#elif after #else.");
-                else if (token->type == TokenNewLine)
+                else if (isLineHead(token))
                     errorAt(token, "An expression is expected.");
 
-                curBody->end = token->prev->prev; // Should points to "#" token
+                curBody->end = line; // Should points to "#" token
                 entire.elifs->next = (Elif *)safeAlloc(sizeof(Elif));
                 entire.elifs = entire.elifs->next;
                 entire.elifs->cond.begin = token;
-                token = skipUntilNewline(token);
+                token = skipLine(line);
                 entire.elifs->cond.end = token->prev;
-                token = token->next;
                 curBody = &entire.elifs->body;
                 curBody->begin = token;
                 continue;
             } else if (depth == 0 && consumeTokenCertainType(&token, TokenElse)) {
-                if (token->type != TokenNewLine)
+                if (!isLineHead(token))
                     errorAt(token, "Unexpected token.");
 
-                curBody->end = token->prev->prev; // Should points to "#" token.
-                token = token->next;
+                curBody->end = line; // Should points to "#" token.
                 entire.elifs->next = (Elif *)safeAlloc(sizeof(Elif));
                 entire.elifs = entire.elifs->next;
                 curBody = &entire.elifs->body;
@@ -740,14 +749,14 @@ static Token *parseIfDirective(Token *token) {
                 sawElse = 1;
                 continue;
             } else if (consumeTokenIdent(&token, "endif")) {
-                if (token->type != TokenNewLine)
+                if (!isLineHead(token))
                     errorAt(token, "Unexpected token.");
 
                 if (depth != 0) {
                     depth--;
                 } else {
-                    curBody->end = token->prev->prev; // Should points to "#" token.
-                    entire.directive.end = token;
+                    curBody->end = line; // Should points to "#" token.
+                    entire.directive.end = token->prev;
                     entire.elifs = elifHead.next;
                     break;
                 }
@@ -755,7 +764,7 @@ static Token *parseIfDirective(Token *token) {
         } else if (token->type == TokenEOF) {
             errorAt(token, "Unexpected EOF");
         }
-        token = skipUntilNewline(token)->next;
+        token = skipLine(line);
     }
 
     if (evalIfCondition(&entire.cond)) {
@@ -804,20 +813,21 @@ static Token *parseIfdefDirective(Token *token, int inverse) {
     ident = consumeTokenAnyIdent(&token);
     if (!ident)
         errorAt(token, "Macro name required after \"#ifdef\".");
-    else if (token->type != TokenNewLine)
+    else if (!isLineHead(token))
         errorAt(token, "Unexpected token");
 
     directive.end = token;
 
-    // Pop ["ifdef", "\n") tokens.
+    // Pop ["ifdef", <next line>) tokens.
     popTokenRange(directive.begin->next, directive.end->prev);
 
-    tokenIf = (Token *)safeAlloc(sizeof(Token));
+    tokenIf = newToken();
     tokenIf->type = TokenIf;
-    tokenDefined = (Token *)safeAlloc(sizeof(Token));
+    tokenDefined = newToken();
     tokenDefined->type = TokenIdent;
     tokenDefined->str = "defined";
     tokenDefined->len = strlen(tokenDefined->str);
+    tokenDefined->data.atom = internAtom(tokenDefined->str, tokenDefined->len);
 
     // Insert "if defined(<macro>)" or "if !defined(<macro>)" tokens
     concatToken(directive.begin, directive.end);
@@ -849,7 +859,7 @@ static Token *applyBuiltinDefinedMacro(Token *token) {
 
     popTokenRange(head->next, token->prev);
     head->type = TokenNumber;
-    head->val = findMacro(macro) != NULL;
+    head->data.val = findMacro(macro) != NULL;
     return head->next;
 }
 
@@ -857,17 +867,17 @@ static Token *applyBuiltinDefinedMacro(Token *token) {
 static int applyPredefinedMacro(Token *token) {
     if (matchToken(token, "__LINE__", 8)) {
         token->type = TokenNumber;
-        token->val = token->line;
+        token->data.val = tokenLine(token);
     } else if (matchToken(token, "__FILE__", 8)) {
         LiteralString *s = (LiteralString *)safeAlloc(sizeof(LiteralString));
-        s->string = token->file->display;
+        s->string = tokenFile(token)->display;
         s->len = strlen(s->string);
         s->id = globals.literalStringCount++;
         s->next = globals.strings;
         globals.strings = s;
 
         token->type = TokenLiteralString;
-        token->literalStr = s;
+        token->data.literalStr = s;
     } else {
         return 0;
     }
@@ -888,7 +898,7 @@ static char *stringifyTokens(Token *begin, Token *end, int *len) {
     for (Token *token = begin; token != termination; token = token->next) {
         switch (token->type) {
         case TokenLiteralString:
-            *len += token->literalStr->len;
+            *len += token->data.literalStr->len;
             totalSize += token->len;
             for (int i = 0; i < token->len; ++i) {
                 if (strchr("\"\\", token->str[i]))
@@ -962,7 +972,7 @@ static void replaceMacroArgs(MacroArg *args, Token *begin, Token *end) {
         Range dest = {};
 
         for (MacroArg *arg = args; arg; arg = arg->next) {
-            if (matchToken(arg->name, token->str, token->len)) {
+            if (arg->name->data.atom == tokenAtom(token)) {
                 replacement = arg;
                 break;
             }
@@ -984,10 +994,10 @@ static void replaceMacroArgs(MacroArg *args, Token *begin, Token *end) {
             s->next = globals.strings;
             globals.strings = s;
 
-            dest.begin = dest.end = (Token *)safeAlloc(sizeof(Token));
+            dest.begin = dest.end = newToken();
             *dest.begin = *token;
             dest.begin->type = TokenLiteralString;
-            dest.begin->literalStr = s;
+            dest.begin->data.literalStr = s;
             dest.begin->prev = dest.begin->next = NULL;
         } else {
             dest.begin = dest.end = cloneTokenList(replacement->begin, replacement->end);
@@ -1011,7 +1021,7 @@ static MacroArg *parseMacroArguments(Macro *macro, Token *begin, Token **endOfAr
     MacroArg head = {};
     MacroArg *curArg = &head;
 
-    if (!matchToken(macro->token, token->str, token->len))
+    if (macro->token->data.atom != token->data.atom)
         errorUnreachable();
 
     token = token->next; // Skip macro name token.
@@ -1080,17 +1090,15 @@ static Token *applyMacro(Token *begin) {
 
     src.begin = src.end = cur;
     dest.begin = dest.end = macro->replace;
-    if (dest.end->type != TokenNewLine)
-        while (dest.end->next->type != TokenNewLine)
+    if (!isLineHead(dest.end))
+        while (!isLineHead(dest.end->next))
             dest.end = dest.end->next;
 
     if (!macro->isFunc) {
-        if (src.begin->type != TokenNewLine) {
+        if (!isLineHead(dest.begin)) {
             dest.begin = dest.end = cloneTokenList(dest.begin, dest.end);
             for (Token *token = dest.begin; token; token = token->next) {
-                token->line = src.begin->line;
-                token->column = src.begin->column;
-                token->file = src.begin->file;
+                token->offset = src.begin->offset;
                 if (!token->next)
                     dest.end = token;
             }
@@ -1104,16 +1112,14 @@ static Token *applyMacro(Token *begin) {
     macroArgs = parseMacroArguments(macro, cur, &src.end);
     cur = src.end->next;
 
-    if (dest.begin->type != TokenNewLine) {
+    if (!isLineHead(dest.begin)) {
         Range wrapper = {};
         wrapper.begin = newTokenSOF();
         wrapper.end = newTokenEOF();
 
         dest.begin = cloneTokenList(dest.begin, dest.end);
         for (Token *token = dest.begin; token; token = token->next) {
-            token->line = src.begin->line;
-            token->column = src.begin->column;
-            token->file = src.begin->file;
+            token->offset = src.begin->offset;
             if (!token->next)
                 dest.end = token;
         }
@@ -1126,9 +1132,6 @@ static Token *applyMacro(Token *begin) {
         popTokenRange(src.begin, src.end);
 
         retpos = wrapper.begin->next;
-
-        safeFree(wrapper.begin);
-        safeFree(wrapper.end);
     } else {
         retpos = src.begin->next;
         popTokenRange(src.begin, src.end);
@@ -1145,7 +1148,9 @@ void preprocess(Token *token) {
         if (consumeTokenReserved(&token, "#")) {
             Token *tokenHash = token->prev;
 
-            if (consumeTokenIdent(&token, "define")) {
+            if (isLineHead(token)) {
+                popTokenRange(tokenHash, tokenHash);
+            } else if (consumeTokenIdent(&token, "define")) {
                 token = parseDefineDirective(tokenHash);
             } else if (consumeTokenIdent(&token, "undef")) {
                 token = parseUndefDirective(tokenHash);
@@ -1157,8 +1162,6 @@ void preprocess(Token *token) {
                 token = parseIfdefDirective(tokenHash, 1);
             } else if (consumeTokenCertainType(&token, TokenIf)) {
                 token = parseIfDirective(tokenHash);
-            } else if (consumeTokenCertainType(&token, TokenNewLine)) {
-                popTokenRange(tokenHash, tokenHash->next);
             }
         } else {
             Token *applied = NULL;
@@ -0,0 +1,185 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+void testArithmeticComputation(void) {
+    assert("test/arithmetic.c", 4, (4), (5-3+2), "5-3+2");
+    assert("test/arithmetic.c", 5, (6), (5+3-2), "5+3-2");
+    assert("test/arithmetic.c", 6, (3), (6/2), "6/2");
+    assert("test/arithmetic.c", 7, (3), (7/2), "7/2");
+    assert("test/arithmetic.c", 8, (3), (8%5), "8%5");
+    assert("test/arithmetic.c", 9, (11), (5+3*2), "5+3*2");
+    assert("test/arithmetic.c", 10, (7), (5+4/2), "5+4/2");
+    assert("test/arithmetic.c", 11, (2), (10-4*2), "10-4*2");
+    assert("test/arithmetic.c", 12, (8), (10-4/2), "10-4/2");
+    assert("test/arithmetic.c", 13, (10), (15/3*2), "15/3*2");
+    assert("test/arithmetic.c", 14, (10), (15*2/3), "15*2/3");
+    assert("test/arithmetic.c", 15, (16), ((5+3)*2), "(5+3)*2");
+    assert("test/arithmetic.c", 16, (17), ((5+3)*2+1), "(5+3)*2+1");
+    assert("test/arithmetic.c", 17, (24), ((5+3)*(2+1)), "(5+3)*(2+1)");
+    assert("test/arithmetic.c", 18, (4), ((5+3)/2), "(5+3)/2");
+    assert("test/arithmetic.c", 19, (5), ((5+3)/2+1), "(5+3)/2+1");
+    assert("test/arithmetic.c", 20, (2), ((5+3)/(2+1)), "(5+3)/(2+1)");
+    assert("test/arithmetic.c", 21, (10), (-10+20), "-10+20");
+    assert("test/arithmetic.c", 22, (10), (-5*+10+60), "-5*+10+60");
+    assert("test/arithmetic.c", 23, (75), (-(-5*+15)), "-(-5*+15)");
+    assert("test/arithmetic.c", 24, (1), (1 == 1), "1 == 1");
+    assert("test/arithmetic.c", 25, (0), (0 == 1), "0 == 1");
+    assert("test/arithmetic.c", 26, (1), (0 != 1), "0 != 1");
+    assert("test/arithmetic.c", 27, (0), (1 != 1), "1 != 1");
+    assert("test/arithmetic.c", 28, (1), (1 < 2), "1 < 2");
+    assert("test/arithmetic.c", 29, (0), (3 < 2), "3 < 2");
+    assert("test/arithmetic.c", 30, (1), (1 <= 2), "1 <= 2");
+    assert("test/arithmetic.c", 31, (1), (2 <= 2), "2 <= 2");
+    assert("test/arithmetic.c", 32, (0), (3 <= 2), "3 <= 2");
+    assert("test/arithmetic.c", 33, (0), (1 > 2), "1 > 2");
+    assert("test/arithmetic.c", 34, (1), (3 > 2), "3 > 2");
+    assert("test/arithmetic.c", 35, (0), (1 >= 2), "1 >= 2");
+    assert("test/arithmetic.c", 36, (1), (2 >= 2), "2 >= 2");
+    assert("test/arithmetic.c", 37, (1), (3 >= 2), "3 >= 2");
+    assert("test/arithmetic.c", 38, (1), (1 < 1 << 2), "1 < 1 << 2");
+    assert("test/arithmetic.c", 39, (1), (2 > 2 >> 1), "2 > 2 >> 1");
+}
+void testBitwiseOperations(void) {
+    assert("test/arithmetic.c", 43, (1), (3 & 5), "3 & 5");
+    assert("test/arithmetic.c", 44, (7), (3 | 5), "3 | 5");
+    assert("test/arithmetic.c", 45, (6), (3 ^ 5), "3 ^ 5");
+    assert("test/arithmetic.c", 46, (5), (7 & 6 ^ 3), "7 & 6 ^ 3");
+    assert("test/arithmetic.c", 47, (3), (3 & 6 | 1 & 1), "3 & 6 | 1 & 1");
+    assert("test/arithmetic.c", 48, (0), (3 | 7 ^ 7), "3 | 7 ^ 7");
+    assert("test/arithmetic.c", 49, (2), (1 << 1), "1 << 1");
+    assert("test/arithmetic.c", 50, (32), (1 << 5), "1 << 5");
+    assert("test/arithmetic.c", 51, (256), (1 << 8), "1 << 8");
+    assert("test/arithmetic.c", 52, (1), (2 >> 1), "2 >> 1");
+    assert("test/arithmetic.c", 53, (8), (64 >> 3), "64 >> 3");
+    assert("test/arithmetic.c", 54, (-2), (-8 >> 2), "-8 >> 2");
+    assert("test/arithmetic.c", 55, (8), (1 << 1 << 2), "1 << 1 << 2");
+    assert("test/arithmetic.c", 56, (16), (1 << (1 << 2)), "1 << (1 << 2)");
+}
+void testArithmeticAssignment(void) {
+    int n;
+    n = 13;
+    n *= 23;
+    assert("test/arithmetic.c", 64, (299), (n), "n");
+    n = 39;
+    n /= 3;
+    assert("test/arithmetic.c", 68, (13), (n), "n");
+    n = 3;
+    n &= 5;
+    assert("test/arithmetic.c", 72, (1), (n), "n");
+    n = 3;
+    n |= 5;
+    assert("test/arithmetic.c", 76, (7), (n), "n");
+    n = 3;
+    n ^= 5;
+    assert("test/arithmetic.c", 80, (6), (n), "n");
+    n = 2;
+    n <<= 2;
+    assert("test/arithmetic.c", 84, (8), (n), "n");
+    n = 1;
+    n <<= 8;
+    assert("test/arithmetic.c", 88, (256), (n), "n");
+    n = 2;
+    n >>= 1;
+    assert("test/arithmetic.c", 92, (1), (n), "n");
+    n = 64;
+    n >>= 3;
+    assert("test/arithmetic.c", 96, (8), (n), "n");
+    n = -8;
+    n >>= 2;
+    assert("test/arithmetic.c", 100, (-2), (n), "n");
+}
+void testHexNumber(void) {
+    assert("test/arithmetic.c", 104, (15), (0xf), "0xf");
+    assert("test/arithmetic.c", 105, (10), (0xa), "0xa");
+    assert("test/arithmetic.c", 106, (240), (0xf0), "0xf0");
+    assert("test/arithmetic.c", 107, (2623), (0xa3f), "0xa3f");
+}
+void testOctalNumber(void) {
+    assert("test/arithmetic.c", 111, (0), (0), "0");
+    assert("test/arithmetic.c", 112, (0), (00), "00");
+    assert("test/arithmetic.c", 113, (7), (07), "07");
+    assert("test/arithmetic.c", 114, (8), (010), "010");
+    assert("test/arithmetic.c", 115, (59), (073), "073");
+}
+void testImmediateOperands(void) {
+    int n = 7;
+    int a[4] = {1, 2, 3, 4};
+    int *p = &a[1];
+    assert("test/arithmetic.c", 123, (10), (n + 3), "n + 3");
+    assert("test/arithmetic.c", 124, (10), (3 + n), "3 + n");
+    assert("test/arithmetic.c", 125, (4), (n - 3), "n - 3");
+    assert("test/arithmetic.c", 126, (-4), (3 - n), "3 - n");
+    assert("test/arithmetic.c", 127, (28), (n * 4), "n * 4");
+    assert("test/arithmetic.c", 128, (-28), (-4 * n), "-4 * n");
+    assert("test/arithmetic.c", 129, (3), (n & 3), "n & 3");
+    assert("test/arithmetic.c", 130, (15), (8 | n), "8 | n");
+    assert("test/arithmetic.c", 131, (5), (n ^ 2), "n ^ 2");
+    assert("test/arithmetic.c", 132, (56), (n << 3), "n << 3");
+    assert("test/arithmetic.c", 133, (1), (n >> 2), "n >> 2");
+    assert("test/arithmetic.c", 134, (1), (n < 8), "n < 8");
+    assert("test/arithmetic.c", 135, (0), (7 < n), "7 < n");
+    assert("test/arithmetic.c", 136, (1), (7 <= n), "7 <= n");
+    assert("test/arithmetic.c", 137, (1), (7 == n), "7 == n");
+    assert("test/arithmetic.c", 138, (0), (n != 7), "n != 7");
+    assert("test/arithmetic.c", 139, (4), (*(p + 2)), "*(p + 2)");
+    assert("test/arithmetic.c", 140, (4), (*(2 + p)), "*(2 + p)");
+    assert("test/arithmetic.c", 141, (1), (*(p - 1)), "*(p - 1)");
+}
+void testConstantExpressions(void) {
+    int zero = 0;
+    assert("test/arithmetic.c", 146, (4095), ((1 << 12) - 1), "(1 << 12) - 1");
+    assert("test/arithmetic.c", 147, (-7), (7 / -1), "7 / -1");
+    assert("test/arithmetic.c", 148, (1), (7 % -2), "7 % -2");
+    assert("test/arithmetic.c", 149, (44), ((char)300), "(char)300");
+    assert("test/arithmetic.c", 150, (-56), ((char)200), "(char)200");
+    assert("test/arithmetic.c", 151, (1), (3 < 5 && !(2 == 3)), "3 < 5 && !(2 == 3)");
+    assert("test/arithmetic.c", 152, (0), (zero && 1), "zero && 1");
+    assert("test/arithmetic.c", 153, (1), (2 || zero), "2 || zero");
+    assert("test/arithmetic.c", 154, (6), (0 ? 5 : 6), "0 ? 5 : 6");
+    assert("test/arithmetic.c", 155, (13), ((1 + 2) * 4 + 1), "(1 + 2) * 4 + 1");
+}
+void testConstantDivisors(void) {
+    int d3 = 3, d8 = 8, d10 = 10, d641 = 641, dbig = 1000000007;
+    int values[8] = {0, 1, -1, 7919, -104729, 2147483647, -2147483647 - 1, 65536};
+    for (int i = 0; i < 8; ++i) {
+        int n = values[i];
+        assert("test/arithmetic.c", 164, (n / d3), (n / 3), "n / 3");
+        assert("test/arithmetic.c", 165, (n % d3), (n % 3), "n % 3");
+        assert("test/arithmetic.c", 166, (n / d8), (n / 8), "n / 8");
+        assert("test/arithmetic.c", 167, (n % d8), (n % 8), "n % 8");
+        assert("test/arithmetic.c", 168, (n / d10), (n / 10), "n / 10");
+        assert("test/arithmetic.c", 169, (n % d10), (n % 10), "n % 10");
+        assert("test/arithmetic.c", 170, (n / d641), (n / 641), "n / 641");
+        assert("test/arithmetic.c", 171, (n % d641), (n % 641), "n % 641");
+        assert("test/arithmetic.c", 172, (n / dbig), (n / 1000000007), "n / 1000000007");
+        assert("test/arithmetic.c", 173, (n % dbig), (n % 1000000007), "n % 1000000007");
+        assert("test/arithmetic.c", 174, (n), (n / 1), "n / 1");
+        assert("test/arithmetic.c", 175, (0), (n % 1), "n % 1");
+    }
+    assert("test/arithmetic.c", 177, (-2), (-7 / 3), "-7 / 3");
+    assert("test/arithmetic.c", 178, (-1), (-7 % 3), "-7 % 3");
+    assert("test/arithmetic.c", 179, (-3), (-25 / 8), "-25 / 8");
+    assert("test/arithmetic.c", 180, (-1), (-25 % 8), "-25 % 8");
+}
+void testConstantMultipliers(void) {
+    int n = 13;
+    assert("test/arithmetic.c", 185, (104), (n * 8), "n * 8");
+    assert("test/arithmetic.c", 186, (117), (n * 9), "n * 9");
+    assert("test/arithmetic.c", 187, (91), (n * 7), "n * 7");
+    assert("test/arithmetic.c", 188, (-403), (-n * 31), "-n * 31");
+    assert("test/arithmetic.c", 189, (143), (11 * n), "11 * n");
+}
+int main(void) {
+    testArithmeticComputation();
+    testArithmeticAssignment();
+    testHexNumber();
+    testOctalNumber();
+    testImmediateOperands();
+    testConstantExpressions();
+    testConstantDivisors();
+    testConstantMultipliers();
+    return 0;
+}
@@ -0,0 +1,2449 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testArithmeticComputation
+testArithmeticComputation:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 4
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  mov rcx, 6
+  mov r9, 6
+  mov rsi, 5
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 6
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 7
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 8
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  mov rcx, 11
+  mov r9, 11
+  mov rsi, 9
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  mov rcx, 7
+  mov r9, 7
+  mov rsi, 10
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 11
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 12
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 13
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 14
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 15
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  mov rcx, 17
+  mov r9, 17
+  mov rsi, 16
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  mov rcx, 24
+  mov r9, 24
+  mov rsi, 17
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 18
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  mov rcx, 5
+  mov r9, 5
+  mov rsi, 19
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 20
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 21
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 22
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  mov rcx, 75
+  mov r9, 75
+  mov rsi, 23
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 24
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 26
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 27
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 28
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 29
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 30
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 31
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 32
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 33
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 34
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 35
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 36
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 37
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 38
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 39
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testArithmeticComputation:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testBitwiseOperations
+testBitwiseOperations:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 43
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov r8, rax
+  mov rcx, 7
+  mov r9, 7
+  mov rsi, 44
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov r8, rax
+  mov rcx, 6
+  mov r9, 6
+  mov rsi, 45
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov r8, rax
+  mov rcx, 5
+  mov r9, 5
+  mov rsi, 46
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 47
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 48
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 49
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov r8, rax
+  mov rcx, 32
+  mov r9, 32
+  mov rsi, 50
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov r8, rax
+  mov rcx, 256
+  mov r9, 256
+  mov rsi, 51
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 52
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 53
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov r8, rax
+  mov rcx, -2
+  mov r9, -2
+  mov rsi, 54
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 55
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 56
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testBitwiseOperations:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testArithmeticAssignment
+testArithmeticAssignment:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 23
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 299
+  mov rsi, 64
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 39
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xaaaaaaab
+  imul rdi, rax
+  sar rdi, 33
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 68
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 5
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 72
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  or rax, 5
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 76
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  xor rax, 5
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 6
+  mov rsi, 80
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 84
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 256
+  mov rsi, 88
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sar eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 92
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 64
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sar eax, 3
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 96
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, -8
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sar eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, -2
+  mov rsi, 100
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testArithmeticAssignment:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testHexNumber
+testHexNumber:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov r8, rax
+  mov rcx, 15
+  mov r9, 15
+  mov rsi, 104
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 105
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov r8, rax
+  mov rcx, 240
+  mov r9, 240
+  mov rsi, 106
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov r8, rax
+  mov rcx, 2623
+  mov r9, 2623
+  mov rsi, 107
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testHexNumber:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testOctalNumber
+testOctalNumber:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 112
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov r8, rax
+  mov rcx, 7
+  mov r9, 7
+  mov rsi, 113
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 114
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov r8, rax
+  mov rcx, 59
+  mov r9, 59
+  mov rsi, 115
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testOctalNumber:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testImmediateOperands
+testImmediateOperands:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov rdi, 1
+  mov DWORD PTR -20[rbp], edi
+  mov rax, rdi
+  mov rdi, 2
+  mov DWORD PTR -16[rbp], edi
+  mov rax, rdi
+  mov rdi, 3
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 4
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString139[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 123
+  lea rax, QWORD PTR .LiteralString138[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString141[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 124
+  lea rax, QWORD PTR .LiteralString140[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString143[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 3
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 125
+  lea rax, QWORD PTR .LiteralString142[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString145[rip]
+  mov r8, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, -4
+  mov rsi, 126
+  lea rax, QWORD PTR .LiteralString144[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString147[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 2
+  mov rcx, rax
+  mov r9, 28
+  mov rsi, 127
+  lea rax, QWORD PTR .LiteralString146[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString149[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, -4
+  mov rcx, rax
+  mov r9, -28
+  mov rsi, 128
+  lea rax, QWORD PTR .LiteralString148[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString151[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 3
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 129
+  lea rax, QWORD PTR .LiteralString150[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  or rax, 8
+  mov rcx, rax
+  mov r9, 15
+  mov rsi, 130
+  lea rax, QWORD PTR .LiteralString152[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString155[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  xor rax, 2
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 131
+  lea rax, QWORD PTR .LiteralString154[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString157[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal eax, 3
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 56
+  mov rsi, 132
+  lea rax, QWORD PTR .LiteralString156[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString159[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sar eax, 2
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 133
+  lea rax, QWORD PTR .LiteralString158[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString161[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  setl al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 134
+  lea rax, QWORD PTR .LiteralString160[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString163[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  setg al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 135
+  lea rax, QWORD PTR .LiteralString162[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString165[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  setge al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 136
+  lea rax, QWORD PTR .LiteralString164[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString167[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 137
+  lea rax, QWORD PTR .LiteralString166[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString169[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  setne al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 138
+  lea rax, QWORD PTR .LiteralString168[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString171[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 139
+  lea rax, QWORD PTR .LiteralString170[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString173[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 140
+  lea rax, QWORD PTR .LiteralString172[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString175[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 141
+  lea rax, QWORD PTR .LiteralString174[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testImmediateOperands:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testConstantExpressions
+testConstantExpressions:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString177[rip]
+  mov r8, rax
+  mov rcx, 4095
+  mov r9, 4095
+  mov rsi, 146
+  lea rax, QWORD PTR .LiteralString176[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString179[rip]
+  mov r8, rax
+  mov rax, 7
+  mov rdi, -1
+  cqo
+  idiv rdi
+  mov rcx, rax
+  mov r9, -7
+  mov rsi, 147
+  lea rax, QWORD PTR .LiteralString178[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString181[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 148
+  lea rax, QWORD PTR .LiteralString180[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString183[rip]
+  mov r8, rax
+  mov rcx, 44
+  mov r9, 44
+  mov rsi, 149
+  lea rax, QWORD PTR .LiteralString182[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString185[rip]
+  mov r8, rax
+  mov rcx, -56
+  mov r9, -56
+  mov rsi, 150
+  lea rax, QWORD PTR .LiteralString184[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString187[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 151
+  lea rax, QWORD PTR .LiteralString186[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString189[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false1
+  mov rax, 1
+  jmp .Llogical_end1
+.Llogical_false1:
+  mov rax, 0
+.Llogical_end1:
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 152
+  lea rax, QWORD PTR .LiteralString188[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString191[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 153
+  lea rax, QWORD PTR .LiteralString190[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString193[rip]
+  mov r8, rax
+  mov rcx, 6
+  mov r9, 6
+  mov rsi, 154
+  lea rax, QWORD PTR .LiteralString192[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString195[rip]
+  mov r8, rax
+  mov rcx, 13
+  mov r9, 13
+  mov rsi, 155
+  lea rax, QWORD PTR .LiteralString194[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testConstantExpressions:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testConstantDivisors
+testConstantDivisors:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 8
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 10
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 641
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1000000007
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -52[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  mov rdi, 0
+  mov DWORD PTR -52[rbp], edi
+  mov rax, rdi
+  mov rdi, 1
+  mov DWORD PTR -48[rbp], edi
+  mov rax, rdi
+  mov rdi, -1
+  mov DWORD PTR -44[rbp], edi
+  mov rax, rdi
+  mov rdi, 7919
+  mov DWORD PTR -40[rbp], edi
+  mov rax, rdi
+  mov rdi, -104729
+  mov DWORD PTR -36[rbp], edi
+  mov rax, rdi
+  mov rdi, 2147483647
+  mov DWORD PTR -32[rbp], edi
+  mov rax, rdi
+  mov rdi, -2147483648
+  mov DWORD PTR -28[rbp], edi
+  mov rax, rdi
+  mov rdi, 65536
+  mov DWORD PTR -24[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jge .Lend4
+  .p2align 4
+.Lbegin4:
+  lea rdi, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR -52[rbp+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString197[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xaaaaaaab
+  imul rdi, rax
+  sar rdi, 33
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rax
+  mov rsi, 164
+  lea rax, QWORD PTR .LiteralString196[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString199[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xaaaaaaab
+  imul rdi, rax
+  sar rdi, 33
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  imul rdi, 3
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rdx
+  mov rsi, 165
+  lea rax, QWORD PTR .LiteralString198[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString201[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rax, rdi
+  sar rax, 3
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rax
+  mov rsi, 166
+  lea rax, QWORD PTR .LiteralString200[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString203[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rdi, rax
+  and rdi, -8
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rdx
+  mov rsi, 167
+  lea rax, QWORD PTR .LiteralString202[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString205[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcccccccd
+  imul rdi, rax
+  sar rdi, 35
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rax
+  mov rsi, 168
+  lea rax, QWORD PTR .LiteralString204[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString207[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcccccccd
+  imul rdi, rax
+  sar rdi, 35
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  imul rdi, 10
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rdx
+  mov rsi, 169
+  lea rax, QWORD PTR .LiteralString206[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString209[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcc7b0200
+  imul rdi, rax
+  sar rdi, 41
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rax
+  mov rsi, 170
+  lea rax, QWORD PTR .LiteralString208[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString211[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcc7b0200
+  imul rdi, rax
+  sar rdi, 41
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  imul rdi, 641
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rdx
+  mov rsi, 171
+  lea rax, QWORD PTR .LiteralString210[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString213[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0x89705f32
+  imul rdi, rax
+  sar rdi, 61
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rax
+  mov rsi, 172
+  lea rax, QWORD PTR .LiteralString212[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString215[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0x89705f32
+  imul rdi, rax
+  sar rdi, 61
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  imul rdi, 1000000007
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rdx
+  mov rsi, 173
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString217[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  mov rsi, 174
+  lea rax, QWORD PTR .LiteralString216[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString219[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, 0
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 175
+  lea rax, QWORD PTR .LiteralString218[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator4:
+  lea rax, QWORD PTR -56[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jl .Lbegin4
+.Lend4:
+  lea rax, QWORD PTR .LiteralString221[rip]
+  mov r8, rax
+  mov rcx, -2
+  mov r9, -2
+  mov rsi, 177
+  lea rax, QWORD PTR .LiteralString220[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString223[rip]
+  mov r8, rax
+  mov rcx, -1
+  mov r9, -1
+  mov rsi, 178
+  lea rax, QWORD PTR .LiteralString222[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString225[rip]
+  mov r8, rax
+  mov rcx, -3
+  mov r9, -3
+  mov rsi, 179
+  lea rax, QWORD PTR .LiteralString224[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString227[rip]
+  mov r8, rax
+  mov rcx, -1
+  mov r9, -1
+  mov rsi, 180
+  lea rax, QWORD PTR .LiteralString226[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testConstantDivisors:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testConstantMultipliers
+testConstantMultipliers:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString229[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 3
+  mov rcx, rax
+  mov r9, 104
+  mov rsi, 185
+  lea rax, QWORD PTR .LiteralString228[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString231[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*8]
+  mov rcx, rax
+  mov r9, 117
+  mov rsi, 186
+  lea rax, QWORD PTR .LiteralString230[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString233[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sal rax, 3
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, 91
+  mov rsi, 187
+  lea rax, QWORD PTR .LiteralString232[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString235[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  sal rax, 5
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, -403
+  mov rsi, 188
+  lea rax, QWORD PTR .LiteralString234[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString237[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 11
+  mov rcx, rax
+  mov r9, 143
+  mov rsi, 189
+  lea rax, QWORD PTR .LiteralString236[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testConstantMultipliers:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testArithmeticComputation
+  mov al, 0
+  call testArithmeticAssignment
+  mov al, 0
+  call testHexNumber
+  mov al, 0
+  call testOctalNumber
+  mov al, 0
+  call testImmediateOperands
+  mov al, 0
+  call testConstantExpressions
+  mov al, 0
+  call testConstantDivisors
+  mov al, 0
+  call testConstantMultipliers
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/arithmetic.c"
+.LiteralString1:
+  .string  "5-3+2"
+.LiteralString2:
+  .string  "test/arithmetic.c"
+.LiteralString3:
+  .string  "5+3-2"
+.LiteralString4:
+  .string  "test/arithmetic.c"
+.LiteralString5:
+  .string  "6/2"
+.LiteralString6:
+  .string  "test/arithmetic.c"
+.LiteralString7:
+  .string  "7/2"
+.LiteralString8:
+  .string  "test/arithmetic.c"
+.LiteralString9:
+  .string  "8%5"
+.LiteralString10:
+  .string  "test/arithmetic.c"
+.LiteralString11:
+  .string  "5+3*2"
+.LiteralString12:
+  .string  "test/arithmetic.c"
+.LiteralString13:
+  .string  "5+4/2"
+.LiteralString14:
+  .string  "test/arithmetic.c"
+.LiteralString15:
+  .string  "10-4*2"
+.LiteralString16:
+  .string  "test/arithmetic.c"
+.LiteralString17:
+  .string  "10-4/2"
+.LiteralString18:
+  .string  "test/arithmetic.c"
+.LiteralString19:
+  .string  "15/3*2"
+.LiteralString20:
+  .string  "test/arithmetic.c"
+.LiteralString21:
+  .string  "15*2/3"
+.LiteralString22:
+  .string  "test/arithmetic.c"
+.LiteralString23:
+  .string  "(5+3)*2"
+.LiteralString24:
+  .string  "test/arithmetic.c"
+.LiteralString25:
+  .string  "(5+3)*2+1"
+.LiteralString26:
+  .string  "test/arithmetic.c"
+.LiteralString27:
+  .string  "(5+3)*(2+1)"
+.LiteralString28:
+  .string  "test/arithmetic.c"
+.LiteralString29:
+  .string  "(5+3)/2"
+.LiteralString30:
+  .string  "test/arithmetic.c"
+.LiteralString31:
+  .string  "(5+3)/2+1"
+.LiteralString32:
+  .string  "test/arithmetic.c"
+.LiteralString33:
+  .string  "(5+3)/(2+1)"
+.LiteralString34:
+  .string  "test/arithmetic.c"
+.LiteralString35:
+  .string  "-10+20"
+.LiteralString36:
+  .string  "test/arithmetic.c"
+.LiteralString37:
+  .string  "-5*+10+60"
+.LiteralString38:
+  .string  "test/arithmetic.c"
+.LiteralString39:
+  .string  "-(-5*+15)"
+.LiteralString40:
+  .string  "test/arithmetic.c"
+.LiteralString41:
+  .string  "1 == 1"
+.LiteralString42:
+  .string  "test/arithmetic.c"
+.LiteralString43:
+  .string  "0 == 1"
+.LiteralString44:
+  .string  "test/arithmetic.c"
+.LiteralString45:
+  .string  "0 != 1"
+.LiteralString46:
+  .string  "test/arithmetic.c"
+.LiteralString47:
+  .string  "1 != 1"
+.LiteralString48:
+  .string  "test/arithmetic.c"
+.LiteralString49:
+  .string  "1 < 2"
+.LiteralString50:
+  .string  "test/arithmetic.c"
+.LiteralString51:
+  .string  "3 < 2"
+.LiteralString52:
+  .string  "test/arithmetic.c"
+.LiteralString53:
+  .string  "1 <= 2"
+.LiteralString54:
+  .string  "test/arithmetic.c"
+.LiteralString55:
+  .string  "2 <= 2"
+.LiteralString56:
+  .string  "test/arithmetic.c"
+.LiteralString57:
+  .string  "3 <= 2"
+.LiteralString58:
+  .string  "test/arithmetic.c"
+.LiteralString59:
+  .string  "1 > 2"
+.LiteralString60:
+  .string  "test/arithmetic.c"
+.LiteralString61:
+  .string  "3 > 2"
+.LiteralString62:
+  .string  "test/arithmetic.c"
+.LiteralString63:
+  .string  "1 >= 2"
+.LiteralString64:
+  .string  "test/arithmetic.c"
+.LiteralString65:
+  .string  "2 >= 2"
+.LiteralString66:
+  .string  "test/arithmetic.c"
+.LiteralString67:
+  .string  "3 >= 2"
+.LiteralString68:
+  .string  "test/arithmetic.c"
+.LiteralString69:
+  .string  "1 < 1 << 2"
+.LiteralString70:
+  .string  "test/arithmetic.c"
+.LiteralString71:
+  .string  "2 > 2 >> 1"
+.LiteralString72:
+  .string  "test/arithmetic.c"
+.LiteralString73:
+  .string  "3 & 5"
+.LiteralString74:
+  .string  "test/arithmetic.c"
+.LiteralString75:
+  .string  "3 | 5"
+.LiteralString76:
+  .string  "test/arithmetic.c"
+.LiteralString77:
+  .string  "3 ^ 5"
+.LiteralString78:
+  .string  "test/arithmetic.c"
+.LiteralString79:
+  .string  "7 & 6 ^ 3"
+.LiteralString80:
+  .string  "test/arithmetic.c"
+.LiteralString81:
+  .string  "3 & 6 | 1 & 1"
+.LiteralString82:
+  .string  "test/arithmetic.c"
+.LiteralString83:
+  .string  "3 | 7 ^ 7"
+.LiteralString84:
+  .string  "test/arithmetic.c"
+.LiteralString85:
+  .string  "1 << 1"
+.LiteralString86:
+  .string  "test/arithmetic.c"
+.LiteralString87:
+  .string  "1 << 5"
+.LiteralString88:
+  .string  "test/arithmetic.c"
+.LiteralString89:
+  .string  "1 << 8"
+.LiteralString90:
+  .string  "test/arithmetic.c"
+.LiteralString91:
+  .string  "2 >> 1"
+.LiteralString92:
+  .string  "test/arithmetic.c"
+.LiteralString93:
+  .string  "64 >> 3"
+.LiteralString94:
+  .string  "test/arithmetic.c"
+.LiteralString95:
+  .string  "-8 >> 2"
+.LiteralString96:
+  .string  "test/arithmetic.c"
+.LiteralString97:
+  .string  "1 << 1 << 2"
+.LiteralString98:
+  .string  "test/arithmetic.c"
+.LiteralString99:
+  .string  "1 << (1 << 2)"
+.LiteralString100:
+  .string  "test/arithmetic.c"
+.LiteralString101:
+  .string  "n"
+.LiteralString102:
+  .string  "test/arithmetic.c"
+.LiteralString103:
+  .string  "n"
+.LiteralString104:
+  .string  "test/arithmetic.c"
+.LiteralString105:
+  .string  "n"
+.LiteralString106:
+  .string  "test/arithmetic.c"
+.LiteralString107:
+  .string  "n"
+.LiteralString108:
+  .string  "test/arithmetic.c"
+.LiteralString109:
+  .string  "n"
+.LiteralString110:
+  .string  "test/arithmetic.c"
+.LiteralString111:
+  .string  "n"
+.LiteralString112:
+  .string  "test/arithmetic.c"
+.LiteralString113:
+  .string  "n"
+.LiteralString114:
+  .string  "test/arithmetic.c"
+.LiteralString115:
+  .string  "n"
+.LiteralString116:
+  .string  "test/arithmetic.c"
+.LiteralString117:
+  .string  "n"
+.LiteralString118:
+  .string  "test/arithmetic.c"
+.LiteralString119:
+  .string  "n"
+.LiteralString120:
+  .string  "test/arithmetic.c"
+.LiteralString121:
+  .string  "0xf"
+.LiteralString122:
+  .string  "test/arithmetic.c"
+.LiteralString123:
+  .string  "0xa"
+.LiteralString124:
+  .string  "test/arithmetic.c"
+.LiteralString125:
+  .string  "0xf0"
+.LiteralString126:
+  .string  "test/arithmetic.c"
+.LiteralString127:
+  .string  "0xa3f"
+.LiteralString128:
+  .string  "test/arithmetic.c"
+.LiteralString129:
+  .string  "0"
+.LiteralString130:
+  .string  "test/arithmetic.c"
+.LiteralString131:
+  .string  "00"
+.LiteralString132:
+  .string  "test/arithmetic.c"
+.LiteralString133:
+  .string  "07"
+.LiteralString134:
+  .string  "test/arithmetic.c"
+.LiteralString135:
+  .string  "010"
+.LiteralString136:
+  .string  "test/arithmetic.c"
+.LiteralString137:
+  .string  "073"
+.LiteralString138:
+  .string  "test/arithmetic.c"
+.LiteralString139:
+  .string  "n + 3"
+.LiteralString140:
+  .string  "test/arithmetic.c"
+.LiteralString141:
+  .string  "3 + n"
+.LiteralString142:
+  .string  "test/arithmetic.c"
+.LiteralString143:
+  .string  "n - 3"
+.LiteralString144:
+  .string  "test/arithmetic.c"
+.LiteralString145:
+  .string  "3 - n"
+.LiteralString146:
+  .string  "test/arithmetic.c"
+.LiteralString147:
+  .string  "n * 4"
+.LiteralString148:
+  .string  "test/arithmetic.c"
+.LiteralString149:
+  .string  "-4 * n"
+.LiteralString150:
+  .string  "test/arithmetic.c"
+.LiteralString151:
+  .string  "n & 3"
+.LiteralString152:
+  .string  "test/arithmetic.c"
+.LiteralString153:
+  .string  "8 | n"
+.LiteralString154:
+  .string  "test/arithmetic.c"
+.LiteralString155:
+  .string  "n ^ 2"
+.LiteralString156:
+  .string  "test/arithmetic.c"
+.LiteralString157:
+  .string  "n << 3"
+.LiteralString158:
+  .string  "test/arithmetic.c"
+.LiteralString159:
+  .string  "n >> 2"
+.LiteralString160:
+  .string  "test/arithmetic.c"
+.LiteralString161:
+  .string  "n < 8"
+.LiteralString162:
+  .string  "test/arithmetic.c"
+.LiteralString163:
+  .string  "7 < n"
+.LiteralString164:
+  .string  "test/arithmetic.c"
+.LiteralString165:
+  .string  "7 <= n"
+.LiteralString166:
+  .string  "test/arithmetic.c"
+.LiteralString167:
+  .string  "7 == n"
+.LiteralString168:
+  .string  "test/arithmetic.c"
+.LiteralString169:
+  .string  "n != 7"
+.LiteralString170:
+  .string  "test/arithmetic.c"
+.LiteralString171:
+  .string  "*(p + 2)"
+.LiteralString172:
+  .string  "test/arithmetic.c"
+.LiteralString173:
+  .string  "*(2 + p)"
+.LiteralString174:
+  .string  "test/arithmetic.c"
+.LiteralString175:
+  .string  "*(p - 1)"
+.LiteralString176:
+  .string  "test/arithmetic.c"
+.LiteralString177:
+  .string  "(1 << 12) - 1"
+.LiteralString178:
+  .string  "test/arithmetic.c"
+.LiteralString179:
+  .string  "7 / -1"
+.LiteralString180:
+  .string  "test/arithmetic.c"
+.LiteralString181:
+  .string  "7 % -2"
+.LiteralString182:
+  .string  "test/arithmetic.c"
+.LiteralString183:
+  .string  "(char)300"
+.LiteralString184:
+  .string  "test/arithmetic.c"
+.LiteralString185:
+  .string  "(char)200"
+.LiteralString186:
+  .string  "test/arithmetic.c"
+.LiteralString187:
+  .string  "3 < 5 && !(2 == 3)"
+.LiteralString188:
+  .string  "test/arithmetic.c"
+.LiteralString189:
+  .string  "zero && 1"
+.LiteralString190:
+  .string  "test/arithmetic.c"
+.LiteralString191:
+  .string  "2 || zero"
+.LiteralString192:
+  .string  "test/arithmetic.c"
+.LiteralString193:
+  .string  "0 ? 5 : 6"
+.LiteralString194:
+  .string  "test/arithmetic.c"
+.LiteralString195:
+  .string  "(1 + 2) * 4 + 1"
+.LiteralString196:
+  .string  "test/arithmetic.c"
+.LiteralString197:
+  .string  "n / 3"
+.LiteralString198:
+  .string  "test/arithmetic.c"
+.LiteralString199:
+  .string  "n % 3"
+.LiteralString200:
+  .string  "test/arithmetic.c"
+.LiteralString201:
+  .string  "n / 8"
+.LiteralString202:
+  .string  "test/arithmetic.c"
+.LiteralString203:
+  .string  "n % 8"
+.LiteralString204:
+  .string  "test/arithmetic.c"
+.LiteralString205:
+  .string  "n / 10"
+.LiteralString206:
+  .string  "test/arithmetic.c"
+.LiteralString207:
+  .string  "n % 10"
+.LiteralString208:
+  .string  "test/arithmetic.c"
+.LiteralString209:
+  .string  "n / 641"
+.LiteralString210:
+  .string  "test/arithmetic.c"
+.LiteralString211:
+  .string  "n % 641"
+.LiteralString212:
+  .string  "test/arithmetic.c"
+.LiteralString213:
+  .string  "n / 1000000007"
+.LiteralString214:
+  .string  "test/arithmetic.c"
+.LiteralString215:
+  .string  "n % 1000000007"
+.LiteralString216:
+  .string  "test/arithmetic.c"
+.LiteralString217:
+  .string  "n / 1"
+.LiteralString218:
+  .string  "test/arithmetic.c"
+.LiteralString219:
+  .string  "n % 1"
+.LiteralString220:
+  .string  "test/arithmetic.c"
+.LiteralString221:
+  .string  "-7 / 3"
+.LiteralString222:
+  .string  "test/arithmetic.c"
+.LiteralString223:
+  .string  "-7 % 3"
+.LiteralString224:
+  .string  "test/arithmetic.c"
+.LiteralString225:
+  .string  "-25 / 8"
+.LiteralString226:
+  .string  "test/arithmetic.c"
+.LiteralString227:
+  .string  "-25 % 8"
+.LiteralString228:
+  .string  "test/arithmetic.c"
+.LiteralString229:
+  .string  "n * 8"
+.LiteralString230:
+  .string  "test/arithmetic.c"
+.LiteralString231:
+  .string  "n * 9"
+.LiteralString232:
+  .string  "test/arithmetic.c"
+.LiteralString233:
+  .string  "n * 7"
+.LiteralString234:
+  .string  "test/arithmetic.c"
+.LiteralString235:
+  .string  "-n * 31"
+.LiteralString236:
+  .string  "test/arithmetic.c"
+.LiteralString237:
+  .string  "11 * n"
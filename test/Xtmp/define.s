@@ -0,0 +1,1005 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testObjectiveMacro
+testObjectiveMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 53
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 53
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 59
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -22[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov BYTE PTR 8[rdi], 0
+  mov BYTE PTR 9[rdi], 0
+  mov rdi, 82
+  mov BYTE PTR -22[rbp], dil
+  mov rax, rdi
+  mov rdi, 69
+  mov BYTE PTR -21[rbp], dil
+  mov rax, rdi
+  mov rdi, 80
+  mov BYTE PTR -20[rbp], dil
+  mov rax, rdi
+  mov rdi, 95
+  mov BYTE PTR -19[rbp], dil
+  mov rax, rdi
+  mov rdi, 84
+  mov BYTE PTR -18[rbp], dil
+  mov rax, rdi
+  mov rdi, 79
+  mov BYTE PTR -17[rbp], dil
+  mov rax, rdi
+  mov rdi, 95
+  mov BYTE PTR -16[rbp], dil
+  mov rax, rdi
+  mov rdi, 53
+  mov BYTE PTR -15[rbp], dil
+  mov rax, rdi
+  mov rdi, 51
+  mov BYTE PTR -14[rbp], dil
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 53
+  je .Lend0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend0:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 53
+  je .Lend1
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend1:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 59
+  je .Lend2
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend2:
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -22[rbp]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  test rax, rax
+  je .Lend3
+  lea rax, QWORD PTR -22[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend3:
+.Lreturn_testObjectiveMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testEmptyObjectiveMacro
+testEmptyObjectiveMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 101
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 101
+  je .Lend4
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend4:
+.Lreturn_testEmptyObjectiveMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testNestedObjectiveMacro
+testNestedObjectiveMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 59
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 59
+  je .Lend5
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend5:
+.Lreturn_testNestedObjectiveMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test__LINE__macro
+test__LINE__macro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 60
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 60
+  je .Lend6
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend6:
+  mov rdi, 66
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 66
+  je .Lend7
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend7:
+.Lreturn_test__LINE__macro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test__FILE__macro
+test__FILE__macro:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  test rax, rax
+  je .Lend8
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend8:
+.Lreturn_test__FILE__macro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testMacroMultipleExpantion
+testMacroMultipleExpantion:
+.Lreturn_testMacroMultipleExpantion:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testUndef
+testUndef:
+.Lreturn_testUndef:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncLikeMacroWithNoParam
+testFuncLikeMacroWithNoParam:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 101
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 101
+  je .Lend12
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend12:
+.Lreturn_testFuncLikeMacroWithNoParam:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncLikeMacroWithOneParam
+testFuncLikeMacroWithOneParam:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 17
+  je .Lend13
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend13:
+  mov rdi, 4
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Lend14
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend14:
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend15
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend15:
+  mov rdi, 10
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Lend16
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend16:
+.Lreturn_testFuncLikeMacroWithOneParam:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl add2
+add2:
+  mov r10, rdi
+  mov r11, rsi
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_add2
+.Lreturn_add2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncLikeMacroWithMultiParam
+testFuncLikeMacroWithMultiParam:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  mov rdi, 8
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend17
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend17:
+  mov rdi, 31
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  je .Lend18
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend18:
+  mov rdi, 0
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rax, 29
+  mov rdi, 23
+  mov rsi, rax
+  mov al, 0
+  call add2
+  add eax, 36
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 88
+  je .Lelse19_0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+  jmp .Lend19
+.Lelse19_0:
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lend19
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+  jmp .Lend19
+.Lend19:
+  mov rdi, 0
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rax, 37
+  mov rdi, 31
+  mov rsi, rax
+  mov al, 0
+  call add2
+  mov rbx, rax
+  mov rax, 29
+  mov rdi, 23
+  mov rsi, rax
+  mov al, 0
+  call add2
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 120
+  je .Lelse20_0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+  jmp .Lend20
+.Lelse20_0:
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Lend20
+  lea rax, QWORD PTR gValidateCalled[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+  jmp .Lend20
+.Lend20:
+  mov rdi, 67
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 67
+  je .Lend21
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend21:
+.Lreturn_testFuncLikeMacroWithMultiParam:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testLineContinuation
+testLineContinuation:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  je .Lend22
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend22:
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 17
+  je .Lend23
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend23:
+  mov rdi, 216
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 216
+  je .Lend24
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend24:
+  mov rdi, 222
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 222
+  je .Lend25
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend25:
+.Lreturn_testLineContinuation:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testLineContinuationInsideTokens
+testLineContinuationInsideTokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lend26
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend26:
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  test rax, rax
+  je .Lend27
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend27:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lend28
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend28:
+  mov rdi, 256
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 256
+  je .Lend29
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend29:
+  mov rdi, 264
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 264
+  je .Lend30
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend30:
+.Lreturn_testLineContinuationInsideTokens:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testDirectiveLineEnds
+testDirectiveLineEnds:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 68
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 68
+  je .Lend34
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend34:
+.Lreturn_testDirectiveLineEnds:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testObjectiveMacro
+  mov al, 0
+  call testEmptyObjectiveMacro
+  mov al, 0
+  call testNestedObjectiveMacro
+  mov al, 0
+  call test__LINE__macro
+  mov al, 0
+  call test__FILE__macro
+  mov al, 0
+  call testMacroMultipleExpantion
+  mov al, 0
+  call testUndef
+  mov al, 0
+  call testFuncLikeMacroWithNoParam
+  mov al, 0
+  call testFuncLikeMacroWithOneParam
+  mov al, 0
+  call testFuncLikeMacroWithMultiParam
+  mov al, 0
+  call testLineContinuation
+  mov al, 0
+  call testLineContinuationInsideTokens
+  mov al, 0
+  call testDirectiveLineEnds
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "REP_TO_53"
+.LiteralString1:
+  .string  "testObjectiveMacro(): n1 != 53: n1 is %d\n"
+.LiteralString2:
+  .string  "testObjectiveMacro(): n2 != 53: n2 is %d\n"
+.LiteralString3:
+  .string  "testObjectiveMacro(): n3 != 59: n3 is %d\n"
+.LiteralString4:
+  .string  "REP_TO_53"
+.LiteralString5:
+  .string  "testObjectiveMacro(): string is wrongly replaced: %s\n"
+.LiteralString6:
+  .string  "testEmptyObjectiveMacro(): n != 101: n is %d\n"
+.LiteralString7:
+  .string  "testObjectiveMacro(): n != 59: n is %d\n"
+.LiteralString8:
+  .string  "test__LINE__macro(): Wrong line number (direct): %d\n"
+.LiteralString9:
+  .string  "test__LINE__macro(): Wrong line number (indirect): %d\n"
+.LiteralString10:
+  .string  "test/define.c"
+.LiteralString11:
+  .string  "test__FILE__macro(): Filename mismatch: %s\n"
+.LiteralString12:
+  .string  "testMacroMultipleExpantion(): MULTI_EXPAND_1 != 2809: %d\n"
+.LiteralString13:
+  .string  "testMacroMultipleExpantion(): MULTI_EXPAND_2 != 2862: %d\n"
+.LiteralString14:
+  .string  "foo-bar-baz"
+.LiteralString15:
+  .string  "testUndef(): Invalid UNDEF_TEST_MACRO value: %d\n"
+.LiteralString16:
+  .string  "testFuncLikeMacroWithNoParam(): n != 101: %d\n"
+.LiteralString17:
+  .string  "testFuncLikeMacroWithOneParam(): n != 17: %d\n"
+.LiteralString18:
+  .string  "testFuncLikeMacroWithOneParam(): n != 4: %d\n"
+.LiteralString19:
+  .string  "testFuncLikeMacroWithOneParam(): n != 7: %d\n"
+.LiteralString20:
+  .string  "testFuncLikeMacroWithOneParam(): n != 10: %d\n"
+.LiteralString21:
+  .string  "testFuncLikeMacroWithMultiParam(): n != 8: %d\n"
+.LiteralString22:
+  .string  "testFuncLikeMacroWithMultiParam(): n != 31: %d\n"
+.LiteralString23:
+  .string  "testFuncLikeMacroWithMultiParam(): n != 88: %d\n"
+.LiteralString24:
+  .string  "testFuncLikeMacroWithMultiParam(): gValidateCalled != 1: %d\n"
+.LiteralString25:
+  .string  "testFuncLikeMacroWithMultiParam(): n != 120: %d\n"
+.LiteralString26:
+  .string  "testFuncLikeMacroWithMultiParam(): gValidateCalled != 2: %d\n"
+.LiteralString27:
+  .string  "testFuncLikeMacroWithMultiParam(): n != 67: %d\n"
+.LiteralString28:
+  .string  "testLineContinuation(): n != 13: %d\n"
+.LiteralString29:
+  .string  "testLineContinuation(): foobar != 17: %d\n"
+.LiteralString30:
+  .string  "testLineContinuation(): __LINE__ != 216: %d\n"
+.LiteralString31:
+  .string  "testLineContinuation(): __LINE__ != 222: %d\n"
+.LiteralString32:
+  .string  "abcd"
+.LiteralString33:
+  .string  "testLineContinuationInsideTokens(): n != 3: %d\n"
+.LiteralString34:
+  .string  "abcd"
+.LiteralString35:
+  .string  "testLineContinuationInsideTokens(): s != \"abcd\": %s\n"
+.LiteralString36:
+  .string  "testLineContinuationInsideTokens(): n != 3: %d\n"
+.LiteralString37:
+  .string  "testLineContinuationInsideTokens(): __LINE__ != 256: %d\n"
+.LiteralString38:
+  .string  "testLineContinuationInsideTokens(): __LINE__ != 264: %d\n"
+.LiteralString39:
+  .string  "testLineContinuationInsideTokens(): Broken character literal.\n"
+.LiteralString40:
+  .string  "testDirectiveLineEnds(): n != 68: %d\n"
+.LiteralString41:
+  .string  "OK\n"
+.LiteralString42:
+  .string  "test/define.c"
+.LiteralString43:
+  .string  "test/define.c"
+.globl gValidateCalled
+gValidateCalled:
+  .zero 4
@@ -0,0 +1,103 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+enum GA {
+    GItemA,
+    GItemB,
+    GItemC
+};
+enum GAvar {
+    GItemX,
+    GItemY,
+    GItemZ
+} gNamed;
+enum {
+    GNamelessA,
+    GNamelessB,
+    GNamelessC,
+} gNameless;
+enum {
+    GNamelessX,
+    GNamelessY,
+    GNamelessZ,
+};
+void testGlobalEnumWithTag(void) {
+    assert("test/enums.c", 28, (0), (GItemA), "GItemA");
+    assert("test/enums.c", 29, (1), (GItemB), "GItemB");
+    assert("test/enums.c", 30, (2), (GItemC), "GItemC");
+    assert("test/enums.c", 32, (0), (GItemX), "GItemX");
+    assert("test/enums.c", 33, (1), (GItemY), "GItemY");
+    assert("test/enums.c", 34, (2), (GItemZ), "GItemZ");
+    gNamed = GItemY;
+    assert("test/enums.c", 37, (1), (gNamed), "gNamed");
+}
+void testGlobalEnumWithoutTag(void) {
+    assert("test/enums.c", 41, (0), (GNamelessA), "GNamelessA");
+    assert("test/enums.c", 42, (1), (GNamelessB), "GNamelessB");
+    assert("test/enums.c", 43, (2), (GNamelessC), "GNamelessC");
+    assert("test/enums.c", 45, (0), (GNamelessX), "GNamelessX");
+    assert("test/enums.c", 46, (1), (GNamelessY), "GNamelessY");
+    assert("test/enums.c", 47, (2), (GNamelessZ), "GNamelessZ");
+    gNameless = GNamelessZ;
+    assert("test/enums.c", 50, (2), (gNameless), "gNameless");
+}
+void testLocalEnumWithTag(void) {
+    {
+        enum A {
+            ItemA,
+            ItemB,
+            ItemC,
+        };
+        enum A ev = ItemA;
+        int n = ItemC;
+        assert("test/enums.c", 64, (0), (ItemA), "ItemA");
+        assert("test/enums.c", 65, (1), (ItemB), "ItemB");
+        assert("test/enums.c", 66, (2), (ItemC), "ItemC");
+        assert("test/enums.c", 67, (0), (ev), "ev");
+        assert("test/enums.c", 68, (2), (n), "n");
+        ev = ItemB;
+        assert("test/enums.c", 71, (1), (ev), "ev");
+        ev = 13;
+        assert("test/enums.c", 74, (13), (ev), "ev");
+    }
+    {
+        enum B {
+            ItemX,
+            ItemY,
+            ItemZ
+        } v = ItemY;
+        assert("test/enums.c", 83, (0), (ItemX), "ItemX");
+        assert("test/enums.c", 84, (1), (ItemY), "ItemY");
+        assert("test/enums.c", 85, (2), (ItemZ), "ItemZ");
+        assert("test/enums.c", 86, (1), (v), "v");
+    }
+}
+void testLocalEnumWithoutTag(void) {
+    enum {
+        NamelessA,
+        NamelessB,
+        NamelessC,
+    } v = NamelessC;
+    assert("test/enums.c", 97, (0), (NamelessA), "NamelessA");
+    assert("test/enums.c", 98, (1), (NamelessB), "NamelessB");
+    assert("test/enums.c", 99, (2), (NamelessC), "NamelessC");
+    assert("test/enums.c", 100, (2), (v), "v");
+}
+void testSizeOfEnum(void) {
+    enum A {
+        ItemA,
+        ItemB,
+    };
+    assert("test/enums.c", 109, (4), (sizeof(enum A)), "sizeof(enum A)");
+}
+int main(void) {
+    testGlobalEnumWithTag();
+    testGlobalEnumWithoutTag();
+    testLocalEnumWithTag();
+    testLocalEnumWithoutTag();
+    testSizeOfEnum();
+    return 0;
+}
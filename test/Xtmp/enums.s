@@ -0,0 +1,568 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testGlobalEnumWithTag
+testGlobalEnumWithTag:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 28
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 29
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 30
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 32
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 33
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 34
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 1
+  lea rax, QWORD PTR gNamed[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gNamed[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 37
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testGlobalEnumWithTag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testGlobalEnumWithoutTag
+testGlobalEnumWithoutTag:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 41
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 42
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 43
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 45
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 46
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 47
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR gNameless[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gNameless[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 50
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testGlobalEnumWithoutTag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testLocalEnumWithTag
+testLocalEnumWithTag:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 2
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 64
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 65
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 66
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 67
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 68
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 71
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 74
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 83
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 84
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 85
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 86
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testLocalEnumWithTag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testLocalEnumWithoutTag
+testLocalEnumWithoutTag:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 2
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 97
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 98
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 99
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 100
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testLocalEnumWithoutTag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testSizeOfEnum
+testSizeOfEnum:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 109
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testSizeOfEnum:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testGlobalEnumWithTag
+  mov al, 0
+  call testGlobalEnumWithoutTag
+  mov al, 0
+  call testLocalEnumWithTag
+  mov al, 0
+  call testLocalEnumWithoutTag
+  mov al, 0
+  call testSizeOfEnum
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/enums.c"
+.LiteralString1:
+  .string  "GItemA"
+.LiteralString2:
+  .string  "test/enums.c"
+.LiteralString3:
+  .string  "GItemB"
+.LiteralString4:
+  .string  "test/enums.c"
+.LiteralString5:
+  .string  "GItemC"
+.LiteralString6:
+  .string  "test/enums.c"
+.LiteralString7:
+  .string  "GItemX"
+.LiteralString8:
+  .string  "test/enums.c"
+.LiteralString9:
+  .string  "GItemY"
+.LiteralString10:
+  .string  "test/enums.c"
+.LiteralString11:
+  .string  "GItemZ"
+.LiteralString12:
+  .string  "test/enums.c"
+.LiteralString13:
+  .string  "gNamed"
+.LiteralString14:
+  .string  "test/enums.c"
+.LiteralString15:
+  .string  "GNamelessA"
+.LiteralString16:
+  .string  "test/enums.c"
+.LiteralString17:
+  .string  "GNamelessB"
+.LiteralString18:
+  .string  "test/enums.c"
+.LiteralString19:
+  .string  "GNamelessC"
+.LiteralString20:
+  .string  "test/enums.c"
+.LiteralString21:
+  .string  "GNamelessX"
+.LiteralString22:
+  .string  "test/enums.c"
+.LiteralString23:
+  .string  "GNamelessY"
+.LiteralString24:
+  .string  "test/enums.c"
+.LiteralString25:
+  .string  "GNamelessZ"
+.LiteralString26:
+  .string  "test/enums.c"
+.LiteralString27:
+  .string  "gNameless"
+.LiteralString28:
+  .string  "test/enums.c"
+.LiteralString29:
+  .string  "ItemA"
+.LiteralString30:
+  .string  "test/enums.c"
+.LiteralString31:
+  .string  "ItemB"
+.LiteralString32:
+  .string  "test/enums.c"
+.LiteralString33:
+  .string  "ItemC"
+.LiteralString34:
+  .string  "test/enums.c"
+.LiteralString35:
+  .string  "ev"
+.LiteralString36:
+  .string  "test/enums.c"
+.LiteralString37:
+  .string  "n"
+.LiteralString38:
+  .string  "test/enums.c"
+.LiteralString39:
+  .string  "ev"
+.LiteralString40:
+  .string  "test/enums.c"
+.LiteralString41:
+  .string  "ev"
+.LiteralString42:
+  .string  "test/enums.c"
+.LiteralString43:
+  .string  "ItemX"
+.LiteralString44:
+  .string  "test/enums.c"
+.LiteralString45:
+  .string  "ItemY"
+.LiteralString46:
+  .string  "test/enums.c"
+.LiteralString47:
+  .string  "ItemZ"
+.LiteralString48:
+  .string  "test/enums.c"
+.LiteralString49:
+  .string  "v"
+.LiteralString50:
+  .string  "test/enums.c"
+.LiteralString51:
+  .string  "NamelessA"
+.LiteralString52:
+  .string  "test/enums.c"
+.LiteralString53:
+  .string  "NamelessB"
+.LiteralString54:
+  .string  "test/enums.c"
+.LiteralString55:
+  .string  "NamelessC"
+.LiteralString56:
+  .string  "test/enums.c"
+.LiteralString57:
+  .string  "v"
+.LiteralString58:
+  .string  "test/enums.c"
+.LiteralString59:
+  .string  "sizeof(enum A)"
+.globl gNameless
+gNameless:
+  .zero 4
+.globl gNamed
+gNamed:
+  .zero 4
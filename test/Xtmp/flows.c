@@ -0,0 +1,739 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int g_test_cond_operator_validator;
+int test_if_return_1(void) {
+    if (1)
+        return 42;
+    return 10;
+}
+int test_if_return_2(void) {
+    if (0)
+        return 10;
+    return 42;
+}
+int test_if_return_3(void) {
+    if (1)
+        if(1)
+            return 42;
+    return 10;
+}
+int test_if_return_4(void) {
+    if (1)
+        if(0)
+            return 10;
+    return 42;
+}
+int test_if_return_5(void) {
+    if (0)
+        return 10;
+    else
+        return 42;
+    return 20;
+}
+int test_if_return_6(void) {
+    if (0)
+        return 10;
+    else if (1)
+        return 42;
+    else
+        return 20;
+    return 30;
+}
+int test_if_return_7(void) {
+    if (0)
+        return 10;
+    else if (0)
+        return 20;
+    else if (1)
+        return 42;
+    else
+        return 30;
+    return 40;
+}
+int test_if_return_8(void) {
+    if (0)
+        return 10;
+    else if (0)
+        return 20;
+    else if (0)
+        return 30;
+    else
+        return 42;
+    return 40;
+}
+int test_if_return_9(void) {
+    if (0)
+        return 10;
+    else if (0)
+        return 20;
+    else if (0)
+        return 30;
+    return 42;
+}
+void test_switch_case_default(void) {
+    {
+        int n = 3;
+        int validation = 0;
+        switch (n) {
+        case 3:
+            validation = 11;
+            break;
+        case 4:
+            validation = 13;
+            break;
+        default:
+            validation = 17;
+            break;
+        }
+        assert("test/flows.c", 98, (11), (validation), "validation");
+    }
+    {
+        int n = 4;
+        int validation = 0;
+        switch (n) {
+        case 3:
+            validation = 11;
+            break;
+        case 4:
+            validation = 13;
+            break;
+        default:
+            validation = 17;
+            break;
+        }
+        assert("test/flows.c", 114, (13), (validation), "validation");
+    }
+    {
+        int n = 100;
+        int validation = 0;
+        switch (n) {
+        case 3:
+            validation = 11;
+            break;
+        case 4:
+            validation = 13;
+            break;
+        default:
+            validation = 17;
+            break;
+        }
+        assert("test/flows.c", 130, (17), (validation), "validation");
+    }
+    {
+        int n = 4;
+        int validation = 0;
+        switch (n) {
+        case 3:
+            validation = 7;
+            break;
+        case 4:
+            validation += 11;
+            validation += 13;
+            break;
+        default:
+            validation = 17;
+            break;
+        }
+        assert("test/flows.c", 147, (24), (validation), "validation");
+    }
+}
+void test_switch_no_default(void) {
+    int n = 100;
+    int validation = 7;
+    switch (n) {
+    case 3:
+        validation = 11;
+        break;
+    case 4:
+        validation = 13;
+        break;
+    }
+    assert("test/flows.c", 162, (7), (validation), "validation");
+}
+void test_switch_fallthrough(void) {
+    int n = 3;
+    int validation = 7;
+    switch (n) {
+    case 3:
+        validation += 11;
+    case 4:
+        validation += 13;
+        break;
+    }
+    assert("test/flows.c", 175, (31), (validation), "validation");
+}
+void test_switch_scope(void) {
+    int n = 2;
+    switch (n) {
+        int a = 3;
+    case 1:
+        a = 5;
+    case 2:
+        a = 7;
+    default:
+        assert("test/flows.c", 187, (7), (a), "a");
+    }
+}
+int strcmp(const char *, const char *);
+void test_switch_duffs_device(void) {
+    char s1[100] = {};
+    char s2[] = "abcdefghijklmnopqrstuvwxyz";
+    char *to = s1;
+    char *from = s2;
+    int count = sizeof(s2);
+    switch (count % 8) {
+       case 0: do { *to++ = *from++;
+       case 7: *to++ = *from++;
+       case 6: *to++ = *from++;
+       case 5: *to++ = *from++;
+       case 4: *to++ = *from++;
+       case 3: *to++ = *from++;
+       case 2: *to++ = *from++;
+       case 1: *to++ = *from++;
+                } while ((count -= 8) > 0);
+     }
+    assert("test/flows.c", 214, (0), (strcmp(s1, s2)), "strcmp(s1, s2)");
+}
+void test_switch_break_in_loop(void) {
+    int n1 = 13;
+    int n2 = 17;
+    while (1) {
+        switch (5) {
+        case 5:
+            n1 = 23;
+            break;
+        }
+        n2 = 29;
+        break;
+    }
+    assert("test/flows.c", 229, (23), (n1), "n1");
+    assert("test/flows.c", 230, (29), (n2), "n2");
+}
+void test_switch_nest(void) {
+    int inner = 23;
+    int outer = 29;
+    switch (5) {
+    case 5:
+        switch (7) {
+        case 7:
+            inner = 31;
+            break;
+        }
+        outer = 37;
+        break;
+    }
+    assert("test/flows.c", 246, (31), (inner), "inner");
+    assert("test/flows.c", 247, (37), (outer), "outer");
+}
+void test_switch_constFolding(void) {
+    int n = 0;
+    switch (13) {
+    case 1 + 2: n = 3; break;
+    case (2 + 3 - 1) * 4 / 2 + ((12 | 4 ^ (3 + (1 << 3))) & 3) + (1 << 1): n = 5; break;
+    case 3+10-2*3: n = 7; break;
+    case 3 ? 5 : 0: n = 11; break;
+    case 0 ? 5 : 0: n = 13; break;
+    }
+    assert("test/flows.c", 259, (5), (n), "n");
+}
+int switch_dense(int n) {
+    switch (n) {
+    case -2: return 10;
+    case -1: return 11;
+    case 0: return 12;
+    case 1: return 13;
+    case 3: return 15;
+    case 4: return 16;
+    default: return 99;
+    }
+}
+int switch_dense_no_default(int n) {
+    int r = 0;
+    switch (n) {
+    case 10: r = 1;
+    case 11: r += 2; break;
+    case 12: r = 4; break;
+    case 14: r = 8; break;
+    }
+    return r;
+}
+int switch_sparse(int n) {
+    switch (n) {
+    case -1000: return 1;
+    case -7: return 2;
+    case 3: return 3;
+    case 90: return 4;
+    case 512: return 5;
+    case 4096: return 6;
+    case 100000: return 7;
+    case 2147483647: return 8;
+    default: return 0;
+    }
+}
+void test_switch_dispatch(void) {
+    assert("test/flows.c", 300, (99), (switch_dense(-3)), "switch_dense(-3)");
+    assert("test/flows.c", 301, (10), (switch_dense(-2)), "switch_dense(-2)");
+    assert("test/flows.c", 302, (11), (switch_dense(-1)), "switch_dense(-1)");
+    assert("test/flows.c", 303, (12), (switch_dense(0)), "switch_dense(0)");
+    assert("test/flows.c", 304, (13), (switch_dense(1)), "switch_dense(1)");
+    assert("test/flows.c", 305, (99), (switch_dense(2)), "switch_dense(2)");
+    assert("test/flows.c", 306, (15), (switch_dense(3)), "switch_dense(3)");
+    assert("test/flows.c", 307, (16), (switch_dense(4)), "switch_dense(4)");
+    assert("test/flows.c", 308, (99), (switch_dense(5)), "switch_dense(5)");
+    assert("test/flows.c", 309, (99), (switch_dense(-2147483647)), "switch_dense(-2147483647)");
+    assert("test/flows.c", 311, (0), (switch_dense_no_default(9)), "switch_dense_no_default(9)");
+    assert("test/flows.c", 312, (3), (switch_dense_no_default(10)), "switch_dense_no_default(10)");
+    assert("test/flows.c", 313, (2), (switch_dense_no_default(11)), "switch_dense_no_default(11)");
+    assert("test/flows.c", 314, (4), (switch_dense_no_default(12)), "switch_dense_no_default(12)");
+    assert("test/flows.c", 315, (0), (switch_dense_no_default(13)), "switch_dense_no_default(13)");
+    assert("test/flows.c", 316, (8), (switch_dense_no_default(14)), "switch_dense_no_default(14)");
+    assert("test/flows.c", 317, (0), (switch_dense_no_default(15)), "switch_dense_no_default(15)");
+    assert("test/flows.c", 319, (1), (switch_sparse(-1000)), "switch_sparse(-1000)");
+    assert("test/flows.c", 320, (2), (switch_sparse(-7)), "switch_sparse(-7)");
+    assert("test/flows.c", 321, (3), (switch_sparse(3)), "switch_sparse(3)");
+    assert("test/flows.c", 322, (4), (switch_sparse(90)), "switch_sparse(90)");
+    assert("test/flows.c", 323, (5), (switch_sparse(512)), "switch_sparse(512)");
+    assert("test/flows.c", 324, (6), (switch_sparse(4096)), "switch_sparse(4096)");
+    assert("test/flows.c", 325, (7), (switch_sparse(100000)), "switch_sparse(100000)");
+    assert("test/flows.c", 326, (8), (switch_sparse(2147483647)), "switch_sparse(2147483647)");
+    assert("test/flows.c", 327, (0), (switch_sparse(0)), "switch_sparse(0)");
+    assert("test/flows.c", 328, (0), (switch_sparse(-8)), "switch_sparse(-8)");
+    assert("test/flows.c", 329, (0), (switch_sparse(91)), "switch_sparse(91)");
+    assert("test/flows.c", 330, (0), (switch_sparse(100001)), "switch_sparse(100001)");
+}
+int never_called(void) {
+    do {printf("%s:%d: unreachable", "test/flows.c", 334); assert("test/flows.c", 334, (0), (1), "1");} while(0);
+    return 0;
+}
+void test_constant_condition(void) {
+    int n = 0;
+    if (0)
+        n = never_called();
+    else if (1 - 1)
+        n = never_called();
+    else if (2)
+        n = 3;
+    else
+        n = never_called();
+    assert("test/flows.c", 349, (3), (n), "n");
+    if (1)
+        n = 5;
+    else
+        n = never_called();
+    assert("test/flows.c", 355, (5), (n), "n");
+    for (; 0;)
+        n = never_called();
+    assert("test/flows.c", 359, (5), (n), "n");
+    n = 1 ? 7 : never_called();
+    assert("test/flows.c", 362, (7), (n), "n");
+    switch (n) {
+    case 1:
+        if (0) {
+        case 7:
+            n = 11;
+        }
+    }
+    assert("test/flows.c", 372, (11), (n), "n");
+}
+int test_for_return_1(void) {
+    for (;;)
+        return 10;
+}
+int test_for_return_2(void) {
+    int i;
+    for (i = 1;;)
+        return 10;
+}
+int test_for_return_3(void) {
+    for (; 1;)
+        return 10;
+}
+int test_for_return_4(void) {
+    for (;; 1)
+        return 10;
+}
+int test_for_1(void) {
+    int a, i;
+    a = 0;
+    for (i = 0; i < 3; ++i)
+        a = a + i + 1;
+    return a;
+}
+int test_for_2(void) {
+    int a, b, i;
+    a = b = 1;
+    for (i = 0; i < 9; ++i) {
+        int tmp;
+        tmp = a;
+        a = a + b;
+        b = tmp;
+    }
+    return a;
+}
+int test_for_3(void) {
+    int sum = 0;
+    for (int i = 1; i <= 10; ++i) {
+        sum += i;
+    }
+    return sum;
+}
+void test_for_4(void) {
+    int i = 0;
+    for (; i < 3; ++i);
+    assert("test/flows.c", 428, (3), (i), "i");
+}
+int test_for_break_1(void) {
+    int n = 7;
+    for (;;) {
+        break;
+        n = 5;
+    }
+    return n;
+}
+int test_for_break_2(void) {
+    int n = 7;
+    for (;;)
+        break;
+    n = 5;
+    return n;
+}
+int test_for_break_3(void) {
+    int n = 7;
+    for (;;) {
+        n++;
+        break;
+    }
+    return n;
+}
+int test_for_break_4(void) {
+    int n = 11;
+    for (int i = 0; i < 1; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            n = 7;
+            break;
+        }
+        n = 5;
+    }
+    return n;
+}
+int test_for_break_5(void) {
+    int n = 11;
+    if (1) {
+        for (;;) {
+            n = 7;
+            break;
+        }
+        n = 5;
+    }
+    return n;
+}
+int test_for_break_6(void) {
+    int n[3] = {1, 1, 1};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                ++n[2];
+            }
+            ++n[1];
+            break;
+        }
+        ++n[0];
+        break;
+    }
+    return n[0] * 10000 + n[1] * 100 + n[2];
+}
+void test_for_continue_1(void) {
+    int i, n;
+    n = 7;
+    for (i = 0; i < 5; ++i) {
+        continue;
+        n = 13;
+    }
+    assert("test/flows.c", 504, (5), (i), "i");
+    assert("test/flows.c", 505, (7), (n), "n");
+}
+void test_for_continue_2(void) {
+    int i, j, n;
+    n = 13;
+    for (i = 0; i < 3; ++i) {
+        for (j = 0; j < 5; ++j) {
+            continue;
+            n = 17;
+        }
+    }
+    assert("test/flows.c", 517, (13), (n), "n");
+    assert("test/flows.c", 518, (3), (i), "i");
+    assert("test/flows.c", 519, (5), (j), "j");
+}
+void test_for_continue_3(void) {
+    int i, j, n;
+    n = 13;
+    for (i = 0; i < 3; ++i) {
+        for (j = 0; j < 3; ++j) {
+            n = 17;
+            continue;
+            n = 19;
+        }
+    }
+    assert("test/flows.c", 533, (17), (n), "n");
+    assert("test/flows.c", 534, (3), (i), "i");
+    assert("test/flows.c", 535, (3), (j), "j");
+}
+void test_for_continue_4(void) {
+    int flag_stay = 1;
+    int n = 13;
+    for (; flag_stay;) {
+        n++;
+        flag_stay = 0;
+        continue;
+    }
+    assert("test/flows.c", 546, (14), (n), "n");
+}
+int test_while_return_1(void) {
+    while(1)
+        return 10;
+}
+int test_while_1(void) {
+    while(0)
+        return 3;
+    return 10;
+}
+int test_while_2(void) {
+    int a;
+    a = 0;
+    while (a < 1)
+        while (a < 2)
+            a++;
+    return 50;
+}
+int test_while_3(void) {
+    int a;
+    a = 0;
+    while (a < 10)
+        while (a < 20)
+            a++;
+    return a;
+}
+void test_do_while(void) {
+    int n = 5;
+    assert("test/flows.c", 580, (5), (n), "n");
+    do {
+        n += 2;
+    } while(0);
+    assert("test/flows.c", 584, (7), (n), "n");
+}
+void test_do_while_break(void) {
+    int n = 5;
+    assert("test/flows.c", 589, (5), (n), "n");
+    do {
+        break;
+        n += 2;
+    } while(0);
+    assert("test/flows.c", 594, (5), (n), "n");
+}
+void test_do_while_continue_1(void) {
+    int n = 5, m = 13;
+    int count = 0;
+    assert("test/flows.c", 600, (5), (n), "n");
+    do {
+        count++;
+        if (count <= 2)
+            continue;
+        m += 5;
+        break;
+        n += 2;
+    } while(1);
+    assert("test/flows.c", 609, (5), (n), "n");
+    assert("test/flows.c", 610, (18), (m), "m");
+}
+void test_do_while_continue_2(void) {
+    int n = 13;
+    do {
+        n++;
+        continue;
+    } while(0);
+    assert("test/flows.c", 619, (14), (n), "n");
+}
+int helper_always_1(void) {
+    return 1;
+}
+int helper_always_3(void) {
+    return 3;
+}
+void test_comma_1(void) {
+    int n[] = {5, 7, 11, 13, 17, 19};
+    int r;
+    r = n[helper_always_1(), helper_always_3()];
+    assert("test/flows.c", 635, (13), (r), "r");
+    r = n[helper_always_3(), helper_always_1()];
+    assert("test/flows.c", 637, (7), (r), "r");
+}
+void test_comma_2(void) {
+    int a = 3, b = 5;
+    int c;
+    c = a = 11, b = 13;
+    assert("test/flows.c", 644, (11), (a), "a");
+    assert("test/flows.c", 645, (13), (b), "b");
+    assert("test/flows.c", 646, (11), (c), "c");
+}
+void test_cond_not(void) {
+    int a = 3;
+    int n = 7;
+    assert("test/flows.c", 653, (3), (a), "a");
+    if (!a) {
+        n = 11;
+    } else {
+        n = 13;
+    }
+    assert("test/flows.c", 659, (13), (n), "n");
+    a = 0;
+    assert("test/flows.c", 662, (0), (a), "a");
+    if (!a) {
+        n = 17;
+    } else {
+        n = 19;
+    }
+    assert("test/flows.c", 668, (17), (n), "n");
+}
+void test_not(void) {
+    int p = 3;
+    if (!0 && !0 && !0) p = 5;
+    assert("test/flows.c", 675, (5), (p), "p");
+}
+void make_value_13(int *n) {
+    do {
+        *n = 13;
+        return;
+    } while(0);
+    *n = 17;
+}
+void test_return_without_expr(void) {
+    int n = 0;
+    assert("test/flows.c", 688, (0), (n), "n");
+    make_value_13(&n);
+    assert("test/flows.c", 690, (13), (n), "n");
+}
+int helper_conditional_operator_set_13(void) {
+    g_test_cond_operator_validator = 13;
+    return 0;
+}
+void test_conditional_operator(void) {
+    int n = 1 ? 13 : 19;
+    assert("test/flows.c", 700, (13), (n), "n");
+    n = 0 ? 23 : 29;
+    assert("test/flows.c", 703, (29), (n), "n");
+    n = 1 ? 1 ? 31 : 37 : 41;
+    assert("test/flows.c", 706, (31), (n), "n");
+    n = 1 ? 0 ? 47 : 53 : 59;
+    assert("test/flows.c", 709, (53), (n), "n");
+    n = 0 ? 0 ? 61 : 67 : 1 ? 71 : 73;
+    assert("test/flows.c", 712, (71), (n), "n");
+    g_test_cond_operator_validator = 0;
+    n = 0 ? helper_conditional_operator_set_13() : 19;
+    assert("test/flows.c", 716, (0), (g_test_cond_operator_validator), "g_test_cond_operator_validator");
+    n = 1 ? helper_conditional_operator_set_13() : 19;
+    assert("test/flows.c", 719, (13), (g_test_cond_operator_validator), "g_test_cond_operator_validator");
+}
+void test_rotated_loops(void) {
+    int i, j, n = 0;
+    for (i = 0; i < 0; ++i)
+        n = 100;
+    assert("test/flows.c", 726, (0), (n), "n");
+    for (i = 0; i < 10 && n < 20; ++i) {
+        if (i == 3)
+            continue;
+        n += i;
+    }
+    assert("test/flows.c", 732, (8), (i), "i");
+    assert("test/flows.c", 733, (25), (n), "n");
+    for (i = 0, n = 0; i < 5 || i == 7; ++i) {
+        for (j = 0; j < i ? 1 : 0; ++j)
+            ++n;
+        if (i == 4)
+            i = 6;
+    }
+    assert("test/flows.c", 740, (8), (i), "i");
+    assert("test/flows.c", 741, (17), (n), "n");
+    n = 0;
+    while (!n && i)
+        n = i--;
+    assert("test/flows.c", 745, (8), (n), "n");
+}
+void test_keyword_like_names(void) {
+    int iffy = 1;
+    int doit = 2;
+    int interval = 3;
+    int elsewhere = 0;
+    int n = 0;
+    if (iffy == 2)
+        n = 1;
+    else{if (doit == 2)
+            n = interval;
+    }
+    assert("test/flows.c", 760, (3), (n), "n");
+    if (elsewhere)
+        n = 1;
+    else
+    if (n == 3)
+        n = 4;
+    assert("test/flows.c", 767, (4), (n), "n");
+}
+int main(void) {
+    assert("test/flows.c", 771, (42), (test_if_return_1()), "test_if_return_1()");
+    assert("test/flows.c", 772, (42), (test_if_return_2()), "test_if_return_2()");
+    assert("test/flows.c", 773, (42), (test_if_return_3()), "test_if_return_3()");
+    assert("test/flows.c", 774, (42), (test_if_return_4()), "test_if_return_4()");
+    assert("test/flows.c", 775, (42), (test_if_return_5()), "test_if_return_5()");
+    assert("test/flows.c", 776, (42), (test_if_return_6()), "test_if_return_6()");
+    assert("test/flows.c", 777, (42), (test_if_return_7()), "test_if_return_7()");
+    assert("test/flows.c", 778, (42), (test_if_return_8()), "test_if_return_8()");
+    assert("test/flows.c", 779, (42), (test_if_return_9()), "test_if_return_9()");
+    test_switch_case_default();
+    test_switch_no_default();
+    test_switch_fallthrough();
+    test_switch_scope();
+    test_switch_duffs_device();
+    test_switch_break_in_loop();
+    test_switch_nest();
+    test_switch_constFolding();
+    test_switch_dispatch();
+    test_constant_condition();
+    assert("test/flows.c", 790, (10), (test_for_return_1()), "test_for_return_1()");
+    assert("test/flows.c", 791, (10), (test_for_return_2()), "test_for_return_2()");
+    assert("test/flows.c", 792, (10), (test_for_return_3()), "test_for_return_3()");
+    assert("test/flows.c", 793, (10), (test_for_return_4()), "test_for_return_4()");
+    assert("test/flows.c", 794, (6), (test_for_1()), "test_for_1()");
+    assert("test/flows.c", 795, (89), (test_for_2()), "test_for_2()");
+    assert("test/flows.c", 796, (55), (test_for_3()), "test_for_3()");
+    test_for_4();
+    assert("test/flows.c", 798, (7), (test_for_break_1()), "test_for_break_1()");
+    assert("test/flows.c", 799, (5), (test_for_break_2()), "test_for_break_2()");
+    assert("test/flows.c", 800, (8), (test_for_break_3()), "test_for_break_3()");
+    assert("test/flows.c", 801, (5), (test_for_break_4()), "test_for_break_4()");
+    assert("test/flows.c", 802, (5), (test_for_break_5()), "test_for_break_5()");
+    assert("test/flows.c", 803, (20204), (test_for_break_6()), "test_for_break_6()");
+    test_for_continue_1();
+    test_for_continue_2();
+    test_for_continue_3();
+    test_for_continue_4();
+    assert("test/flows.c", 808, (10), (test_while_return_1()), "test_while_return_1()");
+    assert("test/flows.c", 809, (10), (test_while_1()), "test_while_1()");
+    assert("test/flows.c", 810, (50), (test_while_2()), "test_while_2()");
+    assert("test/flows.c", 811, (20), (test_while_3()), "test_while_3()");
+    test_do_while();
+    test_do_while_break();
+    test_do_while_continue_1();
+    test_do_while_continue_2();
+    test_comma_1();
+    test_comma_2();
+    test_cond_not();
+    test_not();
+    test_conditional_operator();
+    test_rotated_loops();
+    test_keyword_like_names();
+    return 0;
+}
@@ -0,0 +1,5037 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl test_if_return_1
+test_if_return_1:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_1
+  mov rax, 10
+  jmp .Lreturn_test_if_return_1
+.Lreturn_test_if_return_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_2
+test_if_return_2:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_2
+.Lreturn_test_if_return_2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_3
+test_if_return_3:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_3
+  mov rax, 10
+  jmp .Lreturn_test_if_return_3
+.Lreturn_test_if_return_3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_4
+test_if_return_4:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_4
+.Lreturn_test_if_return_4:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_5
+test_if_return_5:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_5
+  mov rax, 20
+  jmp .Lreturn_test_if_return_5
+.Lreturn_test_if_return_5:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_6
+test_if_return_6:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_6
+  mov rax, 30
+  jmp .Lreturn_test_if_return_6
+.Lreturn_test_if_return_6:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_7
+test_if_return_7:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_7
+  mov rax, 40
+  jmp .Lreturn_test_if_return_7
+.Lreturn_test_if_return_7:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_8
+test_if_return_8:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_8
+  mov rax, 40
+  jmp .Lreturn_test_if_return_8
+.Lreturn_test_if_return_8:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_if_return_9
+test_if_return_9:
+  mov rax, 42
+  jmp .Lreturn_test_if_return_9
+.Lreturn_test_if_return_9:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_case_default
+test_switch_case_default:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_11_3
+  cmp rax, 4
+  je .Lswitch_case_11_4
+  jmp .Lswitch_default_11
+.Lswitch_case_11_3:
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend11
+.Lswitch_case_11_4:
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend11
+.Lswitch_default_11:
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend11
+.Lend11:
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 98
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 4
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_12_3
+  cmp rax, 4
+  je .Lswitch_case_12_4
+  jmp .Lswitch_default_12
+.Lswitch_case_12_3:
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend12
+.Lswitch_case_12_4:
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend12
+.Lswitch_default_12:
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend12
+.Lend12:
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 114
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 100
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_13_3
+  cmp rax, 4
+  je .Lswitch_case_13_4
+  jmp .Lswitch_default_13
+.Lswitch_case_13_3:
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend13
+.Lswitch_case_13_4:
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend13
+.Lswitch_default_13:
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend13
+.Lend13:
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 130
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 4
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_14_3
+  cmp rax, 4
+  je .Lswitch_case_14_4
+  jmp .Lswitch_default_14
+.Lswitch_case_14_3:
+  mov rdi, 7
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend14
+.Lswitch_case_14_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 11
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 13
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend14
+.Lswitch_default_14:
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend14
+.Lend14:
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 24
+  mov rsi, 147
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_switch_case_default:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_no_default
+test_switch_no_default:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 100
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_15_3
+  cmp rax, 4
+  je .Lswitch_case_15_4
+  jmp .Lend15
+.Lswitch_case_15_3:
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend15
+.Lswitch_case_15_4:
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend15
+.Lend15:
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 162
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_switch_no_default:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_fallthrough
+test_switch_fallthrough:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_16_3
+  cmp rax, 4
+  je .Lswitch_case_16_4
+  jmp .Lend16
+.Lswitch_case_16_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 11
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lswitch_case_16_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 13
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend16
+.Lend16:
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 175
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_switch_fallthrough:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_scope
+test_switch_scope:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 2
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lswitch_case_17_1
+  cmp rax, 2
+  je .Lswitch_case_17_2
+  jmp .Lswitch_default_17
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lswitch_case_17_1:
+  mov rdi, 5
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lswitch_case_17_2:
+  mov rdi, 7
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lswitch_default_17:
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 187
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lend17:
+.Lreturn_test_switch_scope:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_duffs_device
+test_switch_duffs_device:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov QWORD PTR -160[rbp], rbx
+  lea rdi, QWORD PTR -100[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  mov DWORD PTR 96[rdi], 0
+  lea rdi, QWORD PTR -127[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov BYTE PTR 24[rdi], 0
+  mov BYTE PTR 25[rdi], 0
+  mov BYTE PTR 26[rdi], 0
+  mov rdi, 97
+  mov BYTE PTR -127[rbp], dil
+  mov rax, rdi
+  mov rdi, 98
+  mov BYTE PTR -126[rbp], dil
+  mov rax, rdi
+  mov rdi, 99
+  mov BYTE PTR -125[rbp], dil
+  mov rax, rdi
+  mov rdi, 100
+  mov BYTE PTR -124[rbp], dil
+  mov rax, rdi
+  mov rdi, 101
+  mov BYTE PTR -123[rbp], dil
+  mov rax, rdi
+  mov rdi, 102
+  mov BYTE PTR -122[rbp], dil
+  mov rax, rdi
+  mov rdi, 103
+  mov BYTE PTR -121[rbp], dil
+  mov rax, rdi
+  mov rdi, 104
+  mov BYTE PTR -120[rbp], dil
+  mov rax, rdi
+  mov rdi, 105
+  mov BYTE PTR -119[rbp], dil
+  mov rax, rdi
+  mov rdi, 106
+  mov BYTE PTR -118[rbp], dil
+  mov rax, rdi
+  mov rdi, 107
+  mov BYTE PTR -117[rbp], dil
+  mov rax, rdi
+  mov rdi, 108
+  mov BYTE PTR -116[rbp], dil
+  mov rax, rdi
+  mov rdi, 109
+  mov BYTE PTR -115[rbp], dil
+  mov rax, rdi
+  mov rdi, 110
+  mov BYTE PTR -114[rbp], dil
+  mov rax, rdi
+  mov rdi, 111
+  mov BYTE PTR -113[rbp], dil
+  mov rax, rdi
+  mov rdi, 112
+  mov BYTE PTR -112[rbp], dil
+  mov rax, rdi
+  mov rdi, 113
+  mov BYTE PTR -111[rbp], dil
+  mov rax, rdi
+  mov rdi, 114
+  mov BYTE PTR -110[rbp], dil
+  mov rax, rdi
+  mov rdi, 115
+  mov BYTE PTR -109[rbp], dil
+  mov rax, rdi
+  mov rdi, 116
+  mov BYTE PTR -108[rbp], dil
+  mov rax, rdi
+  mov rdi, 117
+  mov BYTE PTR -107[rbp], dil
+  mov rax, rdi
+  mov rdi, 118
+  mov BYTE PTR -106[rbp], dil
+  mov rax, rdi
+  mov rdi, 119
+  mov BYTE PTR -105[rbp], dil
+  mov rax, rdi
+  mov rdi, 120
+  mov BYTE PTR -104[rbp], dil
+  mov rax, rdi
+  mov rdi, 121
+  mov BYTE PTR -103[rbp], dil
+  mov rax, rdi
+  mov rdi, 122
+  mov BYTE PTR -102[rbp], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -100[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -127[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -148[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 27
+  lea rax, QWORD PTR -148[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -148[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rdi, rax
+  and rdi, -8
+  sub rax, rdi
+  cmp rax, 7
+  ja .Lend18
+  lea rdi, QWORD PTR .Lswitch_table_18[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_18:
+  .long .Lswitch_case_18_0 - .Lswitch_table_18
+  .long .Lswitch_case_18_1 - .Lswitch_table_18
+  .long .Lswitch_case_18_2 - .Lswitch_table_18
+  .long .Lswitch_case_18_3 - .Lswitch_table_18
+  .long .Lswitch_case_18_4 - .Lswitch_table_18
+  .long .Lswitch_case_18_5 - .Lswitch_table_18
+  .long .Lswitch_case_18_6 - .Lswitch_table_18
+  .long .Lswitch_case_18_7 - .Lswitch_table_18
+.previous
+.Lswitch_case_18_0:
+  .p2align 4
+.Lbegin19:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_7:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_6:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_5:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_4:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_3:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_2:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Lswitch_case_18_1:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rcx
+  mov rdi, rsi
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+.Literator19:
+  lea rax, QWORD PTR -148[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -148[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  jg .Lbegin19
+.Lend19:
+.Lend18:
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR -127[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 214
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_test_switch_duffs_device:
+  mov rbx, QWORD PTR -160[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_break_in_loop
+test_switch_break_in_loop:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin20:
+  mov rax, 5
+  cmp rax, 5
+  je .Lswitch_case_21_5
+  jmp .Lend21
+.Lswitch_case_21_5:
+  mov rdi, 23
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend21
+.Lend21:
+  mov rdi, 29
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend20
+.Literator20:
+  jmp .Lbegin20
+.Lend20:
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 229
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 230
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_switch_break_in_loop:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_nest
+test_switch_nest:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 23
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 29
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, 5
+  cmp rax, 5
+  je .Lswitch_case_22_5
+  jmp .Lend22
+.Lswitch_case_22_5:
+  mov rax, 7
+  cmp rax, 7
+  je .Lswitch_case_23_7
+  jmp .Lend23
+.Lswitch_case_23_7:
+  mov rdi, 31
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lend23:
+  mov rdi, 37
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend22
+.Lend22:
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 246
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 247
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_switch_nest:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_constFolding
+test_switch_constFolding:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, 13
+  cmp rax, 13
+  ja .Lend24
+  lea rdi, QWORD PTR .Lswitch_table_24[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_24:
+  .long .Lswitch_case_24_0 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lswitch_case_24_3 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lswitch_case_24_5 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lswitch_case_24_7 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lend24 - .Lswitch_table_24
+  .long .Lswitch_case_24_d - .Lswitch_table_24
+.previous
+.Lswitch_case_24_3:
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend24
+.Lswitch_case_24_d:
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend24
+.Lswitch_case_24_7:
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend24
+.Lswitch_case_24_5:
+  mov rdi, 11
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend24
+.Lswitch_case_24_0:
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend24
+.Lend24:
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 259
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_switch_constFolding:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl switch_dense
+switch_dense:
+  mov r10, rdi
+  movsx rax, r10d
+  sub rax, -2
+  cmp rax, 6
+  ja .Lswitch_default_27
+  lea rdi, QWORD PTR .Lswitch_table_27[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_27:
+  .long .Lswitch_case_27_fffffffe - .Lswitch_table_27
+  .long .Lswitch_case_27_ffffffff - .Lswitch_table_27
+  .long .Lswitch_case_27_0 - .Lswitch_table_27
+  .long .Lswitch_case_27_1 - .Lswitch_table_27
+  .long .Lswitch_default_27 - .Lswitch_table_27
+  .long .Lswitch_case_27_3 - .Lswitch_table_27
+  .long .Lswitch_case_27_4 - .Lswitch_table_27
+.previous
+.Lswitch_case_27_fffffffe:
+  mov rax, 10
+  jmp .Lreturn_switch_dense
+.Lswitch_case_27_ffffffff:
+  mov rax, 11
+  jmp .Lreturn_switch_dense
+.Lswitch_case_27_0:
+  mov rax, 12
+  jmp .Lreturn_switch_dense
+.Lswitch_case_27_1:
+  mov rax, 13
+  jmp .Lreturn_switch_dense
+.Lswitch_case_27_3:
+  mov rax, 15
+  jmp .Lreturn_switch_dense
+.Lswitch_case_27_4:
+  mov rax, 16
+  jmp .Lreturn_switch_dense
+.Lswitch_default_27:
+  mov rax, 99
+  jmp .Lreturn_switch_dense
+.Lend27:
+.Lreturn_switch_dense:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl switch_dense_no_default
+switch_dense_no_default:
+  mov r10, rdi
+  lea rdi, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  movsx rax, r10d
+  sub rax, 10
+  cmp rax, 4
+  ja .Lend28
+  lea rdi, QWORD PTR .Lswitch_table_28[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_28:
+  .long .Lswitch_case_28_a - .Lswitch_table_28
+  .long .Lswitch_case_28_b - .Lswitch_table_28
+  .long .Lswitch_case_28_c - .Lswitch_table_28
+  .long .Lend28 - .Lswitch_table_28
+  .long .Lswitch_case_28_e - .Lswitch_table_28
+.previous
+.Lswitch_case_28_a:
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lswitch_case_28_b:
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend28
+.Lswitch_case_28_c:
+  mov rdi, 4
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend28
+.Lswitch_case_28_e:
+  mov rdi, 8
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend28
+.Lend28:
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_switch_dense_no_default
+.Lreturn_switch_dense_no_default:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl switch_sparse
+switch_sparse:
+  mov r10, rdi
+  movsx rax, r10d
+  cmp rax, 90
+  je .Lswitch_case_29_5a
+  jg .Lswitch_upper_29_3
+  cmp rax, -1000
+  je .Lswitch_case_29_fffffc18
+  cmp rax, -7
+  je .Lswitch_case_29_fffffff9
+  cmp rax, 3
+  je .Lswitch_case_29_3
+  jmp .Lswitch_default_29
+.Lswitch_upper_29_3:
+  cmp rax, 4096
+  je .Lswitch_case_29_1000
+  jg .Lswitch_upper_29_5
+  cmp rax, 512
+  je .Lswitch_case_29_200
+  jmp .Lswitch_default_29
+.Lswitch_upper_29_5:
+  cmp rax, 100000
+  je .Lswitch_case_29_186a0
+  cmp rax, 2147483647
+  je .Lswitch_case_29_7fffffff
+  jmp .Lswitch_default_29
+.Lswitch_case_29_fffffc18:
+  mov rax, 1
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_fffffff9:
+  mov rax, 2
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_3:
+  mov rax, 3
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_5a:
+  mov rax, 4
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_200:
+  mov rax, 5
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_1000:
+  mov rax, 6
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_186a0:
+  mov rax, 7
+  jmp .Lreturn_switch_sparse
+.Lswitch_case_29_7fffffff:
+  mov rax, 8
+  jmp .Lreturn_switch_sparse
+.Lswitch_default_29:
+  mov rax, 0
+  jmp .Lreturn_switch_sparse
+.Lend29:
+.Lreturn_switch_sparse:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_switch_dispatch
+test_switch_dispatch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rbx, rax
+  mov rdi, -3
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 99
+  mov rsi, 300
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rbx, rax
+  mov rdi, -2
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 301
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rbx, rax
+  mov rdi, -1
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 11
+  mov rsi, 302
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rbx, rax
+  mov rdi, 0
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 12
+  mov rsi, 303
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rbx, rax
+  mov rdi, 1
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 13
+  mov rsi, 304
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rbx, rax
+  mov rdi, 2
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 99
+  mov rsi, 305
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rbx, rax
+  mov rdi, 3
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 15
+  mov rsi, 306
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rbx, rax
+  mov rdi, 4
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 16
+  mov rsi, 307
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rbx, rax
+  mov rdi, 5
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 99
+  mov rsi, 308
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rbx, rax
+  mov rdi, -2147483647
+  mov al, 0
+  call switch_dense
+  mov rcx, rax
+  mov r8, 99
+  mov rsi, 309
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rbx, rax
+  mov rdi, 9
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 311
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rbx, rax
+  mov rdi, 10
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 3
+  mov rsi, 312
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rbx, rax
+  mov rdi, 11
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 2
+  mov rsi, 313
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rbx, rax
+  mov rdi, 12
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 4
+  mov rsi, 314
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rbx, rax
+  mov rdi, 13
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 315
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rbx, rax
+  mov rdi, 14
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 8
+  mov rsi, 316
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rbx, rax
+  mov rdi, 15
+  mov al, 0
+  call switch_dense_no_default
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 317
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rbx, rax
+  mov rdi, -1000
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 1
+  mov rsi, 319
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rbx, rax
+  mov rdi, -7
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 2
+  mov rsi, 320
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rbx, rax
+  mov rdi, 3
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 3
+  mov rsi, 321
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rbx, rax
+  mov rdi, 90
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 4
+  mov rsi, 322
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rbx, rax
+  mov rdi, 512
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 5
+  mov rsi, 323
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rbx, rax
+  mov rdi, 4096
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 6
+  mov rsi, 324
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rbx, rax
+  mov rdi, 100000
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 7
+  mov rsi, 325
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rbx, rax
+  mov rdi, 2147483647
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 8
+  mov rsi, 326
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rbx, rax
+  mov rdi, 0
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 327
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rbx, rax
+  mov rdi, -8
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 328
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rbx, rax
+  mov rdi, 91
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 329
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rbx, rax
+  mov rdi, 100001
+  mov al, 0
+  call switch_sparse
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 330
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_test_switch_dispatch:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl never_called
+never_called:
+  push rbp
+  mov rbp, rsp
+  .p2align 4
+.Lbegin30:
+  mov rcx, 334
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 334
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator30:
+.Lend30:
+  mov rax, 0
+  jmp .Lreturn_never_called
+.Lreturn_never_called:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_constant_condition
+test_constant_condition:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 349
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 355
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  jmp .Lend33
+  .p2align 4
+.Lbegin33:
+.Literator33:
+.Lend33:
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 359
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 362
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lswitch_case_35_1
+  cmp rax, 7
+  je .Lswitch_case_35_7
+  jmp .Lend35
+.Lswitch_case_35_1:
+  jmp .Lend36
+.Lswitch_case_35_7:
+  mov rdi, 11
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend36:
+.Lend35:
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 372
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_constant_condition:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_return_1
+test_for_return_1:
+  .p2align 4
+.Lbegin37:
+  mov rax, 10
+  jmp .Lreturn_test_for_return_1
+.Literator37:
+  jmp .Lbegin37
+.Lend37:
+.Lreturn_test_for_return_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_return_2
+test_for_return_2:
+  mov rdi, 1
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin38:
+  mov rax, 10
+  jmp .Lreturn_test_for_return_2
+.Literator38:
+  jmp .Lbegin38
+.Lend38:
+.Lreturn_test_for_return_2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_return_3
+test_for_return_3:
+  .p2align 4
+.Lbegin39:
+  mov rax, 10
+  jmp .Lreturn_test_for_return_3
+.Literator39:
+  jmp .Lbegin39
+.Lend39:
+.Lreturn_test_for_return_3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_return_4
+test_for_return_4:
+  .p2align 4
+.Lbegin40:
+  mov rax, 10
+  jmp .Lreturn_test_for_return_4
+.Literator40:
+  mov rax, 1
+  jmp .Lbegin40
+.Lend40:
+.Lreturn_test_for_return_4:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_1
+test_for_1:
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend41
+  .p2align 4
+.Lbegin41:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator41:
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin41
+.Lend41:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_1
+.Lreturn_test_for_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_2
+test_for_2:
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jge .Lend42
+  .p2align 4
+.Lbegin42:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator42:
+  lea rax, QWORD PTR -20[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jl .Lbegin42
+.Lend42:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_2
+.Lreturn_test_for_2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_3
+test_for_3:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jg .Lend43
+  .p2align 4
+.Lbegin43:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator43:
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jle .Lbegin43
+.Lend43:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_3
+.Lreturn_test_for_3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_4
+test_for_4:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend44
+  .p2align 4
+.Lbegin44:
+.Literator44:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin44
+.Lend44:
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 428
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_for_4:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_break_1
+test_for_break_1:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin45:
+  jmp .Lend45
+  mov rdi, 5
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator45:
+  jmp .Lbegin45
+.Lend45:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_break_1
+.Lreturn_test_for_break_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_break_2
+test_for_break_2:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin46:
+  jmp .Lend46
+.Literator46:
+  jmp .Lbegin46
+.Lend46:
+  mov rdi, 5
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_break_2
+.Lreturn_test_for_break_2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_break_3
+test_for_break_3:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin47:
+  lea rax, QWORD PTR -12[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend47
+.Literator47:
+  jmp .Lbegin47
+.Lend47:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_break_3
+.Lreturn_test_for_break_3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_break_4
+test_for_break_4:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 11
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jge .Lend48
+  .p2align 4
+.Lbegin48:
+  lea rdi, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend49
+  .p2align 4
+.Lbegin49:
+  mov rdi, 7
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend49
+.Literator49:
+  lea rax, QWORD PTR -20[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin49
+.Lend49:
+  mov rdi, 5
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator48:
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jl .Lbegin48
+.Lend48:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_break_4
+.Lreturn_test_for_break_4:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_break_5
+test_for_break_5:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 11
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin51:
+  mov rdi, 7
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend51
+.Literator51:
+  jmp .Lbegin51
+.Lend51:
+  mov rdi, 5
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_for_break_5
+.Lreturn_test_for_break_5:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_break_6
+test_for_break_6:
+  lea rdi, QWORD PTR -20[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 1
+  mov DWORD PTR -20[rsp], edi
+  mov rax, rdi
+  mov rdi, 1
+  mov DWORD PTR -16[rsp], edi
+  mov rax, rdi
+  mov rdi, 1
+  mov DWORD PTR -12[rsp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend52
+  .p2align 4
+.Lbegin52:
+  lea rdi, QWORD PTR -28[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend53
+  .p2align 4
+.Lbegin53:
+  lea rdi, QWORD PTR -32[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend54
+  .p2align 4
+.Lbegin54:
+  lea rax, QWORD PTR -12[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator54:
+  lea rax, QWORD PTR -32[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -32[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin54
+.Lend54:
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend53
+.Literator53:
+  lea rax, QWORD PTR -28[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin53
+.Lend53:
+  lea rax, QWORD PTR -20[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend52
+.Literator52:
+  lea rax, QWORD PTR -24[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin52
+.Lend52:
+  mov eax, DWORD PTR -20[rsp]
+  movsx rax, eax
+  imul rax, 10000
+  mov rsi, rax
+  mov eax, DWORD PTR -16[rsp]
+  movsx rax, eax
+  imul rax, 100
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  mov eax, DWORD PTR -12[rsp]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_test_for_break_6
+.Lreturn_test_for_break_6:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_continue_1
+test_for_continue_1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 7
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jge .Lend55
+  .p2align 4
+.Lbegin55:
+  jmp .Literator55
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator55:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jl .Lbegin55
+.Lend55:
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 504
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 505
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_for_continue_1:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_continue_2
+test_for_continue_2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 13
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend56
+  .p2align 4
+.Lbegin56:
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jge .Lend57
+  .p2align 4
+.Lbegin57:
+  jmp .Literator57
+  mov rdi, 17
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator57:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jl .Lbegin57
+.Lend57:
+.Literator56:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin56
+.Lend56:
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 517
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 518
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 519
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_for_continue_2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_continue_3
+test_for_continue_3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 13
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend58
+  .p2align 4
+.Lbegin58:
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend59
+  .p2align 4
+.Lbegin59:
+  mov rdi, 17
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Literator59
+  mov rdi, 19
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator59:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin59
+.Lend59:
+.Literator58:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin58
+.Lend58:
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 533
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 534
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 535
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_for_continue_3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_for_continue_4
+test_for_continue_4:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend60
+  .p2align 4
+.Lbegin60:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Literator60
+.Literator60:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lbegin60
+.Lend60:
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 14
+  mov rsi, 546
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_for_continue_4:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_while_return_1
+test_while_return_1:
+  .p2align 4
+.Lbegin61:
+  mov rax, 10
+  jmp .Lreturn_test_while_return_1
+.Literator61:
+  jmp .Lbegin61
+.Lend61:
+.Lreturn_test_while_return_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_while_1
+test_while_1:
+  jmp .Lend62
+  .p2align 4
+.Lbegin62:
+.Literator62:
+.Lend62:
+  mov rax, 10
+  jmp .Lreturn_test_while_1
+.Lreturn_test_while_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_while_2
+test_while_2:
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jge .Lend63
+  .p2align 4
+.Lbegin63:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jge .Lend64
+  .p2align 4
+.Lbegin64:
+  lea rax, QWORD PTR -12[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator64:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lbegin64
+.Lend64:
+.Literator63:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jl .Lbegin63
+.Lend63:
+  mov rax, 50
+  jmp .Lreturn_test_while_2
+.Lreturn_test_while_2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_while_3
+test_while_3:
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jge .Lend65
+  .p2align 4
+.Lbegin65:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 20
+  jge .Lend66
+  .p2align 4
+.Lbegin66:
+  lea rax, QWORD PTR -12[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator66:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 20
+  jl .Lbegin66
+.Lend66:
+.Literator65:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jl .Lbegin65
+.Lend65:
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_test_while_3
+.Lreturn_test_while_3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_do_while
+test_do_while:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 580
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  .p2align 4
+.Lbegin67:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator67:
+.Lend67:
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 584
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_do_while:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_do_while_break
+test_do_while_break:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 589
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  .p2align 4
+.Lbegin68:
+  jmp .Lend68
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator68:
+.Lend68:
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 594
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_do_while_break:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_do_while_continue_1
+test_do_while_continue_1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 600
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  .p2align 4
+.Lbegin69:
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jg .Lend70
+  jmp .Literator69
+.Lend70:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 5
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend69
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator69:
+  jmp .Lbegin69
+.Lend69:
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 609
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 18
+  mov rsi, 610
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_do_while_continue_1:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_do_while_continue_2
+test_do_while_continue_2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin71:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Literator71
+.Literator71:
+.Lend71:
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 14
+  mov rsi, 619
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_do_while_continue_2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl helper_always_1
+helper_always_1:
+  mov rax, 1
+  jmp .Lreturn_helper_always_1
+.Lreturn_helper_always_1:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl helper_always_3
+helper_always_3:
+  mov rax, 3
+  jmp .Lreturn_helper_always_3
+.Lreturn_helper_always_3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_comma_1
+test_comma_1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -24[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov rdi, 5
+  mov DWORD PTR -24[rbp], edi
+  mov rax, rdi
+  mov rdi, 7
+  mov DWORD PTR -20[rbp], edi
+  mov rax, rdi
+  mov rdi, 11
+  mov DWORD PTR -16[rbp], edi
+  mov rax, rdi
+  mov rdi, 13
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 17
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 19
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  mov al, 0
+  call helper_always_1
+  mov al, 0
+  call helper_always_3
+  mov eax, DWORD PTR -24[rbp+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 635
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call helper_always_3
+  mov al, 0
+  call helper_always_1
+  mov eax, DWORD PTR -24[rbp+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString138[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 637
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_comma_1:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_comma_2
+test_comma_2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString140[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 644
+  lea rax, QWORD PTR .LiteralString139[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString142[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 645
+  lea rax, QWORD PTR .LiteralString141[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString144[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 646
+  lea rax, QWORD PTR .LiteralString143[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_comma_2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_cond_not
+test_cond_not:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString146[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 653
+  lea rax, QWORD PTR .LiteralString145[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse72_0
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend72
+.Lelse72_0:
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend72
+.Lend72:
+  lea rax, QWORD PTR .LiteralString148[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 659
+  lea rax, QWORD PTR .LiteralString147[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString150[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 662
+  lea rax, QWORD PTR .LiteralString149[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse73_0
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend73
+.Lelse73_0:
+  mov rdi, 19
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend73
+.Lend73:
+  lea rax, QWORD PTR .LiteralString152[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 668
+  lea rax, QWORD PTR .LiteralString151[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_cond_not:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_not
+test_not:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString154[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 675
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_not:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl make_value_13
+make_value_13:
+  mov r10, rdi
+  .p2align 4
+.Lbegin77:
+  mov rdi, 13
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lreturn_make_value_13
+.Literator77:
+.Lend77:
+  mov rdi, 17
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_make_value_13:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_return_without_expr
+test_return_without_expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString156[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 688
+  lea rax, QWORD PTR .LiteralString155[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov al, 0
+  call make_value_13
+  lea rax, QWORD PTR .LiteralString158[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 690
+  lea rax, QWORD PTR .LiteralString157[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_return_without_expr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl helper_conditional_operator_set_13
+helper_conditional_operator_set_13:
+  mov rdi, 13
+  lea rax, QWORD PTR g_test_cond_operator_validator[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, 0
+  jmp .Lreturn_helper_conditional_operator_set_13
+.Lreturn_helper_conditional_operator_set_13:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_conditional_operator
+test_conditional_operator:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString160[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 700
+  lea rax, QWORD PTR .LiteralString159[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 29
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString162[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 703
+  lea rax, QWORD PTR .LiteralString161[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 31
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString164[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 706
+  lea rax, QWORD PTR .LiteralString163[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 53
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString166[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 53
+  mov rsi, 709
+  lea rax, QWORD PTR .LiteralString165[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 71
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString168[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 71
+  mov rsi, 712
+  lea rax, QWORD PTR .LiteralString167[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR g_test_cond_operator_validator[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString170[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_test_cond_operator_validator[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 716
+  lea rax, QWORD PTR .LiteralString169[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call helper_conditional_operator_set_13
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString172[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_test_cond_operator_validator[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 719
+  lea rax, QWORD PTR .LiteralString171[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_conditional_operator:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_rotated_loops
+test_rotated_loops:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend89
+  .p2align 4
+.Lbegin89:
+  mov rdi, 100
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator89:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jl .Lbegin89
+.Lend89:
+  lea rax, QWORD PTR .LiteralString174[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 726
+  lea rax, QWORD PTR .LiteralString173[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond90
+  .p2align 4
+.Lbegin90:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lend92
+  jmp .Literator90
+.Lend92:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator90:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lcond90:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jge .Llogicaland91
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 20
+  jl .Lbegin90
+.Llogicaland91:
+.Lend90:
+  lea rax, QWORD PTR .LiteralString176[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 732
+  lea rax, QWORD PTR .LiteralString175[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString178[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 25
+  mov rsi, 733
+  lea rax, QWORD PTR .LiteralString177[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond93
+  .p2align 4
+.Lbegin93:
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond95
+  .p2align 4
+.Lbegin95:
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator95:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lcond95:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lcond_falsy_96
+  mov rax, 1
+  jmp .Lcond_end_96
+.Lcond_falsy_96:
+  mov rax, 0
+.Lcond_end_96:
+  test rax, rax
+  jne .Lbegin95
+.Lend95:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jne .Lend97
+  mov rdi, 6
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend97:
+.Literator93:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lcond93:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jl .Lbegin93
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lbegin93
+.Lend93:
+  lea rax, QWORD PTR .LiteralString180[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 740
+  lea rax, QWORD PTR .LiteralString179[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString182[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 741
+  lea rax, QWORD PTR .LiteralString181[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond98
+  .p2align 4
+.Lbegin98:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator98:
+.Lcond98:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicaland99
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lbegin98
+.Llogicaland99:
+.Lend98:
+  lea rax, QWORD PTR .LiteralString184[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 745
+  lea rax, QWORD PTR .LiteralString183[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_rotated_loops:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_keyword_like_names
+test_keyword_like_names:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 2
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lelse100_0
+  mov rdi, 1
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend100
+.Lelse100_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend101
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend101:
+  jmp .Lend100
+.Lend100:
+  lea rax, QWORD PTR .LiteralString186[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 760
+  lea rax, QWORD PTR .LiteralString185[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse102_0
+  mov rdi, 1
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend102
+.Lelse102_0:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lend102
+  mov rdi, 4
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend102
+.Lend102:
+  lea rax, QWORD PTR .LiteralString188[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 767
+  lea rax, QWORD PTR .LiteralString187[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_keyword_like_names:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString190[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_1
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 771
+  lea rax, QWORD PTR .LiteralString189[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString192[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_2
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 772
+  lea rax, QWORD PTR .LiteralString191[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString194[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_3
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 773
+  lea rax, QWORD PTR .LiteralString193[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString196[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_4
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 774
+  lea rax, QWORD PTR .LiteralString195[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString198[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_5
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 775
+  lea rax, QWORD PTR .LiteralString197[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString200[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_6
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 776
+  lea rax, QWORD PTR .LiteralString199[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString202[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_7
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 777
+  lea rax, QWORD PTR .LiteralString201[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString204[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_8
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 778
+  lea rax, QWORD PTR .LiteralString203[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString206[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_if_return_9
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 779
+  lea rax, QWORD PTR .LiteralString205[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov al, 0
+  call test_switch_case_default
+  mov al, 0
+  call test_switch_no_default
+  mov al, 0
+  call test_switch_fallthrough
+  mov al, 0
+  call test_switch_scope
+  mov al, 0
+  call test_switch_duffs_device
+  mov al, 0
+  call test_switch_break_in_loop
+  mov al, 0
+  call test_switch_nest
+  mov al, 0
+  call test_switch_constFolding
+  mov al, 0
+  call test_switch_dispatch
+  mov al, 0
+  call test_constant_condition
+  lea rax, QWORD PTR .LiteralString208[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_return_1
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 790
+  lea rax, QWORD PTR .LiteralString207[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString210[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_return_2
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 791
+  lea rax, QWORD PTR .LiteralString209[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString212[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_return_3
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 792
+  lea rax, QWORD PTR .LiteralString211[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_return_4
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 793
+  lea rax, QWORD PTR .LiteralString213[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString216[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_1
+  mov rcx, rax
+  mov r8, 6
+  mov rsi, 794
+  lea rax, QWORD PTR .LiteralString215[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString218[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_2
+  mov rcx, rax
+  mov r8, 89
+  mov rsi, 795
+  lea rax, QWORD PTR .LiteralString217[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString220[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_3
+  mov rcx, rax
+  mov r8, 55
+  mov rsi, 796
+  lea rax, QWORD PTR .LiteralString219[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov al, 0
+  call test_for_4
+  lea rax, QWORD PTR .LiteralString222[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_break_1
+  mov rcx, rax
+  mov r8, 7
+  mov rsi, 798
+  lea rax, QWORD PTR .LiteralString221[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString224[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_break_2
+  mov rcx, rax
+  mov r8, 5
+  mov rsi, 799
+  lea rax, QWORD PTR .LiteralString223[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString226[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_break_3
+  mov rcx, rax
+  mov r8, 8
+  mov rsi, 800
+  lea rax, QWORD PTR .LiteralString225[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString228[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_break_4
+  mov rcx, rax
+  mov r8, 5
+  mov rsi, 801
+  lea rax, QWORD PTR .LiteralString227[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString230[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_break_5
+  mov rcx, rax
+  mov r8, 5
+  mov rsi, 802
+  lea rax, QWORD PTR .LiteralString229[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString232[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_for_break_6
+  mov rcx, rax
+  mov r8, 20204
+  mov rsi, 803
+  lea rax, QWORD PTR .LiteralString231[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov al, 0
+  call test_for_continue_1
+  mov al, 0
+  call test_for_continue_2
+  mov al, 0
+  call test_for_continue_3
+  mov al, 0
+  call test_for_continue_4
+  lea rax, QWORD PTR .LiteralString234[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_while_return_1
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 808
+  lea rax, QWORD PTR .LiteralString233[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString236[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_while_1
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 809
+  lea rax, QWORD PTR .LiteralString235[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString238[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_while_2
+  mov rcx, rax
+  mov r8, 50
+  mov rsi, 810
+  lea rax, QWORD PTR .LiteralString237[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString240[rip]
+  mov rbx, rax
+  mov al, 0
+  call test_while_3
+  mov rcx, rax
+  mov r8, 20
+  mov rsi, 811
+  lea rax, QWORD PTR .LiteralString239[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov al, 0
+  call test_do_while
+  mov al, 0
+  call test_do_while_break
+  mov al, 0
+  call test_do_while_continue_1
+  mov al, 0
+  call test_do_while_continue_2
+  mov al, 0
+  call test_comma_1
+  mov al, 0
+  call test_comma_2
+  mov al, 0
+  call test_cond_not
+  mov al, 0
+  call test_not
+  mov al, 0
+  call test_conditional_operator
+  mov al, 0
+  call test_rotated_loops
+  mov al, 0
+  call test_keyword_like_names
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/flows.c"
+.LiteralString1:
+  .string  "validation"
+.LiteralString2:
+  .string  "test/flows.c"
+.LiteralString3:
+  .string  "validation"
+.LiteralString4:
+  .string  "test/flows.c"
+.LiteralString5:
+  .string  "validation"
+.LiteralString6:
+  .string  "test/flows.c"
+.LiteralString7:
+  .string  "validation"
+.LiteralString8:
+  .string  "test/flows.c"
+.LiteralString9:
+  .string  "validation"
+.LiteralString10:
+  .string  "test/flows.c"
+.LiteralString11:
+  .string  "validation"
+.LiteralString12:
+  .string  "test/flows.c"
+.LiteralString13:
+  .string  "a"
+.LiteralString14:
+  .string  "abcdefghijklmnopqrstuvwxyz"
+.LiteralString15:
+  .string  "test/flows.c"
+.LiteralString16:
+  .string  "strcmp(s1, s2)"
+.LiteralString17:
+  .string  "test/flows.c"
+.LiteralString18:
+  .string  "n1"
+.LiteralString19:
+  .string  "test/flows.c"
+.LiteralString20:
+  .string  "n2"
+.LiteralString21:
+  .string  "test/flows.c"
+.LiteralString22:
+  .string  "inner"
+.LiteralString23:
+  .string  "test/flows.c"
+.LiteralString24:
+  .string  "outer"
+.LiteralString25:
+  .string  "test/flows.c"
+.LiteralString26:
+  .string  "n"
+.LiteralString27:
+  .string  "test/flows.c"
+.LiteralString28:
+  .string  "switch_dense(-3)"
+.LiteralString29:
+  .string  "test/flows.c"
+.LiteralString30:
+  .string  "switch_dense(-2)"
+.LiteralString31:
+  .string  "test/flows.c"
+.LiteralString32:
+  .string  "switch_dense(-1)"
+.LiteralString33:
+  .string  "test/flows.c"
+.LiteralString34:
+  .string  "switch_dense(0)"
+.LiteralString35:
+  .string  "test/flows.c"
+.LiteralString36:
+  .string  "switch_dense(1)"
+.LiteralString37:
+  .string  "test/flows.c"
+.LiteralString38:
+  .string  "switch_dense(2)"
+.LiteralString39:
+  .string  "test/flows.c"
+.LiteralString40:
+  .string  "switch_dense(3)"
+.LiteralString41:
+  .string  "test/flows.c"
+.LiteralString42:
+  .string  "switch_dense(4)"
+.LiteralString43:
+  .string  "test/flows.c"
+.LiteralString44:
+  .string  "switch_dense(5)"
+.LiteralString45:
+  .string  "test/flows.c"
+.LiteralString46:
+  .string  "switch_dense(-2147483647)"
+.LiteralString47:
+  .string  "test/flows.c"
+.LiteralString48:
+  .string  "switch_dense_no_default(9)"
+.LiteralString49:
+  .string  "test/flows.c"
+.LiteralString50:
+  .string  "switch_dense_no_default(10)"
+.LiteralString51:
+  .string  "test/flows.c"
+.LiteralString52:
+  .string  "switch_dense_no_default(11)"
+.LiteralString53:
+  .string  "test/flows.c"
+.LiteralString54:
+  .string  "switch_dense_no_default(12)"
+.LiteralString55:
+  .string  "test/flows.c"
+.LiteralString56:
+  .string  "switch_dense_no_default(13)"
+.LiteralString57:
+  .string  "test/flows.c"
+.LiteralString58:
+  .string  "switch_dense_no_default(14)"
+.LiteralString59:
+  .string  "test/flows.c"
+.LiteralString60:
+  .string  "switch_dense_no_default(15)"
+.LiteralString61:
+  .string  "test/flows.c"
+.LiteralString62:
+  .string  "switch_sparse(-1000)"
+.LiteralString63:
+  .string  "test/flows.c"
+.LiteralString64:
+  .string  "switch_sparse(-7)"
+.LiteralString65:
+  .string  "test/flows.c"
+.LiteralString66:
+  .string  "switch_sparse(3)"
+.LiteralString67:
+  .string  "test/flows.c"
+.LiteralString68:
+  .string  "switch_sparse(90)"
+.LiteralString69:
+  .string  "test/flows.c"
+.LiteralString70:
+  .string  "switch_sparse(512)"
+.LiteralString71:
+  .string  "test/flows.c"
+.LiteralString72:
+  .string  "switch_sparse(4096)"
+.LiteralString73:
+  .string  "test/flows.c"
+.LiteralString74:
+  .string  "switch_sparse(100000)"
+.LiteralString75:
+  .string  "test/flows.c"
+.LiteralString76:
+  .string  "switch_sparse(2147483647)"
+.LiteralString77:
+  .string  "test/flows.c"
+.LiteralString78:
+  .string  "switch_sparse(0)"
+.LiteralString79:
+  .string  "test/flows.c"
+.LiteralString80:
+  .string  "switch_sparse(-8)"
+.LiteralString81:
+  .string  "test/flows.c"
+.LiteralString82:
+  .string  "switch_sparse(91)"
+.LiteralString83:
+  .string  "test/flows.c"
+.LiteralString84:
+  .string  "switch_sparse(100001)"
+.LiteralString85:
+  .string  "%s:%d: unreachable"
+.LiteralString86:
+  .string  "test/flows.c"
+.LiteralString87:
+  .string  "test/flows.c"
+.LiteralString88:
+  .string  "1"
+.LiteralString89:
+  .string  "test/flows.c"
+.LiteralString90:
+  .string  "n"
+.LiteralString91:
+  .string  "test/flows.c"
+.LiteralString92:
+  .string  "n"
+.LiteralString93:
+  .string  "test/flows.c"
+.LiteralString94:
+  .string  "n"
+.LiteralString95:
+  .string  "test/flows.c"
+.LiteralString96:
+  .string  "n"
+.LiteralString97:
+  .string  "test/flows.c"
+.LiteralString98:
+  .string  "n"
+.LiteralString99:
+  .string  "test/flows.c"
+.LiteralString100:
+  .string  "i"
+.LiteralString101:
+  .string  "test/flows.c"
+.LiteralString102:
+  .string  "i"
+.LiteralString103:
+  .string  "test/flows.c"
+.LiteralString104:
+  .string  "n"
+.LiteralString105:
+  .string  "test/flows.c"
+.LiteralString106:
+  .string  "n"
+.LiteralString107:
+  .string  "test/flows.c"
+.LiteralString108:
+  .string  "i"
+.LiteralString109:
+  .string  "test/flows.c"
+.LiteralString110:
+  .string  "j"
+.LiteralString111:
+  .string  "test/flows.c"
+.LiteralString112:
+  .string  "n"
+.LiteralString113:
+  .string  "test/flows.c"
+.LiteralString114:
+  .string  "i"
+.LiteralString115:
+  .string  "test/flows.c"
+.LiteralString116:
+  .string  "j"
+.LiteralString117:
+  .string  "test/flows.c"
+.LiteralString118:
+  .string  "n"
+.LiteralString119:
+  .string  "test/flows.c"
+.LiteralString120:
+  .string  "n"
+.LiteralString121:
+  .string  "test/flows.c"
+.LiteralString122:
+  .string  "n"
+.LiteralString123:
+  .string  "test/flows.c"
+.LiteralString124:
+  .string  "n"
+.LiteralString125:
+  .string  "test/flows.c"
+.LiteralString126:
+  .string  "n"
+.LiteralString127:
+  .string  "test/flows.c"
+.LiteralString128:
+  .string  "n"
+.LiteralString129:
+  .string  "test/flows.c"
+.LiteralString130:
+  .string  "n"
+.LiteralString131:
+  .string  "test/flows.c"
+.LiteralString132:
+  .string  "m"
+.LiteralString133:
+  .string  "test/flows.c"
+.LiteralString134:
+  .string  "n"
+.LiteralString135:
+  .string  "test/flows.c"
+.LiteralString136:
+  .string  "r"
+.LiteralString137:
+  .string  "test/flows.c"
+.LiteralString138:
+  .string  "r"
+.LiteralString139:
+  .string  "test/flows.c"
+.LiteralString140:
+  .string  "a"
+.LiteralString141:
+  .string  "test/flows.c"
+.LiteralString142:
+  .string  "b"
+.LiteralString143:
+  .string  "test/flows.c"
+.LiteralString144:
+  .string  "c"
+.LiteralString145:
+  .string  "test/flows.c"
+.LiteralString146:
+  .string  "a"
+.LiteralString147:
+  .string  "test/flows.c"
+.LiteralString148:
+  .string  "n"
+.LiteralString149:
+  .string  "test/flows.c"
+.LiteralString150:
+  .string  "a"
+.LiteralString151:
+  .string  "test/flows.c"
+.LiteralString152:
+  .string  "n"
+.LiteralString153:
+  .string  "test/flows.c"
+.LiteralString154:
+  .string  "p"
+.LiteralString155:
+  .string  "test/flows.c"
+.LiteralString156:
+  .string  "n"
+.LiteralString157:
+  .string  "test/flows.c"
+.LiteralString158:
+  .string  "n"
+.LiteralString159:
+  .string  "test/flows.c"
+.LiteralString160:
+  .string  "n"
+.LiteralString161:
+  .string  "test/flows.c"
+.LiteralString162:
+  .string  "n"
+.LiteralString163:
+  .string  "test/flows.c"
+.LiteralString164:
+  .string  "n"
+.LiteralString165:
+  .string  "test/flows.c"
+.LiteralString166:
+  .string  "n"
+.LiteralString167:
+  .string  "test/flows.c"
+.LiteralString168:
+  .string  "n"
+.LiteralString169:
+  .string  "test/flows.c"
+.LiteralString170:
+  .string  "g_test_cond_operator_validator"
+.LiteralString171:
+  .string  "test/flows.c"
+.LiteralString172:
+  .string  "g_test_cond_operator_validator"
+.LiteralString173:
+  .string  "test/flows.c"
+.LiteralString174:
+  .string  "n"
+.LiteralString175:
+  .string  "test/flows.c"
+.LiteralString176:
+  .string  "i"
+.LiteralString177:
+  .string  "test/flows.c"
+.LiteralString178:
+  .string  "n"
+.LiteralString179:
+  .string  "test/flows.c"
+.LiteralString180:
+  .string  "i"
+.LiteralString181:
+  .string  "test/flows.c"
+.LiteralString182:
+  .string  "n"
+.LiteralString183:
+  .string  "test/flows.c"
+.LiteralString184:
+  .string  "n"
+.LiteralString185:
+  .string  "test/flows.c"
+.LiteralString186:
+  .string  "n"
+.LiteralString187:
+  .string  "test/flows.c"
+.LiteralString188:
+  .string  "n"
+.LiteralString189:
+  .string  "test/flows.c"
+.LiteralString190:
+  .string  "test_if_return_1()"
+.LiteralString191:
+  .string  "test/flows.c"
+.LiteralString192:
+  .string  "test_if_return_2()"
+.LiteralString193:
+  .string  "test/flows.c"
+.LiteralString194:
+  .string  "test_if_return_3()"
+.LiteralString195:
+  .string  "test/flows.c"
+.LiteralString196:
+  .string  "test_if_return_4()"
+.LiteralString197:
+  .string  "test/flows.c"
+.LiteralString198:
+  .string  "test_if_return_5()"
+.LiteralString199:
+  .string  "test/flows.c"
+.LiteralString200:
+  .string  "test_if_return_6()"
+.LiteralString201:
+  .string  "test/flows.c"
+.LiteralString202:
+  .string  "test_if_return_7()"
+.LiteralString203:
+  .string  "test/flows.c"
+.LiteralString204:
+  .string  "test_if_return_8()"
+.LiteralString205:
+  .string  "test/flows.c"
+.LiteralString206:
+  .string  "test_if_return_9()"
+.LiteralString207:
+  .string  "test/flows.c"
+.LiteralString208:
+  .string  "test_for_return_1()"
+.LiteralString209:
+  .string  "test/flows.c"
+.LiteralString210:
+  .string  "test_for_return_2()"
+.LiteralString211:
+  .string  "test/flows.c"
+.LiteralString212:
+  .string  "test_for_return_3()"
+.LiteralString213:
+  .string  "test/flows.c"
+.LiteralString214:
+  .string  "test_for_return_4()"
+.LiteralString215:
+  .string  "test/flows.c"
+.LiteralString216:
+  .string  "test_for_1()"
+.LiteralString217:
+  .string  "test/flows.c"
+.LiteralString218:
+  .string  "test_for_2()"
+.LiteralString219:
+  .string  "test/flows.c"
+.LiteralString220:
+  .string  "test_for_3()"
+.LiteralString221:
+  .string  "test/flows.c"
+.LiteralString222:
+  .string  "test_for_break_1()"
+.LiteralString223:
+  .string  "test/flows.c"
+.LiteralString224:
+  .string  "test_for_break_2()"
+.LiteralString225:
+  .string  "test/flows.c"
+.LiteralString226:
+  .string  "test_for_break_3()"
+.LiteralString227:
+  .string  "test/flows.c"
+.LiteralString228:
+  .string  "test_for_break_4()"
+.LiteralString229:
+  .string  "test/flows.c"
+.LiteralString230:
+  .string  "test_for_break_5()"
+.LiteralString231:
+  .string  "test/flows.c"
+.LiteralString232:
+  .string  "test_for_break_6()"
+.LiteralString233:
+  .string  "test/flows.c"
+.LiteralString234:
+  .string  "test_while_return_1()"
+.LiteralString235:
+  .string  "test/flows.c"
+.LiteralString236:
+  .string  "test_while_1()"
+.LiteralString237:
+  .string  "test/flows.c"
+.LiteralString238:
+  .string  "test_while_2()"
+.LiteralString239:
+  .string  "test/flows.c"
+.LiteralString240:
+  .string  "test_while_3()"
+.globl g_test_cond_operator_validator
+g_test_cond_operator_validator:
+  .zero 4
@@ -0,0 +1,173 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int counter;
+int another_counter;
+void (*g_fptr)(void);
+void (*(*g_fptr_ret_fptr)(void))(void);
+void (*g_fptr_accept_fptr)(void (*)(void));
+void inc_counter(void) {
+    counter++;
+}
+int inc_another_counter(void) {
+    return ++another_counter;
+}
+void call_fptr_and_inc_counter(int n) {
+    (void)n;
+    counter++;
+}
+void (*ret_inc_counter(void))(void) {
+    return inc_counter;
+}
+void (*(*ret_ret_inc_counter(void))(void))(void) {
+    return ret_inc_counter;
+}
+void call_fptr(void (*fptr)(void)) {
+    fptr();
+}
+int add3(int n1, int n2, int n3) {
+    return n1 + n2 + n3;
+}
+int add7(int a, int b, int c, int d, int e, int f, int g) {
+    return a + b + c + d + e + f + g;
+}
+void testFptrInGlobalScope(void) {
+    counter = 0;
+    assert("test/funcptr.c", 46, (0), (counter), "counter");
+    g_fptr = inc_counter;
+    g_fptr_ret_fptr = ret_inc_counter;
+    g_fptr_accept_fptr = call_fptr;
+    g_fptr();
+    assert("test/funcptr.c", 53, (1), (counter), "counter");
+    g_fptr_ret_fptr()();
+    assert("test/funcptr.c", 56, (2), (counter), "counter");
+    counter = 2;
+    g_fptr_accept_fptr(inc_counter);
+    assert("test/funcptr.c", 60, (3), (counter), "counter");
+    g_fptr_accept_fptr(g_fptr);
+    assert("test/funcptr.c", 63, (4), (counter), "counter");
+}
+void testFptrInLocalScope(void) {
+    void (*fptr)(void);
+    void (*(*fptr_ret_fptr)(void))(void);
+    void (*fptr_accept_fptr)(void (*)(void));
+    void (*(*(*fptr_ret_fptr_ret_fptr)(void))(void))(void);
+    void (*fptr2)(void) = inc_counter;
+    counter = 0;
+    assert("test/funcptr.c", 74, (0), (counter), "counter");
+    fptr = inc_counter;
+    fptr_ret_fptr = ret_inc_counter;
+    fptr_accept_fptr = call_fptr;
+    fptr_ret_fptr_ret_fptr = ret_ret_inc_counter;
+    fptr();
+    assert("test/funcptr.c", 82, (1), (counter), "counter");
+    fptr_ret_fptr()();
+    assert("test/funcptr.c", 85, (2), (counter), "counter");
+    counter = 2;
+    fptr_accept_fptr(inc_counter);
+    assert("test/funcptr.c", 89, (3), (counter), "counter");
+    fptr_accept_fptr(fptr);
+    assert("test/funcptr.c", 92, (4), (counter), "counter");
+    fptr2();
+    assert("test/funcptr.c", 95, (5), (counter), "counter");
+    fptr_ret_fptr_ret_fptr()()();
+    assert("test/funcptr.c", 98, (6), (counter), "counter");
+}
+void testFptrInStruct(void) {
+    struct S {
+        void (*fptr)(void);
+        void (*(*fptr_ret_fptr)(void))(void);
+        void (*fptr_accept_fptr)(void (*)(void));
+    };
+    struct S s;
+    counter = 0;
+    assert("test/funcptr.c", 111, (0), (counter), "counter");
+    s.fptr = inc_counter;
+    s.fptr_ret_fptr = ret_inc_counter;
+    s.fptr_accept_fptr = call_fptr;
+    s.fptr();
+    assert("test/funcptr.c", 118, (1), (counter), "counter");
+    s.fptr_ret_fptr()();
+    assert("test/funcptr.c", 121, (2), (counter), "counter");
+    counter = 2;
+    s.fptr_accept_fptr(inc_counter);
+    assert("test/funcptr.c", 125, (3), (counter), "counter");
+    s.fptr_accept_fptr(s.fptr);
+    assert("test/funcptr.c", 128, (4), (counter), "counter");
+}
+void testFptrWithMultipleArgs(void) {
+    int (*p_add3)(int n1, int n2, int n3) = add3;
+    int (*p_add7)(int a, int b, int c, int d, int e, int f, int g) = add7;
+    int n;
+    n = 0;
+    assert("test/funcptr.c", 137, (0), (n), "n");
+    n = p_add3(11, 13, 17);
+    assert("test/funcptr.c", 140, (41), (n), "n");
+    assert("test/funcptr.c", 141, (10), (p_add3(2, 3, 5)), "p_add3(2, 3, 5)");
+    assert("test/funcptr.c", 142, (127), (p_add3(p_add3(3, 5, 7), p_add3(11, 13, 17), p_add3(19, 23, 29))), "p_add3(p_add3(3, 5, 7), p_add3(11, 13, 17), p_add3(19, 23, 29))");
+    n = p_add7(2, 3, 4, 5, 6, 7, 8);
+    assert("test/funcptr.c", 145, (35), (n), "n");
+    assert("test/funcptr.c", 146, (42), (p_add7(3, 4, 5, 6, 7, 8, 9)), "p_add7(3, 4, 5, 6, 7, 8, 9)");
+    assert("test/funcptr.c", 147, (104), (p_add7(p_add7(2, 3, 4, 5, 6, 7, 8), p_add7(1, 1, 1, 1, 1, 1, 3), 10, 11, 12, 13, 14)), "p_add7(p_add7(2, 3, 4, 5, 6, 7, 8), p_add7(1, 1, 1, 1, 1, 1, 3), 10, 11, 12, 13, 14)");
+}
+void testFptrCallAtArgument(void) {
+    void (*outer)(int) = call_fptr_and_inc_counter;
+    int (*inner)(void) = inc_another_counter;
+    counter = 0;
+    another_counter = 0;
+    outer(inner());
+    assert("test/funcptr.c", 157, (1), (counter), "counter");
+    assert("test/funcptr.c", 158, (1), (another_counter), "another_counter");
+}
+void testFptrAddress(void) {
+    void (*fp)(void);
+    void (*fp2)(void) = &inc_counter;
+    void (**fpp)(void);
+    fp = &inc_counter;
+    fpp = &fp;
+    counter = 0;
+    fp();
+    assert("test/funcptr.c", 170, (1), (counter), "counter");
+    fp2();
+    assert("test/funcptr.c", 172, (2), (counter), "counter");
+    (*fpp)();
+    assert("test/funcptr.c", 174, (3), (counter), "counter");
+}
+void testFptrDereference(void) {
+    void (*fp)(void);
+    void (**fpp)(void);
+    fp = &inc_counter;
+    fpp = &fp;
+    counter = 0;
+    (*fp)();
+    assert("test/funcptr.c", 185, (1), (counter), "counter");
+    (***fp)();
+    assert("test/funcptr.c", 187, (2), (counter), "counter");
+    (****inc_counter)();
+    assert("test/funcptr.c", 189, (3), (counter), "counter");
+    (*fpp)();
+    assert("test/funcptr.c", 191, (4), (counter), "counter");
+    (****fpp)();
+    assert("test/funcptr.c", 193, (5), (counter), "counter");
+}
+static int static_add3(int n1, int n2, int n3) {
+    return n1 + n2 + n3;
+}
+void testFptrToStaticFunction(void) {
+    int (*fp)(int, int, int) = static_add3;
+    assert("test/funcptr.c", 201, (6), (fp(1, 2, 3)), "fp(1, 2, 3)");
+}
+int main(void) {
+    testFptrInGlobalScope();
+    testFptrInLocalScope();
+    testFptrInStruct();
+    testFptrWithMultipleArgs();
+    testFptrCallAtArgument();
+    testFptrAddress();
+    testFptrDereference();
+    testFptrToStaticFunction();
+    return 0;
+}
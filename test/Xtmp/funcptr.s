@@ -0,0 +1,1366 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl inc_counter
+inc_counter:
+  lea rax, QWORD PTR counter[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lreturn_inc_counter:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl inc_another_counter
+inc_another_counter:
+  lea rax, QWORD PTR another_counter[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lreturn_inc_another_counter
+.Lreturn_inc_another_counter:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl call_fptr_and_inc_counter
+call_fptr_and_inc_counter:
+  mov r10, rdi
+  movsx rax, r10d
+  movsx rax, al
+  lea rax, QWORD PTR counter[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lreturn_call_fptr_and_inc_counter:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl ret_inc_counter
+ret_inc_counter:
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  jmp .Lreturn_ret_inc_counter
+.Lreturn_ret_inc_counter:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl ret_ret_inc_counter
+ret_ret_inc_counter:
+  mov rax, QWORD PTR ret_inc_counter@GOTPCREL[rip]
+  jmp .Lreturn_ret_ret_inc_counter
+.Lreturn_ret_ret_inc_counter:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl call_fptr
+call_fptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+.Lreturn_call_fptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl add3
+add3:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_add3
+.Lreturn_add3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl add7
+add7:
+  mov r10, rdi
+  mov r11, rsi
+  mov DWORD PTR -20[rsp], edx
+  mov DWORD PTR -24[rsp], ecx
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r9d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR 8[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_add7
+.Lreturn_add7:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrInGlobalScope
+testFptrInGlobalScope:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 0
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 46
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR g_fptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR ret_inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR g_fptr_ret_fptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR call_fptr@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR g_fptr_accept_fptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR g_fptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 53
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_fptr_ret_fptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 56
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR g_fptr_accept_fptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 60
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_fptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR g_fptr_accept_fptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 63
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFptrInGlobalScope:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrInLocalScope
+testFptrInLocalScope:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 74
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR ret_inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR call_fptr@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR ret_ret_inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 82
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 85
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 89
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 92
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 95
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 6
+  mov rsi, 98
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFptrInLocalScope:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrInStruct
+testFptrInStruct:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov rdi, 0
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR ret_inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR call_fptr@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 118
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 121
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 125
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 128
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFptrInStruct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrWithMultipleArgs
+testFptrWithMultipleArgs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -32[rbp], rbx
+  mov QWORD PTR -40[rbp], r12
+  mov QWORD PTR -48[rbp], r13
+  mov QWORD PTR -56[rbp], r14
+  mov QWORD PTR -64[rbp], r15
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR add3@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR add7@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 137
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rcx, 17
+  mov rsi, 13
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, rcx
+  mov al, 0
+  call r10
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 140
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rbx, rax
+  mov rcx, 5
+  mov rsi, 3
+  mov rdi, 2
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, rcx
+  mov al, 0
+  call r10
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 141
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov rbx, rax
+  mov rcx, 29
+  mov rsi, 23
+  mov rdi, 19
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, rcx
+  mov al, 0
+  call r10
+  mov r12, rax
+  mov rcx, 17
+  mov rsi, 13
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, rcx
+  mov al, 0
+  call r10
+  mov r13, rax
+  mov rcx, 7
+  mov rsi, 5
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, rcx
+  mov al, 0
+  call r10
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rsi, r13
+  mov rdx, r12
+  mov al, 0
+  call r10
+  mov rcx, rax
+  mov r8, 127
+  mov rsi, 142
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  sub rsp, 8 /* RSP alignment */
+  push 8
+  mov r9, 7
+  mov r8, 6
+  mov rcx, 5
+  mov r11, 4
+  mov rsi, 3
+  mov rdi, 2
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, r11
+  mov al, 0
+  call r10
+  add rsp, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 35
+  mov rsi, 145
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov rbx, rax
+  sub rsp, 8 /* RSP alignment */
+  push 9
+  mov r9, 8
+  mov r8, 7
+  mov rcx, 6
+  mov r11, 5
+  mov rsi, 4
+  mov rdi, 3
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, r11
+  mov al, 0
+  call r10
+  add rsp, 16
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 146
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  push rax
+  push 14
+  mov r12, 13
+  mov r13, 12
+  mov r14, 11
+  mov r15, 10
+  sub rsp, 8 /* RSP alignment */
+  push 3
+  mov r9, 1
+  mov r8, 1
+  mov rcx, 1
+  mov r11, 1
+  mov rsi, 1
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, r11
+  mov al, 0
+  call r10
+  add rsp, 16
+  mov rbx, rax
+  sub rsp, 8 /* RSP alignment */
+  push 8
+  mov r9, 7
+  mov r8, 6
+  mov rcx, 5
+  mov r11, 4
+  mov rsi, 3
+  mov rdi, 2
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, r11
+  mov al, 0
+  call r10
+  add rsp, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rsi, rbx
+  mov rdx, r15
+  mov rcx, r14
+  mov r8, r13
+  mov r9, r12
+  mov al, 0
+  call r10
+  add rsp, 8
+  mov rcx, rax
+  mov r8, 104
+  mov rsi, 147
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r8
+  pop r8
+  mov al, 0
+  call assert
+.Lreturn_testFptrWithMultipleArgs:
+  mov rbx, QWORD PTR -32[rbp]
+  mov r12, QWORD PTR -40[rbp]
+  mov r13, QWORD PTR -48[rbp]
+  mov r14, QWORD PTR -56[rbp]
+  mov r15, QWORD PTR -64[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrCallAtArgument
+testFptrCallAtArgument:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR call_fptr_and_inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR inc_another_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR another_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 157
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  lea rax, QWORD PTR another_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 158
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFptrCallAtArgument:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrAddress
+testFptrAddress:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 170
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 172
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 174
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFptrAddress:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrDereference
+testFptrDereference:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rax, QWORD PTR inc_counter@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 185
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 187
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 189
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 191
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov r8, rax
+  lea rax, QWORD PTR counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 193
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFptrDereference:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+static_add3:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_static_add3
+.Lreturn_static_add3:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFptrToStaticFunction
+testFptrToStaticFunction:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, QWORD PTR static_add3@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rbx, rax
+  mov rcx, 3
+  mov rsi, 2
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdx, rcx
+  mov al, 0
+  call r10
+  mov rcx, rax
+  mov r8, 6
+  mov rsi, 201
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testFptrToStaticFunction:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testFptrInGlobalScope
+  mov al, 0
+  call testFptrInLocalScope
+  mov al, 0
+  call testFptrInStruct
+  mov al, 0
+  call testFptrWithMultipleArgs
+  mov al, 0
+  call testFptrCallAtArgument
+  mov al, 0
+  call testFptrAddress
+  mov al, 0
+  call testFptrDereference
+  mov al, 0
+  call testFptrToStaticFunction
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/funcptr.c"
+.LiteralString1:
+  .string  "counter"
+.LiteralString2:
+  .string  "test/funcptr.c"
+.LiteralString3:
+  .string  "counter"
+.LiteralString4:
+  .string  "test/funcptr.c"
+.LiteralString5:
+  .string  "counter"
+.LiteralString6:
+  .string  "test/funcptr.c"
+.LiteralString7:
+  .string  "counter"
+.LiteralString8:
+  .string  "test/funcptr.c"
+.LiteralString9:
+  .string  "counter"
+.LiteralString10:
+  .string  "test/funcptr.c"
+.LiteralString11:
+  .string  "counter"
+.LiteralString12:
+  .string  "test/funcptr.c"
+.LiteralString13:
+  .string  "counter"
+.LiteralString14:
+  .string  "test/funcptr.c"
+.LiteralString15:
+  .string  "counter"
+.LiteralString16:
+  .string  "test/funcptr.c"
+.LiteralString17:
+  .string  "counter"
+.LiteralString18:
+  .string  "test/funcptr.c"
+.LiteralString19:
+  .string  "counter"
+.LiteralString20:
+  .string  "test/funcptr.c"
+.LiteralString21:
+  .string  "counter"
+.LiteralString22:
+  .string  "test/funcptr.c"
+.LiteralString23:
+  .string  "counter"
+.LiteralString24:
+  .string  "test/funcptr.c"
+.LiteralString25:
+  .string  "counter"
+.LiteralString26:
+  .string  "test/funcptr.c"
+.LiteralString27:
+  .string  "counter"
+.LiteralString28:
+  .string  "test/funcptr.c"
+.LiteralString29:
+  .string  "counter"
+.LiteralString30:
+  .string  "test/funcptr.c"
+.LiteralString31:
+  .string  "counter"
+.LiteralString32:
+  .string  "test/funcptr.c"
+.LiteralString33:
+  .string  "counter"
+.LiteralString34:
+  .string  "test/funcptr.c"
+.LiteralString35:
+  .string  "n"
+.LiteralString36:
+  .string  "test/funcptr.c"
+.LiteralString37:
+  .string  "n"
+.LiteralString38:
+  .string  "test/funcptr.c"
+.LiteralString39:
+  .string  "p_add3(2, 3, 5)"
+.LiteralString40:
+  .string  "test/funcptr.c"
+.LiteralString41:
+  .string  "p_add3(p_add3(3, 5, 7), p_add3(11, 13, 17), p_add3(19, 23, 29))"
+.LiteralString42:
+  .string  "test/funcptr.c"
+.LiteralString43:
+  .string  "n"
+.LiteralString44:
+  .string  "test/funcptr.c"
+.LiteralString45:
+  .string  "p_add7(3, 4, 5, 6, 7, 8, 9)"
+.LiteralString46:
+  .string  "test/funcptr.c"
+.LiteralString47:
+  .string  "p_add7(p_add7(2, 3, 4, 5, 6, 7, 8), p_add7(1, 1, 1, 1, 1, 1, 3), 10, 11, 12, 13, 14)"
+.LiteralString48:
+  .string  "test/funcptr.c"
+.LiteralString49:
+  .string  "counter"
+.LiteralString50:
+  .string  "test/funcptr.c"
+.LiteralString51:
+  .string  "another_counter"
+.LiteralString52:
+  .string  "test/funcptr.c"
+.LiteralString53:
+  .string  "counter"
+.LiteralString54:
+  .string  "test/funcptr.c"
+.LiteralString55:
+  .string  "counter"
+.LiteralString56:
+  .string  "test/funcptr.c"
+.LiteralString57:
+  .string  "counter"
+.LiteralString58:
+  .string  "test/funcptr.c"
+.LiteralString59:
+  .string  "counter"
+.LiteralString60:
+  .string  "test/funcptr.c"
+.LiteralString61:
+  .string  "counter"
+.LiteralString62:
+  .string  "test/funcptr.c"
+.LiteralString63:
+  .string  "counter"
+.LiteralString64:
+  .string  "test/funcptr.c"
+.LiteralString65:
+  .string  "counter"
+.LiteralString66:
+  .string  "test/funcptr.c"
+.LiteralString67:
+  .string  "counter"
+.LiteralString68:
+  .string  "test/funcptr.c"
+.LiteralString69:
+  .string  "fp(1, 2, 3)"
+.globl g_fptr_accept_fptr
+g_fptr_accept_fptr:
+  .zero 8
+.globl g_fptr_ret_fptr
+g_fptr_ret_fptr:
+  .zero 8
+.globl g_fptr
+g_fptr:
+  .zero 8
+.globl another_counter
+another_counter:
+  .zero 4
+.globl counter
+counter:
+  .zero 4
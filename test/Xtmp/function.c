@@ -0,0 +1,210 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int fib(int n) {
+    if (n <= 1)
+        return 1;
+    else
+        return fib(n - 1) + fib(n - 2);
+}
+int sprintf(char *, const char *, ...);
+void testFuncCallWithVaArgs(void) {
+    char *s;
+    s = safeAlloc(4 * sizeof(char));
+    sprintf(s, "%s", "abc");
+    assert("test/function.c", 18, ('a'), (*s), "*s");
+    assert("test/function.c", 19, ('b'), (s[1]), "s[1]");
+    assert("test/function.c", 20, ('c'), (s[2]), "s[2]");
+    assert("test/function.c", 21, ('\0'), (s[3]), "s[3]");
+    free(s);
+}
+int add(int, int);
+int add(int a, int b) {
+    return a + b;
+}
+int funcRefArgs(int a, int b) {
+    int n1, n2;
+    n1 = a;
+    n2 = b;
+    return n1*3 + n2*2;
+}
+void funcPtrArg(int *n) {
+    *n = 12345;
+}
+void testFunPtrArg(void) {
+    int n;
+    n = 25;
+    assert("test/function.c", 44, (25), (n), "n");
+    funcPtrArg(&n);
+    assert("test/function.c", 46, (12345), (n), "n");
+}
+int funcArg7(int n1, int n2, int n3, int n4, int n5, int n6, int n7) {
+    int a;
+    a = 25;
+    return n7 + a;
+}
+void testFuncArg7(void) {
+    funcArg7(1, 2, 3, 4, 5, 6, 7);
+    assert("test/function.c", 57, (32), (funcArg7(1, 2, 3, 4, 5, 6, 7)), "funcArg7(1, 2, 3, 4, 5, 6, 7)");
+}
+int funcArg8(int n1, int n2, int n3, int n4, int n5, int n6, int n7, int n8) {
+    return n8;
+}
+void testFuncArg8(void) {
+    assert("test/function.c", 64, (8), (funcArg8(1, 2, 3, 4, 5, 6, 7, 8)), "funcArg8(1, 2, 3, 4, 5, 6, 7, 8)");
+    assert("test/function.c", 65, (42), (funcArg8(1, 2, 3, 4, 5, 6, funcArg8(1, 2, 3, 4, 5, 6, 7, 8), 42)), "funcArg8(1, 2, 3, 4, 5, 6, funcArg8(1, 2, 3, 4, 5, 6, 7, 8), 42)");
+}
+int funcArgConflict(int N) {
+    int i;
+    i = 5;
+    return N;
+}
+void testFuncArgConflictOnStack(void) {
+    assert("test/function.c", 75, (3), (funcArgConflict(3)), "funcArgConflict(3)");
+}
+int funcIdentity(int n) {
+    return n;
+}
+void testTmpValuesAcrossFuncCall(void) {
+    assert("test/function.c", 84, (21), (1 + (2 + (3 + (4 + (5 + (6 + funcIdentity(0))))))), "1 + (2 + (3 + (4 + (5 + (6 + funcIdentity(0))))))");
+    assert("test/function.c", 85, (28), (1 + (2 + (3 + (4 + (5 + (6 + (7 + funcIdentity(0)))))))), "1 + (2 + (3 + (4 + (5 + (6 + (7 + funcIdentity(0)))))))");
+    assert("test/function.c", 86, (37), (funcArg8(1, 2, 3, 4, 5, 6, 7, 8) + (1 + (2 + (3 + (4 + (5 + (6 + funcArg8(1, 2, 3, 4, 5, 6, 7, 8)))))))), "funcArg8(1, 2, 3, 4, 5, 6, 7, 8) + (1 + (2 + (3 + (4 + (5 + (6 + funcArg8(1, 2, 3, 4, 5, 6, 7, 8)))))))");
+    assert("test/function.c", 88, (15), (funcArg8(1, 2, 3, 4, 5, 6, 7, 1 + (2 + (3 + (4 + (5 + funcIdentity(0))))) - 0)), "funcArg8(1, 2, 3, 4, 5, 6, 7, 1 + (2 + (3 + (4 + (5 + funcIdentity(0))))) - 0)");
+}
+int leafReassignArgs(int a, char c, int *p) {
+    a = a * 2;
+    c = c + 1;
+    a += *p;
+    return a + c;
+}
+int leafArgAddress(int a, int b) {
+    int *p = &b;
+    *p = *p + a;
+    return b;
+}
+int leafArgIncrement(int a, int b) {
+    a++;
+    --b;
+    return a * 10 + b;
+}
+int leafArg6(int n1, int n2, int n3, int n4, int n5, int n6) {
+    n6 = n6 - n1;
+    return n1 + n2 * 2 + n3 * 3 + n4 * 4 + n5 * 5 + n6 * 6;
+}
+int leafArg8(int n1, int n2, int n3, int n4, int n5, int n6, int n7, int n8) {
+    int local = n7 - n8;
+    return n1 + n2 + n3 + n4 + n5 + n6 + local;
+}
+void testLeafFunctions(void) {
+    int n = 5;
+    assert("test/function.c", 123, (35), (leafReassignArgs(10, 9, &n)), "leafReassignArgs(10, 9, &n)");
+    assert("test/function.c", 124, (7), (leafArgAddress(3, 4)), "leafArgAddress(3, 4)");
+    assert("test/function.c", 125, (43), (leafArgIncrement(3, 4)), "leafArgIncrement(3, 4)");
+    assert("test/function.c", 126, (91), (leafArg6(1, 2, 3, 4, 5, 7)), "leafArg6(1, 2, 3, 4, 5, 7)");
+    assert("test/function.c", 127, (20), (leafArg8(1, 2, 3, 4, 5, 6, 9, 10)), "leafArg8(1, 2, 3, 4, 5, 6, 9, 10)");
+}
+static int inlineSquare(int n) { return n * n; }
+static char inlineLowByte(int n) { return n; }
+static int inlineIncrement(int n) { return ++n; }
+static int inlineSumOfSquares(int a, int b) { return inlineSquare(a) + inlineSquare(b); }
+static int inlineRecursive(int n) { return n ? n + inlineRecursive(n - 1) : 0; }
+int inlineIsPositive(int n);
+inline int inlineIsPositive(int n) { return n > 0 && n; }
+static void inlineStore(int *p, int v) { *p = v; *p += 1; }
+static int (*inlineSquarePtr)(int) = inlineSquare;
+static int inlineLocal(int a) { int t; t = a * a; return t + 1; }
+static int inlineLocalInit(int a) {
+    char c = a;
+    int t = c + 1;
+    return t * inlineLocal(t);
+}
+void testInlineFunctions(void) {
+    int n = 3;
+    int arr[3];
+    assert("test/function.c", 148, (9), (inlineSquare(n)), "inlineSquare(n)");
+    assert("test/function.c", 149, (9), (inlineSquare(n++)), "inlineSquare(n++)");
+    assert("test/function.c", 150, (4), (n), "n");
+    assert("test/function.c", 151, (44), (inlineLowByte(300)), "inlineLowByte(300)");
+    assert("test/function.c", 152, (44), (inlineLowByte(n + 296)), "inlineLowByte(n + 296)");
+    assert("test/function.c", 153, (6), (inlineIncrement(5)), "inlineIncrement(5)");
+    assert("test/function.c", 154, (5), (inlineIncrement(n)), "inlineIncrement(n)");
+    assert("test/function.c", 155, (4), (n), "n");
+    assert("test/function.c", 156, (25), (inlineSumOfSquares(3, n)), "inlineSumOfSquares(3, n)");
+    assert("test/function.c", 157, (55), (inlineRecursive(10)), "inlineRecursive(10)");
+    assert("test/function.c", 158, (1), (inlineIsPositive(n)), "inlineIsPositive(n)");
+    assert("test/function.c", 159, (0), (inlineIsPositive(-n)), "inlineIsPositive(-n)");
+    inlineStore(&n, 41);
+    assert("test/function.c", 161, (42), (n), "n");
+    inlineStore(&arr[inlineSquare(1)], 7);
+    assert("test/function.c", 163, (8), (arr[1]), "arr[1]");
+    assert("test/function.c", 164, (49), (inlineSquarePtr(7)), "inlineSquarePtr(7)");
+    assert("test/function.c", 165, (10), (inlineLocal(3)), "inlineLocal(3)");
+    assert("test/function.c", 166, (170), (inlineLocal(inlineLocal(3) + 3)), "inlineLocal(inlineLocal(3) + 3)");
+    assert("test/function.c", 167, (10), (inlineLocalInit(1)), "inlineLocalInit(1)");
+    assert("test/function.c", 168, (10), (inlineLocalInit(257)), "inlineLocalInit(257)");
+}
+int tailCount(int n, int acc) {
+    if (n == 0)
+        return acc;
+    return tailCount(n - 1, acc + 1);
+}
+int tailIsOdd(int n);
+int tailIsEven(int n) {
+    if (n == 0)
+        return 1;
+    return tailIsOdd(n - 1);
+}
+int tailIsOdd(int n) {
+    if (n == 0)
+        return 0;
+    return tailIsEven(n - 1);
+}
+int tailRotate(int n, int a, int b, int c, int d, int e, int f, int g, int h) {
+    if (n == 0)
+        return a * 10000000 + b * 1000000 + c * 100000 + d * 10000 + e * 1000 +
+               f * 100 + g * 10 + h;
+    return tailRotate(n - 1, h, a, b, c, d, e, f, g);
+}
+int tailMoreStackArgs(int n) { return tailRotate(n, 1, 2, 3, 4, 5, 6, 7, 8); }
+int tailIdentity(int n) { return n; }
+int tailApply(int (*f)(int), int n) { return f(n); }
+char tailLowByte(int n) { return tailIdentity(n); }
+int tailDeref(int *p) { return *p; }
+int tailLocalAddress(int n) {
+    int x = n;
+    return tailDeref(&x);
+}
+int tailLocalArray(int n) {
+    int arr[2];
+    arr[0] = n;
+    return tailDeref(arr);
+}
+void testTailCalls(void) {
+    assert("test/function.c", 208, (10000), (tailCount(10000, 0)), "tailCount(10000, 0)");
+    assert("test/function.c", 209, (1), (tailIsEven(1000)), "tailIsEven(1000)");
+    assert("test/function.c", 210, (0), (tailIsEven(1001)), "tailIsEven(1001)");
+    assert("test/function.c", 211, (81234567), (tailRotate(1, 1, 2, 3, 4, 5, 6, 7, 8)), "tailRotate(1, 1, 2, 3, 4, 5, 6, 7, 8)");
+    assert("test/function.c", 212, (23456781), (tailRotate(7, 1, 2, 3, 4, 5, 6, 7, 8)), "tailRotate(7, 1, 2, 3, 4, 5, 6, 7, 8)");
+    assert("test/function.c", 213, (67812345), (tailMoreStackArgs(3)), "tailMoreStackArgs(3)");
+    assert("test/function.c", 214, (7), (tailApply(tailIdentity, 7)), "tailApply(tailIdentity, 7)");
+    assert("test/function.c", 215, (44), (tailLowByte(300)), "tailLowByte(300)");
+    assert("test/function.c", 216, (5), (tailLocalAddress(5)), "tailLocalAddress(5)");
+    assert("test/function.c", 217, (6), (tailLocalArray(6)), "tailLocalArray(6)");
+}
+int main(void) {
+    assert("test/function.c", 221, (10), (add(3, 7)), "add(3, 7)");
+    assert("test/function.c", 222, (13), (fib(6)), "fib(6)");
+    assert("test/function.c", 223, (23), (funcRefArgs(5, 4)), "funcRefArgs(5, 4)");
+    testFuncArg7();
+    testFuncArg8();
+    testFuncArgConflictOnStack();
+    testTmpValuesAcrossFuncCall();
+    testFuncCallWithVaArgs();
+    testLeafFunctions();
+    testInlineFunctions();
+    testTailCalls();
+    return 0;
+}
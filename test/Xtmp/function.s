@@ -0,0 +1,2797 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jg .Lelse0_0
+  mov rax, 1
+  jmp .Lreturn_fib
+  jmp .Lend0
+.Lelse0_0:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call fib
+  mov rbx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 2
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call fib
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_fib
+  jmp .Lend0
+.Lend0:
+.Lreturn_fib:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncCallWithVaArgs
+testFuncCallWithVaArgs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 4
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call sprintf
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 18
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 98
+  mov rsi, 19
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 99
+  mov rsi, 20
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 3[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 21
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+.Lreturn_testFuncCallWithVaArgs:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl add
+add:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_add
+.Lreturn_add:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl funcRefArgs
+funcRefArgs:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r10d
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  movsx rax, r11d
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 1
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_funcRefArgs
+.Lreturn_funcRefArgs:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl funcPtrArg
+funcPtrArg:
+  mov r10, rdi
+  mov rdi, 12345
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_funcPtrArg:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFunPtrArg
+testFunPtrArg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 25
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 25
+  mov rsi, 44
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov al, 0
+  call funcPtrArg
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 12345
+  mov rsi, 46
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testFunPtrArg:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl funcArg7
+funcArg7:
+  mov r10, rdi
+  mov r11, rsi
+  mov DWORD PTR -20[rsp], edx
+  mov DWORD PTR -24[rsp], ecx
+  mov rdi, 25
+  lea rax, QWORD PTR -36[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR 8[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_funcArg7
+.Lreturn_funcArg7:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncArg7
+testFuncArg7:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  sub rsp, 8 /* RSP alignment */
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg7
+  add rsp, 16
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rbx, rax
+  sub rsp, 8 /* RSP alignment */
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg7
+  add rsp, 16
+  mov rcx, rax
+  mov r8, 32
+  mov rsi, 57
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testFuncArg7:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl funcArg8
+funcArg8:
+  mov r10, rdi
+  mov r11, rsi
+  mov DWORD PTR -20[rsp], edx
+  mov DWORD PTR -24[rsp], ecx
+  lea rax, QWORD PTR 16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_funcArg8
+.Lreturn_funcArg8:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncArg8
+testFuncArg8:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rbx, rax
+  push 8
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg8
+  add rsp, 16
+  mov rcx, rax
+  mov r8, 8
+  mov rsi, 64
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rbx, rax
+  push 42
+  sub rsp, 8 /* RSP alignment */
+  push 8
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg8
+  add rsp, 24
+  push rax
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg8
+  add rsp, 16
+  mov rcx, rax
+  mov r8, 42
+  mov rsi, 65
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testFuncArg8:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl funcArgConflict
+funcArgConflict:
+  mov r10, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  movsx rax, r10d
+  jmp .Lreturn_funcArgConflict
+.Lreturn_funcArgConflict:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncArgConflictOnStack
+testFuncArgConflictOnStack:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rbx, rax
+  mov rdi, 3
+  mov al, 0
+  call funcArgConflict
+  mov rcx, rax
+  mov r8, 3
+  mov rsi, 75
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testFuncArgConflictOnStack:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl funcIdentity
+funcIdentity:
+  mov r10, rdi
+  movsx rax, r10d
+  jmp .Lreturn_funcIdentity
+.Lreturn_funcIdentity:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTmpValuesAcrossFuncCall
+testTmpValuesAcrossFuncCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  mov QWORD PTR -16[rbp], r12
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rbx, rax
+  mov rdi, 0
+  mov al, 0
+  call funcIdentity
+  add eax, 6
+  movsx rax, eax
+  add eax, 5
+  movsx rax, eax
+  add eax, 4
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov r8, 21
+  mov rsi, 84
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rbx, rax
+  mov rdi, 0
+  mov al, 0
+  call funcIdentity
+  add eax, 7
+  movsx rax, eax
+  add eax, 6
+  movsx rax, eax
+  add eax, 5
+  movsx rax, eax
+  add eax, 4
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov r8, 28
+  mov rsi, 85
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rbx, rax
+  push 8
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg8
+  add rsp, 16
+  mov r12, rax
+  push 8
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg8
+  add rsp, 16
+  add eax, 6
+  movsx rax, eax
+  add eax, 5
+  movsx rax, eax
+  add eax, 4
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov r8, 37
+  mov rsi, 86
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rbx, rax
+  mov rdi, 0
+  mov al, 0
+  call funcIdentity
+  add eax, 5
+  movsx rax, eax
+  add eax, 4
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  sub eax, 0
+  movsx rax, eax
+  push rax
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call funcArg8
+  add rsp, 16
+  mov rcx, rax
+  mov r8, 15
+  mov rsi, 88
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testTmpValuesAcrossFuncCall:
+  mov rbx, QWORD PTR -8[rbp]
+  mov r12, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl leafReassignArgs
+leafReassignArgs:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  movsx rax, r10d
+  sal rax, 1
+  mov rdi, rax
+  mov r10d, edi
+  mov rax, rdi
+  movsx rax, r11b
+  add al, 1
+  movsx rax, al
+  mov rdi, rax
+  mov r11b, dil
+  mov rax, rdi
+  movsx rax, r10d
+  mov rsi, rax
+  mov rax, r8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov r10d, edi
+  mov rax, rdi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11b
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_leafReassignArgs
+.Lreturn_leafReassignArgs:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl leafArgAddress
+leafArgAddress:
+  mov r10, rdi
+  mov DWORD PTR -16[rsp], esi
+  lea rdi, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_leafArgAddress
+.Lreturn_leafArgAddress:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl leafArgIncrement
+leafArgIncrement:
+  mov DWORD PTR -12[rsp], edi
+  mov DWORD PTR -16[rsp], esi
+  lea rax, QWORD PTR -12[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -12[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 10
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_leafArgIncrement
+.Lreturn_leafArgIncrement:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl leafArg6
+leafArg6:
+  mov r10, rdi
+  mov r11, rsi
+  mov DWORD PTR -20[rsp], edx
+  mov DWORD PTR -24[rsp], ecx
+  movsx rax, r9d
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov r9d, edi
+  mov rax, rdi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  sal rax, 1
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 2
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r8d
+  lea rax, QWORD PTR 0[rax+rax*4]
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r9d
+  imul rax, 6
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_leafArg6
+.Lreturn_leafArg6:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl leafArg8
+leafArg8:
+  mov r10, rdi
+  mov r11, rsi
+  mov DWORD PTR -20[rsp], edx
+  mov DWORD PTR -24[rsp], ecx
+  lea rdi, QWORD PTR -36[rsp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR 8[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR 16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r9d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_leafArg8
+.Lreturn_leafArg8:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testLeafFunctions
+testLeafFunctions:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rsi, 9
+  mov rdi, 10
+  mov rdx, rax
+  mov al, 0
+  call leafReassignArgs
+  mov rcx, rax
+  mov r8, 35
+  mov rsi, 123
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rbx, rax
+  mov rax, 4
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call leafArgAddress
+  mov rcx, rax
+  mov r8, 7
+  mov rsi, 124
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rbx, rax
+  mov rax, 4
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call leafArgIncrement
+  mov rcx, rax
+  mov r8, 43
+  mov rsi, 125
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rbx, rax
+  mov rax, 7
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call leafArg6
+  mov rcx, rax
+  mov r8, 91
+  mov rsi, 126
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rbx, rax
+  push 10
+  push 9
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call leafArg8
+  add rsp, 16
+  mov rcx, rax
+  mov r8, 20
+  mov rsi, 127
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testLeafFunctions:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineSquare:
+  mov r10, rdi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  jmp .Lreturn_inlineSquare
+.Lreturn_inlineSquare:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineLowByte:
+  mov r10, rdi
+  movsx rax, r10d
+  movsx rax, al
+  jmp .Lreturn_inlineLowByte
+.Lreturn_inlineLowByte:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineIncrement:
+  mov DWORD PTR -12[rsp], edi
+  lea rax, QWORD PTR -12[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lreturn_inlineIncrement
+.Lreturn_inlineIncrement:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineSumOfSquares:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r10d
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  imul rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_inlineSumOfSquares
+.Lreturn_inlineSumOfSquares:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineRecursive:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -32[rbp], rbx
+  mov QWORD PTR -40[rbp], r12
+  mov QWORD PTR -48[rbp], r13
+  mov QWORD PTR -56[rbp], r14
+  mov QWORD PTR -64[rbp], r15
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_1
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_9
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_10
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r13, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_11
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r14, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_12
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r15, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call inlineRecursive
+  mov rdi, rax
+  mov rax, r15
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_12
+.Lcond_falsy_12:
+  mov rax, 0
+.Lcond_end_12:
+  mov rdi, rax
+  mov rax, r14
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_11
+.Lcond_falsy_11:
+  mov rax, 0
+.Lcond_end_11:
+  mov rdi, rax
+  mov rax, r13
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_10
+.Lcond_falsy_10:
+  mov rax, 0
+.Lcond_end_10:
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_9
+.Lcond_falsy_9:
+  mov rax, 0
+.Lcond_end_9:
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_1
+.Lcond_falsy_1:
+  mov rax, 0
+.Lcond_end_1:
+  jmp .Lreturn_inlineRecursive
+.Lreturn_inlineRecursive:
+  mov rbx, QWORD PTR -32[rbp]
+  mov r12, QWORD PTR -40[rbp]
+  mov r13, QWORD PTR -48[rbp]
+  mov r14, QWORD PTR -56[rbp]
+  mov r15, QWORD PTR -64[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl inlineIsPositive
+inlineIsPositive:
+  mov r10, rdi
+  movsx rax, r10d
+  test rax, rax
+  jle .Llogical_false2
+  movsx rax, r10d
+  test rax, rax
+  je .Llogical_false2
+  mov rax, 1
+  jmp .Llogical_end2
+.Llogical_false2:
+  mov rax, 0
+.Llogical_end2:
+  jmp .Lreturn_inlineIsPositive
+.Lreturn_inlineIsPositive:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineStore:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_inlineStore:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineLocal:
+  mov r10, rdi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  jmp .Lreturn_inlineLocal
+.Lreturn_inlineLocal:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineLocalInit:
+  mov r10, rdi
+  lea rdi, QWORD PTR -13[rsp]
+  mov BYTE PTR 0[rdi], 0
+  movsx rax, r10d
+  mov rdi, rax
+  lea rax, QWORD PTR -13[rsp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -13[rsp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  add al, 1
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  jmp .Lreturn_inlineLocalInit
+.Lreturn_inlineLocalInit:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testInlineFunctions
+testInlineFunctions:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -40[rbp], rbx
+  mov QWORD PTR -48[rbp], r12
+  mov QWORD PTR -56[rbp], r13
+  mov QWORD PTR -64[rbp], r14
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov r9, 9
+  mov rsi, 148
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov r9, 9
+  mov rsi, 149
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 150
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  mov rcx, 44
+  mov r9, 44
+  mov rsi, 151
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 296
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 44
+  mov rsi, 152
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  mov rdi, 5
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov DWORD PTR 0[rdi], eax
+  mov r9, 6
+  mov rsi, 153
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov DWORD PTR 0[rdi], eax
+  mov r9, 5
+  mov rsi, 154
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 155
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rsi, 9
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  imul rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 25
+  mov rsi, 156
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rbx, rax
+  mov rdi, 9
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_14
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_15
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r13, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_16
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r14, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call inlineRecursive
+  mov rdi, rax
+  mov rax, r14
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_16
+.Lcond_falsy_16:
+  mov rax, 0
+.Lcond_end_16:
+  mov rdi, rax
+  mov rax, r13
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_15
+.Lcond_falsy_15:
+  mov rax, 0
+.Lcond_end_15:
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  jmp .Lcond_end_14
+.Lcond_falsy_14:
+  mov rax, 0
+.Lcond_end_14:
+  add eax, 10
+  movsx rax, eax
+  mov rcx, rax
+  mov r8, 55
+  mov rsi, 157
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jle .Llogical_false17
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false17
+  mov rax, 1
+  jmp .Llogical_end17
+.Llogical_false17:
+  mov rax, 0
+.Llogical_end17:
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 158
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jle .Llogical_false18
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false18
+  mov rax, 1
+  jmp .Llogical_end18
+.Llogical_false18:
+  mov rax, 0
+.Llogical_end18:
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 159
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 41
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 42
+  mov rsi, 161
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  mov rax, 1
+  lea rax, QWORD PTR 0[rdi+rax*4]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 163
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rbx, rax
+  mov rdi, 7
+  lea rax, QWORD PTR inlineSquarePtr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov al, 0
+  call r10
+  mov rcx, rax
+  mov r8, 49
+  mov rsi, 164
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov r8, rax
+  mov rdi, 9
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 165
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov r8, rax
+  mov rdi, 9
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 170
+  mov rsi, 166
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov r8, rax
+  mov rdi, 1
+  lea rax, QWORD PTR -21[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -21[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  add al, 1
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 167
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov r8, rax
+  mov rdi, 257
+  lea rax, QWORD PTR -21[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -21[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  add al, 1
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 168
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testInlineFunctions:
+  mov rbx, QWORD PTR -40[rbp]
+  mov r12, QWORD PTR -48[rbp]
+  mov r13, QWORD PTR -56[rbp]
+  mov r14, QWORD PTR -64[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailCount
+tailCount:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend3
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_tailCount
+.Lend3:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp tailCount
+.Lreturn_tailCount:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailIsEven
+tailIsEven:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend4
+  mov rax, 1
+  jmp .Lreturn_tailIsEven
+.Lend4:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp tailIsOdd
+.Lreturn_tailIsEven:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailIsOdd
+tailIsOdd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend5
+  mov rax, 0
+  jmp .Lreturn_tailIsOdd
+.Lend5:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp tailIsEven
+.Lreturn_tailIsOdd:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailRotate
+tailRotate:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -32[rbp], rbx
+  mov QWORD PTR -40[rbp], r12
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  mov DWORD PTR -12[rbp], edx
+  mov DWORD PTR -16[rbp], ecx
+  mov DWORD PTR -20[rbp], r8d
+  mov DWORD PTR -24[rbp], r9d
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend6
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 10000000
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 1000000
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 100000
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 10000
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 1000
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR 16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 100
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR 24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 10
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR 32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_tailRotate
+.Lend6:
+  lea rax, QWORD PTR 24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r10, rax
+  lea rax, QWORD PTR 16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r11, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR 32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r12
+  mov rax, rbx
+  mov QWORD PTR 16[rbp], rax
+  mov rax, r11
+  mov QWORD PTR 24[rbp], rax
+  mov rax, r10
+  mov QWORD PTR 32[rbp], rax
+  mov rbx, QWORD PTR -32[rbp]
+  mov r12, QWORD PTR -40[rbp]
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp tailRotate
+.Lreturn_tailRotate:
+  mov rbx, QWORD PTR -32[rbp]
+  mov r12, QWORD PTR -40[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailMoreStackArgs
+tailMoreStackArgs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  sub rsp, 8 /* RSP alignment */
+  push 8
+  push 7
+  push 6
+  mov r9, 5
+  mov r8, 4
+  mov rcx, 3
+  mov r10, 2
+  mov rsi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r10
+  mov al, 0
+  call tailRotate
+  add rsp, 32
+  jmp .Lreturn_tailMoreStackArgs
+.Lreturn_tailMoreStackArgs:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailIdentity
+tailIdentity:
+  mov r10, rdi
+  movsx rax, r10d
+  jmp .Lreturn_tailIdentity
+.Lreturn_tailIdentity:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailApply
+tailApply:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp r10
+.Lreturn_tailApply:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailLowByte
+tailLowByte:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call tailIdentity
+  movsx rax, al
+  jmp .Lreturn_tailLowByte
+.Lreturn_tailLowByte:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailDeref
+tailDeref:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_tailDeref
+.Lreturn_tailDeref:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailLocalAddress
+tailLocalAddress:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call tailDeref
+  jmp .Lreturn_tailLocalAddress
+.Lreturn_tailLocalAddress:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tailLocalArray
+tailLocalArray:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  mov al, 0
+  call tailDeref
+  jmp .Lreturn_tailLocalArray
+.Lreturn_tailLocalArray:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTailCalls
+testTailCalls:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 10000
+  mov rsi, rax
+  mov al, 0
+  call tailCount
+  mov rcx, rax
+  mov r8, 10000
+  mov rsi, 208
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rbx, rax
+  mov rdi, 1000
+  mov al, 0
+  call tailIsEven
+  mov rcx, rax
+  mov r8, 1
+  mov rsi, 209
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rbx, rax
+  mov rdi, 1001
+  mov al, 0
+  call tailIsEven
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 210
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov rbx, rax
+  sub rsp, 8 /* RSP alignment */
+  push 8
+  push 7
+  push 6
+  mov rax, 5
+  mov r8, 4
+  mov rcx, 3
+  mov r9, 2
+  mov rsi, 1
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call tailRotate
+  add rsp, 32
+  mov rcx, rax
+  mov r8, 81234567
+  mov rsi, 211
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov rbx, rax
+  sub rsp, 8 /* RSP alignment */
+  push 8
+  push 7
+  push 6
+  mov rax, 5
+  mov r8, 4
+  mov rcx, 3
+  mov r9, 2
+  mov rsi, 1
+  mov rdi, 7
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call tailRotate
+  add rsp, 32
+  mov rcx, rax
+  mov r8, 23456781
+  mov rsi, 212
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov rbx, rax
+  mov rdi, 3
+  mov al, 0
+  call tailMoreStackArgs
+  mov rcx, rax
+  mov r8, 67812345
+  mov rsi, 213
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov rbx, rax
+  mov rsi, 7
+  mov rax, QWORD PTR tailIdentity@GOTPCREL[rip]
+  mov rdi, rax
+  mov al, 0
+  call tailApply
+  mov rcx, rax
+  mov r8, 7
+  mov rsi, 214
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov rbx, rax
+  mov rdi, 300
+  mov al, 0
+  call tailLowByte
+  mov rcx, rax
+  mov r8, 44
+  mov rsi, 215
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov rbx, rax
+  mov rdi, 5
+  mov al, 0
+  call tailLocalAddress
+  mov rcx, rax
+  mov r8, 5
+  mov rsi, 216
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov rbx, rax
+  mov rdi, 6
+  mov al, 0
+  call tailLocalArray
+  mov rcx, rax
+  mov r8, 6
+  mov rsi, 217
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testTailCalls:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov rbx, rax
+  mov rax, 7
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call add
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 221
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov rbx, rax
+  mov rdi, 6
+  mov al, 0
+  call fib
+  mov rcx, rax
+  mov r8, 13
+  mov rsi, 222
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov rbx, rax
+  mov rax, 4
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call funcRefArgs
+  mov rcx, rax
+  mov r8, 23
+  mov rsi, 223
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov al, 0
+  call testFuncArg7
+  mov al, 0
+  call testFuncArg8
+  mov al, 0
+  call testFuncArgConflictOnStack
+  mov al, 0
+  call testTmpValuesAcrossFuncCall
+  mov al, 0
+  call testFuncCallWithVaArgs
+  mov al, 0
+  call testLeafFunctions
+  mov al, 0
+  call testInlineFunctions
+  mov al, 0
+  call testTailCalls
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "%s"
+.LiteralString1:
+  .string  "abc"
+.LiteralString2:
+  .string  "test/function.c"
+.LiteralString3:
+  .string  "*s"
+.LiteralString4:
+  .string  "test/function.c"
+.LiteralString5:
+  .string  "s[1]"
+.LiteralString6:
+  .string  "test/function.c"
+.LiteralString7:
+  .string  "s[2]"
+.LiteralString8:
+  .string  "test/function.c"
+.LiteralString9:
+  .string  "s[3]"
+.LiteralString10:
+  .string  "test/function.c"
+.LiteralString11:
+  .string  "n"
+.LiteralString12:
+  .string  "test/function.c"
+.LiteralString13:
+  .string  "n"
+.LiteralString14:
+  .string  "test/function.c"
+.LiteralString15:
+  .string  "funcArg7(1, 2, 3, 4, 5, 6, 7)"
+.LiteralString16:
+  .string  "test/function.c"
+.LiteralString17:
+  .string  "funcArg8(1, 2, 3, 4, 5, 6, 7, 8)"
+.LiteralString18:
+  .string  "test/function.c"
+.LiteralString19:
+  .string  "funcArg8(1, 2, 3, 4, 5, 6, funcArg8(1, 2, 3, 4, 5, 6, 7, 8), 42)"
+.LiteralString20:
+  .string  "test/function.c"
+.LiteralString21:
+  .string  "funcArgConflict(3)"
+.LiteralString22:
+  .string  "test/function.c"
+.LiteralString23:
+  .string  "1 + (2 + (3 + (4 + (5 + (6 + funcIdentity(0))))))"
+.LiteralString24:
+  .string  "test/function.c"
+.LiteralString25:
+  .string  "1 + (2 + (3 + (4 + (5 + (6 + (7 + funcIdentity(0)))))))"
+.LiteralString26:
+  .string  "test/function.c"
+.LiteralString27:
+  .string  "funcArg8(1, 2, 3, 4, 5, 6, 7, 8) + (1 + (2 + (3 + (4 + (5 + (6 + funcArg8(1, 2, 3, 4, 5, 6, 7, 8)))))))"
+.LiteralString28:
+  .string  "test/function.c"
+.LiteralString29:
+  .string  "funcArg8(1, 2, 3, 4, 5, 6, 7, 1 + (2 + (3 + (4 + (5 + funcIdentity(0))))) - 0)"
+.LiteralString30:
+  .string  "test/function.c"
+.LiteralString31:
+  .string  "leafReassignArgs(10, 9, &n)"
+.LiteralString32:
+  .string  "test/function.c"
+.LiteralString33:
+  .string  "leafArgAddress(3, 4)"
+.LiteralString34:
+  .string  "test/function.c"
+.LiteralString35:
+  .string  "leafArgIncrement(3, 4)"
+.LiteralString36:
+  .string  "test/function.c"
+.LiteralString37:
+  .string  "leafArg6(1, 2, 3, 4, 5, 7)"
+.LiteralString38:
+  .string  "test/function.c"
+.LiteralString39:
+  .string  "leafArg8(1, 2, 3, 4, 5, 6, 9, 10)"
+.LiteralString40:
+  .string  "test/function.c"
+.LiteralString41:
+  .string  "inlineSquare(n)"
+.LiteralString42:
+  .string  "test/function.c"
+.LiteralString43:
+  .string  "inlineSquare(n++)"
+.LiteralString44:
+  .string  "test/function.c"
+.LiteralString45:
+  .string  "n"
+.LiteralString46:
+  .string  "test/function.c"
+.LiteralString47:
+  .string  "inlineLowByte(300)"
+.LiteralString48:
+  .string  "test/function.c"
+.LiteralString49:
+  .string  "inlineLowByte(n + 296)"
+.LiteralString50:
+  .string  "test/function.c"
+.LiteralString51:
+  .string  "inlineIncrement(5)"
+.LiteralString52:
+  .string  "test/function.c"
+.LiteralString53:
+  .string  "inlineIncrement(n)"
+.LiteralString54:
+  .string  "test/function.c"
+.LiteralString55:
+  .string  "n"
+.LiteralString56:
+  .string  "test/function.c"
+.LiteralString57:
+  .string  "inlineSumOfSquares(3, n)"
+.LiteralString58:
+  .string  "test/function.c"
+.LiteralString59:
+  .string  "inlineRecursive(10)"
+.LiteralString60:
+  .string  "test/function.c"
+.LiteralString61:
+  .string  "inlineIsPositive(n)"
+.LiteralString62:
+  .string  "test/function.c"
+.LiteralString63:
+  .string  "inlineIsPositive(-n)"
+.LiteralString64:
+  .string  "test/function.c"
+.LiteralString65:
+  .string  "n"
+.LiteralString66:
+  .string  "test/function.c"
+.LiteralString67:
+  .string  "arr[1]"
+.LiteralString68:
+  .string  "test/function.c"
+.LiteralString69:
+  .string  "inlineSquarePtr(7)"
+.LiteralString70:
+  .string  "test/function.c"
+.LiteralString71:
+  .string  "inlineLocal(3)"
+.LiteralString72:
+  .string  "test/function.c"
+.LiteralString73:
+  .string  "inlineLocal(inlineLocal(3) + 3)"
+.LiteralString74:
+  .string  "test/function.c"
+.LiteralString75:
+  .string  "inlineLocalInit(1)"
+.LiteralString76:
+  .string  "test/function.c"
+.LiteralString77:
+  .string  "inlineLocalInit(257)"
+.LiteralString78:
+  .string  "test/function.c"
+.LiteralString79:
+  .string  "tailCount(10000, 0)"
+.LiteralString80:
+  .string  "test/function.c"
+.LiteralString81:
+  .string  "tailIsEven(1000)"
+.LiteralString82:
+  .string  "test/function.c"
+.LiteralString83:
+  .string  "tailIsEven(1001)"
+.LiteralString84:
+  .string  "test/function.c"
+.LiteralString85:
+  .string  "tailRotate(1, 1, 2, 3, 4, 5, 6, 7, 8)"
+.LiteralString86:
+  .string  "test/function.c"
+.LiteralString87:
+  .string  "tailRotate(7, 1, 2, 3, 4, 5, 6, 7, 8)"
+.LiteralString88:
+  .string  "test/function.c"
+.LiteralString89:
+  .string  "tailMoreStackArgs(3)"
+.LiteralString90:
+  .string  "test/function.c"
+.LiteralString91:
+  .string  "tailApply(tailIdentity, 7)"
+.LiteralString92:
+  .string  "test/function.c"
+.LiteralString93:
+  .string  "tailLowByte(300)"
+.LiteralString94:
+  .string  "test/function.c"
+.LiteralString95:
+  .string  "tailLocalAddress(5)"
+.LiteralString96:
+  .string  "test/function.c"
+.LiteralString97:
+  .string  "tailLocalArray(6)"
+.LiteralString98:
+  .string  "test/function.c"
+.LiteralString99:
+  .string  "add(3, 7)"
+.LiteralString100:
+  .string  "test/function.c"
+.LiteralString101:
+  .string  "fib(6)"
+.LiteralString102:
+  .string  "test/function.c"
+.LiteralString103:
+  .string  "funcRefArgs(5, 4)"
+inlineSquarePtr:
+  .quad inlineSquare
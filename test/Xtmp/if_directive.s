@@ -0,0 +1,657 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testPrimary
+testPrimary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 19
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 28
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 40
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 43
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 19
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 53
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 56
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 23
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 64
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 29
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 71
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 31
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 77
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testPrimary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testIfCond
+testIfCond:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 82
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 86
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 91
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 104
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 9
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 9
+  mov rsi, 117
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 11
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 126
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 135
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 168
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 19
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 181
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 23
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 190
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 29
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 195
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 31
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 200
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 37
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 207
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 41
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 212
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 43
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 43
+  mov rsi, 223
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 47
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 47
+  mov rsi, 228
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 53
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 53
+  mov rsi, 233
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 59
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 59
+  mov rsi, 238
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 61
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 61
+  mov rsi, 245
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testIfCond:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testPrimary
+  mov al, 0
+  call testIfCond
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test.h"
+.LiteralString1:
+  .string  "%s:%d: unreachable\n"
+.LiteralString2:
+  .string  "%s:%d: unreachable"
+.LiteralString3:
+  .string  "n"
+.LiteralString4:
+  .string  "test/if_directive.c"
+.LiteralString5:
+  .string  "n"
+.LiteralString6:
+  .string  "test/if_directive.c"
+.LiteralString7:
+  .string  "n"
+.LiteralString8:
+  .string  "test/if_directive.c"
+.LiteralString9:
+  .string  "n"
+.LiteralString10:
+  .string  "test/if_directive.c"
+.LiteralString11:
+  .string  "n"
+.LiteralString12:
+  .string  "test/if_directive.c"
+.LiteralString13:
+  .string  "n"
+.LiteralString14:
+  .string  "test/if_directive.c"
+.LiteralString15:
+  .string  "n"
+.LiteralString16:
+  .string  "test/if_directive.c"
+.LiteralString17:
+  .string  "n"
+.LiteralString18:
+  .string  "test/if_directive.c"
+.LiteralString19:
+  .string  "n"
+.LiteralString20:
+  .string  "test/if_directive.c"
+.LiteralString21:
+  .string  "n"
+.LiteralString22:
+  .string  "test/if_directive.c"
+.LiteralString23:
+  .string  "n"
+.LiteralString24:
+  .string  "test/if_directive.c"
+.LiteralString25:
+  .string  "n"
+.LiteralString26:
+  .string  "test/if_directive.c"
+.LiteralString27:
+  .string  "n"
+.LiteralString28:
+  .string  "test/if_directive.c"
+.LiteralString29:
+  .string  "n"
+.LiteralString30:
+  .string  "test/if_directive.c"
+.LiteralString31:
+  .string  "n"
+.LiteralString32:
+  .string  "test/if_directive.c"
+.LiteralString33:
+  .string  "n"
+.LiteralString34:
+  .string  "test/if_directive.c"
+.LiteralString35:
+  .string  "n"
+.LiteralString36:
+  .string  "test/if_directive.c"
+.LiteralString37:
+  .string  "n"
+.LiteralString38:
+  .string  "test/if_directive.c"
+.LiteralString39:
+  .string  "n"
+.LiteralString40:
+  .string  "test/if_directive.c"
+.LiteralString41:
+  .string  "n"
+.LiteralString42:
+  .string  "test/if_directive.c"
+.LiteralString43:
+  .string  "n"
+.LiteralString44:
+  .string  "test/if_directive.c"
+.LiteralString45:
+  .string  "n"
+.LiteralString46:
+  .string  "test/if_directive.c"
+.LiteralString47:
+  .string  "n"
+.LiteralString48:
+  .string  "test/if_directive.c"
+.LiteralString49:
+  .string  "n"
+.LiteralString50:
+  .string  "test/if_directive.c"
+.LiteralString51:
+  .string  "n"
+.LiteralString52:
+  .string  "test/if_directive.c"
+.LiteralString53:
+  .string  "n"
+.LiteralString54:
+  .string  "test/if_directive.c"
+.LiteralString55:
+  .string  "n"
+.LiteralString56:
+  .string  "test/if_directive.c"
+.LiteralString57:
+  .string  "n"
+.LiteralString58:
+  .string  "test/if_directive.c"
+.LiteralString59:
+  .string  "n"
+.LiteralString60:
+  .string  "test/if_directive.c"
@@ -0,0 +1,138 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testIfdefIfndef
+testIfdefIfndef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend0
+  .p2align 4
+.Lbegin1:
+  mov rsi, 12
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+.Literator1:
+.Lend1:
+.Lend0:
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  je .Lend2
+  .p2align 4
+.Lbegin3:
+  mov rsi, 17
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+.Literator3:
+.Lend3:
+.Lend2:
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend4
+  .p2align 4
+.Lbegin5:
+  mov rsi, 30
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+.Literator5:
+.Lend5:
+.Lend4:
+  mov rdi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 17
+  je .Lend6
+  .p2align 4
+.Lbegin7:
+  mov rsi, 35
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+.Literator7:
+.Lend7:
+.Lend6:
+.Lreturn_testIfdefIfndef:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testHeaderGuard
+testHeaderGuard:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  je .Lend8
+  .p2align 4
+.Lbegin9:
+  mov rsi, 51
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+.Literator9:
+.Lend9:
+.Lend8:
+.Lreturn_testHeaderGuard:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testIfdefIfndef
+  mov al, 0
+  call testHeaderGuard
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "%d: unreachable\n"
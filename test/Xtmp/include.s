@@ -0,0 +1,456 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl ret47
+ret47:
+  mov rax, 47
+  jmp .Lreturn_ret47
+.Lreturn_ret47:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl retElemOfGSH
+retElemOfGSH:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_retElemOfGSH
+.Lreturn_retElemOfGSH:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl getHeaderName
+getHeaderName:
+  lea rax, QWORD PTR .StaticVar0[rip]
+  jmp .Lreturn_getHeaderName
+.Lreturn_getHeaderName:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test__LINE__macroInHeader
+test__LINE__macroInHeader:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 8
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend0:
+.Lreturn_test__LINE__macroInHeader:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test__FILE__macroInHeader
+test__FILE__macroInHeader:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  test rax, rax
+  je .Lend1
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend1:
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rbx, rax
+  mov al, 0
+  call getHeaderName
+  mov rdi, rax
+  mov rsi, rbx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  je .Lend2
+  mov al, 0
+  call getHeaderName
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend2:
+.Lreturn_test__FILE__macroInHeader:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testObjectLikeMacro
+testObjectLikeMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 41
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 41
+  je .Lend3
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend3:
+  mov rdi, 43
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 43
+  je .Lend4
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend4:
+  mov rdi, 41
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 41
+  je .Lend5
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend5:
+.Lreturn_testObjectLikeMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFunctionLikeMacro
+testFunctionLikeMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 8
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend6
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend6:
+  mov rdi, 84
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 84
+  je .Lend7
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend7:
+  mov rdi, 82
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 82
+  je .Lend8
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend8:
+.Lreturn_testFunctionLikeMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testFuncCall
+testFuncCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov al, 0
+  call ret47
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 47
+  je .Lend9
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend9:
+.Lreturn_testFuncCall:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testStructDefinition
+testStructDefinition:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lend10
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend10:
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov al, 0
+  call retElemOfGSH
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lend11
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend11:
+.Lreturn_testStructDefinition:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedef
+testTypedef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov edx, DWORD PTR 0[rsi]
+  mov DWORD PTR 0[rdi], edx
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend12
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend12:
+.Lreturn_testTypedef:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call test__LINE__macroInHeader
+  mov al, 0
+  call test__FILE__macroInHeader
+  mov al, 0
+  call testObjectLikeMacro
+  mov al, 0
+  call testFunctionLikeMacro
+  mov al, 0
+  call testFuncCall
+  mov al, 0
+  call testStructDefinition
+  mov al, 0
+  call testTypedef
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "include.header"
+.LiteralString1:
+  .string  "test__LINE__macroInHeader(): n != 8: %d\n"
+.LiteralString2:
+  .string  "test/include.c"
+.LiteralString3:
+  .string  "test__FILE__macroInHeader(): File name mismatch: %s\n"
+.LiteralString4:
+  .string  "include.header"
+.LiteralString5:
+  .string  "test__FILE__macroInHeader(): HEADER name mismatch: %s\n"
+.LiteralString6:
+  .string  "testObjectLikeMacro(): n != 41: %d\n"
+.LiteralString7:
+  .string  "testObjectLikeMacro(): n != 43: %d\n"
+.LiteralString8:
+  .string  "testObjectLikeMacro(): n != 41: %d\n"
+.LiteralString9:
+  .string  "testFunctionLikeMacro(): n != 8: %d\n"
+.LiteralString10:
+  .string  "testFunctionLikeMacro(): n != 84: %d\n"
+.LiteralString11:
+  .string  "testFunctionLikeMacro(): n != 82: %d\n"
+.LiteralString12:
+  .string  "testFuncCall(): n != 47: %d\n"
+.LiteralString13:
+  .string  "testStructDefinition(): obj.num != 3: %d\n"
+.LiteralString14:
+  .string  "testStructDefinition(): n != 3: %d\n"
+.LiteralString15:
+  .string  "testTypedef(): dest.num != 7: %d\n"
+.LiteralString16:
+  .string  "include.header"
+.LiteralString17:
+  .string  "test/include.c"
+.LiteralString18:
+  .string  "test/include.c"
+.StaticVar0:
+  .string "include.header"
@@ -0,0 +1,503 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int strcmp(const char *, const char *);
+typedef struct {
+    int n;
+    char c;
+} GS0;
+typedef struct {
+    int ar[5];
+    char c;
+    char str[10];
+    GS0 s0;
+} GS1;
+int gnum = 101;
+int *gptr1 = &gnum;
+char gchar = 'u';
+int gnumar1[5] = {17, 19, 23};
+int gnumar2[] = {29, 31, 37};
+int gnumarar1[3][3] = {{41, 47, 53}};
+int gnumarar2[][3] = {{59, 61, 67}};
+char gstr1[10] = "abc";
+char gstr2[] = "xyz";
+char gstr3[] = {'d', 'e'};
+char *gstr4 = "asdf";
+char gstrar[2][5] = {"jjj", "kkk"};
+GS0 gs0 = {69, 71};
+GS0 gs0ar[2] = {{73, 79}};
+GS1 gs1 = {{83, 87}, 'w', "goodbye", {89, 97}};
+GS1 gs1rest = {{103, 107}, 'g', "space"};
+GS0 gs0_cmpd = (GS0){109, 113};
+GS1 gs1_cmpd = (GS1){{}, 0, {}, (GS0){119, 123}};
+GS0 *gs0_cmpd_ptr1 = &(GS0){3, 5};
+GS0 *gs0_cmpd_ptr2 = &gs0;
+void test_init_local_variables(void) {
+    {
+        int a = 5;
+        assert("test/init_variables.c", 41, (5), (a), "a");
+    }
+    {
+        int a = 5, b = 10;
+        int c = a + b;
+        assert("test/init_variables.c", 46, (5), (a), "a");
+        assert("test/init_variables.c", 47, (10), (b), "b");
+        assert("test/init_variables.c", 48, (15), (c), "c");
+    }
+}
+void test_init_local_arrays(void) {
+    {
+        int x[3] = {1, 2, 3};
+        assert("test/init_variables.c", 55, (1), (x[0]), "x[0]");
+        assert("test/init_variables.c", 56, (2), (x[1]), "x[1]");
+        assert("test/init_variables.c", 57, (3), (x[2]), "x[2]");
+    }
+    {
+        int x[3] = {1, 2, 3,};
+        assert("test/init_variables.c", 61, (1), (x[0]), "x[0]");
+        assert("test/init_variables.c", 62, (2), (x[1]), "x[1]");
+        assert("test/init_variables.c", 63, (3), (x[2]), "x[2]");
+    }
+    {
+        char x[3] = {'a', 'b', 'c'};
+        assert("test/init_variables.c", 67, ('a'), (x[0]), "x[0]");
+        assert("test/init_variables.c", 68, ('b'), (x[1]), "x[1]");
+        assert("test/init_variables.c", 69, ('c'), (x[2]), "x[2]");
+    }
+    {
+        int x[2][3] = {
+            {1, 2, 3},
+            {4, 5, 6},
+        };
+        int i, j;
+        for (i = 0; i < 2; ++i)
+            for (j = 0; j < 3; ++j)
+                assert("test/init_variables.c", 79, (i*3 + j + 1), (x[i][j]), "x[i][j]");
+    }
+    {
+        char x[4] = "baz";
+        assert("test/init_variables.c", 83, ('b'), (x[0]), "x[0]");
+        assert("test/init_variables.c", 84, ('a'), (x[1]), "x[1]");
+        assert("test/init_variables.c", 85, ('z'), (x[2]), "x[2]");
+        assert("test/init_variables.c", 86, ('\0'), (x[3]), "x[3]");
+    }
+    {
+        char x[2][4] = {
+            "d\nf",
+            {'g', 'h', 'i', '\0'},
+        };
+        assert("test/init_variables.c", 93, ('d'), (x[0][0]), "x[0][0]");
+        assert("test/init_variables.c", 94, ('\n'), (x[0][1]), "x[0][1]");
+        assert("test/init_variables.c", 95, ('f'), (x[0][2]), "x[0][2]");
+        assert("test/init_variables.c", 96, ('\0'), (x[0][3]), "x[0][3]");
+        assert("test/init_variables.c", 97, ('g'), (x[1][0]), "x[1][0]");
+        assert("test/init_variables.c", 98, ('h'), (x[1][1]), "x[1][1]");
+        assert("test/init_variables.c", 99, ('i'), (x[1][2]), "x[1][2]");
+        assert("test/init_variables.c", 100, ('\0'), (x[1][3]), "x[1][3]");
+    }
+    {
+        int x[] = {2, 3, 4};
+        assert("test/init_variables.c", 104, (3), (sizeof(x)/sizeof(x[0])), "sizeof(x)/sizeof(x[0])");
+        assert("test/init_variables.c", 105, (2), (x[0]), "x[0]");
+        assert("test/init_variables.c", 106, (3), (x[1]), "x[1]");
+        assert("test/init_variables.c", 107, (4), (x[2]), "x[2]");
+    }
+    {
+        int x[][3] = {{1, 2, 3}, {4, 5, 6}};
+        assert("test/init_variables.c", 111, (2), (sizeof(x)/sizeof(x[0])), "sizeof(x)/sizeof(x[0])");
+        assert("test/init_variables.c", 112, (1), (x[0][0]), "x[0][0]");
+        assert("test/init_variables.c", 113, (2), (x[0][1]), "x[0][1]");
+        assert("test/init_variables.c", 114, (3), (x[0][2]), "x[0][2]");
+        assert("test/init_variables.c", 115, (4), (x[1][0]), "x[1][0]");
+        assert("test/init_variables.c", 116, (5), (x[1][1]), "x[1][1]");
+        assert("test/init_variables.c", 117, (6), (x[1][2]), "x[1][2]");
+    }
+    {
+        char x[] = "abcd\n";
+        assert("test/init_variables.c", 121, (6), (sizeof(x)/sizeof(x[0])), "sizeof(x)/sizeof(x[0])");
+        assert("test/init_variables.c", 122, ('a'), (x[0]), "x[0]");
+        assert("test/init_variables.c", 123, ('b'), (x[1]), "x[1]");
+        assert("test/init_variables.c", 124, ('c'), (x[2]), "x[2]");
+        assert("test/init_variables.c", 125, ('d'), (x[3]), "x[3]");
+        assert("test/init_variables.c", 126, ('\n'), (x[4]), "x[4]");
+        assert("test/init_variables.c", 127, ('\0'), (x[5]), "x[5]");
+    }
+    {
+        int n[3] = {3, 5, 7}, m = 11;
+        assert("test/init_variables.c", 131, (3), (n[0]), "n[0]");
+        assert("test/init_variables.c", 132, (5), (n[1]), "n[1]");
+        assert("test/init_variables.c", 133, (7), (n[2]), "n[2]");
+        assert("test/init_variables.c", 134, (11), (m), "m");
+    }
+}
+void test_init_local_structs(void) {
+    struct S1 {
+        int n;
+        int m;
+    };
+    struct S2 {
+        char c;
+        int n;
+    };
+    struct S3 {
+        struct S2 s2;
+        char c;
+    };
+    struct S4 {
+        int n[4];
+    };
+    {
+        struct S1 obj = {3, 7};
+        assert("test/init_variables.c", 157, (3), (obj.n), "obj.n");
+        assert("test/init_variables.c", 158, (7), (obj.m), "obj.m");
+    }
+    {
+        struct S2 obj = {'a', 7};
+        assert("test/init_variables.c", 162, (97), (obj.c), "obj.c");
+        assert("test/init_variables.c", 163, (7), (obj.n), "obj.n");
+    }
+    {
+        struct S3 obj = {{'l', 11}, 'z'};
+        assert("test/init_variables.c", 167, (108), (obj.s2.c), "obj.s2.c");
+        assert("test/init_variables.c", 168, (11), (obj.s2.n), "obj.s2.n");
+        assert("test/init_variables.c", 169, (122), (obj.c), "obj.c");
+    }
+    {
+        struct S4 obj = {{13, 17, 19, 23}};
+        assert("test/init_variables.c", 173, (13), (obj.n[0]), "obj.n[0]");
+        assert("test/init_variables.c", 174, (17), (obj.n[1]), "obj.n[1]");
+        assert("test/init_variables.c", 175, (19), (obj.n[2]), "obj.n[2]");
+        assert("test/init_variables.c", 176, (23), (obj.n[3]), "obj.n[3]");
+    }
+    {
+        struct S1 obj[3] = {{29, 31}, {37, 41}, {43, 47}};
+        assert("test/init_variables.c", 180, (29), (obj[0].n), "obj[0].n");
+        assert("test/init_variables.c", 181, (31), (obj[0].m), "obj[0].m");
+        assert("test/init_variables.c", 182, (37), (obj[1].n), "obj[1].n");
+        assert("test/init_variables.c", 183, (41), (obj[1].m), "obj[1].m");
+        assert("test/init_variables.c", 184, (43), (obj[2].n), "obj[2].n");
+        assert("test/init_variables.c", 185, (47), (obj[2].m), "obj[2].m");
+    }
+}
+void fill_stack_garbage(void) {
+    char garbage[5000];
+    for (int i = 0; i < 5000; ++i)
+        garbage[i] = 85;
+    assert("test/init_variables.c", 193, (85), (garbage[4999]), "garbage[4999]");
+}
+int sum_zero_cleared_arrays(void) {
+    int large[1024] = {7};
+    char odd[301] = {1};
+    int medium[13] = {3};
+    int sum = 0;
+    for (int i = 1; i < 1024; ++i)
+        sum += large[i];
+    for (int i = 1; i < 301; ++i)
+        sum += odd[i];
+    for (int i = 1; i < 13; ++i)
+        sum += medium[i];
+    return sum + large[0] + odd[0] + medium[0];
+}
+void test_zero_clear_local_array(void) {
+    {
+        int n[3][3] = {{}, {101, 103},};
+        assert("test/init_variables.c", 213, (0), (n[0][0]), "n[0][0]");
+        assert("test/init_variables.c", 214, (0), (n[0][1]), "n[0][1]");
+        assert("test/init_variables.c", 215, (0), (n[0][2]), "n[0][2]");
+        assert("test/init_variables.c", 216, (101), (n[1][0]), "n[1][0]");
+        assert("test/init_variables.c", 217, (103), (n[1][1]), "n[1][1]");
+        assert("test/init_variables.c", 218, (0), (n[1][2]), "n[1][2]");
+        assert("test/init_variables.c", 219, (0), (n[2][0]), "n[2][0]");
+        assert("test/init_variables.c", 220, (0), (n[2][1]), "n[2][1]");
+        assert("test/init_variables.c", 221, (0), (n[2][2]), "n[2][2]");
+    }
+    {
+        char s[5] = "xyz";
+        assert("test/init_variables.c", 225, (120), (s[0]), "s[0]");
+        assert("test/init_variables.c", 226, (121), (s[1]), "s[1]");
+        assert("test/init_variables.c", 227, (122), (s[2]), "s[2]");
+        assert("test/init_variables.c", 228, (0), (s[3]), "s[3]");
+        assert("test/init_variables.c", 229, (0), (s[4]), "s[4]");
+    }
+    fill_stack_garbage();
+    assert("test/init_variables.c", 232, (11), (sum_zero_cleared_arrays()), "sum_zero_cleared_arrays()");
+}
+void test_zero_clear_local_struct(void) {
+    struct S0 {
+        int n;
+        int narray1[3];
+        int narray3[3][3][3];
+    };
+    struct S {
+        int n;
+        struct S0 s0;
+        struct S0 s0array[3];
+    };
+    {
+        struct S0 obj = {};
+        assert("test/init_variables.c", 248, (0), (obj.n), "obj.n");
+        assert("test/init_variables.c", 249, (0), (obj.narray1[0]), "obj.narray1[0]");
+        assert("test/init_variables.c", 250, (0), (obj.narray1[1]), "obj.narray1[1]");
+        assert("test/init_variables.c", 251, (0), (obj.narray1[2]), "obj.narray1[2]");
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    assert("test/init_variables.c", 255, (0), (obj.narray3[i][j][k]), "obj.narray3[i][j][k]");
+    }
+    {
+        struct S0 obj = {3, {5, 7, 11}, {}};
+        assert("test/init_variables.c", 259, (3), (obj.n), "obj.n");
+        assert("test/init_variables.c", 260, (5), (obj.narray1[0]), "obj.narray1[0]");
+        assert("test/init_variables.c", 261, (7), (obj.narray1[1]), "obj.narray1[1]");
+        assert("test/init_variables.c", 262, (11), (obj.narray1[2]), "obj.narray1[2]");
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    assert("test/init_variables.c", 266, (0), (obj.narray3[i][j][k]), "obj.narray3[i][j][k]");
+    }
+    {
+        struct S obj = {13, {}, {{}, {17, {19, 23, 29}, {}},}};
+        assert("test/init_variables.c", 270, (13), (obj.n), "obj.n");
+        assert("test/init_variables.c", 272, (0), (obj.s0.n), "obj.s0.n");
+        assert("test/init_variables.c", 273, (0), (obj.s0.narray1[0]), "obj.s0.narray1[0]");
+        assert("test/init_variables.c", 274, (0), (obj.s0.narray1[1]), "obj.s0.narray1[1]");
+        assert("test/init_variables.c", 275, (0), (obj.s0.narray1[2]), "obj.s0.narray1[2]");
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    assert("test/init_variables.c", 279, (0), (obj.s0.narray3[i][j][k]), "obj.s0.narray3[i][j][k]");
+        assert("test/init_variables.c", 281, (0), (obj.s0array[0].n), "obj.s0array[0].n");
+        assert("test/init_variables.c", 282, (0), (obj.s0array[0].narray1[0]), "obj.s0array[0].narray1[0]");
+        assert("test/init_variables.c", 283, (0), (obj.s0array[0].narray1[1]), "obj.s0array[0].narray1[1]");
+        assert("test/init_variables.c", 284, (0), (obj.s0array[0].narray1[2]), "obj.s0array[0].narray1[2]");
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    assert("test/init_variables.c", 288, (0), (obj.s0array[0].narray3[i][j][k]), "obj.s0array[0].narray3[i][j][k]");
+        assert("test/init_variables.c", 290, (17), (obj.s0array[1].n), "obj.s0array[1].n");
+        assert("test/init_variables.c", 291, (19), (obj.s0array[1].narray1[0]), "obj.s0array[1].narray1[0]");
+        assert("test/init_variables.c", 292, (23), (obj.s0array[1].narray1[1]), "obj.s0array[1].narray1[1]");
+        assert("test/init_variables.c", 293, (29), (obj.s0array[1].narray1[2]), "obj.s0array[1].narray1[2]");
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    assert("test/init_variables.c", 297, (0), (obj.s0array[1].narray3[i][j][k]), "obj.s0array[1].narray3[i][j][k]");
+        assert("test/init_variables.c", 299, (0), (obj.s0array[2].n), "obj.s0array[2].n");
+        assert("test/init_variables.c", 300, (0), (obj.s0array[2].narray1[0]), "obj.s0array[2].narray1[0]");
+        assert("test/init_variables.c", 301, (0), (obj.s0array[2].narray1[1]), "obj.s0array[2].narray1[1]");
+        assert("test/init_variables.c", 302, (0), (obj.s0array[2].narray1[2]), "obj.s0array[2].narray1[2]");
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    assert("test/init_variables.c", 306, (0), (obj.s0array[2].narray3[i][j][k]), "obj.s0array[2].narray3[i][j][k]");
+    }
+}
+void test_init_global_primitives(void) {
+    assert("test/init_variables.c", 311, (101), (gnum), "gnum");
+    assert("test/init_variables.c", 312, (117), (gchar), "gchar");
+}
+void test_init_global_pointers(void) {
+    assert("test/init_variables.c", 316, (0), (strcmp(gstr4, "asdf")), "strcmp(gstr4, \"asdf\")");
+    assert("test/init_variables.c", 317, (1), (&gnum == gptr1), "&gnum == gptr1");
+}
+void test_init_global_arrays(void) {
+    assert("test/init_variables.c", 321, (5 * sizeof(int)), (sizeof(gnumar1)), "sizeof(gnumar1)");
+    assert("test/init_variables.c", 322, (17), (gnumar1[0]), "gnumar1[0]");
+    assert("test/init_variables.c", 323, (19), (gnumar1[1]), "gnumar1[1]");
+    assert("test/init_variables.c", 324, (23), (gnumar1[2]), "gnumar1[2]");
+    assert("test/init_variables.c", 325, (0), (gnumar1[3]), "gnumar1[3]");
+    assert("test/init_variables.c", 326, (0), (gnumar1[4]), "gnumar1[4]");
+    assert("test/init_variables.c", 328, (3 * sizeof(int)), (sizeof(gnumar2)), "sizeof(gnumar2)");
+    assert("test/init_variables.c", 329, (29), (gnumar2[0]), "gnumar2[0]");
+    assert("test/init_variables.c", 330, (31), (gnumar2[1]), "gnumar2[1]");
+    assert("test/init_variables.c", 331, (37), (gnumar2[2]), "gnumar2[2]");
+    assert("test/init_variables.c", 333, (9 * sizeof(int)), (sizeof(gnumarar1)), "sizeof(gnumarar1)");
+    assert("test/init_variables.c", 334, (41), (gnumarar1[0][0]), "gnumarar1[0][0]");
+    assert("test/init_variables.c", 335, (47), (gnumarar1[0][1]), "gnumarar1[0][1]");
+    assert("test/init_variables.c", 336, (53), (gnumarar1[0][2]), "gnumarar1[0][2]");
+    for (int i = 0; i < 3; ++i) {
+        assert("test/init_variables.c", 338, (0), (gnumarar1[1][i]), "gnumarar1[1][i]");
+        assert("test/init_variables.c", 339, (0), (gnumarar1[2][i]), "gnumarar1[2][i]");
+    }
+    assert("test/init_variables.c", 342, (3 * sizeof(int)), (sizeof(gnumarar2)), "sizeof(gnumarar2)");
+    assert("test/init_variables.c", 343, (59), (gnumarar2[0][0]), "gnumarar2[0][0]");
+    assert("test/init_variables.c", 344, (61), (gnumarar2[0][1]), "gnumarar2[0][1]");
+    assert("test/init_variables.c", 345, (67), (gnumarar2[0][2]), "gnumarar2[0][2]");
+    assert("test/init_variables.c", 347, (10), (sizeof(gstr1)), "sizeof(gstr1)");
+    assert("test/init_variables.c", 348, (0), (strcmp(gstr1, "abc")), "strcmp(gstr1, \"abc\")");
+    assert("test/init_variables.c", 349, (0), (gstr1[8]), "gstr1[8]");
+    assert("test/init_variables.c", 351, (4), (sizeof(gstr2)), "sizeof(gstr2)");
+    assert("test/init_variables.c", 352, (0), (strcmp(gstr2, "xyz")), "strcmp(gstr2, \"xyz\")");
+    assert("test/init_variables.c", 354, (2), (sizeof(gstr3)), "sizeof(gstr3)");
+    assert("test/init_variables.c", 355, (100), (gstr3[0]), "gstr3[0]");
+    assert("test/init_variables.c", 356, (101), (gstr3[1]), "gstr3[1]");
+    assert("test/init_variables.c", 358, (10), (sizeof(gstrar)), "sizeof(gstrar)");
+    assert("test/init_variables.c", 359, (0), (strcmp(gstrar[0], "jjj")), "strcmp(gstrar[0], \"jjj\")");
+    assert("test/init_variables.c", 360, (0), (strcmp(gstrar[1], "kkk")), "strcmp(gstrar[1], \"kkk\")");
+}
+void test_init_global_structs(void) {
+    assert("test/init_variables.c", 364, (69), (gs0.n), "gs0.n");
+    assert("test/init_variables.c", 365, (71), (gs0.c), "gs0.c");
+    assert("test/init_variables.c", 367, (2 * sizeof(GS0)), (sizeof(gs0ar)), "sizeof(gs0ar)");
+    assert("test/init_variables.c", 368, (73), (gs0ar[0].n), "gs0ar[0].n");
+    assert("test/init_variables.c", 369, (79), (gs0ar[0].c), "gs0ar[0].c");
+    assert("test/init_variables.c", 370, (0), (gs0ar[1].n), "gs0ar[1].n");
+    assert("test/init_variables.c", 371, (0), (gs0ar[1].c), "gs0ar[1].c");
+    assert("test/init_variables.c", 373, (83), (gs1.ar[0]), "gs1.ar[0]");
+    assert("test/init_variables.c", 374, (87), (gs1.ar[1]), "gs1.ar[1]");
+    assert("test/init_variables.c", 375, (0), (gs1.ar[3]), "gs1.ar[3]");
+    assert("test/init_variables.c", 376, (119), (gs1.c), "gs1.c");
+    assert("test/init_variables.c", 377, (0), (strcmp(gs1.str, "goodbye")), "strcmp(gs1.str, \"goodbye\")");
+    assert("test/init_variables.c", 378, (0), (gs1.str[9]), "gs1.str[9]");
+    assert("test/init_variables.c", 379, (89), (gs1.s0.n), "gs1.s0.n");
+    assert("test/init_variables.c", 380, (97), (gs1.s0.c), "gs1.s0.c");
+    assert("test/init_variables.c", 382, (103), (gs1rest.ar[0]), "gs1rest.ar[0]");
+    assert("test/init_variables.c", 383, (107), (gs1rest.ar[1]), "gs1rest.ar[1]");
+    assert("test/init_variables.c", 384, (0), (gs1rest.ar[3]), "gs1rest.ar[3]");
+    assert("test/init_variables.c", 385, (103), (gs1rest.c), "gs1rest.c");
+    assert("test/init_variables.c", 386, (0), (strcmp(gs1rest.str, "space")), "strcmp(gs1rest.str, \"space\")");
+    assert("test/init_variables.c", 387, (0), (gs1rest.str[8]), "gs1rest.str[8]");
+    assert("test/init_variables.c", 388, (0), (gs1rest.s0.n), "gs1rest.s0.n");
+    assert("test/init_variables.c", 389, (0), (gs1rest.s0.c), "gs1rest.s0.c");
+    assert("test/init_variables.c", 391, (109), (gs0_cmpd.n), "gs0_cmpd.n");
+    assert("test/init_variables.c", 392, (113), (gs0_cmpd.c), "gs0_cmpd.c");
+    assert("test/init_variables.c", 394, (119), (gs1_cmpd.s0.n), "gs1_cmpd.s0.n");
+    assert("test/init_variables.c", 395, (123), (gs1_cmpd.s0.c), "gs1_cmpd.s0.c");
+    assert("test/init_variables.c", 397, (3), (gs0_cmpd_ptr1->n), "gs0_cmpd_ptr1->n");
+    assert("test/init_variables.c", 398, (5), (gs0_cmpd_ptr1->c), "gs0_cmpd_ptr1->c");
+    assert("test/init_variables.c", 400, (1), (gs0_cmpd_ptr2 == &gs0), "gs0_cmpd_ptr2 == &gs0");
+    assert("test/init_variables.c", 401, (69), (gs0_cmpd_ptr2->n), "gs0_cmpd_ptr2->n");
+    assert("test/init_variables.c", 402, (71), (gs0_cmpd_ptr2->c), "gs0_cmpd_ptr2->c");
+}
+void test_init_static_primitives(void) {
+    static int zero;
+    static int n = 13;
+    assert("test/init_variables.c", 408, (0), (zero), "zero");
+    assert("test/init_variables.c", 409, (13), (n), "n");
+}
+void test_init_static_pointers(void) {
+    static int num;
+    static int *ptr = &num;
+    static char *str = "bar";
+    assert("test/init_variables.c", 417, (1), (ptr == &num), "ptr == &num");
+    assert("test/init_variables.c", 418, (0), (strcmp(str, "bar")), "strcmp(str, \"bar\")");
+}
+void test_init_static_arrays(void) {
+    static int nums1[10] = {3, 5, 7, 11, 13};
+    static int nums2[] = {23, 29, 31, 37};
+    static char s1[10] = "abc";
+    static char s2[] = "xyz";
+    static char s3[] = {'i', 'o', 's'};
+    static char ss1[4][10] = {"fgh", "jkl", "opq"};
+    static char ss2[][10] = {"yuio", "hjkl", "nm,."};
+    assert("test/init_variables.c", 430, (10 * sizeof(int)), (sizeof(nums1)), "sizeof(nums1)");
+    assert("test/init_variables.c", 431, (3), (nums1[0]), "nums1[0]");
+    assert("test/init_variables.c", 432, (5), (nums1[1]), "nums1[1]");
+    assert("test/init_variables.c", 433, (7), (nums1[2]), "nums1[2]");
+    assert("test/init_variables.c", 434, (11), (nums1[3]), "nums1[3]");
+    assert("test/init_variables.c", 435, (13), (nums1[4]), "nums1[4]");
+    assert("test/init_variables.c", 436, (0), (nums1[5]), "nums1[5]");
+    assert("test/init_variables.c", 437, (0), (nums1[6]), "nums1[6]");
+    assert("test/init_variables.c", 438, (0), (nums1[7]), "nums1[7]");
+    assert("test/init_variables.c", 439, (0), (nums1[8]), "nums1[8]");
+    assert("test/init_variables.c", 440, (0), (nums1[9]), "nums1[9]");
+    assert("test/init_variables.c", 442, (4 * sizeof(int)), (sizeof(nums2)), "sizeof(nums2)");
+    assert("test/init_variables.c", 443, (23), (nums2[0]), "nums2[0]");
+    assert("test/init_variables.c", 444, (29), (nums2[1]), "nums2[1]");
+    assert("test/init_variables.c", 445, (31), (nums2[2]), "nums2[2]");
+    assert("test/init_variables.c", 446, (37), (nums2[3]), "nums2[3]");
+    assert("test/init_variables.c", 448, (10), (sizeof(s1)), "sizeof(s1)");
+    assert("test/init_variables.c", 449, (0), (strcmp(s1, "abc")), "strcmp(s1, \"abc\")");
+    assert("test/init_variables.c", 450, (0), (s1[5]), "s1[5]");
+    assert("test/init_variables.c", 452, (4), (sizeof(s2)), "sizeof(s2)");
+    assert("test/init_variables.c", 453, (0), (strcmp(s2, "xyz")), "strcmp(s2, \"xyz\")");
+    assert("test/init_variables.c", 455, (3), (sizeof(s3)), "sizeof(s3)");
+    assert("test/init_variables.c", 456, (105), (s3[0]), "s3[0]");
+    assert("test/init_variables.c", 457, (111), (s3[1]), "s3[1]");
+    assert("test/init_variables.c", 458, (115), (s3[2]), "s3[2]");
+    assert("test/init_variables.c", 460, (40), (sizeof(ss1)), "sizeof(ss1)");
+    assert("test/init_variables.c", 461, (0), (strcmp(ss1[0], "fgh")), "strcmp(ss1[0], \"fgh\")");
+    assert("test/init_variables.c", 462, (0), (strcmp(ss1[1], "jkl")), "strcmp(ss1[1], \"jkl\")");
+    assert("test/init_variables.c", 463, (0), (strcmp(ss1[2], "opq")), "strcmp(ss1[2], \"opq\")");
+    assert("test/init_variables.c", 464, (0), (strcmp(ss1[3], "")), "strcmp(ss1[3], \"\")");
+    assert("test/init_variables.c", 465, (0), (ss1[0][5]), "ss1[0][5]");
+    assert("test/init_variables.c", 467, (30), (sizeof(ss2)), "sizeof(ss2)");
+    assert("test/init_variables.c", 468, (0), (strcmp(ss2[0], "yuio")), "strcmp(ss2[0], \"yuio\")");
+    assert("test/init_variables.c", 469, (0), (strcmp(ss2[1], "hjkl")), "strcmp(ss2[1], \"hjkl\")");
+    assert("test/init_variables.c", 470, (0), (strcmp(ss2[2], "nm,.")), "strcmp(ss2[2], \"nm,.\")");
+    assert("test/init_variables.c", 471, (0), (ss2[0][5]), "ss2[0][5]");
+}
+void test_init_static_structs(void) {
+    typedef struct {
+        int n;
+        char c;
+    } S0;
+    typedef struct {
+        int ar[5];
+        char c;
+        char str[10];
+        S0 s0;
+    } S1;
+    static S0 s0 = {7, 11};
+    static S0 s0ar[2] = {{13, 17}};
+    static S1 s1 = {{19, 23}, 'x', "hello", {29, 31}};
+    static S1 s1rest = {{37, 41}, 'h', "world"};
+    assert("test/init_variables.c", 495, (7), (s0.n), "s0.n");
+    assert("test/init_variables.c", 496, (11), (s0.c), "s0.c");
+    assert("test/init_variables.c", 498, (2 * sizeof(S0)), (sizeof(s0ar)), "sizeof(s0ar)");
+    assert("test/init_variables.c", 499, (13), (s0ar[0].n), "s0ar[0].n");
+    assert("test/init_variables.c", 500, (17), (s0ar[0].c), "s0ar[0].c");
+    assert("test/init_variables.c", 501, (0), (s0ar[1].n), "s0ar[1].n");
+    assert("test/init_variables.c", 502, (0), (s0ar[1].c), "s0ar[1].c");
+    assert("test/init_variables.c", 504, (19), (s1.ar[0]), "s1.ar[0]");
+    assert("test/init_variables.c", 505, (23), (s1.ar[1]), "s1.ar[1]");
+    assert("test/init_variables.c", 506, (0), (s1.ar[3]), "s1.ar[3]");
+    assert("test/init_variables.c", 507, (120), (s1.c), "s1.c");
+    assert("test/init_variables.c", 508, (0), (strcmp(s1.str, "hello")), "strcmp(s1.str, \"hello\")");
+    assert("test/init_variables.c", 509, (0), (s1.str[8]), "s1.str[8]");
+    assert("test/init_variables.c", 510, (29), (s1.s0.n), "s1.s0.n");
+    assert("test/init_variables.c", 511, (31), (s1.s0.c), "s1.s0.c");
+    assert("test/init_variables.c", 513, (37), (s1rest.ar[0]), "s1rest.ar[0]");
+    assert("test/init_variables.c", 514, (41), (s1rest.ar[1]), "s1rest.ar[1]");
+    assert("test/init_variables.c", 515, (0), (s1rest.ar[3]), "s1rest.ar[3]");
+    assert("test/init_variables.c", 516, (104), (s1rest.c), "s1rest.c");
+    assert("test/init_variables.c", 517, (0), (strcmp(s1rest.str, "world")), "strcmp(s1rest.str, \"world\")");
+    assert("test/init_variables.c", 518, (0), (s1rest.str[8]), "s1rest.str[8]");
+    assert("test/init_variables.c", 519, (0), (s1rest.s0.n), "s1rest.s0.n");
+    assert("test/init_variables.c", 520, (0), (s1rest.s0.c), "s1rest.s0.c");
+}
+void test_init_with_NULL(void) {
+    int *p = (void *)0;
+    static int *sp1 = (void *)0;
+    static int n = 7;
+    static int *sp2 = (void *)0;
+    assert("test/init_variables.c", 538, (1), (p == 0), "p == 0");
+    assert("test/init_variables.c", 539, (1), (sp1 == 0), "sp1 == 0");
+    assert("test/init_variables.c", 540, (1), (sp2 == 0), "sp2 == 0");
+    sp1 = &n;
+    sp2 = &n;
+    assert("test/init_variables.c", 543, (7), (n), "n");
+}
+void test_init_static_primitive_with_negative_value(void) {
+    static int n = -1;
+    assert("test/init_variables.c", 548, (-1), (n), "n");
+}
+int main(void) {
+    test_init_local_variables();
+    test_init_local_arrays();
+    test_zero_clear_local_array();
+    test_zero_clear_local_struct();
+    test_init_global_primitives();
+    test_init_global_pointers();
+    test_init_global_arrays();
+    test_init_global_structs();
+    test_init_static_primitives();
+    test_init_static_pointers();
+    test_init_static_arrays();
+    test_init_static_structs();
+    test_init_with_NULL();
+    test_init_static_primitive_with_negative_value();
+}
@@ -0,0 +1,6154 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl test_init_local_variables
+test_init_local_variables:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 41
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 10
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 46
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 47
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 15
+  mov rsi, 48
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_local_variables:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_local_arrays
+test_init_local_arrays:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -12[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 1
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 2
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 3
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 55
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 56
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 57
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -12[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 1
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 2
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 3
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 61
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 62
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 63
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -3[rbp]
+  mov BYTE PTR 0[rdi], 0
+  mov BYTE PTR 1[rdi], 0
+  mov BYTE PTR 2[rdi], 0
+  mov rdi, 97
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  mov rdi, 98
+  mov BYTE PTR -2[rbp], dil
+  mov rax, rdi
+  mov rdi, 99
+  mov BYTE PTR -1[rbp], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov r8, rax
+  mov al, BYTE PTR -3[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 67
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov r8, rax
+  mov al, BYTE PTR -2[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 98
+  mov rsi, 68
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov r8, rax
+  mov al, BYTE PTR -1[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 99
+  mov rsi, 69
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -24[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 4
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jge .Lend0
+  .p2align 4
+.Lbegin0:
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend1
+  .p2align 4
+.Lbegin1:
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov r9, rax
+  mov rsi, 79
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator1:
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin1
+.Lend1:
+.Literator0:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lbegin0
+.Lend0:
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 98
+  mov BYTE PTR -4[rbp], dil
+  mov rax, rdi
+  mov rdi, 97
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  mov rdi, 122
+  mov BYTE PTR -2[rbp], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  mov al, BYTE PTR -4[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 98
+  mov rsi, 83
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  mov al, BYTE PTR -3[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 84
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  mov al, BYTE PTR -2[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 122
+  mov rsi, 85
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  mov al, BYTE PTR -1[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 86
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 100
+  lea rax, QWORD PTR -8[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -8[rbp]
+  mov BYTE PTR 1[rax], dil
+  mov rax, rdi
+  mov rdi, 102
+  lea rax, QWORD PTR -8[rbp]
+  mov BYTE PTR 2[rax], dil
+  mov rax, rdi
+  mov rdi, 103
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 104
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 1[rax], dil
+  mov rax, rdi
+  mov rdi, 105
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 2[rax], dil
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 3[rax], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 93
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 94
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 102
+  mov rsi, 95
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 3[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 96
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 103
+  mov rsi, 97
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 104
+  mov rsi, 98
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 105
+  mov rsi, 99
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov al, BYTE PTR 3[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 100
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -12[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 2
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 3
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 4
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 104
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 105
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 106
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 107
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -24[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 4
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 112
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 113
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 114
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 115
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 116
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 6
+  mov rsi, 117
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -6[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov BYTE PTR 4[rdi], 0
+  mov BYTE PTR 5[rdi], 0
+  mov rdi, 97
+  mov BYTE PTR -6[rbp], dil
+  mov rax, rdi
+  mov rdi, 98
+  mov BYTE PTR -5[rbp], dil
+  mov rax, rdi
+  mov rdi, 99
+  mov BYTE PTR -4[rbp], dil
+  mov rax, rdi
+  mov rdi, 100
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  mov rdi, 10
+  mov BYTE PTR -2[rbp], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov r8, rax
+  mov rcx, 6
+  mov r9, 6
+  mov rsi, 121
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov r8, rax
+  mov al, BYTE PTR -6[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 122
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov r8, rax
+  mov al, BYTE PTR -5[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 98
+  mov rsi, 123
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov r8, rax
+  mov al, BYTE PTR -4[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 99
+  mov rsi, 124
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov r8, rax
+  mov al, BYTE PTR -3[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 125
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov r8, rax
+  mov al, BYTE PTR -2[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 126
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov r8, rax
+  mov al, BYTE PTR -1[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 127
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -12[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 3
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 5
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 7
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 11
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 131
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 132
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 133
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 134
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_local_arrays:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_local_structs
+test_init_local_structs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 157
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 158
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 97
+  lea rax, QWORD PTR -8[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 162
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 163
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -12[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 108
+  lea rax, QWORD PTR -12[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 122
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 108
+  mov rsi, 167
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 168
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 122
+  mov rsi, 169
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -16[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov rdi, 13
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 12[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 173
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 174
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 175
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 176
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -24[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov rdi, 29
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 31
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 37
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 41
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 43
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 47
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 180
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 181
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 182
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 183
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 43
+  mov rsi, 184
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString139[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 47
+  mov rsi, 185
+  lea rax, QWORD PTR .LiteralString138[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_local_structs:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl fill_stack_garbage
+fill_stack_garbage:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 5008
+  lea rdi, QWORD PTR -5004[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -5004[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -5004[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5000
+  jge .Lend2
+  .p2align 4
+.Lbegin2:
+  mov rdi, 85
+  lea rax, QWORD PTR -5004[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR -5000[rbp+rax*1], dil
+  mov rax, rdi
+.Literator2:
+  lea rax, QWORD PTR -5004[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -5004[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5000
+  jl .Lbegin2
+.Lend2:
+  lea rax, QWORD PTR .LiteralString141[rip]
+  mov r8, rax
+  mov al, BYTE PTR -1[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 85
+  mov rsi, 193
+  lea rax, QWORD PTR .LiteralString140[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_fill_stack_garbage:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl sum_zero_cleared_arrays
+sum_zero_cleared_arrays:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 4464
+  lea rdi, QWORD PTR -4096[rbp]
+  mov rcx, 512
+  mov rax, 0
+  rep stosq
+  mov rdi, 7
+  mov DWORD PTR -4096[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -4397[rbp]
+  mov rcx, 37
+  mov rax, 0
+  rep stosq
+  mov DWORD PTR 0[rdi], 0
+  mov BYTE PTR 4[rdi], 0
+  mov rdi, 1
+  mov BYTE PTR -4397[rbp], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -4452[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov DWORD PTR 48[rdi], 0
+  mov rdi, 3
+  mov DWORD PTR -4452[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -4456[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4456[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -4460[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4460[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1024
+  jge .Lend3
+  .p2align 4
+.Lbegin3:
+  lea rax, QWORD PTR -4456[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR -4096[rbp+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4456[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator3:
+  lea rax, QWORD PTR -4460[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1024
+  jl .Lbegin3
+.Lend3:
+  lea rdi, QWORD PTR -4460[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4460[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 301
+  jge .Lend4
+  .p2align 4
+.Lbegin4:
+  lea rax, QWORD PTR -4456[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov al, BYTE PTR -4397[rbp+rax*1]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4456[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator4:
+  lea rax, QWORD PTR -4460[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 301
+  jl .Lbegin4
+.Lend4:
+  lea rdi, QWORD PTR -4460[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4460[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jge .Lend5
+  .p2align 4
+.Lbegin5:
+  lea rax, QWORD PTR -4456[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR -4452[rbp+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4456[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator5:
+  lea rax, QWORD PTR -4460[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4460[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jl .Lbegin5
+.Lend5:
+  lea rax, QWORD PTR -4456[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov eax, DWORD PTR -4096[rbp]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  mov al, BYTE PTR -4397[rbp]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  mov eax, DWORD PTR -4452[rbp]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_sum_zero_cleared_arrays
+.Lreturn_sum_zero_cleared_arrays:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_zero_clear_local_array
+test_zero_clear_local_array:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -48[rbp], rbx
+  lea rdi, QWORD PTR -36[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  mov DWORD PTR 32[rdi], 0
+  mov rdi, 101
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 103
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString143[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 213
+  lea rax, QWORD PTR .LiteralString142[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString145[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 214
+  lea rax, QWORD PTR .LiteralString144[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString147[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 215
+  lea rax, QWORD PTR .LiteralString146[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString149[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 101
+  mov rsi, 216
+  lea rax, QWORD PTR .LiteralString148[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString151[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 103
+  mov rsi, 217
+  lea rax, QWORD PTR .LiteralString150[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 218
+  lea rax, QWORD PTR .LiteralString152[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString155[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 219
+  lea rax, QWORD PTR .LiteralString154[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString157[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 220
+  lea rax, QWORD PTR .LiteralString156[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString159[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 221
+  lea rax, QWORD PTR .LiteralString158[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -5[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov BYTE PTR 4[rdi], 0
+  mov rdi, 120
+  mov BYTE PTR -5[rbp], dil
+  mov rax, rdi
+  mov rdi, 121
+  mov BYTE PTR -4[rbp], dil
+  mov rax, rdi
+  mov rdi, 122
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString162[rip]
+  mov r8, rax
+  mov al, BYTE PTR -5[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 120
+  mov rsi, 225
+  lea rax, QWORD PTR .LiteralString161[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString164[rip]
+  mov r8, rax
+  mov al, BYTE PTR -4[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 121
+  mov rsi, 226
+  lea rax, QWORD PTR .LiteralString163[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString166[rip]
+  mov r8, rax
+  mov al, BYTE PTR -3[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 122
+  mov rsi, 227
+  lea rax, QWORD PTR .LiteralString165[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString168[rip]
+  mov r8, rax
+  mov al, BYTE PTR -2[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 228
+  lea rax, QWORD PTR .LiteralString167[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString170[rip]
+  mov r8, rax
+  mov al, BYTE PTR -1[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 229
+  lea rax, QWORD PTR .LiteralString169[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call fill_stack_garbage
+  lea rax, QWORD PTR .LiteralString172[rip]
+  mov rbx, rax
+  mov al, 0
+  call sum_zero_cleared_arrays
+  mov rcx, rax
+  mov r8, 11
+  mov rsi, 232
+  lea rax, QWORD PTR .LiteralString171[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_test_zero_clear_local_array:
+  mov rbx, QWORD PTR -48[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_zero_clear_local_struct
+test_zero_clear_local_struct:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 512
+  lea rdi, QWORD PTR -124[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  mov QWORD PTR 112[rdi], 0
+  mov DWORD PTR 120[rdi], 0
+  lea rax, QWORD PTR .LiteralString174[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -124[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 248
+  lea rax, QWORD PTR .LiteralString173[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString176[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 249
+  lea rax, QWORD PTR .LiteralString175[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString178[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 250
+  lea rax, QWORD PTR .LiteralString177[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString180[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 251
+  lea rax, QWORD PTR .LiteralString179[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -128[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -128[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -128[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend6
+  .p2align 4
+.Lbegin6:
+  lea rdi, QWORD PTR -132[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -132[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -132[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend7
+  .p2align 4
+.Lbegin7:
+  lea rdi, QWORD PTR -136[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -136[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -136[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend8
+  .p2align 4
+.Lbegin8:
+  lea rax, QWORD PTR .LiteralString182[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 36
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -132[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 255
+  lea rax, QWORD PTR .LiteralString181[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator8:
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -136[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin8
+.Lend8:
+.Literator7:
+  lea rax, QWORD PTR -132[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -132[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin7
+.Lend7:
+.Literator6:
+  lea rax, QWORD PTR -128[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -128[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin6
+.Lend6:
+  lea rdi, QWORD PTR -124[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  mov QWORD PTR 112[rdi], 0
+  mov DWORD PTR 120[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -124[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -120[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -120[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -120[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString184[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -124[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 259
+  lea rax, QWORD PTR .LiteralString183[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString186[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 260
+  lea rax, QWORD PTR .LiteralString185[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString188[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 261
+  lea rax, QWORD PTR .LiteralString187[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString190[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 262
+  lea rax, QWORD PTR .LiteralString189[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -128[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -128[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -128[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend9
+  .p2align 4
+.Lbegin9:
+  lea rdi, QWORD PTR -132[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -132[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -132[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend10
+  .p2align 4
+.Lbegin10:
+  lea rdi, QWORD PTR -136[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -136[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -136[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend11
+  .p2align 4
+.Lbegin11:
+  lea rax, QWORD PTR .LiteralString192[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 36
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -132[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 266
+  lea rax, QWORD PTR .LiteralString191[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator11:
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -136[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin11
+.Lend11:
+.Literator10:
+  lea rax, QWORD PTR -132[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -132[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin10
+.Lend10:
+.Literator9:
+  lea rax, QWORD PTR -128[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -128[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin9
+.Lend9:
+  lea rdi, QWORD PTR -500[rbp]
+  mov rcx, 62
+  mov rax, 0
+  rep stosq
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -500[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -248[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString194[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -500[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 270
+  lea rax, QWORD PTR .LiteralString193[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString196[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -496[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 272
+  lea rax, QWORD PTR .LiteralString195[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString198[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -492[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 273
+  lea rax, QWORD PTR .LiteralString197[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString200[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -492[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 274
+  lea rax, QWORD PTR .LiteralString199[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString202[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -492[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 275
+  lea rax, QWORD PTR .LiteralString201[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend12
+  .p2align 4
+.Lbegin12:
+  lea rdi, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend13
+  .p2align 4
+.Lbegin13:
+  lea rdi, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend14
+  .p2align 4
+.Lbegin14:
+  lea rax, QWORD PTR .LiteralString204[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -480[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 36
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 279
+  lea rax, QWORD PTR .LiteralString203[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator14:
+  lea rax, QWORD PTR -512[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin14
+.Lend14:
+.Literator13:
+  lea rax, QWORD PTR -508[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin13
+.Lend13:
+.Literator12:
+  lea rax, QWORD PTR -504[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin12
+.Lend12:
+  lea rax, QWORD PTR .LiteralString206[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -372[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 281
+  lea rax, QWORD PTR .LiteralString205[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString208[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -368[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 282
+  lea rax, QWORD PTR .LiteralString207[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString210[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -368[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 283
+  lea rax, QWORD PTR .LiteralString209[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString212[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -368[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 284
+  lea rax, QWORD PTR .LiteralString211[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend15
+  .p2align 4
+.Lbegin15:
+  lea rdi, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend16
+  .p2align 4
+.Lbegin16:
+  lea rdi, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend17
+  .p2align 4
+.Lbegin17:
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -356[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 36
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 288
+  lea rax, QWORD PTR .LiteralString213[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator17:
+  lea rax, QWORD PTR -512[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin17
+.Lend17:
+.Literator16:
+  lea rax, QWORD PTR -508[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin16
+.Lend16:
+.Literator15:
+  lea rax, QWORD PTR -504[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin15
+.Lend15:
+  lea rax, QWORD PTR .LiteralString216[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 290
+  lea rax, QWORD PTR .LiteralString215[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString218[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 291
+  lea rax, QWORD PTR .LiteralString217[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString220[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 292
+  lea rax, QWORD PTR .LiteralString219[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString222[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 293
+  lea rax, QWORD PTR .LiteralString221[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend18
+  .p2align 4
+.Lbegin18:
+  lea rdi, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend19
+  .p2align 4
+.Lbegin19:
+  lea rdi, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend20
+  .p2align 4
+.Lbegin20:
+  lea rax, QWORD PTR .LiteralString224[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 36
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 297
+  lea rax, QWORD PTR .LiteralString223[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator20:
+  lea rax, QWORD PTR -512[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin20
+.Lend20:
+.Literator19:
+  lea rax, QWORD PTR -508[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin19
+.Lend19:
+.Literator18:
+  lea rax, QWORD PTR -504[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin18
+.Lend18:
+  lea rax, QWORD PTR .LiteralString226[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -124[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 299
+  lea rax, QWORD PTR .LiteralString225[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString228[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 300
+  lea rax, QWORD PTR .LiteralString227[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString230[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 301
+  lea rax, QWORD PTR .LiteralString229[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString232[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 302
+  lea rax, QWORD PTR .LiteralString231[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -504[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend21
+  .p2align 4
+.Lbegin21:
+  lea rdi, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -508[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend22
+  .p2align 4
+.Lbegin22:
+  lea rdi, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -512[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend23
+  .p2align 4
+.Lbegin23:
+  lea rax, QWORD PTR .LiteralString234[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 36
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 306
+  lea rax, QWORD PTR .LiteralString233[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator23:
+  lea rax, QWORD PTR -512[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -512[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin23
+.Lend23:
+.Literator22:
+  lea rax, QWORD PTR -508[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -508[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin22
+.Lend22:
+.Literator21:
+  lea rax, QWORD PTR -504[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -504[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin21
+.Lend21:
+.Lreturn_test_zero_clear_local_struct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_global_primitives
+test_init_global_primitives:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString236[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnum[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 101
+  mov rsi, 311
+  lea rax, QWORD PTR .LiteralString235[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString238[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gchar[rip]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 117
+  mov rsi, 312
+  lea rax, QWORD PTR .LiteralString237[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_global_primitives:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_global_pointers
+test_init_global_pointers:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString241[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString240[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gstr4[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 316
+  lea rax, QWORD PTR .LiteralString239[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString243[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnum[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gptr1[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 317
+  lea rax, QWORD PTR .LiteralString242[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_global_pointers:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_global_arrays
+test_init_global_arrays:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  lea rax, QWORD PTR .LiteralString245[rip]
+  mov r8, rax
+  mov rcx, 20
+  mov r9, 20
+  mov rsi, 321
+  lea rax, QWORD PTR .LiteralString244[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString247[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar1[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 322
+  lea rax, QWORD PTR .LiteralString246[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString249[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar1[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 323
+  lea rax, QWORD PTR .LiteralString248[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString251[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar1[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 324
+  lea rax, QWORD PTR .LiteralString250[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString253[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar1[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 325
+  lea rax, QWORD PTR .LiteralString252[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString255[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar1[rip]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 326
+  lea rax, QWORD PTR .LiteralString254[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString257[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 328
+  lea rax, QWORD PTR .LiteralString256[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString259[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar2[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 329
+  lea rax, QWORD PTR .LiteralString258[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString261[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar2[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 330
+  lea rax, QWORD PTR .LiteralString260[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString263[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumar2[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 331
+  lea rax, QWORD PTR .LiteralString262[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString265[rip]
+  mov r8, rax
+  mov rcx, 36
+  mov r9, 36
+  mov rsi, 333
+  lea rax, QWORD PTR .LiteralString264[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString267[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar1[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 334
+  lea rax, QWORD PTR .LiteralString266[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString269[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar1[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 47
+  mov rsi, 335
+  lea rax, QWORD PTR .LiteralString268[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString271[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar1[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 53
+  mov rsi, 336
+  lea rax, QWORD PTR .LiteralString270[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend24
+  .p2align 4
+.Lbegin24:
+  lea rax, QWORD PTR .LiteralString273[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar1[rip]
+  add rax, 12
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 338
+  lea rax, QWORD PTR .LiteralString272[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString275[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar1[rip]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 339
+  lea rax, QWORD PTR .LiteralString274[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator24:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin24
+.Lend24:
+  lea rax, QWORD PTR .LiteralString277[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 342
+  lea rax, QWORD PTR .LiteralString276[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString279[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar2[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 59
+  mov rsi, 343
+  lea rax, QWORD PTR .LiteralString278[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString281[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar2[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 61
+  mov rsi, 344
+  lea rax, QWORD PTR .LiteralString280[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString283[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gnumarar2[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 67
+  mov rsi, 345
+  lea rax, QWORD PTR .LiteralString282[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString285[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 347
+  lea rax, QWORD PTR .LiteralString284[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString288[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString287[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gstr1[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 348
+  lea rax, QWORD PTR .LiteralString286[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString290[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gstr1[rip]
+  mov al, BYTE PTR 8[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 349
+  lea rax, QWORD PTR .LiteralString289[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString292[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 351
+  lea rax, QWORD PTR .LiteralString291[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString295[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString294[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gstr2[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 352
+  lea rax, QWORD PTR .LiteralString293[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString297[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 354
+  lea rax, QWORD PTR .LiteralString296[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString299[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gstr3[rip]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 355
+  lea rax, QWORD PTR .LiteralString298[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString301[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gstr3[rip]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 101
+  mov rsi, 356
+  lea rax, QWORD PTR .LiteralString300[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString303[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 358
+  lea rax, QWORD PTR .LiteralString302[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString306[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString305[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gstrar[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 359
+  lea rax, QWORD PTR .LiteralString304[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString309[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString308[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gstrar[rip]
+  add rax, 5
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 360
+  lea rax, QWORD PTR .LiteralString307[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_test_init_global_arrays:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_global_structs
+test_init_global_structs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString311[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 69
+  mov rsi, 364
+  lea rax, QWORD PTR .LiteralString310[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString313[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0[rip]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 71
+  mov rsi, 365
+  lea rax, QWORD PTR .LiteralString312[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString315[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 367
+  lea rax, QWORD PTR .LiteralString314[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString317[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0ar[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 73
+  mov rsi, 368
+  lea rax, QWORD PTR .LiteralString316[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString319[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0ar[rip]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 79
+  mov rsi, 369
+  lea rax, QWORD PTR .LiteralString318[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString321[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0ar[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 370
+  lea rax, QWORD PTR .LiteralString320[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString323[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0ar[rip]
+  add rax, 8
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 371
+  lea rax, QWORD PTR .LiteralString322[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString325[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 83
+  mov rsi, 373
+  lea rax, QWORD PTR .LiteralString324[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString327[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 87
+  mov rsi, 374
+  lea rax, QWORD PTR .LiteralString326[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString329[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 375
+  lea rax, QWORD PTR .LiteralString328[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString331[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  add rax, 20
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 119
+  mov rsi, 376
+  lea rax, QWORD PTR .LiteralString330[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString334[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString333[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gs1[rip]
+  add rax, 21
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 377
+  lea rax, QWORD PTR .LiteralString332[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString336[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  add rax, 21
+  mov al, BYTE PTR 9[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 378
+  lea rax, QWORD PTR .LiteralString335[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString338[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 89
+  mov rsi, 379
+  lea rax, QWORD PTR .LiteralString337[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString340[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1[rip]
+  add rax, 32
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 380
+  lea rax, QWORD PTR .LiteralString339[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString342[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 103
+  mov rsi, 382
+  lea rax, QWORD PTR .LiteralString341[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString344[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 107
+  mov rsi, 383
+  lea rax, QWORD PTR .LiteralString343[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString346[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 384
+  lea rax, QWORD PTR .LiteralString345[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString348[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  add rax, 20
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 103
+  mov rsi, 385
+  lea rax, QWORD PTR .LiteralString347[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString351[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString350[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  add rax, 21
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 386
+  lea rax, QWORD PTR .LiteralString349[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString353[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  add rax, 21
+  mov al, BYTE PTR 8[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 387
+  lea rax, QWORD PTR .LiteralString352[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString355[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 388
+  lea rax, QWORD PTR .LiteralString354[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString357[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1rest[rip]
+  add rax, 32
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 389
+  lea rax, QWORD PTR .LiteralString356[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString359[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 109
+  mov rsi, 391
+  lea rax, QWORD PTR .LiteralString358[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString361[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd[rip]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 113
+  mov rsi, 392
+  lea rax, QWORD PTR .LiteralString360[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString363[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1_cmpd[rip]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 119
+  mov rsi, 394
+  lea rax, QWORD PTR .LiteralString362[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString365[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs1_cmpd[rip]
+  add rax, 32
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 123
+  mov rsi, 395
+  lea rax, QWORD PTR .LiteralString364[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString367[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd_ptr1[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 397
+  lea rax, QWORD PTR .LiteralString366[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString369[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd_ptr1[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 398
+  lea rax, QWORD PTR .LiteralString368[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString371[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd_ptr2[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR gs0[rip]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 400
+  lea rax, QWORD PTR .LiteralString370[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString373[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd_ptr2[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 69
+  mov rsi, 401
+  lea rax, QWORD PTR .LiteralString372[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString375[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gs0_cmpd_ptr2[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 71
+  mov rsi, 402
+  lea rax, QWORD PTR .LiteralString374[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_global_structs:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_static_primitives
+test_init_static_primitives:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString377[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 408
+  lea rax, QWORD PTR .LiteralString376[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString379[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar5[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 409
+  lea rax, QWORD PTR .LiteralString378[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_static_primitives:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_static_pointers
+test_init_static_pointers:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString382[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar7[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar6[rip]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 417
+  lea rax, QWORD PTR .LiteralString381[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString385[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString384[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar8[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 418
+  lea rax, QWORD PTR .LiteralString383[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_test_init_static_pointers:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_static_arrays
+test_init_static_arrays:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString395[rip]
+  mov r8, rax
+  mov rcx, 40
+  mov r9, 40
+  mov rsi, 430
+  lea rax, QWORD PTR .LiteralString394[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString397[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 431
+  lea rax, QWORD PTR .LiteralString396[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString399[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 432
+  lea rax, QWORD PTR .LiteralString398[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString401[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 433
+  lea rax, QWORD PTR .LiteralString400[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString403[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 434
+  lea rax, QWORD PTR .LiteralString402[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString405[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 435
+  lea rax, QWORD PTR .LiteralString404[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString407[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 20[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 436
+  lea rax, QWORD PTR .LiteralString406[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString409[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 24[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 437
+  lea rax, QWORD PTR .LiteralString408[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString411[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 28[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 438
+  lea rax, QWORD PTR .LiteralString410[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString413[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 32[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 439
+  lea rax, QWORD PTR .LiteralString412[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString415[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar9[rip]
+  mov eax, DWORD PTR 36[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 440
+  lea rax, QWORD PTR .LiteralString414[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString417[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 442
+  lea rax, QWORD PTR .LiteralString416[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString419[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar10[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 443
+  lea rax, QWORD PTR .LiteralString418[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString421[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar10[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 444
+  lea rax, QWORD PTR .LiteralString420[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString423[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar10[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 445
+  lea rax, QWORD PTR .LiteralString422[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString425[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar10[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 446
+  lea rax, QWORD PTR .LiteralString424[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString427[rip]
+  mov r8, rax
+  mov rcx, 10
+  mov r9, 10
+  mov rsi, 448
+  lea rax, QWORD PTR .LiteralString426[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString430[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString429[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar11[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 449
+  lea rax, QWORD PTR .LiteralString428[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString432[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar11[rip]
+  mov al, BYTE PTR 5[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 450
+  lea rax, QWORD PTR .LiteralString431[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString434[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 452
+  lea rax, QWORD PTR .LiteralString433[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString437[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString436[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar12[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 453
+  lea rax, QWORD PTR .LiteralString435[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString439[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 455
+  lea rax, QWORD PTR .LiteralString438[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString441[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar13[rip]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 105
+  mov rsi, 456
+  lea rax, QWORD PTR .LiteralString440[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString443[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar13[rip]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 111
+  mov rsi, 457
+  lea rax, QWORD PTR .LiteralString442[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString445[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar13[rip]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 115
+  mov rsi, 458
+  lea rax, QWORD PTR .LiteralString444[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString447[rip]
+  mov r8, rax
+  mov rcx, 40
+  mov r9, 40
+  mov rsi, 460
+  lea rax, QWORD PTR .LiteralString446[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString450[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString449[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar14[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 461
+  lea rax, QWORD PTR .LiteralString448[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString453[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString452[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar14[rip]
+  add rax, 10
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 462
+  lea rax, QWORD PTR .LiteralString451[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString456[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString455[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar14[rip]
+  add rax, 20
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 463
+  lea rax, QWORD PTR .LiteralString454[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString459[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString458[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar14[rip]
+  add rax, 30
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 464
+  lea rax, QWORD PTR .LiteralString457[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString461[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar14[rip]
+  mov al, BYTE PTR 5[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 465
+  lea rax, QWORD PTR .LiteralString460[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString463[rip]
+  mov r8, rax
+  mov rcx, 30
+  mov r9, 30
+  mov rsi, 467
+  lea rax, QWORD PTR .LiteralString462[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString466[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString465[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar15[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 468
+  lea rax, QWORD PTR .LiteralString464[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString469[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString468[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar15[rip]
+  add rax, 10
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 469
+  lea rax, QWORD PTR .LiteralString467[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString472[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString471[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar15[rip]
+  add rax, 20
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 470
+  lea rax, QWORD PTR .LiteralString470[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString474[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar15[rip]
+  mov al, BYTE PTR 5[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 471
+  lea rax, QWORD PTR .LiteralString473[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_static_arrays:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_static_structs
+test_init_static_structs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString478[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar16[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 495
+  lea rax, QWORD PTR .LiteralString477[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString480[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar16[rip]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 496
+  lea rax, QWORD PTR .LiteralString479[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString482[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 498
+  lea rax, QWORD PTR .LiteralString481[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString484[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar17[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 499
+  lea rax, QWORD PTR .LiteralString483[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString486[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar17[rip]
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 500
+  lea rax, QWORD PTR .LiteralString485[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString488[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar17[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 501
+  lea rax, QWORD PTR .LiteralString487[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString490[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar17[rip]
+  add rax, 8
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 502
+  lea rax, QWORD PTR .LiteralString489[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString492[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 504
+  lea rax, QWORD PTR .LiteralString491[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString494[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 505
+  lea rax, QWORD PTR .LiteralString493[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString496[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 506
+  lea rax, QWORD PTR .LiteralString495[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString498[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  add rax, 20
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 120
+  mov rsi, 507
+  lea rax, QWORD PTR .LiteralString497[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString501[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString500[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  add rax, 21
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 508
+  lea rax, QWORD PTR .LiteralString499[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString503[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  add rax, 21
+  mov al, BYTE PTR 8[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 509
+  lea rax, QWORD PTR .LiteralString502[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString505[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 510
+  lea rax, QWORD PTR .LiteralString504[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString507[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar18[rip]
+  add rax, 32
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 511
+  lea rax, QWORD PTR .LiteralString506[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString509[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 513
+  lea rax, QWORD PTR .LiteralString508[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString511[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 514
+  lea rax, QWORD PTR .LiteralString510[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString513[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 515
+  lea rax, QWORD PTR .LiteralString512[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString515[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  add rax, 20
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 104
+  mov rsi, 516
+  lea rax, QWORD PTR .LiteralString514[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString518[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString517[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  add rax, 21
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 517
+  lea rax, QWORD PTR .LiteralString516[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString520[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  add rax, 21
+  mov al, BYTE PTR 8[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 518
+  lea rax, QWORD PTR .LiteralString519[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString522[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 519
+  lea rax, QWORD PTR .LiteralString521[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString524[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar19[rip]
+  add rax, 32
+  add rax, 4
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 520
+  lea rax, QWORD PTR .LiteralString523[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_static_structs:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_with_NULL
+test_init_with_NULL:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString526[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 538
+  lea rax, QWORD PTR .LiteralString525[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString528[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar20[rip]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 539
+  lea rax, QWORD PTR .LiteralString527[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString530[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar22[rip]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 540
+  lea rax, QWORD PTR .LiteralString529[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .StaticVar21[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar20[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar21[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar22[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString532[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar21[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 543
+  lea rax, QWORD PTR .LiteralString531[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_with_NULL:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_init_static_primitive_with_negative_value
+test_init_static_primitive_with_negative_value:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString534[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .StaticVar23[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, -1
+  mov rsi, 548
+  lea rax, QWORD PTR .LiteralString533[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_init_static_primitive_with_negative_value:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call test_init_local_variables
+  mov al, 0
+  call test_init_local_arrays
+  mov al, 0
+  call test_zero_clear_local_array
+  mov al, 0
+  call test_zero_clear_local_struct
+  mov al, 0
+  call test_init_global_primitives
+  mov al, 0
+  call test_init_global_pointers
+  mov al, 0
+  call test_init_global_arrays
+  mov al, 0
+  call test_init_global_structs
+  mov al, 0
+  call test_init_static_primitives
+  mov al, 0
+  call test_init_static_pointers
+  mov al, 0
+  call test_init_static_arrays
+  mov al, 0
+  call test_init_static_structs
+  mov al, 0
+  call test_init_with_NULL
+  mov al, 0
+  call test_init_static_primitive_with_negative_value
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "abc"
+.LiteralString1:
+  .string  "xyz"
+.LiteralString2:
+  .string  "asdf"
+.LiteralString3:
+  .string  "jjj"
+.LiteralString4:
+  .string  "kkk"
+.LiteralString5:
+  .string  "goodbye"
+.LiteralString6:
+  .string  "space"
+.LiteralString7:
+  .string  "test/init_variables.c"
+.LiteralString8:
+  .string  "a"
+.LiteralString9:
+  .string  "test/init_variables.c"
+.LiteralString10:
+  .string  "a"
+.LiteralString11:
+  .string  "test/init_variables.c"
+.LiteralString12:
+  .string  "b"
+.LiteralString13:
+  .string  "test/init_variables.c"
+.LiteralString14:
+  .string  "c"
+.LiteralString15:
+  .string  "test/init_variables.c"
+.LiteralString16:
+  .string  "x[0]"
+.LiteralString17:
+  .string  "test/init_variables.c"
+.LiteralString18:
+  .string  "x[1]"
+.LiteralString19:
+  .string  "test/init_variables.c"
+.LiteralString20:
+  .string  "x[2]"
+.LiteralString21:
+  .string  "test/init_variables.c"
+.LiteralString22:
+  .string  "x[0]"
+.LiteralString23:
+  .string  "test/init_variables.c"
+.LiteralString24:
+  .string  "x[1]"
+.LiteralString25:
+  .string  "test/init_variables.c"
+.LiteralString26:
+  .string  "x[2]"
+.LiteralString27:
+  .string  "test/init_variables.c"
+.LiteralString28:
+  .string  "x[0]"
+.LiteralString29:
+  .string  "test/init_variables.c"
+.LiteralString30:
+  .string  "x[1]"
+.LiteralString31:
+  .string  "test/init_variables.c"
+.LiteralString32:
+  .string  "x[2]"
+.LiteralString33:
+  .string  "test/init_variables.c"
+.LiteralString34:
+  .string  "x[i][j]"
+.LiteralString35:
+  .string  "baz"
+.LiteralString36:
+  .string  "test/init_variables.c"
+.LiteralString37:
+  .string  "x[0]"
+.LiteralString38:
+  .string  "test/init_variables.c"
+.LiteralString39:
+  .string  "x[1]"
+.LiteralString40:
+  .string  "test/init_variables.c"
+.LiteralString41:
+  .string  "x[2]"
+.LiteralString42:
+  .string  "test/init_variables.c"
+.LiteralString43:
+  .string  "x[3]"
+.LiteralString44:
+  .string  "d\nf"
+.LiteralString45:
+  .string  "test/init_variables.c"
+.LiteralString46:
+  .string  "x[0][0]"
+.LiteralString47:
+  .string  "test/init_variables.c"
+.LiteralString48:
+  .string  "x[0][1]"
+.LiteralString49:
+  .string  "test/init_variables.c"
+.LiteralString50:
+  .string  "x[0][2]"
+.LiteralString51:
+  .string  "test/init_variables.c"
+.LiteralString52:
+  .string  "x[0][3]"
+.LiteralString53:
+  .string  "test/init_variables.c"
+.LiteralString54:
+  .string  "x[1][0]"
+.LiteralString55:
+  .string  "test/init_variables.c"
+.LiteralString56:
+  .string  "x[1][1]"
+.LiteralString57:
+  .string  "test/init_variables.c"
+.LiteralString58:
+  .string  "x[1][2]"
+.LiteralString59:
+  .string  "test/init_variables.c"
+.LiteralString60:
+  .string  "x[1][3]"
+.LiteralString61:
+  .string  "test/init_variables.c"
+.LiteralString62:
+  .string  "sizeof(x)/sizeof(x[0])"
+.LiteralString63:
+  .string  "test/init_variables.c"
+.LiteralString64:
+  .string  "x[0]"
+.LiteralString65:
+  .string  "test/init_variables.c"
+.LiteralString66:
+  .string  "x[1]"
+.LiteralString67:
+  .string  "test/init_variables.c"
+.LiteralString68:
+  .string  "x[2]"
+.LiteralString69:
+  .string  "test/init_variables.c"
+.LiteralString70:
+  .string  "sizeof(x)/sizeof(x[0])"
+.LiteralString71:
+  .string  "test/init_variables.c"
+.LiteralString72:
+  .string  "x[0][0]"
+.LiteralString73:
+  .string  "test/init_variables.c"
+.LiteralString74:
+  .string  "x[0][1]"
+.LiteralString75:
+  .string  "test/init_variables.c"
+.LiteralString76:
+  .string  "x[0][2]"
+.LiteralString77:
+  .string  "test/init_variables.c"
+.LiteralString78:
+  .string  "x[1][0]"
+.LiteralString79:
+  .string  "test/init_variables.c"
+.LiteralString80:
+  .string  "x[1][1]"
+.LiteralString81:
+  .string  "test/init_variables.c"
+.LiteralString82:
+  .string  "x[1][2]"
+.LiteralString83:
+  .string  "abcd\n"
+.LiteralString84:
+  .string  "test/init_variables.c"
+.LiteralString85:
+  .string  "sizeof(x)/sizeof(x[0])"
+.LiteralString86:
+  .string  "test/init_variables.c"
+.LiteralString87:
+  .string  "x[0]"
+.LiteralString88:
+  .string  "test/init_variables.c"
+.LiteralString89:
+  .string  "x[1]"
+.LiteralString90:
+  .string  "test/init_variables.c"
+.LiteralString91:
+  .string  "x[2]"
+.LiteralString92:
+  .string  "test/init_variables.c"
+.LiteralString93:
+  .string  "x[3]"
+.LiteralString94:
+  .string  "test/init_variables.c"
+.LiteralString95:
+  .string  "x[4]"
+.LiteralString96:
+  .string  "test/init_variables.c"
+.LiteralString97:
+  .string  "x[5]"
+.LiteralString98:
+  .string  "test/init_variables.c"
+.LiteralString99:
+  .string  "n[0]"
+.LiteralString100:
+  .string  "test/init_variables.c"
+.LiteralString101:
+  .string  "n[1]"
+.LiteralString102:
+  .string  "test/init_variables.c"
+.LiteralString103:
+  .string  "n[2]"
+.LiteralString104:
+  .string  "test/init_variables.c"
+.LiteralString105:
+  .string  "m"
+.LiteralString106:
+  .string  "test/init_variables.c"
+.LiteralString107:
+  .string  "obj.n"
+.LiteralString108:
+  .string  "test/init_variables.c"
+.LiteralString109:
+  .string  "obj.m"
+.LiteralString110:
+  .string  "test/init_variables.c"
+.LiteralString111:
+  .string  "obj.c"
+.LiteralString112:
+  .string  "test/init_variables.c"
+.LiteralString113:
+  .string  "obj.n"
+.LiteralString114:
+  .string  "test/init_variables.c"
+.LiteralString115:
+  .string  "obj.s2.c"
+.LiteralString116:
+  .string  "test/init_variables.c"
+.LiteralString117:
+  .string  "obj.s2.n"
+.LiteralString118:
+  .string  "test/init_variables.c"
+.LiteralString119:
+  .string  "obj.c"
+.LiteralString120:
+  .string  "test/init_variables.c"
+.LiteralString121:
+  .string  "obj.n[0]"
+.LiteralString122:
+  .string  "test/init_variables.c"
+.LiteralString123:
+  .string  "obj.n[1]"
+.LiteralString124:
+  .string  "test/init_variables.c"
+.LiteralString125:
+  .string  "obj.n[2]"
+.LiteralString126:
+  .string  "test/init_variables.c"
+.LiteralString127:
+  .string  "obj.n[3]"
+.LiteralString128:
+  .string  "test/init_variables.c"
+.LiteralString129:
+  .string  "obj[0].n"
+.LiteralString130:
+  .string  "test/init_variables.c"
+.LiteralString131:
+  .string  "obj[0].m"
+.LiteralString132:
+  .string  "test/init_variables.c"
+.LiteralString133:
+  .string  "obj[1].n"
+.LiteralString134:
+  .string  "test/init_variables.c"
+.LiteralString135:
+  .string  "obj[1].m"
+.LiteralString136:
+  .string  "test/init_variables.c"
+.LiteralString137:
+  .string  "obj[2].n"
+.LiteralString138:
+  .string  "test/init_variables.c"
+.LiteralString139:
+  .string  "obj[2].m"
+.LiteralString140:
+  .string  "test/init_variables.c"
+.LiteralString141:
+  .string  "garbage[4999]"
+.LiteralString142:
+  .string  "test/init_variables.c"
+.LiteralString143:
+  .string  "n[0][0]"
+.LiteralString144:
+  .string  "test/init_variables.c"
+.LiteralString145:
+  .string  "n[0][1]"
+.LiteralString146:
+  .string  "test/init_variables.c"
+.LiteralString147:
+  .string  "n[0][2]"
+.LiteralString148:
+  .string  "test/init_variables.c"
+.LiteralString149:
+  .string  "n[1][0]"
+.LiteralString150:
+  .string  "test/init_variables.c"
+.LiteralString151:
+  .string  "n[1][1]"
+.LiteralString152:
+  .string  "test/init_variables.c"
+.LiteralString153:
+  .string  "n[1][2]"
+.LiteralString154:
+  .string  "test/init_variables.c"
+.LiteralString155:
+  .string  "n[2][0]"
+.LiteralString156:
+  .string  "test/init_variables.c"
+.LiteralString157:
+  .string  "n[2][1]"
+.LiteralString158:
+  .string  "test/init_variables.c"
+.LiteralString159:
+  .string  "n[2][2]"
+.LiteralString160:
+  .string  "xyz"
+.LiteralString161:
+  .string  "test/init_variables.c"
+.LiteralString162:
+  .string  "s[0]"
+.LiteralString163:
+  .string  "test/init_variables.c"
+.LiteralString164:
+  .string  "s[1]"
+.LiteralString165:
+  .string  "test/init_variables.c"
+.LiteralString166:
+  .string  "s[2]"
+.LiteralString167:
+  .string  "test/init_variables.c"
+.LiteralString168:
+  .string  "s[3]"
+.LiteralString169:
+  .string  "test/init_variables.c"
+.LiteralString170:
+  .string  "s[4]"
+.LiteralString171:
+  .string  "test/init_variables.c"
+.LiteralString172:
+  .string  "sum_zero_cleared_arrays()"
+.LiteralString173:
+  .string  "test/init_variables.c"
+.LiteralString174:
+  .string  "obj.n"
+.LiteralString175:
+  .string  "test/init_variables.c"
+.LiteralString176:
+  .string  "obj.narray1[0]"
+.LiteralString177:
+  .string  "test/init_variables.c"
+.LiteralString178:
+  .string  "obj.narray1[1]"
+.LiteralString179:
+  .string  "test/init_variables.c"
+.LiteralString180:
+  .string  "obj.narray1[2]"
+.LiteralString181:
+  .string  "test/init_variables.c"
+.LiteralString182:
+  .string  "obj.narray3[i][j][k]"
+.LiteralString183:
+  .string  "test/init_variables.c"
+.LiteralString184:
+  .string  "obj.n"
+.LiteralString185:
+  .string  "test/init_variables.c"
+.LiteralString186:
+  .string  "obj.narray1[0]"
+.LiteralString187:
+  .string  "test/init_variables.c"
+.LiteralString188:
+  .string  "obj.narray1[1]"
+.LiteralString189:
+  .string  "test/init_variables.c"
+.LiteralString190:
+  .string  "obj.narray1[2]"
+.LiteralString191:
+  .string  "test/init_variables.c"
+.LiteralString192:
+  .string  "obj.narray3[i][j][k]"
+.LiteralString193:
+  .string  "test/init_variables.c"
+.LiteralString194:
+  .string  "obj.n"
+.LiteralString195:
+  .string  "test/init_variables.c"
+.LiteralString196:
+  .string  "obj.s0.n"
+.LiteralString197:
+  .string  "test/init_variables.c"
+.LiteralString198:
+  .string  "obj.s0.narray1[0]"
+.LiteralString199:
+  .string  "test/init_variables.c"
+.LiteralString200:
+  .string  "obj.s0.narray1[1]"
+.LiteralString201:
+  .string  "test/init_variables.c"
+.LiteralString202:
+  .string  "obj.s0.narray1[2]"
+.LiteralString203:
+  .string  "test/init_variables.c"
+.LiteralString204:
+  .string  "obj.s0.narray3[i][j][k]"
+.LiteralString205:
+  .string  "test/init_variables.c"
+.LiteralString206:
+  .string  "obj.s0array[0].n"
+.LiteralString207:
+  .string  "test/init_variables.c"
+.LiteralString208:
+  .string  "obj.s0array[0].narray1[0]"
+.LiteralString209:
+  .string  "test/init_variables.c"
+.LiteralString210:
+  .string  "obj.s0array[0].narray1[1]"
+.LiteralString211:
+  .string  "test/init_variables.c"
+.LiteralString212:
+  .string  "obj.s0array[0].narray1[2]"
+.LiteralString213:
+  .string  "test/init_variables.c"
+.LiteralString214:
+  .string  "obj.s0array[0].narray3[i][j][k]"
+.LiteralString215:
+  .string  "test/init_variables.c"
+.LiteralString216:
+  .string  "obj.s0array[1].n"
+.LiteralString217:
+  .string  "test/init_variables.c"
+.LiteralString218:
+  .string  "obj.s0array[1].narray1[0]"
+.LiteralString219:
+  .string  "test/init_variables.c"
+.LiteralString220:
+  .string  "obj.s0array[1].narray1[1]"
+.LiteralString221:
+  .string  "test/init_variables.c"
+.LiteralString222:
+  .string  "obj.s0array[1].narray1[2]"
+.LiteralString223:
+  .string  "test/init_variables.c"
+.LiteralString224:
+  .string  "obj.s0array[1].narray3[i][j][k]"
+.LiteralString225:
+  .string  "test/init_variables.c"
+.LiteralString226:
+  .string  "obj.s0array[2].n"
+.LiteralString227:
+  .string  "test/init_variables.c"
+.LiteralString228:
+  .string  "obj.s0array[2].narray1[0]"
+.LiteralString229:
+  .string  "test/init_variables.c"
+.LiteralString230:
+  .string  "obj.s0array[2].narray1[1]"
+.LiteralString231:
+  .string  "test/init_variables.c"
+.LiteralString232:
+  .string  "obj.s0array[2].narray1[2]"
+.LiteralString233:
+  .string  "test/init_variables.c"
+.LiteralString234:
+  .string  "obj.s0array[2].narray3[i][j][k]"
+.LiteralString235:
+  .string  "test/init_variables.c"
+.LiteralString236:
+  .string  "gnum"
+.LiteralString237:
+  .string  "test/init_variables.c"
+.LiteralString238:
+  .string  "gchar"
+.LiteralString239:
+  .string  "test/init_variables.c"
+.LiteralString240:
+  .string  "asdf"
+.LiteralString241:
+  .string  "strcmp(gstr4, \"asdf\")"
+.LiteralString242:
+  .string  "test/init_variables.c"
+.LiteralString243:
+  .string  "&gnum == gptr1"
+.LiteralString244:
+  .string  "test/init_variables.c"
+.LiteralString245:
+  .string  "sizeof(gnumar1)"
+.LiteralString246:
+  .string  "test/init_variables.c"
+.LiteralString247:
+  .string  "gnumar1[0]"
+.LiteralString248:
+  .string  "test/init_variables.c"
+.LiteralString249:
+  .string  "gnumar1[1]"
+.LiteralString250:
+  .string  "test/init_variables.c"
+.LiteralString251:
+  .string  "gnumar1[2]"
+.LiteralString252:
+  .string  "test/init_variables.c"
+.LiteralString253:
+  .string  "gnumar1[3]"
+.LiteralString254:
+  .string  "test/init_variables.c"
+.LiteralString255:
+  .string  "gnumar1[4]"
+.LiteralString256:
+  .string  "test/init_variables.c"
+.LiteralString257:
+  .string  "sizeof(gnumar2)"
+.LiteralString258:
+  .string  "test/init_variables.c"
+.LiteralString259:
+  .string  "gnumar2[0]"
+.LiteralString260:
+  .string  "test/init_variables.c"
+.LiteralString261:
+  .string  "gnumar2[1]"
+.LiteralString262:
+  .string  "test/init_variables.c"
+.LiteralString263:
+  .string  "gnumar2[2]"
+.LiteralString264:
+  .string  "test/init_variables.c"
+.LiteralString265:
+  .string  "sizeof(gnumarar1)"
+.LiteralString266:
+  .string  "test/init_variables.c"
+.LiteralString267:
+  .string  "gnumarar1[0][0]"
+.LiteralString268:
+  .string  "test/init_variables.c"
+.LiteralString269:
+  .string  "gnumarar1[0][1]"
+.LiteralString270:
+  .string  "test/init_variables.c"
+.LiteralString271:
+  .string  "gnumarar1[0][2]"
+.LiteralString272:
+  .string  "test/init_variables.c"
+.LiteralString273:
+  .string  "gnumarar1[1][i]"
+.LiteralString274:
+  .string  "test/init_variables.c"
+.LiteralString275:
+  .string  "gnumarar1[2][i]"
+.LiteralString276:
+  .string  "test/init_variables.c"
+.LiteralString277:
+  .string  "sizeof(gnumarar2)"
+.LiteralString278:
+  .string  "test/init_variables.c"
+.LiteralString279:
+  .string  "gnumarar2[0][0]"
+.LiteralString280:
+  .string  "test/init_variables.c"
+.LiteralString281:
+  .string  "gnumarar2[0][1]"
+.LiteralString282:
+  .string  "test/init_variables.c"
+.LiteralString283:
+  .string  "gnumarar2[0][2]"
+.LiteralString284:
+  .string  "test/init_variables.c"
+.LiteralString285:
+  .string  "sizeof(gstr1)"
+.LiteralString286:
+  .string  "test/init_variables.c"
+.LiteralString287:
+  .string  "abc"
+.LiteralString288:
+  .string  "strcmp(gstr1, \"abc\")"
+.LiteralString289:
+  .string  "test/init_variables.c"
+.LiteralString290:
+  .string  "gstr1[8]"
+.LiteralString291:
+  .string  "test/init_variables.c"
+.LiteralString292:
+  .string  "sizeof(gstr2)"
+.LiteralString293:
+  .string  "test/init_variables.c"
+.LiteralString294:
+  .string  "xyz"
+.LiteralString295:
+  .string  "strcmp(gstr2, \"xyz\")"
+.LiteralString296:
+  .string  "test/init_variables.c"
+.LiteralString297:
+  .string  "sizeof(gstr3)"
+.LiteralString298:
+  .string  "test/init_variables.c"
+.LiteralString299:
+  .string  "gstr3[0]"
+.LiteralString300:
+  .string  "test/init_variables.c"
+.LiteralString301:
+  .string  "gstr3[1]"
+.LiteralString302:
+  .string  "test/init_variables.c"
+.LiteralString303:
+  .string  "sizeof(gstrar)"
+.LiteralString304:
+  .string  "test/init_variables.c"
+.LiteralString305:
+  .string  "jjj"
+.LiteralString306:
+  .string  "strcmp(gstrar[0], \"jjj\")"
+.LiteralString307:
+  .string  "test/init_variables.c"
+.LiteralString308:
+  .string  "kkk"
+.LiteralString309:
+  .string  "strcmp(gstrar[1], \"kkk\")"
+.LiteralString310:
+  .string  "test/init_variables.c"
+.LiteralString311:
+  .string  "gs0.n"
+.LiteralString312:
+  .string  "test/init_variables.c"
+.LiteralString313:
+  .string  "gs0.c"
+.LiteralString314:
+  .string  "test/init_variables.c"
+.LiteralString315:
+  .string  "sizeof(gs0ar)"
+.LiteralString316:
+  .string  "test/init_variables.c"
+.LiteralString317:
+  .string  "gs0ar[0].n"
+.LiteralString318:
+  .string  "test/init_variables.c"
+.LiteralString319:
+  .string  "gs0ar[0].c"
+.LiteralString320:
+  .string  "test/init_variables.c"
+.LiteralString321:
+  .string  "gs0ar[1].n"
+.LiteralString322:
+  .string  "test/init_variables.c"
+.LiteralString323:
+  .string  "gs0ar[1].c"
+.LiteralString324:
+  .string  "test/init_variables.c"
+.LiteralString325:
+  .string  "gs1.ar[0]"
+.LiteralString326:
+  .string  "test/init_variables.c"
+.LiteralString327:
+  .string  "gs1.ar[1]"
+.LiteralString328:
+  .string  "test/init_variables.c"
+.LiteralString329:
+  .string  "gs1.ar[3]"
+.LiteralString330:
+  .string  "test/init_variables.c"
+.LiteralString331:
+  .string  "gs1.c"
+.LiteralString332:
+  .string  "test/init_variables.c"
+.LiteralString333:
+  .string  "goodbye"
+.LiteralString334:
+  .string  "strcmp(gs1.str, \"goodbye\")"
+.LiteralString335:
+  .string  "test/init_variables.c"
+.LiteralString336:
+  .string  "gs1.str[9]"
+.LiteralString337:
+  .string  "test/init_variables.c"
+.LiteralString338:
+  .string  "gs1.s0.n"
+.LiteralString339:
+  .string  "test/init_variables.c"
+.LiteralString340:
+  .string  "gs1.s0.c"
+.LiteralString341:
+  .string  "test/init_variables.c"
+.LiteralString342:
+  .string  "gs1rest.ar[0]"
+.LiteralString343:
+  .string  "test/init_variables.c"
+.LiteralString344:
+  .string  "gs1rest.ar[1]"
+.LiteralString345:
+  .string  "test/init_variables.c"
+.LiteralString346:
+  .string  "gs1rest.ar[3]"
+.LiteralString347:
+  .string  "test/init_variables.c"
+.LiteralString348:
+  .string  "gs1rest.c"
+.LiteralString349:
+  .string  "test/init_variables.c"
+.LiteralString350:
+  .string  "space"
+.LiteralString351:
+  .string  "strcmp(gs1rest.str, \"space\")"
+.LiteralString352:
+  .string  "test/init_variables.c"
+.LiteralString353:
+  .string  "gs1rest.str[8]"
+.LiteralString354:
+  .string  "test/init_variables.c"
+.LiteralString355:
+  .string  "gs1rest.s0.n"
+.LiteralString356:
+  .string  "test/init_variables.c"
+.LiteralString357:
+  .string  "gs1rest.s0.c"
+.LiteralString358:
+  .string  "test/init_variables.c"
+.LiteralString359:
+  .string  "gs0_cmpd.n"
+.LiteralString360:
+  .string  "test/init_variables.c"
+.LiteralString361:
+  .string  "gs0_cmpd.c"
+.LiteralString362:
+  .string  "test/init_variables.c"
+.LiteralString363:
+  .string  "gs1_cmpd.s0.n"
+.LiteralString364:
+  .string  "test/init_variables.c"
+.LiteralString365:
+  .string  "gs1_cmpd.s0.c"
+.LiteralString366:
+  .string  "test/init_variables.c"
+.LiteralString367:
+  .string  "gs0_cmpd_ptr1->n"
+.LiteralString368:
+  .string  "test/init_variables.c"
+.LiteralString369:
+  .string  "gs0_cmpd_ptr1->c"
+.LiteralString370:
+  .string  "test/init_variables.c"
+.LiteralString371:
+  .string  "gs0_cmpd_ptr2 == &gs0"
+.LiteralString372:
+  .string  "test/init_variables.c"
+.LiteralString373:
+  .string  "gs0_cmpd_ptr2->n"
+.LiteralString374:
+  .string  "test/init_variables.c"
+.LiteralString375:
+  .string  "gs0_cmpd_ptr2->c"
+.LiteralString376:
+  .string  "test/init_variables.c"
+.LiteralString377:
+  .string  "zero"
+.LiteralString378:
+  .string  "test/init_variables.c"
+.LiteralString379:
+  .string  "n"
+.LiteralString380:
+  .string  "bar"
+.LiteralString381:
+  .string  "test/init_variables.c"
+.LiteralString382:
+  .string  "ptr == &num"
+.LiteralString383:
+  .string  "test/init_variables.c"
+.LiteralString384:
+  .string  "bar"
+.LiteralString385:
+  .string  "strcmp(str, \"bar\")"
+.LiteralString386:
+  .string  "abc"
+.LiteralString387:
+  .string  "xyz"
+.LiteralString388:
+  .string  "fgh"
+.LiteralString389:
+  .string  "jkl"
+.LiteralString390:
+  .string  "opq"
+.LiteralString391:
+  .string  "yuio"
+.LiteralString392:
+  .string  "hjkl"
+.LiteralString393:
+  .string  "nm,."
+.LiteralString394:
+  .string  "test/init_variables.c"
+.LiteralString395:
+  .string  "sizeof(nums1)"
+.LiteralString396:
+  .string  "test/init_variables.c"
+.LiteralString397:
+  .string  "nums1[0]"
+.LiteralString398:
+  .string  "test/init_variables.c"
+.LiteralString399:
+  .string  "nums1[1]"
+.LiteralString400:
+  .string  "test/init_variables.c"
+.LiteralString401:
+  .string  "nums1[2]"
+.LiteralString402:
+  .string  "test/init_variables.c"
+.LiteralString403:
+  .string  "nums1[3]"
+.LiteralString404:
+  .string  "test/init_variables.c"
+.LiteralString405:
+  .string  "nums1[4]"
+.LiteralString406:
+  .string  "test/init_variables.c"
+.LiteralString407:
+  .string  "nums1[5]"
+.LiteralString408:
+  .string  "test/init_variables.c"
+.LiteralString409:
+  .string  "nums1[6]"
+.LiteralString410:
+  .string  "test/init_variables.c"
+.LiteralString411:
+  .string  "nums1[7]"
+.LiteralString412:
+  .string  "test/init_variables.c"
+.LiteralString413:
+  .string  "nums1[8]"
+.LiteralString414:
+  .string  "test/init_variables.c"
+.LiteralString415:
+  .string  "nums1[9]"
+.LiteralString416:
+  .string  "test/init_variables.c"
+.LiteralString417:
+  .string  "sizeof(nums2)"
+.LiteralString418:
+  .string  "test/init_variables.c"
+.LiteralString419:
+  .string  "nums2[0]"
+.LiteralString420:
+  .string  "test/init_variables.c"
+.LiteralString421:
+  .string  "nums2[1]"
+.LiteralString422:
+  .string  "test/init_variables.c"
+.LiteralString423:
+  .string  "nums2[2]"
+.LiteralString424:
+  .string  "test/init_variables.c"
+.LiteralString425:
+  .string  "nums2[3]"
+.LiteralString426:
+  .string  "test/init_variables.c"
+.LiteralString427:
+  .string  "sizeof(s1)"
+.LiteralString428:
+  .string  "test/init_variables.c"
+.LiteralString429:
+  .string  "abc"
+.LiteralString430:
+  .string  "strcmp(s1, \"abc\")"
+.LiteralString431:
+  .string  "test/init_variables.c"
+.LiteralString432:
+  .string  "s1[5]"
+.LiteralString433:
+  .string  "test/init_variables.c"
+.LiteralString434:
+  .string  "sizeof(s2)"
+.LiteralString435:
+  .string  "test/init_variables.c"
+.LiteralString436:
+  .string  "xyz"
+.LiteralString437:
+  .string  "strcmp(s2, \"xyz\")"
+.LiteralString438:
+  .string  "test/init_variables.c"
+.LiteralString439:
+  .string  "sizeof(s3)"
+.LiteralString440:
+  .string  "test/init_variables.c"
+.LiteralString441:
+  .string  "s3[0]"
+.LiteralString442:
+  .string  "test/init_variables.c"
+.LiteralString443:
+  .string  "s3[1]"
+.LiteralString444:
+  .string  "test/init_variables.c"
+.LiteralString445:
+  .string  "s3[2]"
+.LiteralString446:
+  .string  "test/init_variables.c"
+.LiteralString447:
+  .string  "sizeof(ss1)"
+.LiteralString448:
+  .string  "test/init_variables.c"
+.LiteralString449:
+  .string  "fgh"
+.LiteralString450:
+  .string  "strcmp(ss1[0], \"fgh\")"
+.LiteralString451:
+  .string  "test/init_variables.c"
+.LiteralString452:
+  .string  "jkl"
+.LiteralString453:
+  .string  "strcmp(ss1[1], \"jkl\")"
+.LiteralString454:
+  .string  "test/init_variables.c"
+.LiteralString455:
+  .string  "opq"
+.LiteralString456:
+  .string  "strcmp(ss1[2], \"opq\")"
+.LiteralString457:
+  .string  "test/init_variables.c"
+.LiteralString458:
+  .string  ""
+.LiteralString459:
+  .string  "strcmp(ss1[3], \"\")"
+.LiteralString460:
+  .string  "test/init_variables.c"
+.LiteralString461:
+  .string  "ss1[0][5]"
+.LiteralString462:
+  .string  "test/init_variables.c"
+.LiteralString463:
+  .string  "sizeof(ss2)"
+.LiteralString464:
+  .string  "test/init_variables.c"
+.LiteralString465:
+  .string  "yuio"
+.LiteralString466:
+  .string  "strcmp(ss2[0], \"yuio\")"
+.LiteralString467:
+  .string  "test/init_variables.c"
+.LiteralString468:
+  .string  "hjkl"
+.LiteralString469:
+  .string  "strcmp(ss2[1], \"hjkl\")"
+.LiteralString470:
+  .string  "test/init_variables.c"
+.LiteralString471:
+  .string  "nm,."
+.LiteralString472:
+  .string  "strcmp(ss2[2], \"nm,.\")"
+.LiteralString473:
+  .string  "test/init_variables.c"
+.LiteralString474:
+  .string  "ss2[0][5]"
+.LiteralString475:
+  .string  "hello"
+.LiteralString476:
+  .string  "world"
+.LiteralString477:
+  .string  "test/init_variables.c"
+.LiteralString478:
+  .string  "s0.n"
+.LiteralString479:
+  .string  "test/init_variables.c"
+.LiteralString480:
+  .string  "s0.c"
+.LiteralString481:
+  .string  "test/init_variables.c"
+.LiteralString482:
+  .string  "sizeof(s0ar)"
+.LiteralString483:
+  .string  "test/init_variables.c"
+.LiteralString484:
+  .string  "s0ar[0].n"
+.LiteralString485:
+  .string  "test/init_variables.c"
+.LiteralString486:
+  .string  "s0ar[0].c"
+.LiteralString487:
+  .string  "test/init_variables.c"
+.LiteralString488:
+  .string  "s0ar[1].n"
+.LiteralString489:
+  .string  "test/init_variables.c"
+.LiteralString490:
+  .string  "s0ar[1].c"
+.LiteralString491:
+  .string  "test/init_variables.c"
+.LiteralString492:
+  .string  "s1.ar[0]"
+.LiteralString493:
+  .string  "test/init_variables.c"
+.LiteralString494:
+  .string  "s1.ar[1]"
+.LiteralString495:
+  .string  "test/init_variables.c"
+.LiteralString496:
+  .string  "s1.ar[3]"
+.LiteralString497:
+  .string  "test/init_variables.c"
+.LiteralString498:
+  .string  "s1.c"
+.LiteralString499:
+  .string  "test/init_variables.c"
+.LiteralString500:
+  .string  "hello"
+.LiteralString501:
+  .string  "strcmp(s1.str, \"hello\")"
+.LiteralString502:
+  .string  "test/init_variables.c"
+.LiteralString503:
+  .string  "s1.str[8]"
+.LiteralString504:
+  .string  "test/init_variables.c"
+.LiteralString505:
+  .string  "s1.s0.n"
+.LiteralString506:
+  .string  "test/init_variables.c"
+.LiteralString507:
+  .string  "s1.s0.c"
+.LiteralString508:
+  .string  "test/init_variables.c"
+.LiteralString509:
+  .string  "s1rest.ar[0]"
+.LiteralString510:
+  .string  "test/init_variables.c"
+.LiteralString511:
+  .string  "s1rest.ar[1]"
+.LiteralString512:
+  .string  "test/init_variables.c"
+.LiteralString513:
+  .string  "s1rest.ar[3]"
+.LiteralString514:
+  .string  "test/init_variables.c"
+.LiteralString515:
+  .string  "s1rest.c"
+.LiteralString516:
+  .string  "test/init_variables.c"
+.LiteralString517:
+  .string  "world"
+.LiteralString518:
+  .string  "strcmp(s1rest.str, \"world\")"
+.LiteralString519:
+  .string  "test/init_variables.c"
+.LiteralString520:
+  .string  "s1rest.str[8]"
+.LiteralString521:
+  .string  "test/init_variables.c"
+.LiteralString522:
+  .string  "s1rest.s0.n"
+.LiteralString523:
+  .string  "test/init_variables.c"
+.LiteralString524:
+  .string  "s1rest.s0.c"
+.LiteralString525:
+  .string  "test/init_variables.c"
+.LiteralString526:
+  .string  "p == 0"
+.LiteralString527:
+  .string  "test/init_variables.c"
+.LiteralString528:
+  .string  "sp1 == 0"
+.LiteralString529:
+  .string  "test/init_variables.c"
+.LiteralString530:
+  .string  "sp2 == 0"
+.LiteralString531:
+  .string  "test/init_variables.c"
+.LiteralString532:
+  .string  "n"
+.LiteralString533:
+  .string  "test/init_variables.c"
+.LiteralString534:
+  .string  "n"
+.globl gs0_cmpd_ptr2
+gs0_cmpd_ptr2:
+  .quad gs0
+.globl gs0_cmpd_ptr1
+gs0_cmpd_ptr1:
+  .quad .StaticVar3
+.globl gs1_cmpd
+gs1_cmpd:
+  .zero 20
+  .byte 0
+  .zero 10
+  .zero 1
+  .long 119
+  .byte 123
+  .zero 3
+.globl gs0_cmpd
+gs0_cmpd:
+  .long 109
+  .byte 113
+  .zero 3
+.globl gs1rest
+gs1rest:
+  .long 103
+  .long 107
+  .zero 12
+  .byte 103
+  .string "space"
+  .zero 4
+  .zero 9
+.globl gs1
+gs1:
+  .long 83
+  .long 87
+  .zero 12
+  .byte 119
+  .string "goodbye"
+  .zero 2
+  .zero 1
+  .long 89
+  .byte 97
+  .zero 3
+.globl gs0ar
+gs0ar:
+  .long 73
+  .byte 79
+  .zero 3
+  .zero 8
+.globl gs0
+gs0:
+  .long 69
+  .byte 71
+  .zero 3
+.globl gstrar
+gstrar:
+  .string "jjj"
+  .zero 1
+  .string "kkk"
+  .zero 1
+.globl gstr4
+gstr4:
+  .quad .LiteralString2
+.globl gstr3
+gstr3:
+  .byte 100
+  .byte 101
+.globl gstr2
+gstr2:
+  .string "xyz"
+.globl gstr1
+gstr1:
+  .string "abc"
+  .zero 6
+.globl gnumarar2
+gnumarar2:
+  .long 59
+  .long 61
+  .long 67
+.globl gnumarar1
+gnumarar1:
+  .long 41
+  .long 47
+  .long 53
+  .zero 24
+.globl gnumar2
+gnumar2:
+  .long 29
+  .long 31
+  .long 37
+.globl gnumar1
+gnumar1:
+  .long 17
+  .long 19
+  .long 23
+  .zero 8
+.globl gchar
+gchar:
+  .byte 117
+.globl gptr1
+gptr1:
+  .quad gnum
+.globl gnum
+gnum:
+  .long 101
+.StaticVar23:
+  .long -1
+.StaticVar22:
+  .quad 0
+.StaticVar21:
+  .long 7
+.StaticVar20:
+  .quad 0
+.StaticVar19:
+  .long 37
+  .long 41
+  .zero 12
+  .byte 104
+  .string "world"
+  .zero 4
+  .zero 9
+.StaticVar18:
+  .long 19
+  .long 23
+  .zero 12
+  .byte 120
+  .string "hello"
+  .zero 4
+  .zero 1
+  .long 29
+  .byte 31
+  .zero 3
+.StaticVar17:
+  .long 13
+  .byte 17
+  .zero 3
+  .zero 8
+.StaticVar16:
+  .long 7
+  .byte 11
+  .zero 3
+.StaticVar15:
+  .string "yuio"
+  .zero 5
+  .string "hjkl"
+  .zero 5
+  .string "nm,."
+  .zero 5
+.StaticVar14:
+  .string "fgh"
+  .zero 6
+  .string "jkl"
+  .zero 6
+  .string "opq"
+  .zero 6
+  .zero 10
+.StaticVar13:
+  .byte 105
+  .byte 111
+  .byte 115
+.StaticVar12:
+  .string "xyz"
+.StaticVar11:
+  .string "abc"
+  .zero 6
+.StaticVar10:
+  .long 23
+  .long 29
+  .long 31
+  .long 37
+.StaticVar9:
+  .long 3
+  .long 5
+  .long 7
+  .long 11
+  .long 13
+  .zero 20
+.StaticVar8:
+  .quad .LiteralString380
+.StaticVar7:
+  .quad .StaticVar6
+.StaticVar6:
+  .zero 4
+.StaticVar5:
+  .long 13
+.StaticVar4:
+  .zero 4
+.StaticVar3:
+  .long 3
+  .byte 5
+  .zero 3
+.StaticVar2:
+  .zero 20
+  .byte 0
+  .zero 10
+  .zero 1
+  .long 119
+  .byte 123
+  .zero 3
+.StaticVar1:
+  .long 119
+  .byte 123
+  .zero 3
+.StaticVar0:
+  .long 109
+  .byte 113
+  .zero 3
@@ -0,0 +1,147 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int g_counter;
+int inc_counter_true(void) {
+    g_counter++;
+    return 1;
+}
+int inc_counter_false(void) {
+    g_counter++;
+    return 0;
+}
+void test_logicalAND(void) {
+    int n = 0;
+    if (1 && 1) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 21); assert("test/logical_cond.c", 21, (0), (1), "1");} while(0);
+    }
+    if (1 && 1 && 1) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 27); assert("test/logical_cond.c", 27, (0), (1), "1");} while(0);
+    }
+    if (0 && 0)
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 31); assert("test/logical_cond.c", 31, (0), (1), "1");} while(0);
+    if (0 && 1)
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 34); assert("test/logical_cond.c", 34, (0), (1), "1");} while(0);
+    if (1 && 0)
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 37); assert("test/logical_cond.c", 37, (0), (1), "1");} while(0);
+    if (1 && 0 && 1)
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 40); assert("test/logical_cond.c", 40, (0), (1), "1");} while(0);
+    if (1 && 1 && 0)
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 43); assert("test/logical_cond.c", 43, (0), (1), "1");} while(0);
+    if ((n = 3) && (n = 5) && (n = 7)) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 47); assert("test/logical_cond.c", 47, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 49, (7), (n), "n");
+    if ((n = 13) && (n = 0) && (n = 17)) {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 51); assert("test/logical_cond.c", 51, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 53, (0), (n), "n");
+}
+void test_logicalAND_short_circuit(void) {
+    g_counter = 0;
+    assert("test/logical_cond.c", 58, (0), (g_counter), "g_counter");
+    if (inc_counter_false() && inc_counter_false()) {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 60); assert("test/logical_cond.c", 60, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 62, (1), (g_counter), "g_counter");
+    g_counter = 0;
+    assert("test/logical_cond.c", 65, (0), (g_counter), "g_counter");
+    if (inc_counter_false() && inc_counter_false() && inc_counter_false()) {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 67); assert("test/logical_cond.c", 67, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 69, (1), (g_counter), "g_counter");
+}
+void test_logicalOR(void) {
+    int n = 0;
+    if (1 || 1) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 78); assert("test/logical_cond.c", 78, (0), (1), "1");} while(0);
+    }
+    if (1 || 0) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 84); assert("test/logical_cond.c", 84, (0), (1), "1");} while(0);
+    }
+    if (0 || 1) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 91); assert("test/logical_cond.c", 91, (0), (1), "1");} while(0);
+    }
+    if (0 || 0) {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 95); assert("test/logical_cond.c", 95, (0), (1), "1");} while(0);
+    }
+    if (0 || 0 || 1) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 100); assert("test/logical_cond.c", 100, (0), (1), "1");} while(0);
+    }
+}
+void test_logicalOR_short_circuit(void) {
+    g_counter = 0;
+    assert("test/logical_cond.c", 106, (0), (g_counter), "g_counter");
+    if (inc_counter_true() || inc_counter_false()) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 109); assert("test/logical_cond.c", 109, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 111, (1), (g_counter), "g_counter");
+    g_counter = 0;
+    assert("test/logical_cond.c", 114, (0), (g_counter), "g_counter");
+    if (inc_counter_false() || inc_counter_false()) {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 116); assert("test/logical_cond.c", 116, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 118, (2), (g_counter), "g_counter");
+    g_counter = 0;
+    assert("test/logical_cond.c", 121, (0), (g_counter), "g_counter");
+    if (inc_counter_false() || inc_counter_true() || inc_counter_false()) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 124); assert("test/logical_cond.c", 124, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 126, (2), (g_counter), "g_counter");
+}
+void test_logical_AND_OR_mixtured(void) {
+    g_counter = 0;
+    assert("test/logical_cond.c", 131, (0), (g_counter), "g_counter");
+    if (inc_counter_true() && inc_counter_false() ||
+            inc_counter_true() && inc_counter_true()) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 135); assert("test/logical_cond.c", 135, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 137, (4), (g_counter), "g_counter");
+    g_counter = 0;
+    assert("test/logical_cond.c", 140, (0), (g_counter), "g_counter");
+    if (inc_counter_false() || inc_counter_true() && inc_counter_true()) {
+    } else {
+        do {printf("%s:%d: unreachable", "test/logical_cond.c", 143); assert("test/logical_cond.c", 143, (0), (1), "1");} while(0);
+    }
+    assert("test/logical_cond.c", 145, (3), (g_counter), "g_counter");
+}
+void test_logical_cond_in_flows(void) {
+    int n = 0;
+    int i;
+    for (i = 0; i < 10 && !(i == 5 || i == 7); i++)
+        n++;
+    assert("test/logical_cond.c", 154, (5), (n), "n");
+    n = 0;
+    i = 0;
+    do {
+        n += i;
+    } while (++i <= 4 || i == 8);
+    assert("test/logical_cond.c", 161, (10), (n), "n");
+    assert("test/logical_cond.c", 163, (3), ((1 < 2 && !(3 <= 2)) ? 3 : 4), "(1 < 2 && !(3 <= 2)) ? 3 : 4");
+    assert("test/logical_cond.c", 164, (4), ((2 != 2 || !1) ? 3 : 4), "(2 != 2 || !1) ? 3 : 4");
+    assert("test/logical_cond.c", 165, (1), (5 > 3 && 2 >= 2), "5 > 3 && 2 >= 2");
+    assert("test/logical_cond.c", 166, (0), (5 < 3 || 2 > 2), "5 < 3 || 2 > 2");
+    assert("test/logical_cond.c", 167, (1), (!(5 < 3) && !!3), "!(5 < 3) && !!3");
+}
+int main(void) {
+    test_logicalAND();
+    test_logicalAND_short_circuit();
+    test_logicalOR();
+    test_logicalOR_short_circuit();
+    test_logical_AND_OR_mixtured();
+    test_logical_cond_in_flows();
+    return 0;
+}
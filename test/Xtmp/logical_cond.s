@@ -0,0 +1,1139 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl inc_counter_true
+inc_counter_true:
+  lea rax, QWORD PTR g_counter[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, 1
+  jmp .Lreturn_inc_counter_true
+.Lreturn_inc_counter_true:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl inc_counter_false
+inc_counter_false:
+  lea rax, QWORD PTR g_counter[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, 0
+  jmp .Lreturn_inc_counter_false
+.Lreturn_inc_counter_false:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_logicalAND
+test_logicalAND:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  je .Lelse24_0
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  je .Lelse24_0
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  je .Lelse24_0
+  jmp .Lend24
+.Lelse24_0:
+  .p2align 4
+.Lbegin27:
+  mov rcx, 47
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 47
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator27:
+.Lend27:
+  jmp .Lend24
+.Lend24:
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 49
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  je .Lend28
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  je .Lend28
+  mov rdi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  test rax, rax
+  je .Lend28
+  .p2align 4
+.Lbegin31:
+  mov rcx, 51
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 51
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator31:
+.Lend31:
+.Lend28:
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 53
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_logicalAND:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_logicalAND_short_circuit
+test_logicalAND_short_circuit:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 58
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lend32
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lend32
+  .p2align 4
+.Lbegin34:
+  mov rcx, 60
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 60
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator34:
+.Lend34:
+.Lend32:
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 62
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 65
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lend35
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lend35
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lend35
+  .p2align 4
+.Lbegin38:
+  mov rcx, 67
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 67
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator38:
+.Lend38:
+.Lend35:
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 69
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_logicalAND_short_circuit:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_logicalOR
+test_logicalOR:
+  lea rdi, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_test_logicalOR:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_logicalOR_short_circuit
+test_logicalOR_short_circuit:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 106
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  jne .Llogicalor56
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lelse55_0
+.Llogicalor56:
+  jmp .Lend55
+.Lelse55_0:
+  .p2align 4
+.Lbegin57:
+  mov rcx, 109
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 109
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator57:
+.Lend57:
+  jmp .Lend55
+.Lend55:
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 114
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  jne .Llogicalor59
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lend58
+.Llogicalor59:
+  .p2align 4
+.Lbegin60:
+  mov rcx, 116
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 116
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator60:
+.Lend60:
+.Lend58:
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 118
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 121
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  jne .Llogicalor63
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  jne .Llogicalor63
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  je .Lelse61_0
+.Llogicalor63:
+  jmp .Lend61
+.Lelse61_0:
+  .p2align 4
+.Lbegin64:
+  mov rcx, 124
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 124
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator64:
+.Lend64:
+  jmp .Lend61
+.Lend61:
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 126
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_logicalOR_short_circuit:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_logical_AND_OR_mixtured
+test_logical_AND_OR_mixtured:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 131
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  je .Llogicaland66
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  jne .Llogicalor68
+.Llogicaland66:
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  je .Lelse65_0
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  je .Lelse65_0
+.Llogicalor68:
+  jmp .Lend65
+.Lelse65_0:
+  .p2align 4
+.Lbegin69:
+  mov rcx, 135
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 135
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator69:
+.Lend69:
+  jmp .Lend65
+.Lend65:
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 137
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR g_counter[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 140
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call inc_counter_false
+  test rax, rax
+  jne .Llogicalor72
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  je .Lelse70_0
+  mov al, 0
+  call inc_counter_true
+  test rax, rax
+  je .Lelse70_0
+.Llogicalor72:
+  jmp .Lend70
+.Lelse70_0:
+  .p2align 4
+.Lbegin73:
+  mov rcx, 143
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 0
+  mov rsi, 143
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator73:
+.Lend73:
+  jmp .Lend70
+.Lend70:
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_counter[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 145
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_logical_AND_OR_mixtured:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_logical_cond_in_flows
+test_logical_cond_in_flows:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond74
+  .p2align 4
+.Lbegin74:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator74:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lcond74:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jge .Llogicaland76
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Llogicalor75
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lbegin74
+.Llogicalor75:
+.Llogicaland76:
+.Lend74:
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 154
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin77:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator77:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  cmp rax, 4
+  jle .Lbegin77
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lbegin77
+.Lend77:
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 161
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 163
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 164
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 165
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 166
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 167
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_logical_cond_in_flows:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call test_logicalAND
+  mov al, 0
+  call test_logicalAND_short_circuit
+  mov al, 0
+  call test_logicalOR
+  mov al, 0
+  call test_logicalOR_short_circuit
+  mov al, 0
+  call test_logical_AND_OR_mixtured
+  mov al, 0
+  call test_logical_cond_in_flows
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "%s:%d: unreachable"
+.LiteralString1:
+  .string  "test/logical_cond.c"
+.LiteralString2:
+  .string  "test/logical_cond.c"
+.LiteralString3:
+  .string  "1"
+.LiteralString4:
+  .string  "%s:%d: unreachable"
+.LiteralString5:
+  .string  "test/logical_cond.c"
+.LiteralString6:
+  .string  "test/logical_cond.c"
+.LiteralString7:
+  .string  "1"
+.LiteralString8:
+  .string  "%s:%d: unreachable"
+.LiteralString9:
+  .string  "test/logical_cond.c"
+.LiteralString10:
+  .string  "test/logical_cond.c"
+.LiteralString11:
+  .string  "1"
+.LiteralString12:
+  .string  "%s:%d: unreachable"
+.LiteralString13:
+  .string  "test/logical_cond.c"
+.LiteralString14:
+  .string  "test/logical_cond.c"
+.LiteralString15:
+  .string  "1"
+.LiteralString16:
+  .string  "%s:%d: unreachable"
+.LiteralString17:
+  .string  "test/logical_cond.c"
+.LiteralString18:
+  .string  "test/logical_cond.c"
+.LiteralString19:
+  .string  "1"
+.LiteralString20:
+  .string  "%s:%d: unreachable"
+.LiteralString21:
+  .string  "test/logical_cond.c"
+.LiteralString22:
+  .string  "test/logical_cond.c"
+.LiteralString23:
+  .string  "1"
+.LiteralString24:
+  .string  "%s:%d: unreachable"
+.LiteralString25:
+  .string  "test/logical_cond.c"
+.LiteralString26:
+  .string  "test/logical_cond.c"
+.LiteralString27:
+  .string  "1"
+.LiteralString28:
+  .string  "%s:%d: unreachable"
+.LiteralString29:
+  .string  "test/logical_cond.c"
+.LiteralString30:
+  .string  "test/logical_cond.c"
+.LiteralString31:
+  .string  "1"
+.LiteralString32:
+  .string  "test/logical_cond.c"
+.LiteralString33:
+  .string  "n"
+.LiteralString34:
+  .string  "%s:%d: unreachable"
+.LiteralString35:
+  .string  "test/logical_cond.c"
+.LiteralString36:
+  .string  "test/logical_cond.c"
+.LiteralString37:
+  .string  "1"
+.LiteralString38:
+  .string  "test/logical_cond.c"
+.LiteralString39:
+  .string  "n"
+.LiteralString40:
+  .string  "test/logical_cond.c"
+.LiteralString41:
+  .string  "g_counter"
+.LiteralString42:
+  .string  "%s:%d: unreachable"
+.LiteralString43:
+  .string  "test/logical_cond.c"
+.LiteralString44:
+  .string  "test/logical_cond.c"
+.LiteralString45:
+  .string  "1"
+.LiteralString46:
+  .string  "test/logical_cond.c"
+.LiteralString47:
+  .string  "g_counter"
+.LiteralString48:
+  .string  "test/logical_cond.c"
+.LiteralString49:
+  .string  "g_counter"
+.LiteralString50:
+  .string  "%s:%d: unreachable"
+.LiteralString51:
+  .string  "test/logical_cond.c"
+.LiteralString52:
+  .string  "test/logical_cond.c"
+.LiteralString53:
+  .string  "1"
+.LiteralString54:
+  .string  "test/logical_cond.c"
+.LiteralString55:
+  .string  "g_counter"
+.LiteralString56:
+  .string  "%s:%d: unreachable"
+.LiteralString57:
+  .string  "test/logical_cond.c"
+.LiteralString58:
+  .string  "test/logical_cond.c"
+.LiteralString59:
+  .string  "1"
+.LiteralString60:
+  .string  "%s:%d: unreachable"
+.LiteralString61:
+  .string  "test/logical_cond.c"
+.LiteralString62:
+  .string  "test/logical_cond.c"
+.LiteralString63:
+  .string  "1"
+.LiteralString64:
+  .string  "%s:%d: unreachable"
+.LiteralString65:
+  .string  "test/logical_cond.c"
+.LiteralString66:
+  .string  "test/logical_cond.c"
+.LiteralString67:
+  .string  "1"
+.LiteralString68:
+  .string  "%s:%d: unreachable"
+.LiteralString69:
+  .string  "test/logical_cond.c"
+.LiteralString70:
+  .string  "test/logical_cond.c"
+.LiteralString71:
+  .string  "1"
+.LiteralString72:
+  .string  "%s:%d: unreachable"
+.LiteralString73:
+  .string  "test/logical_cond.c"
+.LiteralString74:
+  .string  "test/logical_cond.c"
+.LiteralString75:
+  .string  "1"
+.LiteralString76:
+  .string  "test/logical_cond.c"
+.LiteralString77:
+  .string  "g_counter"
+.LiteralString78:
+  .string  "%s:%d: unreachable"
+.LiteralString79:
+  .string  "test/logical_cond.c"
+.LiteralString80:
+  .string  "test/logical_cond.c"
+.LiteralString81:
+  .string  "1"
+.LiteralString82:
+  .string  "test/logical_cond.c"
+.LiteralString83:
+  .string  "g_counter"
+.LiteralString84:
+  .string  "test/logical_cond.c"
+.LiteralString85:
+  .string  "g_counter"
+.LiteralString86:
+  .string  "%s:%d: unreachable"
+.LiteralString87:
+  .string  "test/logical_cond.c"
+.LiteralString88:
+  .string  "test/logical_cond.c"
+.LiteralString89:
+  .string  "1"
+.LiteralString90:
+  .string  "test/logical_cond.c"
+.LiteralString91:
+  .string  "g_counter"
+.LiteralString92:
+  .string  "test/logical_cond.c"
+.LiteralString93:
+  .string  "g_counter"
+.LiteralString94:
+  .string  "%s:%d: unreachable"
+.LiteralString95:
+  .string  "test/logical_cond.c"
+.LiteralString96:
+  .string  "test/logical_cond.c"
+.LiteralString97:
+  .string  "1"
+.LiteralString98:
+  .string  "test/logical_cond.c"
+.LiteralString99:
+  .string  "g_counter"
+.LiteralString100:
+  .string  "test/logical_cond.c"
+.LiteralString101:
+  .string  "g_counter"
+.LiteralString102:
+  .string  "%s:%d: unreachable"
+.LiteralString103:
+  .string  "test/logical_cond.c"
+.LiteralString104:
+  .string  "test/logical_cond.c"
+.LiteralString105:
+  .string  "1"
+.LiteralString106:
+  .string  "test/logical_cond.c"
+.LiteralString107:
+  .string  "g_counter"
+.LiteralString108:
+  .string  "test/logical_cond.c"
+.LiteralString109:
+  .string  "g_counter"
+.LiteralString110:
+  .string  "%s:%d: unreachable"
+.LiteralString111:
+  .string  "test/logical_cond.c"
+.LiteralString112:
+  .string  "test/logical_cond.c"
+.LiteralString113:
+  .string  "1"
+.LiteralString114:
+  .string  "test/logical_cond.c"
+.LiteralString115:
+  .string  "g_counter"
+.LiteralString116:
+  .string  "test/logical_cond.c"
+.LiteralString117:
+  .string  "n"
+.LiteralString118:
+  .string  "test/logical_cond.c"
+.LiteralString119:
+  .string  "n"
+.LiteralString120:
+  .string  "test/logical_cond.c"
+.LiteralString121:
+  .string  "(1 < 2 && !(3 <= 2)) ? 3 : 4"
+.LiteralString122:
+  .string  "test/logical_cond.c"
+.LiteralString123:
+  .string  "(2 != 2 || !1) ? 3 : 4"
+.LiteralString124:
+  .string  "test/logical_cond.c"
+.LiteralString125:
+  .string  "5 > 3 && 2 >= 2"
+.LiteralString126:
+  .string  "test/logical_cond.c"
+.LiteralString127:
+  .string  "5 < 3 || 2 > 2"
+.LiteralString128:
+  .string  "test/logical_cond.c"
+.LiteralString129:
+  .string  "!(5 < 3) && !!3"
+.globl g_counter
+g_counter:
+  .zero 4
@@ -0,0 +1,320 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+subassert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov DWORD PTR -16[rbp], edx
+  mov DWORD PTR -20[rbp], ecx
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call printf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend0:
+.Lreturn_subassert:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+testHashHashOperator:
+  push rbp
+  mov rbp, rsp
+  .p2align 4
+.Lbegin1:
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 20
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator1:
+.Lend1:
+  .p2align 4
+.Lbegin2:
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 21
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator2:
+.Lend2:
+  .p2align 4
+.Lbegin3:
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 22
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator3:
+.Lend3:
+  .p2align 4
+.Lbegin4:
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 23
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator4:
+.Lend4:
+  .p2align 4
+.Lbegin5:
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 24
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator5:
+.Lend5:
+  .p2align 4
+.Lbegin6:
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator6:
+.Lend6:
+  .p2align 4
+.Lbegin7:
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 26
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator7:
+.Lend7:
+  .p2align 4
+.Lbegin8:
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 27
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator8:
+.Lend8:
+  .p2align 4
+.Lbegin9:
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 28
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator9:
+.Lend9:
+.Lreturn_testHashHashOperator:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  .p2align 4
+.Lbegin10:
+  mov rcx, 0
+  mov r8, 0
+  mov rsi, 33
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator10:
+.Lend10:
+  .p2align 4
+.Lbegin11:
+  mov rcx, 1
+  mov r8, 1
+  mov rsi, 34
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call subassert
+.Literator11:
+.Lend11:
+  mov al, 0
+  call testHashHashOperator
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "%s:%d: Value mismatch: got: %d\n"
+.LiteralString1:
+  .string  "foo"
+.LiteralString2:
+  .string  "10-bar"
+.LiteralString3:
+  .string  "'c'"
+.LiteralString4:
+  .string  "'\\n'"
+.LiteralString5:
+  .string  "'\\\\'"
+.LiteralString6:
+  .string  "baz"
+.LiteralString7:
+  .string  "\"baz\""
+.LiteralString8:
+  .string  "\n \\"
+.LiteralString9:
+  .string  "\"\\n \\\\\""
+.LiteralString10:
+  .string  "foo bar"
+.LiteralString11:
+  .string  "hoge fuga"
+.LiteralString12:
+  .string  "test/preproc.c"
+.LiteralString13:
+  .string  "foo"
+.LiteralString14:
+  .string  "test/preproc.c"
+.LiteralString15:
+  .string  "10-bar"
+.LiteralString16:
+  .string  "test/preproc.c"
+.LiteralString17:
+  .string  "'c'"
+.LiteralString18:
+  .string  "test/preproc.c"
+.LiteralString19:
+  .string  "'\\n'"
+.LiteralString20:
+  .string  "test/preproc.c"
+.LiteralString21:
+  .string  "'\\\\'"
+.LiteralString22:
+  .string  "test/preproc.c"
+.LiteralString23:
+  .string  "\"baz\""
+.LiteralString24:
+  .string  "test/preproc.c"
+.LiteralString25:
+  .string  "\"\\n \\\\\""
+.LiteralString26:
+  .string  "test/preproc.c"
+.LiteralString27:
+  .string  "foo bar"
+.LiteralString28:
+  .string  "test/preproc.c"
+.LiteralString29:
+  .string  "hoge fuga"
+.LiteralString30:
+  .string  "test/preproc.c"
+.LiteralString31:
+  .string  "test/preproc.c"
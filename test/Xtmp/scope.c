@@ -0,0 +1,76 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+void test_find_var_in_outer_scope(void) {
+    int n;
+    n = 5;
+    assert("test/scope.c", 6, (5), (n), "n");
+    {
+        n = 10;
+    }
+    assert("test/scope.c", 10, (10), (n), "n");
+    {
+        int a;
+        a = 20;
+        assert("test/scope.c", 15, (20), (a), "a");
+        {
+            int b;
+            b = a + 10;
+            n = b;
+            assert("test/scope.c", 20, (30), (b), "b");
+        }
+    }
+    assert("test/scope.c", 23, (30), (n), "n");
+}
+void test_inner_scope_independent(void) {
+    int n;
+    n = 5;
+    assert("test/scope.c", 29, (5), (n), "n");
+    {
+        int a;
+        a = 10;
+        assert("test/scope.c", 33, (10), (a), "a");
+        assert("test/scope.c", 34, (5), (n), "n");
+    }
+    assert("test/scope.c", 36, (5), (n), "n");
+}
+void test_names_dropped_on_scope_exit(void) {
+    {
+        struct S { int a; } s;
+        enum { ItemA, ItemB } e;
+        typedef int T;
+        int v;
+        s.a = 3;
+        v = ItemB;
+        assert("test/scope.c", 47, (4), (sizeof(T)), "sizeof(T)");
+        assert("test/scope.c", 48, (3), (s.a), "s.a");
+        assert("test/scope.c", 49, (1), (v), "v");
+    }
+    {
+        struct S { char a; char b; } s;
+        enum { ItemB, ItemA } e;
+        typedef char T;
+        char v;
+        s.b = 7;
+        v = ItemB;
+        assert("test/scope.c", 58, (1), (sizeof(T)), "sizeof(T)");
+        assert("test/scope.c", 59, (2), (sizeof(s)), "sizeof(s)");
+        assert("test/scope.c", 60, (0), (v), "v");
+    }
+    for (int i = 0; i < 1; ++i) {
+        int v;
+        v = 5;
+        assert("test/scope.c", 65, (5), (v), "v");
+    }
+    for (int i = 2; i < 3; ++i)
+        assert("test/scope.c", 68, (2), (i), "i");
+}
+int main(void) {
+    test_find_var_in_outer_scope();
+    test_inner_scope_independent();
+    test_names_dropped_on_scope_exit();
+    return 0;
+}
@@ -0,0 +1,51 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int gar1[2];
+int gar2[2][3];
+int gar3[2][3][4];
+int main(void) {
+    int n;
+    int *p;
+    int ar1[2];
+    int ar2[2][3];
+    int ar3[2][3][4];
+    assert("test/sizeof.c", 14, (4), (sizeof(10)), "sizeof(10)");
+    assert("test/sizeof.c", 15, (4), (sizeof(n)), "sizeof(n)");
+    assert("test/sizeof.c", 16, (4), (sizeof(sizeof(n))), "sizeof(sizeof(n))");
+    assert("test/sizeof.c", 17, (8), (sizeof(p)), "sizeof(p)");
+    assert("test/sizeof.c", 18, (8), (sizeof p), "sizeof p");
+    assert("test/sizeof.c", 19, (4), (sizeof(*p)), "sizeof(*p)");
+    assert("test/sizeof.c", 20, (4), (sizeof(int)), "sizeof(int)");
+    assert("test/sizeof.c", 21, (8), (sizeof(int *)), "sizeof(int *)");
+    assert("test/sizeof.c", 22, (8), (sizeof(int **)), "sizeof(int **)");
+    assert("test/sizeof.c", 23, (12), (sizeof(int[3])), "sizeof(int[3])");
+    assert("test/sizeof.c", 24, (60), (sizeof(int[3][5])), "sizeof(int[3][5])");
+    assert("test/sizeof.c", 25, (24), (sizeof(int*[3])), "sizeof(int*[3])");
+    assert("test/sizeof.c", 26, (24), (sizeof(int**[3])), "sizeof(int**[3])");
+    assert("test/sizeof.c", 27, (1), (sizeof(char)), "sizeof(char)");
+    assert("test/sizeof.c", 28, (8), (sizeof(char *)), "sizeof(char *)");
+    assert("test/sizeof.c", 29, (8), (sizeof(char **)), "sizeof(char **)");
+    assert("test/sizeof.c", 30, (1), (sizeof(void)), "sizeof(void)");
+    assert("test/sizeof.c", 31, (8), (sizeof(void *)), "sizeof(void *)");
+    assert("test/sizeof.c", 32, (8), (sizeof(void **)), "sizeof(void **)");
+    assert("test/sizeof.c", 33, (4), (sizeof(ar1[0])), "sizeof(ar1[0])");
+    assert("test/sizeof.c", 34, (8), (sizeof(ar1)), "sizeof(ar1)");
+    assert("test/sizeof.c", 35, (24), (sizeof(ar2)), "sizeof(ar2)");
+    assert("test/sizeof.c", 36, (12), (sizeof(ar2[0])), "sizeof(ar2[0])");
+    assert("test/sizeof.c", 37, (16), (sizeof(ar3[0][0])), "sizeof(ar3[0][0])");
+    assert("test/sizeof.c", 38, (4), (sizeof(gar1[0])), "sizeof(gar1[0])");
+    assert("test/sizeof.c", 39, (8), (sizeof(gar1)), "sizeof(gar1)");
+    assert("test/sizeof.c", 40, (24), (sizeof(gar2)), "sizeof(gar2)");
+    assert("test/sizeof.c", 41, (12), (sizeof(gar2[0])), "sizeof(gar2[0])");
+    assert("test/sizeof.c", 42, (16), (sizeof(gar3[0][0])), "sizeof(gar3[0][0])");
+    assert("test/sizeof.c", 43, (4), (sizeof("foo")), "sizeof(\"foo\")");
+    assert("test/sizeof.c", 44, (2), (sizeof("\n")), "sizeof(\"\\n\")");
+    assert("test/sizeof.c", 45, (2), (sizeof("\t")), "sizeof(\"\\t\")");
+    assert("test/sizeof.c", 46, (2), (sizeof("\\")), "sizeof(\"\\\\\")");
+    assert("test/sizeof.c", 47, (2), (sizeof("\"")), "sizeof(\"\\\"\")");
+    return 0;
+}
@@ -0,0 +1,512 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 14
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 15
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 16
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 17
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 18
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 19
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 20
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 21
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 22
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 23
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  mov rcx, 60
+  mov r9, 60
+  mov rsi, 24
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  mov rcx, 24
+  mov r9, 24
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  mov rcx, 24
+  mov r9, 24
+  mov rsi, 26
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 27
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 28
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 29
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 30
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 31
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 32
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 33
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 34
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  mov rcx, 24
+  mov r9, 24
+  mov rsi, 35
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 36
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 37
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 38
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 39
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  mov rcx, 24
+  mov r9, 24
+  mov rsi, 40
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 41
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  mov rcx, 16
+  mov r9, 16
+  mov rsi, 42
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 43
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 44
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 45
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 46
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 47
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/sizeof.c"
+.LiteralString1:
+  .string  "sizeof(10)"
+.LiteralString2:
+  .string  "test/sizeof.c"
+.LiteralString3:
+  .string  "sizeof(n)"
+.LiteralString4:
+  .string  "test/sizeof.c"
+.LiteralString5:
+  .string  "sizeof(sizeof(n))"
+.LiteralString6:
+  .string  "test/sizeof.c"
+.LiteralString7:
+  .string  "sizeof(p)"
+.LiteralString8:
+  .string  "test/sizeof.c"
+.LiteralString9:
+  .string  "sizeof p"
+.LiteralString10:
+  .string  "test/sizeof.c"
+.LiteralString11:
+  .string  "sizeof(*p)"
+.LiteralString12:
+  .string  "test/sizeof.c"
+.LiteralString13:
+  .string  "sizeof(int)"
+.LiteralString14:
+  .string  "test/sizeof.c"
+.LiteralString15:
+  .string  "sizeof(int *)"
+.LiteralString16:
+  .string  "test/sizeof.c"
+.LiteralString17:
+  .string  "sizeof(int **)"
+.LiteralString18:
+  .string  "test/sizeof.c"
+.LiteralString19:
+  .string  "sizeof(int[3])"
+.LiteralString20:
+  .string  "test/sizeof.c"
+.LiteralString21:
+  .string  "sizeof(int[3][5])"
+.LiteralString22:
+  .string  "test/sizeof.c"
+.LiteralString23:
+  .string  "sizeof(int*[3])"
+.LiteralString24:
+  .string  "test/sizeof.c"
+.LiteralString25:
+  .string  "sizeof(int**[3])"
+.LiteralString26:
+  .string  "test/sizeof.c"
+.LiteralString27:
+  .string  "sizeof(char)"
+.LiteralString28:
+  .string  "test/sizeof.c"
+.LiteralString29:
+  .string  "sizeof(char *)"
+.LiteralString30:
+  .string  "test/sizeof.c"
+.LiteralString31:
+  .string  "sizeof(char **)"
+.LiteralString32:
+  .string  "test/sizeof.c"
+.LiteralString33:
+  .string  "sizeof(void)"
+.LiteralString34:
+  .string  "test/sizeof.c"
+.LiteralString35:
+  .string  "sizeof(void *)"
+.LiteralString36:
+  .string  "test/sizeof.c"
+.LiteralString37:
+  .string  "sizeof(void **)"
+.LiteralString38:
+  .string  "test/sizeof.c"
+.LiteralString39:
+  .string  "sizeof(ar1[0])"
+.LiteralString40:
+  .string  "test/sizeof.c"
+.LiteralString41:
+  .string  "sizeof(ar1)"
+.LiteralString42:
+  .string  "test/sizeof.c"
+.LiteralString43:
+  .string  "sizeof(ar2)"
+.LiteralString44:
+  .string  "test/sizeof.c"
+.LiteralString45:
+  .string  "sizeof(ar2[0])"
+.LiteralString46:
+  .string  "test/sizeof.c"
+.LiteralString47:
+  .string  "sizeof(ar3[0][0])"
+.LiteralString48:
+  .string  "test/sizeof.c"
+.LiteralString49:
+  .string  "sizeof(gar1[0])"
+.LiteralString50:
+  .string  "test/sizeof.c"
+.LiteralString51:
+  .string  "sizeof(gar1)"
+.LiteralString52:
+  .string  "test/sizeof.c"
+.LiteralString53:
+  .string  "sizeof(gar2)"
+.LiteralString54:
+  .string  "test/sizeof.c"
+.LiteralString55:
+  .string  "sizeof(gar2[0])"
+.LiteralString56:
+  .string  "test/sizeof.c"
+.LiteralString57:
+  .string  "sizeof(gar3[0][0])"
+.LiteralString58:
+  .string  "test/sizeof.c"
+.LiteralString59:
+  .string  "foo"
+.LiteralString60:
+  .string  "sizeof(\"foo\")"
+.LiteralString61:
+  .string  "test/sizeof.c"
+.LiteralString62:
+  .string  "\n"
+.LiteralString63:
+  .string  "sizeof(\"\\n\")"
+.LiteralString64:
+  .string  "test/sizeof.c"
+.LiteralString65:
+  .string  "\t"
+.LiteralString66:
+  .string  "sizeof(\"\\t\")"
+.LiteralString67:
+  .string  "test/sizeof.c"
+.LiteralString68:
+  .string  "\\"
+.LiteralString69:
+  .string  "sizeof(\"\\\\\")"
+.LiteralString70:
+  .string  "test/sizeof.c"
+.LiteralString71:
+  .string  "\""
+.LiteralString72:
+  .string  "sizeof(\"\\\"\")"
+.globl gar3
+gar3:
+  .zero 96
+.globl gar2
+gar2:
+  .zero 24
+.globl gar1
+gar1:
+  .zero 8
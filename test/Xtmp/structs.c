@@ -0,0 +1,242 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+struct GStruct {};
+struct GStruct gObj;
+struct {int n[2]; char s[3];} gObjWithoutTag;
+void test_decl_global_struct_var(void) {
+    struct GStruct obj;
+}
+void test_decl_local_struct_var(void) {
+    struct LStruct {
+        int n;
+        int array[1][2][3], *p, **pp;
+    };
+    struct LStruct obj;
+}
+void test_sizeof_struct(void) {
+    struct S0 {};
+    struct S1 {
+        int n;
+    };
+    struct S2 {
+        char c;
+        int n;
+    };
+    struct S3 {
+        struct S2 s2;
+        char c;
+    };
+    assert("test/structs.c", 34, (0), (sizeof(struct S0)), "sizeof(struct S0)");
+    assert("test/structs.c", 35, (4), (sizeof(struct S1)), "sizeof(struct S1)");
+    assert("test/structs.c", 36, (8), (sizeof(struct S2)), "sizeof(struct S2)");
+    assert("test/structs.c", 37, (12), (sizeof(struct S3)), "sizeof(struct S3)");
+}
+void test_struct_member_access(void) {
+    struct S1 {
+        int n;
+        int m;
+        char c;
+        int o;
+    };
+    struct S2 {
+        int n;
+        struct S1 s1;
+        int m;
+    };
+    struct S3 {
+        int n;
+        struct S2 *ps2;
+        int m;
+    };
+    struct S1 s1;
+    struct S2 s2;
+    struct S3 s3;
+    s1.n = 7;
+    s1.m = 11;
+    s1.c = 13;
+    s1.o = 17;
+    assert("test/structs.c", 67, (7), (s1.n), "s1.n");
+    assert("test/structs.c", 68, (11), (s1.m), "s1.m");
+    assert("test/structs.c", 69, (13), (s1.c), "s1.c");
+    assert("test/structs.c", 70, (17), (s1.o), "s1.o");
+    s2.n = 19;
+    s2.s1.n = 23;
+    s2.s1.m = 29;
+    s2.s1.c = 31;
+    s2.s1.o = 37;
+    s2.m = 41;
+    assert("test/structs.c", 79, (19), (s2.n), "s2.n");
+    assert("test/structs.c", 80, (23), (s2.s1.n), "s2.s1.n");
+    assert("test/structs.c", 81, (29), (s2.s1.m), "s2.s1.m");
+    assert("test/structs.c", 82, (31), (s2.s1.c), "s2.s1.c");
+    assert("test/structs.c", 83, (37), (s2.s1.o), "s2.s1.o");
+    assert("test/structs.c", 84, (41), (s2.m), "s2.m");
+    s3.n = 43;
+    s3.m = 47;
+    s3.ps2 = &s2;
+    assert("test/structs.c", 90, (43), (s3.n), "s3.n");
+    assert("test/structs.c", 91, (47), (s3.m), "s3.m");
+    assert("test/structs.c", 92, (19), ((*s3.ps2).n), "(*s3.ps2).n");
+    assert("test/structs.c", 93, (23), ((*s3.ps2).s1.n), "(*s3.ps2).s1.n");
+    assert("test/structs.c", 94, (29), ((*s3.ps2).s1.m), "(*s3.ps2).s1.m");
+    assert("test/structs.c", 95, (31), ((*s3.ps2).s1.c), "(*s3.ps2).s1.c");
+    assert("test/structs.c", 96, (37), ((*s3.ps2).s1.o), "(*s3.ps2).s1.o");
+    assert("test/structs.c", 97, (41), ((*s3.ps2).m), "(*s3.ps2).m");
+    assert("test/structs.c", 98, (19), (s3.ps2->n), "s3.ps2->n");
+    assert("test/structs.c", 99, (23), (s3.ps2->s1.n), "s3.ps2->s1.n");
+}
+void test_decl_local_struct_without_tag(void) {
+    struct S {
+        int n;
+        char c;
+    } obj = {3, 'a'}, zero = {};
+    assert("test/structs.c", 108, (3), (obj.n), "obj.n");
+    assert("test/structs.c", 109, (97), (obj.c), "obj.c");
+    assert("test/structs.c", 110, (0), (zero.n), "zero.n");
+    assert("test/structs.c", 111, (0), (zero.c), "zero.c");
+}
+void test_decl_global_struct_without_tag(void) {
+    assert("test/structs.c", 115, (0), (gObjWithoutTag.n[0]), "gObjWithoutTag.n[0]");
+    assert("test/structs.c", 116, (0), (gObjWithoutTag.n[1]), "gObjWithoutTag.n[1]");
+    assert("test/structs.c", 117, (0), (gObjWithoutTag.s[0]), "gObjWithoutTag.s[0]");
+    assert("test/structs.c", 118, (0), (gObjWithoutTag.s[1]), "gObjWithoutTag.s[1]");
+    assert("test/structs.c", 119, (0), (gObjWithoutTag.s[2]), "gObjWithoutTag.s[2]");
+}
+void test_struct_assign(void) {
+    typedef struct S {
+        int a[5];
+        char c;
+        int n;
+    } S;
+    S s1 = {{11, 13, 17, 19, 23}, 'a', 29};
+    S s2 = {}, s3 = {};
+    s3 = s2 = s1;
+    assert("test/structs.c", 132, (11), (s2.a[0]), "s2.a[0]");
+    assert("test/structs.c", 133, (13), (s2.a[1]), "s2.a[1]");
+    assert("test/structs.c", 134, (17), (s2.a[2]), "s2.a[2]");
+    assert("test/structs.c", 135, (19), (s2.a[3]), "s2.a[3]");
+    assert("test/structs.c", 136, (23), (s2.a[4]), "s2.a[4]");
+    assert("test/structs.c", 137, (97), (s2.c), "s2.c");
+    assert("test/structs.c", 138, (29), (s2.n), "s2.n");
+    assert("test/structs.c", 139, (11), (s3.a[0]), "s3.a[0]");
+    assert("test/structs.c", 140, (13), (s3.a[1]), "s3.a[1]");
+    assert("test/structs.c", 141, (17), (s3.a[2]), "s3.a[2]");
+    assert("test/structs.c", 142, (19), (s3.a[3]), "s3.a[3]");
+    assert("test/structs.c", 143, (23), (s3.a[4]), "s3.a[4]");
+    assert("test/structs.c", 144, (97), (s3.c), "s3.c");
+    assert("test/structs.c", 145, (29), (s3.n), "s3.n");
+    assert("test/structs.c", 146, (11), (s1.a[0]), "s1.a[0]");
+    assert("test/structs.c", 147, (13), (s1.a[1]), "s1.a[1]");
+    assert("test/structs.c", 148, (17), (s1.a[2]), "s1.a[2]");
+    assert("test/structs.c", 149, (19), (s1.a[3]), "s1.a[3]");
+    assert("test/structs.c", 150, (23), (s1.a[4]), "s1.a[4]");
+    assert("test/structs.c", 151, (97), (s1.c), "s1.c");
+    assert("test/structs.c", 152, (29), (s1.n), "s1.n");
+    s1.a[2] = 31;
+    assert("test/structs.c", 155, (31), (s1.a[2]), "s1.a[2]");
+    assert("test/structs.c", 156, (17), (s2.a[2]), "s2.a[2]");
+}
+void test_compound_literal(void) {
+    typedef struct S {
+        int n;
+        int m;
+    } S;
+    {
+        S s;
+        s = (S){13, 19};
+        assert("test/structs.c", 167, (13), (s.n), "s.n");
+        assert("test/structs.c", 168, (19), (s.m), "s.m");
+    }
+    {
+        S s = (S){23, 29};
+        assert("test/structs.c", 172, (23), (s.n), "s.n");
+        assert("test/structs.c", 173, (29), (s.m), "s.m");
+    }
+    {
+        int m = (S){31, 37}.m;
+        assert("test/structs.c", 177, (37), (m), "m");
+    }
+    {
+        S s1 = {}, s2 = {41, 43};
+        s1 = (S){47, 53} = s2;
+        assert("test/structs.c", 182, (41), (s1.n), "s1.n");
+        assert("test/structs.c", 183, (43), (s1.m), "s1.m");
+    }
+    {
+        int m = (&(S){57, 59})->m;
+        assert("test/structs.c", 187, (57), (m), "m");
+    }
+}
+void test_compare_struct_pointers(void) {
+    struct S {} a;
+    assert("test/structs.c", 193, (1), (&a == &a), "&a == &a");
+}
+void testUseStructImmediately(void) {
+    struct S {
+        int a;
+        struct S *s;
+    };
+    struct S inner = (struct S){11, (struct S*)0};
+    struct S obj = {5, &inner};
+    assert("test/structs.c", 204, (5), (obj.a), "obj.a");
+    assert("test/structs.c", 205, (11), (obj.s->a), "obj.s->a");
+    assert("test/structs.c", 206, (1), ((struct S*)0 == obj.s->s), "(struct S*)0 == obj.s->s");
+}
+void test_struct_assign_to_member_from_ptr(void) {
+    struct A {
+        int n, m;
+    };
+    struct B {
+        int x;
+        struct A a;
+    };
+    struct A a = { 5, 13 };
+    struct B b = {};
+    struct A *ap = &a;
+    b.a = *ap;
+    assert("test/structs.c", 225, (5), (b.a.n), "b.a.n");
+    assert("test/structs.c", 226, (13), (b.a.m), "b.a.m");
+}
+void test_struct_assign_large(void) {
+    struct Medium {
+        int n[9];
+        char c;
+    } m1, m2;
+    struct Large {
+        char s[300];
+        int tail;
+    } l1, l2;
+    for (int i = 0; i < 9; ++i)
+        m1.n[i] = i * 3;
+    m1.c = 'm';
+    for (int i = 0; i < 300; ++i)
+        l1.s[i] = i % 100;
+    l1.tail = 4242;
+    m2 = m1;
+    l2 = l1;
+    assert("test/structs.c", 246, (0), (m2.n[0]), "m2.n[0]");
+    assert("test/structs.c", 247, (24), (m2.n[8]), "m2.n[8]");
+    assert("test/structs.c", 248, ('m'), (m2.c), "m2.c");
+    assert("test/structs.c", 249, (0), (l2.s[0]), "l2.s[0]");
+    assert("test/structs.c", 250, (99), (l2.s[299]), "l2.s[299]");
+    assert("test/structs.c", 251, (55), (l2.s[155]), "l2.s[155]");
+    assert("test/structs.c", 252, (4242), (l2.tail), "l2.tail");
+}
+int main(void) {
+    test_decl_global_struct_var();
+    test_decl_local_struct_var();
+    test_sizeof_struct();
+    test_struct_member_access();
+    test_decl_local_struct_without_tag();
+    test_decl_global_struct_without_tag();
+    test_struct_assign();
+    test_compare_struct_pointers();
+    testUseStructImmediately();
+    test_struct_assign_to_member_from_ptr();
+    test_struct_assign_large();
+    return 0;
+}
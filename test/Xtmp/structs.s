@@ -0,0 +1,1891 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl test_decl_global_struct_var
+test_decl_global_struct_var:
+.Lreturn_test_decl_global_struct_var:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_decl_local_struct_var
+test_decl_local_struct_var:
+.Lreturn_test_decl_local_struct_var:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_sizeof_struct
+test_sizeof_struct:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 34
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 35
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 36
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 37
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_sizeof_struct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_struct_member_access
+test_struct_member_access:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov rdi, 7
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 67
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 68
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 69
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 70
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 19
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 31
+  lea rax, QWORD PTR -28[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 37
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 41
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 79
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 80
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 81
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 82
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 83
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 84
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 43
+  lea rax, QWORD PTR -64[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 47
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 43
+  mov rsi, 90
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 47
+  mov rsi, 91
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 92
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 93
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 94
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  add rax, 8
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 95
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 96
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 97
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 98
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 99
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_struct_member_access:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_decl_local_struct_without_tag
+test_decl_local_struct_without_tag:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 97
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 108
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 109
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 110
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_decl_local_struct_without_tag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_decl_global_struct_without_tag
+test_decl_global_struct_without_tag:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gObjWithoutTag[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 115
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gObjWithoutTag[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 116
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gObjWithoutTag[rip]
+  add rax, 8
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 117
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gObjWithoutTag[rip]
+  add rax, 8
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 118
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gObjWithoutTag[rip]
+  add rax, 8
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 119
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_decl_global_struct_without_tag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_struct_assign
+test_struct_assign:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  lea rdi, QWORD PTR -28[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov DWORD PTR 24[rdi], 0
+  mov rdi, 11
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 12[rax], edi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 16[rax], edi
+  mov rax, rdi
+  mov rdi, 97
+  lea rax, QWORD PTR -8[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov DWORD PTR 24[rdi], 0
+  lea rdi, QWORD PTR -84[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov DWORD PTR 24[rdi], 0
+  lea rax, QWORD PTR -84[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov rdx, QWORD PTR 16[rsi]
+  mov QWORD PTR 16[rdi], rdx
+  mov edx, DWORD PTR 24[rsi]
+  mov DWORD PTR 24[rdi], edx
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov rdx, QWORD PTR 16[rsi]
+  mov QWORD PTR 16[rdi], rdx
+  mov edx, DWORD PTR 24[rsi]
+  mov DWORD PTR 24[rdi], edx
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 132
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 133
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 134
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 135
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 136
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 137
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 138
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 139
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 140
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 141
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 142
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 143
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 144
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 145
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 146
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 147
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 148
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 149
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 150
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 151
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 152
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 31
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 31
+  mov rsi, 155
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 156
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_struct_assign:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_compound_literal
+test_compound_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rax, QWORD PTR -8[rbp]
+  mov rcx, rax
+  mov rdi, 13
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 167
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 168
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rcx, rax
+  mov rdi, 23
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 172
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 173
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 31
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 37
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 177
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 41
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 43
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rcx, rax
+  mov rdi, 47
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 53
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 182
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 43
+  mov rsi, 183
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 57
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 59
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 57
+  mov rsi, 187
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_compound_literal:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_compare_struct_pointers
+test_compare_struct_pointers:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov r8, rax
+  lea rax, QWORD PTR 0[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR 0[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 193
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_compare_struct_pointers:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testUseStructImmediately
+testUseStructImmediately:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -16[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rax, QWORD PTR -16[rbp]
+  mov rcx, rax
+  mov rdi, 11
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -48[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov rdi, 5
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 204
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 205
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 206
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testUseStructImmediately:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_struct_assign_to_member_from_ptr
+test_struct_assign_to_member_from_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 5
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 225
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString139[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 226
+  lea rax, QWORD PTR .LiteralString138[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_struct_assign_to_member_from_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_struct_assign_large
+test_struct_assign_large:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 704
+  lea rdi, QWORD PTR -692[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -692[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jge .Lend0
+  .p2align 4
+.Lbegin0:
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov DWORD PTR 0[rsi+rax*4], edi
+  mov rax, rdi
+.Literator0:
+  lea rax, QWORD PTR -692[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jl .Lbegin0
+.Lend0:
+  mov rdi, 109
+  lea rax, QWORD PTR -4[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -692[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -692[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 300
+  jge .Lend1
+  .p2align 4
+.Lbegin1:
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xa3d70a3e
+  imul rdi, rax
+  sar rdi, 38
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  imul rdi, 100
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -384[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+.Literator1:
+  lea rax, QWORD PTR -692[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -692[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 300
+  jl .Lbegin1
+.Lend1:
+  mov rdi, 4242
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  mov rdx, QWORD PTR 32[rsi]
+  mov QWORD PTR 32[rdi], rdx
+  lea rax, QWORD PTR -688[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -384[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov rcx, 38
+  rep movsq
+  lea rax, QWORD PTR .LiteralString141[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 246
+  lea rax, QWORD PTR .LiteralString140[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString143[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov eax, DWORD PTR 32[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 24
+  mov rsi, 247
+  lea rax, QWORD PTR .LiteralString142[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString145[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 109
+  mov rsi, 248
+  lea rax, QWORD PTR .LiteralString144[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString147[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -688[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 249
+  lea rax, QWORD PTR .LiteralString146[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString149[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -688[rbp]
+  mov al, BYTE PTR 299[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 99
+  mov rsi, 250
+  lea rax, QWORD PTR .LiteralString148[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString151[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -688[rbp]
+  mov al, BYTE PTR 155[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 55
+  mov rsi, 251
+  lea rax, QWORD PTR .LiteralString150[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -388[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4242
+  mov rsi, 252
+  lea rax, QWORD PTR .LiteralString152[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_struct_assign_large:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call test_decl_global_struct_var
+  mov al, 0
+  call test_decl_local_struct_var
+  mov al, 0
+  call test_sizeof_struct
+  mov al, 0
+  call test_struct_member_access
+  mov al, 0
+  call test_decl_local_struct_without_tag
+  mov al, 0
+  call test_decl_global_struct_without_tag
+  mov al, 0
+  call test_struct_assign
+  mov al, 0
+  call test_compare_struct_pointers
+  mov al, 0
+  call testUseStructImmediately
+  mov al, 0
+  call test_struct_assign_to_member_from_ptr
+  mov al, 0
+  call test_struct_assign_large
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/structs.c"
+.LiteralString1:
+  .string  "sizeof(struct S0)"
+.LiteralString2:
+  .string  "test/structs.c"
+.LiteralString3:
+  .string  "sizeof(struct S1)"
+.LiteralString4:
+  .string  "test/structs.c"
+.LiteralString5:
+  .string  "sizeof(struct S2)"
+.LiteralString6:
+  .string  "test/structs.c"
+.LiteralString7:
+  .string  "sizeof(struct S3)"
+.LiteralString8:
+  .string  "test/structs.c"
+.LiteralString9:
+  .string  "s1.n"
+.LiteralString10:
+  .string  "test/structs.c"
+.LiteralString11:
+  .string  "s1.m"
+.LiteralString12:
+  .string  "test/structs.c"
+.LiteralString13:
+  .string  "s1.c"
+.LiteralString14:
+  .string  "test/structs.c"
+.LiteralString15:
+  .string  "s1.o"
+.LiteralString16:
+  .string  "test/structs.c"
+.LiteralString17:
+  .string  "s2.n"
+.LiteralString18:
+  .string  "test/structs.c"
+.LiteralString19:
+  .string  "s2.s1.n"
+.LiteralString20:
+  .string  "test/structs.c"
+.LiteralString21:
+  .string  "s2.s1.m"
+.LiteralString22:
+  .string  "test/structs.c"
+.LiteralString23:
+  .string  "s2.s1.c"
+.LiteralString24:
+  .string  "test/structs.c"
+.LiteralString25:
+  .string  "s2.s1.o"
+.LiteralString26:
+  .string  "test/structs.c"
+.LiteralString27:
+  .string  "s2.m"
+.LiteralString28:
+  .string  "test/structs.c"
+.LiteralString29:
+  .string  "s3.n"
+.LiteralString30:
+  .string  "test/structs.c"
+.LiteralString31:
+  .string  "s3.m"
+.LiteralString32:
+  .string  "test/structs.c"
+.LiteralString33:
+  .string  "(*s3.ps2).n"
+.LiteralString34:
+  .string  "test/structs.c"
+.LiteralString35:
+  .string  "(*s3.ps2).s1.n"
+.LiteralString36:
+  .string  "test/structs.c"
+.LiteralString37:
+  .string  "(*s3.ps2).s1.m"
+.LiteralString38:
+  .string  "test/structs.c"
+.LiteralString39:
+  .string  "(*s3.ps2).s1.c"
+.LiteralString40:
+  .string  "test/structs.c"
+.LiteralString41:
+  .string  "(*s3.ps2).s1.o"
+.LiteralString42:
+  .string  "test/structs.c"
+.LiteralString43:
+  .string  "(*s3.ps2).m"
+.LiteralString44:
+  .string  "test/structs.c"
+.LiteralString45:
+  .string  "s3.ps2->n"
+.LiteralString46:
+  .string  "test/structs.c"
+.LiteralString47:
+  .string  "s3.ps2->s1.n"
+.LiteralString48:
+  .string  "test/structs.c"
+.LiteralString49:
+  .string  "obj.n"
+.LiteralString50:
+  .string  "test/structs.c"
+.LiteralString51:
+  .string  "obj.c"
+.LiteralString52:
+  .string  "test/structs.c"
+.LiteralString53:
+  .string  "zero.n"
+.LiteralString54:
+  .string  "test/structs.c"
+.LiteralString55:
+  .string  "zero.c"
+.LiteralString56:
+  .string  "test/structs.c"
+.LiteralString57:
+  .string  "gObjWithoutTag.n[0]"
+.LiteralString58:
+  .string  "test/structs.c"
+.LiteralString59:
+  .string  "gObjWithoutTag.n[1]"
+.LiteralString60:
+  .string  "test/structs.c"
+.LiteralString61:
+  .string  "gObjWithoutTag.s[0]"
+.LiteralString62:
+  .string  "test/structs.c"
+.LiteralString63:
+  .string  "gObjWithoutTag.s[1]"
+.LiteralString64:
+  .string  "test/structs.c"
+.LiteralString65:
+  .string  "gObjWithoutTag.s[2]"
+.LiteralString66:
+  .string  "test/structs.c"
+.LiteralString67:
+  .string  "s2.a[0]"
+.LiteralString68:
+  .string  "test/structs.c"
+.LiteralString69:
+  .string  "s2.a[1]"
+.LiteralString70:
+  .string  "test/structs.c"
+.LiteralString71:
+  .string  "s2.a[2]"
+.LiteralString72:
+  .string  "test/structs.c"
+.LiteralString73:
+  .string  "s2.a[3]"
+.LiteralString74:
+  .string  "test/structs.c"
+.LiteralString75:
+  .string  "s2.a[4]"
+.LiteralString76:
+  .string  "test/structs.c"
+.LiteralString77:
+  .string  "s2.c"
+.LiteralString78:
+  .string  "test/structs.c"
+.LiteralString79:
+  .string  "s2.n"
+.LiteralString80:
+  .string  "test/structs.c"
+.LiteralString81:
+  .string  "s3.a[0]"
+.LiteralString82:
+  .string  "test/structs.c"
+.LiteralString83:
+  .string  "s3.a[1]"
+.LiteralString84:
+  .string  "test/structs.c"
+.LiteralString85:
+  .string  "s3.a[2]"
+.LiteralString86:
+  .string  "test/structs.c"
+.LiteralString87:
+  .string  "s3.a[3]"
+.LiteralString88:
+  .string  "test/structs.c"
+.LiteralString89:
+  .string  "s3.a[4]"
+.LiteralString90:
+  .string  "test/structs.c"
+.LiteralString91:
+  .string  "s3.c"
+.LiteralString92:
+  .string  "test/structs.c"
+.LiteralString93:
+  .string  "s3.n"
+.LiteralString94:
+  .string  "test/structs.c"
+.LiteralString95:
+  .string  "s1.a[0]"
+.LiteralString96:
+  .string  "test/structs.c"
+.LiteralString97:
+  .string  "s1.a[1]"
+.LiteralString98:
+  .string  "test/structs.c"
+.LiteralString99:
+  .string  "s1.a[2]"
+.LiteralString100:
+  .string  "test/structs.c"
+.LiteralString101:
+  .string  "s1.a[3]"
+.LiteralString102:
+  .string  "test/structs.c"
+.LiteralString103:
+  .string  "s1.a[4]"
+.LiteralString104:
+  .string  "test/structs.c"
+.LiteralString105:
+  .string  "s1.c"
+.LiteralString106:
+  .string  "test/structs.c"
+.LiteralString107:
+  .string  "s1.n"
+.LiteralString108:
+  .string  "test/structs.c"
+.LiteralString109:
+  .string  "s1.a[2]"
+.LiteralString110:
+  .string  "test/structs.c"
+.LiteralString111:
+  .string  "s2.a[2]"
+.LiteralString112:
+  .string  "test/structs.c"
+.LiteralString113:
+  .string  "s.n"
+.LiteralString114:
+  .string  "test/structs.c"
+.LiteralString115:
+  .string  "s.m"
+.LiteralString116:
+  .string  "test/structs.c"
+.LiteralString117:
+  .string  "s.n"
+.LiteralString118:
+  .string  "test/structs.c"
+.LiteralString119:
+  .string  "s.m"
+.LiteralString120:
+  .string  "test/structs.c"
+.LiteralString121:
+  .string  "m"
+.LiteralString122:
+  .string  "test/structs.c"
+.LiteralString123:
+  .string  "s1.n"
+.LiteralString124:
+  .string  "test/structs.c"
+.LiteralString125:
+  .string  "s1.m"
+.LiteralString126:
+  .string  "test/structs.c"
+.LiteralString127:
+  .string  "m"
+.LiteralString128:
+  .string  "test/structs.c"
+.LiteralString129:
+  .string  "&a == &a"
+.LiteralString130:
+  .string  "test/structs.c"
+.LiteralString131:
+  .string  "obj.a"
+.LiteralString132:
+  .string  "test/structs.c"
+.LiteralString133:
+  .string  "obj.s->a"
+.LiteralString134:
+  .string  "test/structs.c"
+.LiteralString135:
+  .string  "(struct S*)0 == obj.s->s"
+.LiteralString136:
+  .string  "test/structs.c"
+.LiteralString137:
+  .string  "b.a.n"
+.LiteralString138:
+  .string  "test/structs.c"
+.LiteralString139:
+  .string  "b.a.m"
+.LiteralString140:
+  .string  "test/structs.c"
+.LiteralString141:
+  .string  "m2.n[0]"
+.LiteralString142:
+  .string  "test/structs.c"
+.LiteralString143:
+  .string  "m2.n[8]"
+.LiteralString144:
+  .string  "test/structs.c"
+.LiteralString145:
+  .string  "m2.c"
+.LiteralString146:
+  .string  "test/structs.c"
+.LiteralString147:
+  .string  "l2.s[0]"
+.LiteralString148:
+  .string  "test/structs.c"
+.LiteralString149:
+  .string  "l2.s[299]"
+.LiteralString150:
+  .string  "test/structs.c"
+.LiteralString151:
+  .string  "l2.s[155]"
+.LiteralString152:
+  .string  "test/structs.c"
+.LiteralString153:
+  .string  "l2.tail"
+.globl gObjWithoutTag
+gObjWithoutTag:
+  .zero 12
+.globl gObj
+gObj:
+  .zero 0
@@ -0,0 +1 @@
+static int main(void) { return 0;}
@@ -0,0 +1,9 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+main:
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  ret
+.section .note.GNU-stack,"",@progbits
@@ -0,0 +1 @@
+int f(int n1, int n2, int n3, int n4, int n5, int n6, int n7, int n8); int main(void) {return f(1, 2, 3, 4, 5, 6, 7, 8);}
@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  push 8
+  push 7
+  mov rax, 6
+  mov r8, 5
+  mov rcx, 4
+  mov r9, 3
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call f
+  add rsp, 16
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
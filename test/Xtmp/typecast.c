@@ -0,0 +1,37 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+void testBasicTypeCastWithPrimitiveType(void) {
+    {
+        int n = 19 + 256 + 512;
+        assert("test/typecast.c", 6, (787), (n), "n");
+        n = (int)(char)n;
+        assert("test/typecast.c", 8, (19), (n), "n");
+    }
+    {
+        char c = 'a';
+        int n = (int)c;
+        assert("test/typecast.c", 13, (97), (n), "n");
+    }
+}
+void testBasicTypeCastWithPointerType(void) {
+    int n = 13;
+    void *pVoid = (void *)&n;
+    int *pInt = (int *)pVoid;
+    assert("test/typecast.c", 22, (13), (n), "n");
+    assert("test/typecast.c", 23, (1), (pInt == &n), "pInt == &n");
+    assert("test/typecast.c", 24, (13), (*pInt), "*pInt");
+    assert("test/typecast.c", 25, (13), (*(int *)pVoid), "*(int *)pVoid");
+    *pInt = 17;
+    assert("test/typecast.c", 28, (17), (n), "n");
+    *(int *)pVoid = 23;
+    assert("test/typecast.c", 31, (23), (n), "n");
+}
+int main(void) {
+    testBasicTypeCastWithPrimitiveType();
+    testBasicTypeCastWithPointerType();
+    return 0;
+}
@@ -0,0 +1,265 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testBasicTypeCastWithPrimitiveType
+testBasicTypeCastWithPrimitiveType:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 787
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 787
+  mov rsi, 6
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, al
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 8
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -1[rbp]
+  mov BYTE PTR 0[rdi], 0
+  mov rdi, 97
+  lea rax, QWORD PTR -1[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 13
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testBasicTypeCastWithPrimitiveType:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testBasicTypeCastWithPointerType
+testBasicTypeCastWithPointerType:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 22
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 23
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 24
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 17
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 28
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 23
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 31
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testBasicTypeCastWithPointerType:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testBasicTypeCastWithPrimitiveType
+  mov al, 0
+  call testBasicTypeCastWithPointerType
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/typecast.c"
+.LiteralString1:
+  .string  "n"
+.LiteralString2:
+  .string  "test/typecast.c"
+.LiteralString3:
+  .string  "n"
+.LiteralString4:
+  .string  "test/typecast.c"
+.LiteralString5:
+  .string  "n"
+.LiteralString6:
+  .string  "test/typecast.c"
+.LiteralString7:
+  .string  "n"
+.LiteralString8:
+  .string  "test/typecast.c"
+.LiteralString9:
+  .string  "pInt == &n"
+.LiteralString10:
+  .string  "test/typecast.c"
+.LiteralString11:
+  .string  "*pInt"
+.LiteralString12:
+  .string  "test/typecast.c"
+.LiteralString13:
+  .string  "*(int *)pVoid"
+.LiteralString14:
+  .string  "test/typecast.c"
+.LiteralString15:
+  .string  "n"
+.LiteralString16:
+  .string  "test/typecast.c"
+.LiteralString17:
+  .string  "n"
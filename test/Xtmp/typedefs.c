@@ -0,0 +1,143 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+typedef char* GCharPtr;
+GCharPtr gCharPtr;
+void testGlobalTypedefPrimitive(void) {
+    char c = 7;
+    gCharPtr = &c;
+    assert("test/typedefs.c", 10, (7), (c), "c");
+    assert("test/typedefs.c", 11, (7), (*gCharPtr), "*gCharPtr");
+    *gCharPtr = 19;
+    assert("test/typedefs.c", 14, (19), (c), "c");
+    assert("test/typedefs.c", 16, (8), (sizeof(GCharPtr)), "sizeof(GCharPtr)");
+    assert("test/typedefs.c", 17, (8), (sizeof(gCharPtr)), "sizeof(gCharPtr)");
+}
+void testTypedefPrimitive(void) {
+    typedef int* IntPtr;
+    int n = 13;
+    IntPtr p = &n;
+    assert("test/typedefs.c", 25, (13), (n), "n");
+    assert("test/typedefs.c", 26, (13), (*p), "*p");
+    *p = 17;
+    assert("test/typedefs.c", 29, (17), (n), "n");
+    assert("test/typedefs.c", 31, (8), (sizeof(IntPtr)), "sizeof(IntPtr)");
+    assert("test/typedefs.c", 32, (8), (sizeof(p)), "sizeof(p)");
+}
+void testTypedefStruct(void) {
+    struct Struct1 {
+        int n;
+        int m;
+    };
+    typedef struct Struct1 S1;
+    typedef struct Struct2 S2;
+    struct Struct2 {
+        S1 s1;
+    };
+    {
+        S1 s1;
+        s1.n = 5;
+        s1.m = 7;
+        assert("test/typedefs.c", 52, (5), (s1.n), "s1.n");
+        assert("test/typedefs.c", 53, (7), (s1.m), "s1.m");
+    }
+    {
+        S2 s2;
+        s2.s1.n = 11;
+        s2.s1.m = 13;
+        assert("test/typedefs.c", 61, (11), (s2.s1.n), "s2.s1.n");
+        assert("test/typedefs.c", 62, (13), (s2.s1.m), "s2.s1.m");
+    }
+    {
+        S1 s1 = {19};
+        S2 s2 = {{23, 29}};
+        assert("test/typedefs.c", 68, (19), (s1.n), "s1.n");
+        assert("test/typedefs.c", 69, (0), (s1.m), "s1.m");
+        assert("test/typedefs.c", 70, (23), (s2.s1.n), "s2.s1.n");
+        assert("test/typedefs.c", 71, (29), (s2.s1.m), "s2.s1.m");
+    }
+    assert("test/typedefs.c", 74, (8), (sizeof(S1)), "sizeof(S1)");
+    assert("test/typedefs.c", 75, (8), (sizeof(S2)), "sizeof(S2)");
+}
+void testTypedefStructInPlace(void) {
+    typedef struct {
+        int n;
+        int m;
+    } S1;
+    typedef struct {
+        S1 s1;
+    } S2;
+    {
+        S1 s1;
+        s1.n = 5;
+        s1.m = 7;
+        assert("test/typedefs.c", 93, (5), (s1.n), "s1.n");
+        assert("test/typedefs.c", 94, (7), (s1.m), "s1.m");
+    }
+    {
+        S2 s2;
+        s2.s1.n = 11;
+        s2.s1.m = 13;
+        assert("test/typedefs.c", 102, (11), (s2.s1.n), "s2.s1.n");
+        assert("test/typedefs.c", 103, (13), (s2.s1.m), "s2.s1.m");
+    }
+    {
+        S1 s1 = {19};
+        S2 s2 = {{23, 29}};
+        assert("test/typedefs.c", 109, (19), (s1.n), "s1.n");
+        assert("test/typedefs.c", 110, (0), (s1.m), "s1.m");
+        assert("test/typedefs.c", 111, (23), (s2.s1.n), "s2.s1.n");
+        assert("test/typedefs.c", 112, (29), (s2.s1.m), "s2.s1.m");
+    }
+    assert("test/typedefs.c", 115, (8), (sizeof(S1)), "sizeof(S1)");
+    assert("test/typedefs.c", 116, (8), (sizeof(S2)), "sizeof(S2)");
+}
+void testTypedefEnum(void) {
+    typedef enum Enum1 E1;
+    enum Enum1 {
+        ItemA,
+        ItemB,
+    };
+    E1 v = ItemB;
+    assert("test/typedefs.c", 128, (1), (v), "v");
+    assert("test/typedefs.c", 129, (4), (sizeof(enum Enum1)), "sizeof(enum Enum1)");
+    assert("test/typedefs.c", 130, (4), (sizeof(E1)), "sizeof(E1)");
+}
+void testTypedefEnumInPlace(void) {
+    typedef enum {
+        ItemX,
+        ItemY,
+        ItemZ
+    } Enum;
+    Enum v = ItemZ;
+    assert("test/typedefs.c", 142, (2), (v), "v");
+    assert("test/typedefs.c", 143, (4), (sizeof(Enum)), "sizeof(Enum)");
+}
+void testTypedefIncompleteArray(void) {
+    typedef int Int[];
+    Int a1 = {3, 5};
+    Int a2 = {7};
+    assert("test/typedefs.c", 151, (3), (a1[0]), "a1[0]");
+    assert("test/typedefs.c", 152, (5), (a1[1]), "a1[1]");
+    assert("test/typedefs.c", 153, (7), (a2[0]), "a2[0]");
+    assert("test/typedefs.c", 154, (8), (sizeof(a1)), "sizeof(a1)");
+    assert("test/typedefs.c", 155, (4), (sizeof(a2)), "sizeof(a2)");
+}
+typedef int GInt[3];
+void helperFuncTakeGInt(GInt);
+void testTypeNotRewritten(void) {
+    assert("test/typedefs.c", 162, (12), (sizeof(GInt)), "sizeof(GInt)");
+}
+int main(void) {
+    testGlobalTypedefPrimitive();
+    testTypedefPrimitive();
+    testTypedefStruct();
+    testTypedefStructInPlace();
+    testTypedefEnum();
+    testTypedefEnumInPlace();
+    testTypeNotRewritten();
+    return 0;
+}
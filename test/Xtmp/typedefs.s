@@ -0,0 +1,896 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl testGlobalTypedefPrimitive
+testGlobalTypedefPrimitive:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -1[rbp]
+  mov BYTE PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -1[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -1[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR gCharPtr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 10
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gCharPtr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 11
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 19
+  lea rax, QWORD PTR gCharPtr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 14
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 16
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 17
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testGlobalTypedefPrimitive:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedefPrimitive
+testTypedefPrimitive:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 26
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 17
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 29
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 31
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 32
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypedefPrimitive:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedefStruct
+testTypedefStruct:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 5
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 52
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 53
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 61
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 62
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 19
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 23
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 68
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 69
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 70
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 71
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 74
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 75
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypedefStruct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedefStructInPlace
+testTypedefStructInPlace:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 5
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 93
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 94
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 11
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 102
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 103
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 19
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 23
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 109
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 110
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 112
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 115
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 116
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypedefStructInPlace:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedefEnum
+testTypedefEnum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 128
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 129
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 130
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypedefEnum:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedefEnumInPlace
+testTypedefEnumInPlace:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 2
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 142
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 143
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypedefEnumInPlace:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypedefIncompleteArray
+testTypedefIncompleteArray:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 3
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 5
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 7
+  mov DWORD PTR -16[rbp], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 151
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 152
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -16[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 153
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 154
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 4
+  mov rsi, 155
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypedefIncompleteArray:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testTypeNotRewritten
+testTypeNotRewritten:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov r8, rax
+  mov rcx, 12
+  mov r9, 12
+  mov rsi, 162
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testTypeNotRewritten:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testGlobalTypedefPrimitive
+  mov al, 0
+  call testTypedefPrimitive
+  mov al, 0
+  call testTypedefStruct
+  mov al, 0
+  call testTypedefStructInPlace
+  mov al, 0
+  call testTypedefEnum
+  mov al, 0
+  call testTypedefEnumInPlace
+  mov al, 0
+  call testTypeNotRewritten
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/typedefs.c"
+.LiteralString1:
+  .string  "c"
+.LiteralString2:
+  .string  "test/typedefs.c"
+.LiteralString3:
+  .string  "*gCharPtr"
+.LiteralString4:
+  .string  "test/typedefs.c"
+.LiteralString5:
+  .string  "c"
+.LiteralString6:
+  .string  "test/typedefs.c"
+.LiteralString7:
+  .string  "sizeof(GCharPtr)"
+.LiteralString8:
+  .string  "test/typedefs.c"
+.LiteralString9:
+  .string  "sizeof(gCharPtr)"
+.LiteralString10:
+  .string  "test/typedefs.c"
+.LiteralString11:
+  .string  "n"
+.LiteralString12:
+  .string  "test/typedefs.c"
+.LiteralString13:
+  .string  "*p"
+.LiteralString14:
+  .string  "test/typedefs.c"
+.LiteralString15:
+  .string  "n"
+.LiteralString16:
+  .string  "test/typedefs.c"
+.LiteralString17:
+  .string  "sizeof(IntPtr)"
+.LiteralString18:
+  .string  "test/typedefs.c"
+.LiteralString19:
+  .string  "sizeof(p)"
+.LiteralString20:
+  .string  "test/typedefs.c"
+.LiteralString21:
+  .string  "s1.n"
+.LiteralString22:
+  .string  "test/typedefs.c"
+.LiteralString23:
+  .string  "s1.m"
+.LiteralString24:
+  .string  "test/typedefs.c"
+.LiteralString25:
+  .string  "s2.s1.n"
+.LiteralString26:
+  .string  "test/typedefs.c"
+.LiteralString27:
+  .string  "s2.s1.m"
+.LiteralString28:
+  .string  "test/typedefs.c"
+.LiteralString29:
+  .string  "s1.n"
+.LiteralString30:
+  .string  "test/typedefs.c"
+.LiteralString31:
+  .string  "s1.m"
+.LiteralString32:
+  .string  "test/typedefs.c"
+.LiteralString33:
+  .string  "s2.s1.n"
+.LiteralString34:
+  .string  "test/typedefs.c"
+.LiteralString35:
+  .string  "s2.s1.m"
+.LiteralString36:
+  .string  "test/typedefs.c"
+.LiteralString37:
+  .string  "sizeof(S1)"
+.LiteralString38:
+  .string  "test/typedefs.c"
+.LiteralString39:
+  .string  "sizeof(S2)"
+.LiteralString40:
+  .string  "test/typedefs.c"
+.LiteralString41:
+  .string  "s1.n"
+.LiteralString42:
+  .string  "test/typedefs.c"
+.LiteralString43:
+  .string  "s1.m"
+.LiteralString44:
+  .string  "test/typedefs.c"
+.LiteralString45:
+  .string  "s2.s1.n"
+.LiteralString46:
+  .string  "test/typedefs.c"
+.LiteralString47:
+  .string  "s2.s1.m"
+.LiteralString48:
+  .string  "test/typedefs.c"
+.LiteralString49:
+  .string  "s1.n"
+.LiteralString50:
+  .string  "test/typedefs.c"
+.LiteralString51:
+  .string  "s1.m"
+.LiteralString52:
+  .string  "test/typedefs.c"
+.LiteralString53:
+  .string  "s2.s1.n"
+.LiteralString54:
+  .string  "test/typedefs.c"
+.LiteralString55:
+  .string  "s2.s1.m"
+.LiteralString56:
+  .string  "test/typedefs.c"
+.LiteralString57:
+  .string  "sizeof(S1)"
+.LiteralString58:
+  .string  "test/typedefs.c"
+.LiteralString59:
+  .string  "sizeof(S2)"
+.LiteralString60:
+  .string  "test/typedefs.c"
+.LiteralString61:
+  .string  "v"
+.LiteralString62:
+  .string  "test/typedefs.c"
+.LiteralString63:
+  .string  "sizeof(enum Enum1)"
+.LiteralString64:
+  .string  "test/typedefs.c"
+.LiteralString65:
+  .string  "sizeof(E1)"
+.LiteralString66:
+  .string  "test/typedefs.c"
+.LiteralString67:
+  .string  "v"
+.LiteralString68:
+  .string  "test/typedefs.c"
+.LiteralString69:
+  .string  "sizeof(Enum)"
+.LiteralString70:
+  .string  "test/typedefs.c"
+.LiteralString71:
+  .string  "a1[0]"
+.LiteralString72:
+  .string  "test/typedefs.c"
+.LiteralString73:
+  .string  "a1[1]"
+.LiteralString74:
+  .string  "test/typedefs.c"
+.LiteralString75:
+  .string  "a2[0]"
+.LiteralString76:
+  .string  "test/typedefs.c"
+.LiteralString77:
+  .string  "sizeof(a1)"
+.LiteralString78:
+  .string  "test/typedefs.c"
+.LiteralString79:
+  .string  "sizeof(a2)"
+.LiteralString80:
+  .string  "test/typedefs.c"
+.LiteralString81:
+  .string  "sizeof(GInt)"
+.globl gCharPtr
+gCharPtr:
+  .zero 8
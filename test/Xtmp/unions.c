@@ -0,0 +1,162 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+union GUnion {};
+void test_decl_global_union_var(void) {
+    union GUnion obj;
+}
+void test_decl_local_union_var(void) {
+    union LUnion {
+        int n;
+        int array[1][2][3], *p, **pp;
+    };
+    union LUnion obj;
+}
+void test_sizeof_union(void) {
+    union S0 {};
+    union S1 {
+        int n;
+    };
+    union S2 {
+        char c;
+        int n;
+        void *p;
+    };
+    union S3 {
+        char c;
+        union S2 s2;
+    };
+    assert("test/unions.c", 31, (0), (sizeof(union S0)), "sizeof(union S0)");
+    assert("test/unions.c", 32, (4), (sizeof(union S1)), "sizeof(union S1)");
+    assert("test/unions.c", 33, (8), (sizeof(union S2)), "sizeof(union S2)");
+    assert("test/unions.c", 34, (8), (sizeof(union S3)), "sizeof(union S3)");
+}
+void test_union_member_access(void) {
+    union S1 {
+        int n;
+        int m;
+        char c;
+        int o;
+    };
+    union S2 {
+        int n;
+        union S1 s1;
+        int m;
+    };
+    union S3 {
+        int n;
+        union S2 *ps2;
+        int m;
+    };
+    union S1 s1;
+    union S2 s2;
+    union S3 s3;
+    s1.n = 7;
+    assert("test/unions.c", 60, (7), (s1.n), "s1.n");
+    assert("test/unions.c", 61, (7), (s1.m), "s1.m");
+    s2.s1.n = 13;
+    assert("test/unions.c", 64, (13), (s2.s1.n), "s2.s1.n");
+    s3.ps2 = &s2;
+    assert("test/unions.c", 67, (13), (s3.ps2->n), "s3.ps2->n");
+}
+void test_union_member_position(void) {
+    union U {
+        int n;
+        char c;
+        struct { int x[5]; } s;
+    };
+    union U u;
+    assert("test/unions.c", 78, (1), ((void *)&u.n == (void *)&u.c), "(void *)&u.n == (void *)&u.c");
+    assert("test/unions.c", 79, (1), ((void *)&u.n == (void *)&u.s), "(void *)&u.n == (void *)&u.s");
+}
+void test_decl_local_union_without_tag(void) {
+    union U {
+        int a[5];
+        char c;
+    } obj = {{ 3, 5, 7, 11, 13 }};
+    assert("test/unions.c", 88, (3), (obj.a[0]), "obj.a[0]");
+    assert("test/unions.c", 89, (5), (obj.a[1]), "obj.a[1]");
+    assert("test/unions.c", 90, (7), (obj.a[2]), "obj.a[2]");
+    assert("test/unions.c", 91, (11), (obj.a[3]), "obj.a[3]");
+    assert("test/unions.c", 92, (13), (obj.a[4]), "obj.a[4]");
+}
+void test_union_assign(void) {
+    typedef union U {
+        int a[2];
+        char c;
+    } U;
+    U u1 = {{ 3, 5 }};
+    U u2 = {{ 7, 11 }};
+    U u3;
+    u3.c = 'x';
+    u3 = u2 = u1;
+    assert("test/unions.c", 107, (3), (u1.a[0]), "u1.a[0]");
+    assert("test/unions.c", 108, (5), (u1.a[1]), "u1.a[1]");
+    assert("test/unions.c", 109, (3), (u2.a[0]), "u2.a[0]");
+    assert("test/unions.c", 110, (5), (u2.a[1]), "u2.a[1]");
+    assert("test/unions.c", 111, (3), (u3.a[0]), "u3.a[0]");
+    assert("test/unions.c", 112, (5), (u3.a[1]), "u3.a[1]");
+}
+void test_compound_literal(void) {
+    typedef union U {
+        int a[2];
+    } U;
+    {
+        U u;
+        u = (U){ {13, 17} };
+        assert("test/unions.c", 122, (13), (u.a[0]), "u.a[0]");
+        assert("test/unions.c", 123, (17), (u.a[1]), "u.a[1]");
+    }
+    {
+        U u = (U){ {23, 29} };
+        assert("test/unions.c", 127, (23), (u.a[0]), "u.a[0]");
+        assert("test/unions.c", 128, (29), (u.a[1]), "u.a[1]");
+    }
+    {
+        int x = (U){ {31, 37} }.a[1];
+        assert("test/unions.c", 132, (37), (x), "x");
+    }
+    {
+        U u1 = {{47, 49}}, u2 = {{41, 43}};
+        u1 = (U){{53, 59}} = u2;
+        assert("test/unions.c", 137, (41), (u1.a[0]), "u1.a[0]");
+        assert("test/unions.c", 138, (43), (u1.a[1]), "u1.a[1]");
+    }
+    {
+        int x = (&(U){ {31, 37} })->a[1];
+        assert("test/unions.c", 142, (37), (x), "x");
+    }
+}
+void test_compare_union_pointers(void) {
+    union U {} x;
+    assert("test/unions.c", 148, (1), (&x == &x), "&x == &x");
+}
+void test_struct_assign_to_member_from_ptr(void) {
+    union A {
+        int n, m;
+    };
+    union B {
+        int x;
+        union A a;
+    };
+    union A a = { 13 };
+    union B b = { 17 };
+    union A *ap = &a;
+    b.a = *ap;
+    assert("test/unions.c", 166, (13), (b.a.n), "b.a.n");
+}
+int main(void) {
+    test_decl_global_union_var();
+    test_decl_local_union_var();
+    test_sizeof_union();
+    test_union_member_access();
+    test_union_member_position();
+    test_decl_local_union_without_tag();
+    test_union_assign();
+    test_compound_literal();
+    test_compare_union_pointers();
+    test_struct_assign_to_member_from_ptr();
+}
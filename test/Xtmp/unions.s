@@ -0,0 +1,867 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl test_decl_global_union_var
+test_decl_global_union_var:
+.Lreturn_test_decl_global_union_var:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_decl_local_union_var
+test_decl_local_union_var:
+.Lreturn_test_decl_local_union_var:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_sizeof_union
+test_sizeof_union:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 31
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  mov rcx, 4
+  mov r9, 4
+  mov rsi, 32
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 33
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 34
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_sizeof_union:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_union_member_access
+test_union_member_access:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 7
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 60
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 61
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 64
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 67
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_union_member_access:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_union_member_position
+test_union_member_position:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 78
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 79
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_union_member_position:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_decl_local_union_without_tag
+test_decl_local_union_without_tag:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -20[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov DWORD PTR 16[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 12[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 16[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 88
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 89
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 90
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 91
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 92
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_decl_local_union_without_tag:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_union_assign
+test_union_assign:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 7
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 120
+  lea rax, QWORD PTR -24[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -24[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 107
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 108
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 109
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 110
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 112
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_union_assign:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_compound_literal
+test_compound_literal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rax, QWORD PTR -8[rbp]
+  mov rcx, rax
+  mov rdi, 13
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 4[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 122
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 123
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rcx, rax
+  mov rdi, 23
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 4[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 127
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 128
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 31
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 37
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 4[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 132
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 47
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 49
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 41
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 43
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 4[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rcx, rax
+  mov rdi, 53
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 59
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 4[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 41
+  mov rsi, 137
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 43
+  mov rsi, 138
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 31
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 37
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 4[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 37
+  mov rsi, 142
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_compound_literal:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_compare_union_pointers
+test_compare_union_pointers:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  lea rax, QWORD PTR 0[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR 0[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 148
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_compare_union_pointers:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_struct_assign_to_member_from_ptr
+test_struct_assign_to_member_from_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 17
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov edx, DWORD PTR 0[rsi]
+  mov DWORD PTR 0[rdi], edx
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 166
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_struct_assign_to_member_from_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call test_decl_global_union_var
+  mov al, 0
+  call test_decl_local_union_var
+  mov al, 0
+  call test_sizeof_union
+  mov al, 0
+  call test_union_member_access
+  mov al, 0
+  call test_union_member_position
+  mov al, 0
+  call test_decl_local_union_without_tag
+  mov al, 0
+  call test_union_assign
+  mov al, 0
+  call test_compound_literal
+  mov al, 0
+  call test_compare_union_pointers
+  mov al, 0
+  call test_struct_assign_to_member_from_ptr
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/unions.c"
+.LiteralString1:
+  .string  "sizeof(union S0)"
+.LiteralString2:
+  .string  "test/unions.c"
+.LiteralString3:
+  .string  "sizeof(union S1)"
+.LiteralString4:
+  .string  "test/unions.c"
+.LiteralString5:
+  .string  "sizeof(union S2)"
+.LiteralString6:
+  .string  "test/unions.c"
+.LiteralString7:
+  .string  "sizeof(union S3)"
+.LiteralString8:
+  .string  "test/unions.c"
+.LiteralString9:
+  .string  "s1.n"
+.LiteralString10:
+  .string  "test/unions.c"
+.LiteralString11:
+  .string  "s1.m"
+.LiteralString12:
+  .string  "test/unions.c"
+.LiteralString13:
+  .string  "s2.s1.n"
+.LiteralString14:
+  .string  "test/unions.c"
+.LiteralString15:
+  .string  "s3.ps2->n"
+.LiteralString16:
+  .string  "test/unions.c"
+.LiteralString17:
+  .string  "(void *)&u.n == (void *)&u.c"
+.LiteralString18:
+  .string  "test/unions.c"
+.LiteralString19:
+  .string  "(void *)&u.n == (void *)&u.s"
+.LiteralString20:
+  .string  "test/unions.c"
+.LiteralString21:
+  .string  "obj.a[0]"
+.LiteralString22:
+  .string  "test/unions.c"
+.LiteralString23:
+  .string  "obj.a[1]"
+.LiteralString24:
+  .string  "test/unions.c"
+.LiteralString25:
+  .string  "obj.a[2]"
+.LiteralString26:
+  .string  "test/unions.c"
+.LiteralString27:
+  .string  "obj.a[3]"
+.LiteralString28:
+  .string  "test/unions.c"
+.LiteralString29:
+  .string  "obj.a[4]"
+.LiteralString30:
+  .string  "test/unions.c"
+.LiteralString31:
+  .string  "u1.a[0]"
+.LiteralString32:
+  .string  "test/unions.c"
+.LiteralString33:
+  .string  "u1.a[1]"
+.LiteralString34:
+  .string  "test/unions.c"
+.LiteralString35:
+  .string  "u2.a[0]"
+.LiteralString36:
+  .string  "test/unions.c"
+.LiteralString37:
+  .string  "u2.a[1]"
+.LiteralString38:
+  .string  "test/unions.c"
+.LiteralString39:
+  .string  "u3.a[0]"
+.LiteralString40:
+  .string  "test/unions.c"
+.LiteralString41:
+  .string  "u3.a[1]"
+.LiteralString42:
+  .string  "test/unions.c"
+.LiteralString43:
+  .string  "u.a[0]"
+.LiteralString44:
+  .string  "test/unions.c"
+.LiteralString45:
+  .string  "u.a[1]"
+.LiteralString46:
+  .string  "test/unions.c"
+.LiteralString47:
+  .string  "u.a[0]"
+.LiteralString48:
+  .string  "test/unions.c"
+.LiteralString49:
+  .string  "u.a[1]"
+.LiteralString50:
+  .string  "test/unions.c"
+.LiteralString51:
+  .string  "x"
+.LiteralString52:
+  .string  "test/unions.c"
+.LiteralString53:
+  .string  "u1.a[0]"
+.LiteralString54:
+  .string  "test/unions.c"
+.LiteralString55:
+  .string  "u1.a[1]"
+.LiteralString56:
+  .string  "test/unions.c"
+.LiteralString57:
+  .string  "x"
+.LiteralString58:
+  .string  "test/unions.c"
+.LiteralString59:
+  .string  "&x == &x"
+.LiteralString60:
+  .string  "test/unions.c"
+.LiteralString61:
+  .string  "b.a.n"
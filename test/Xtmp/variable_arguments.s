@@ -0,0 +1,329 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl fmt1
+fmt1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 8
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call vsprintf
+  lea rax, QWORD PTR .StaticVar0[rip]
+  jmp .Lreturn_fmt1
+.Lreturn_fmt1:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testVaStart_1
+testVaStart_1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov al, 0
+  call fmt1
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 23
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov rcx, 10
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call fmt1
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 26
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  push 107
+  push 106
+  mov r9, 105
+  mov r8, 104
+  mov rcx, 103
+  mov r10, 102
+  mov rsi, 101
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rdi, rax
+  mov rdx, r10
+  mov al, 0
+  call fmt1
+  add rsp, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 29
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testVaStart_1:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl fmt2
+fmt2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -80[rbp], rbx
+  mov QWORD PTR -88[rbp], r12
+  mov QWORD PTR -96[rbp], r13
+  mov DWORD PTR -48[rbp], edi
+  mov DWORD PTR -40[rbp], esi
+  mov DWORD PTR -32[rbp], edx
+  mov DWORD PTR -24[rbp], ecx
+  mov DWORD PTR -16[rbp], r8d
+  mov DWORD PTR -8[rbp], r9d
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  push rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  push rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r10, rax
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rdi, rax
+  mov rdx, r10
+  mov al, 0
+  call sprintf
+  add rsp, 16
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 48
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 24[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rbx, rax
+  lea rax, QWORD PTR 16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r12, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov r13, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, r13
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rdi, rax
+  mov rsi, r12
+  mov rdx, rbx
+  mov al, 0
+  call vsprintf
+  lea rax, QWORD PTR .StaticVar1[rip]
+  jmp .Lreturn_fmt2
+.Lreturn_fmt2:
+  mov rbx, QWORD PTR -80[rbp]
+  mov r12, QWORD PTR -88[rbp]
+  mov r13, QWORD PTR -96[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testVaStart_2
+testVaStart_2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  sub rsp, 8 /* RSP alignment */
+  lea rax, QWORD PTR .LiteralString14[rip]
+  push rax
+  mov rax, 16
+  mov r8, 15
+  mov rcx, 14
+  mov r9, 13
+  mov rsi, 12
+  mov rdi, 11
+  mov rdx, r9
+  mov r9, rax
+  mov al, 0
+  call fmt2
+  add rsp, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rbx, rax
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strcmp
+  mov rcx, rax
+  mov r8, 0
+  mov rsi, 48
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_testVaStart_2:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call testVaStart_1
+  mov al, 0
+  call testVaStart_2
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "NO-VA_ARGS"
+.LiteralString1:
+  .string  "test/variable_arguments.c"
+.LiteralString2:
+  .string  "NO-VA_ARGS"
+.LiteralString3:
+  .string  "strcmp(result, \"NO-VA_ARGS\")"
+.LiteralString4:
+  .string  "%s, %d"
+.LiteralString5:
+  .string  "Hello"
+.LiteralString6:
+  .string  "test/variable_arguments.c"
+.LiteralString7:
+  .string  "Hello, 10"
+.LiteralString8:
+  .string  "strcmp(result, \"Hello, 10\")"
+.LiteralString9:
+  .string  "%d, %d, %d, %d, %d, %d, %d"
+.LiteralString10:
+  .string  "test/variable_arguments.c"
+.LiteralString11:
+  .string  "101, 102, 103, 104, 105, 106, 107"
+.LiteralString12:
+  .string  "strcmp(result, \"101, 102, 103, 104, 105, 106, 107\")"
+.LiteralString13:
+  .string  "%d, %d, %d, %d, %d, %d: "
+.LiteralString14:
+  .string  "NO-VA_ARGS"
+.LiteralString15:
+  .string  "test/variable_arguments.c"
+.LiteralString16:
+  .string  "11, 12, 13, 14, 15, 16: NO-VA_ARGS"
+.LiteralString17:
+  .string  "strcmp(result, \"11, 12, 13, 14, 15, 16: NO-VA_ARGS\")"
+.StaticVar1:
+  .zero 128
+.StaticVar0:
+  .zero 64
@@ -0,0 +1,473 @@
+void *safeAlloc(int size);
+void assert(char *file, int linenr, int expected, int actual, char *code);
+int *allocInt4();
+void free(void *p);
+int printf(const char *fmt, ...);
+int strcmp(const char *, const char *);
+int g_num1;
+int *g_ptr, g_array[3], g_marray1[2][3], g_marray2[2][3][4], g_num2;
+extern int gExternVar;
+int gExternVar;
+void test_global_variables(void) {
+    int i, j;
+    g_num1 = 10;
+    g_array[0] = 100;
+    g_array[1] = 200;
+    g_array[2] = 300;
+    g_marray2[1][2][2] = 100;
+    g_marray2[1][2][3] = 200;
+    g_num2 = 400;
+    assert("test/variables.c", 20, (10), (g_num1), "g_num1");
+    assert("test/variables.c", 21, (100), (g_array[0]), "g_array[0]");
+    assert("test/variables.c", 22, (200), (g_array[1]), "g_array[1]");
+    assert("test/variables.c", 23, (300), (g_array[2]), "g_array[2]");
+    assert("test/variables.c", 24, (400), (g_num2), "g_num2");
+    assert("test/variables.c", 25, (100), (g_marray2[1][2][2]), "g_marray2[1][2][2]");
+    assert("test/variables.c", 26, (200), (g_marray2[1][2][3]), "g_marray2[1][2][3]");
+    for (i = 0; i < 2; ++i)
+        for (j = 0; j < 3; ++j)
+            g_marray1[i][j] = 3 * i + j + 1;
+    for (i = 0; i < 2; ++i)
+        for (j = 0; j < 3; ++j)
+            assert("test/variables.c", 33, (3 * i + j + 1), (g_marray1[i][j]), "g_marray1[i][j]");
+    g_ptr = &g_num2;
+    *g_ptr = 42;
+    assert("test/variables.c", 37, (42), (*g_ptr), "*g_ptr");
+    assert("test/variables.c", 38, (42), (g_num2), "g_num2");
+    g_ptr = g_array;
+    assert("test/variables.c", 41, (100), (*g_ptr), "*g_ptr");
+    assert("test/variables.c", 42, (100), (g_ptr[0]), "g_ptr[0]");
+    assert("test/variables.c", 43, (200), (g_ptr[1]), "g_ptr[1]");
+    assert("test/variables.c", 44, (300), (g_ptr[2]), "g_ptr[2]");
+    *g_ptr = 1000;
+    assert("test/variables.c", 47, (1000), (*g_ptr), "*g_ptr");
+    assert("test/variables.c", 48, (1000), (g_array[0]), "g_array[0]");
+    g_ptr++;
+    assert("test/variables.c", 51, (200), (*g_ptr), "*g_ptr");
+    g_ptr--;
+    assert("test/variables.c", 54, (1000), (*g_ptr), "*g_ptr");
+    g_ptr += 2;
+    assert("test/variables.c", 57, (300), (*g_ptr), "*g_ptr");
+    g_ptr -= 2;
+    assert("test/variables.c", 60, (1000), (*g_ptr), "*g_ptr");
+}
+void test_local_variables(void) {
+    {
+        int a;
+        a = 10;
+        assert("test/variables.c", 67, (10), (a), "a");
+    }
+    {
+        int a;
+        a = -(-5*+15);
+        assert("test/variables.c", 72, (75), (a), "a");
+    }
+    {
+        int a, b;
+        a = 10;
+        b = a;
+        assert("test/variables.c", 78, (10), (a), "a");
+        assert("test/variables.c", 79, (10), (b), "b");
+    }
+    {
+        int a, b;
+        a = b = 10;
+        assert("test/variables.c", 84, (10), (a), "a");
+        assert("test/variables.c", 85, (10), (b), "b");
+    }
+    {
+        int a, b;
+        a = 3;
+        b = 10;
+        assert("test/variables.c", 91, (13), (a + b), "a + b");
+        assert("test/variables.c", 92, (30), (a * b), "a * b");
+        assert("test/variables.c", 93, (1), (a < b), "a < b");
+        assert("test/variables.c", 94, (0), (a > b), "a > b");
+    }
+    {
+        int foo;
+        foo = 10;
+        assert("test/variables.c", 99, (10), (foo), "foo");
+    }
+    {
+        int foo, bar;
+        foo = 10;
+        bar = 20;
+        assert("test/variables.c", 105, (10), (foo), "foo");
+        assert("test/variables.c", 106, (20), (bar), "bar");
+        assert("test/variables.c", 107, (200), (foo * bar), "foo * bar");
+        bar = foo;
+        assert("test/variables.c", 110, (10), (foo), "foo");
+        assert("test/variables.c", 111, (10), (bar), "bar");
+        bar = (foo * foo == 100);
+        assert("test/variables.c", 114, (1), (bar), "bar");
+        bar = 0;
+        assert("test/variables.c", 117, (0), (bar), "bar");
+        bar = ((foo = 5) == 5);
+        assert("test/variables.c", 120, (5), (foo), "foo");
+        assert("test/variables.c", 121, (1), (bar), "bar");
+    }
+    {
+        int a, b, c, d;
+        a = 4;
+        b = 3;
+        c = 2;
+        d = 1;
+        assert("test/variables.c", 129, (10), (a + b + c + d), "a + b + c + d");
+    }
+    {
+        int a, b, c, d;
+        a = 4;
+        b = 3;
+        c = 2;
+        d = 1;
+        a -= b -= c -= d;
+        assert("test/variables.c", 138, (2), (a), "a");
+        assert("test/variables.c", 139, (2), (b), "b");
+        assert("test/variables.c", 140, (1), (c), "c");
+        assert("test/variables.c", 141, (1), (d), "d");
+    }
+    {
+        int n;
+        n = 10;
+        assert("test/variables.c", 146, (10), (n), "n");
+        assert("test/variables.c", 147, (11), (++n), "++n");
+        assert("test/variables.c", 148, (11), (n), "n");
+        assert("test/variables.c", 149, (10), (--n), "--n");
+        assert("test/variables.c", 150, (10), (n), "n");
+        assert("test/variables.c", 151, (10), (n++), "n++");
+        assert("test/variables.c", 152, (11), (n), "n");
+        assert("test/variables.c", 153, (11), (n--), "n--");
+        assert("test/variables.c", 154, (10), (n), "n");
+        n += 100;
+        assert("test/variables.c", 157, (110), (n), "n");
+        n -= 50;
+        assert("test/variables.c", 160, (60), (n), "n");
+    }
+    {
+        int a[2];
+        *a = 2;
+        assert("test/variables.c", 165, (2), (*a), "*a");
+        assert("test/variables.c", 166, (2), (a[0]), "a[0]");
+        *(a+1) = 5;
+        assert("test/variables.c", 169, (5), (*(a+1)), "*(a+1)");
+        assert("test/variables.c", 170, (5), (a[1]), "a[1]");
+        assert("test/variables.c", 171, (2), (*a), "*a");
+    }
+    {
+        int c;
+        int b[2];
+        int a;
+        a = 10;
+        b[0] = 3;
+        b[1] = 5;
+        c = 100;
+        assert("test/variables.c", 181, (10), (a), "a");
+        assert("test/variables.c", 182, (3), (b[0]), "b[0]");
+        assert("test/variables.c", 183, (5), (b[1]), "b[1]");
+        assert("test/variables.c", 184, (100), (c), "c");
+    }
+    {
+        int *p, *save;
+        p = allocInt4();
+        save = p;
+        assert("test/variables.c", 191, (1), (p[0]), "p[0]");
+        assert("test/variables.c", 192, (2), (p[1]), "p[1]");
+        assert("test/variables.c", 193, (3), (p[2]), "p[2]");
+        assert("test/variables.c", 194, (4), (p[3]), "p[3]");
+        assert("test/variables.c", 195, (2), (*(++p)), "*(++p)");
+        free(save);
+    }
+    {
+        int n, *p;
+        n = 100;
+        p = &n;
+        assert("test/variables.c", 202, (100), (n), "n");
+        assert("test/variables.c", 203, (100), (*p), "*p");
+        *p = 200;
+        assert("test/variables.c", 205, (200), (n), "n");
+    }
+    {
+        int n, *p, **pp;
+        n = 100;
+        p = &n;
+        pp = &p;
+        assert("test/variables.c", 212, (100), (**pp), "**pp");
+        **pp = 200;
+        assert("test/variables.c", 214, (200), (n), "n");
+    }
+    {
+        int x[2][3];
+        int i, j;
+        for (i = 0; i < 2; ++i)
+            for (j = 0; j < 3; ++j)
+                x[i][j] = 3 * i + j + 1;
+        for (i = 0; i < 2; ++i)
+            for (j = 0; j < 3; ++j)
+                assert("test/variables.c", 225, (3 * i + j + 1), (x[i][j]), "x[i][j]");
+    }
+    {
+        char a, b;
+        a = 3;
+        b = 8;
+        assert("test/variables.c", 231, (3), (a), "a");
+        assert("test/variables.c", 232, (8), (b), "b");
+        assert("test/variables.c", 233, (11), (a + b), "a + b");
+        assert("test/variables.c", 234, (0), (a == b), "a == b");
+        a++;
+        assert("test/variables.c", 237, (4), (a), "a");
+        a--;
+        assert("test/variables.c", 239, (3), (a), "a");
+        a = 'a';
+        assert("test/variables.c", 242, (97), (a), "a");
+    }
+    {
+        char x[3];
+        int y;
+        x[0] = 2;
+        x[1] = -1;
+        y = 4;
+        assert("test/variables.c", 250, (3), (x[1] + y), "x[1] + y");
+    }
+    {
+        char x[3];
+        char *p;
+        x[0] = 1;
+        x[1] = 2;
+        x[2] = 3;
+        p = x;
+        p++;
+        assert("test/variables.c", 260, (2), (*p), "*p");
+    }
+    {
+        char *s;
+        s = "abc";
+        assert("test/variables.c", 266, ('a'), (*s), "*s");
+        assert("test/variables.c", 267, ('b'), (s[1]), "s[1]");
+        assert("test/variables.c", 268, ('c'), (s[2]), "s[2]");
+        s = "def";
+        assert("test/variables.c", 271, ('d'), (*s), "*s");
+        assert("test/variables.c", 272, ('e'), (s[1]), "s[1]");
+        assert("test/variables.c", 273, ('f'), (s[2]), "s[2]");
+    }
+    {
+        void *p;
+        int n;
+        p = &n;
+        assert("test/variables.c", 279, (1), (p == &n), "p == &n");
+    }
+    {
+        void *vp;
+        int n, *p;
+        p = &n;
+        vp = &p;
+        assert("test/variables.c", 286, (1), (vp == &p), "vp == &p");
+    }
+    {
+        int *p = (int *)0;
+        assert("test/variables.c", 291, (1), (p == 0), "p == 0");
+        assert("test/variables.c", 292, (0), (p != 0), "p != 0");
+        p = (int *)13;
+        assert("test/variables.c", 295, (0), (p == 0), "p == 0");
+        assert("test/variables.c", 296, (1), (p != 0), "p != 0");
+    }
+    {
+        char *p = (char *)0;
+        assert("test/variables.c", 300, (1), (p == 0), "p == 0");
+        assert("test/variables.c", 301, (0), (p != 0), "p != 0");
+        p = (char *)15;
+        assert("test/variables.c", 304, (0), (p == 0), "p == 0");
+        assert("test/variables.c", 305, (1), (p != 0), "p != 0");
+    }
+}
+void test_increment_or_decrement_array_element(void) {
+    int x[3] = {3, 5, 7};
+    x[2]++;
+    assert("test/variables.c", 312, (8), (x[2]), "x[2]");
+    x[2]--;
+    assert("test/variables.c", 314, (7), (x[2]), "x[2]");
+    ++x[2];
+    assert("test/variables.c", 316, (8), (x[2]), "x[2]");
+    --x[2];
+    assert("test/variables.c", 318, (7), (x[2]), "x[2]");
+}
+int local_var_independent(void) {
+    int a[2];
+    *a = 5;
+    return 10;
+}
+int helper_countup(void) {
+    static int count;
+    return ++count;
+}
+int helper_countup2(void) {
+    static int count1;
+    static int count2;
+    count1++;
+    count2++;
+    return count1 + count2;
+}
+void test_static_local_variable(void) {
+    assert("test/variables.c", 341, (1), (helper_countup()), "helper_countup()");
+    assert("test/variables.c", 342, (2), (helper_countup()), "helper_countup()");
+    assert("test/variables.c", 343, (3), (helper_countup()), "helper_countup()");
+    assert("test/variables.c", 345, (2), (helper_countup2()), "helper_countup2()");
+    assert("test/variables.c", 346, (4), (helper_countup2()), "helper_countup2()");
+    assert("test/variables.c", 347, (6), (helper_countup2()), "helper_countup2()");
+    assert("test/variables.c", 349, (4), (helper_countup()), "helper_countup()");
+}
+void test_access_results_in_array(void) {
+    int arar[][5] = {{3, 5, 7, 9, 11}, {13, 17, 19, 23, 29}};
+    int *par = arar[1];
+    assert("test/variables.c", 356, (13), (par[0]), "par[0]");
+    assert("test/variables.c", 357, (17), (par[1]), "par[1]");
+    assert("test/variables.c", 358, (19), (par[2]), "par[2]");
+    assert("test/variables.c", 359, (23), (par[3]), "par[3]");
+    assert("test/variables.c", 360, (29), (par[4]), "par[4]");
+}
+void test_extern_variable(void) {
+    gExternVar = 101;
+    assert("test/variables.c", 365, (101), (gExternVar), "gExternVar");
+}
+void testDeclArray(void) {
+    {
+        char a[3];
+        assert("test/variables.c", 371, (3), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[(3)];
+        assert("test/variables.c", 375, (3), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[2 + 3];
+        assert("test/variables.c", 379, (5), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[3*5+7];
+        assert("test/variables.c", 383, (22), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[1 ? 3 : 0];
+        assert("test/variables.c", 387, (3), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[0 ? 2 : 3 + 5];
+        assert("test/variables.c", 391, (8), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[!(0+(-0)) ? 2 : 3 + 5];
+        assert("test/variables.c", 395, (2), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[1 | 2];
+        assert("test/variables.c", 399, (3), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[3 & 2];
+        assert("test/variables.c", 403, (2), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[!0];
+        assert("test/variables.c", 407, (1), (sizeof(a)), "sizeof(a)");
+    }
+    {
+        char a[!7];
+        assert("test/variables.c", 411, (0), (sizeof(a)), "sizeof(a)");
+    }
+}
+void testSubBetweenPointers(void) {
+    typedef struct S {
+        int a;
+        char b[10];
+        int c;
+    } S;
+    {
+        int *p = (int *)0;
+        int *q = (int *)(sizeof(int) * 13);
+        assert("test/variables.c", 424, (13), (q - p), "q - p");
+        assert("test/variables.c", 425, (-13), (p - q), "p - q");
+    }
+    {
+        char *p = (char *)0;
+        char *q = (char *)(sizeof(char) * 13);
+        assert("test/variables.c", 430, (13), (q - p), "q - p");
+        assert("test/variables.c", 431, (-13), (p - q), "p - q");
+    }
+    {
+        int a[4] = {};
+        int *p = a;
+        int *q = a + 3;
+        assert("test/variables.c", 437, (3), (q - p), "q - p");
+        assert("test/variables.c", 438, (-3), (p - q), "p - q");
+    }
+    {
+        char a[10] = {};
+        char *p = a;
+        char *q = a + 5;
+        assert("test/variables.c", 444, (5), (q - p), "q - p");
+        assert("test/variables.c", 445, (-5), (p - q), "p - q");
+    }
+    {
+        S a[10] = {};
+        S *p = a;
+        S *q = a + 7;
+        assert("test/variables.c", 451, (7), (q - p), "q - p");
+        assert("test/variables.c", 452, (-7), (p - q), "p - q");
+    }
+}
+void testIndexedAccess(void) {
+    typedef struct {
+        int a, b, c;
+    } S;
+    char c[4] = {1, 2, 3, 4};
+    int n[4] = {10, 20, 30, 40};
+    int m[2][3] = {{1, 2, 3}, {4, 5, 6}};
+    int *p = &n[2];
+    int *ps[2];
+    S s[2];
+    int i = 1;
+    assert("test/variables.c", 468, (2), (c[i]), "c[i]");
+    assert("test/variables.c", 469, (20), (n[i]), "n[i]");
+    assert("test/variables.c", 470, (20), (*(i + n)), "*(i + n)");
+    assert("test/variables.c", 471, (40), (n[i + 2]), "n[i + 2]");
+    assert("test/variables.c", 472, (20), (p[-i]), "p[-i]");
+    assert("test/variables.c", 473, (40), (*(p + i)), "*(p + i)");
+    assert("test/variables.c", 474, (6), (m[i][i + 1]), "m[i][i + 1]");
+    ps[i] = p;
+    assert("test/variables.c", 476, (30), (*ps[i]), "*ps[i]");
+    assert("test/variables.c", 477, (40), (ps[i][i]), "ps[i][i]");
+    c[i] = 100;
+    n[i + 1] = 33;
+    p[-2 * i] = 11;
+    assert("test/variables.c", 481, (100), (c[1]), "c[1]");
+    assert("test/variables.c", 482, (33), (n[2]), "n[2]");
+    assert("test/variables.c", 483, (11), (n[0]), "n[0]");
+    s[i].b = 7;
+    assert("test/variables.c", 485, (7), (s[1].b), "s[1].b");
+    assert("test/variables.c", 486, (12), ((char *)&s[i] - (char *)&s[0]), "(char *)&s[i] - (char *)&s[0]");
+}
+void testLongTokens(void) {
+    int a_rather_long_variable_name_0 = 1;
+    int a_rather_long_variable_name_1 = 2;
+    char s[] = "0123456789abcdef\"0123456789\\abcdef*/";
+    assert("test/variables.c", 495, (1), (a_rather_long_variable_name_0), "a_rather_long_variable_name_0");
+    assert("test/variables.c", 496, (2), (a_rather_long_variable_name_1), "a_rather_long_variable_name_1");
+    assert("test/variables.c", 497, (37), (sizeof(s)), "sizeof(s)");
+    assert("test/variables.c", 498, ('"'), (s[16]), "s[16]");
+    assert("test/variables.c", 499, ('\\'), (s[27]), "s[27]");
+    assert("test/variables.c", 500, ('/'), (s[35]), "s[35]");
+}
+int main(void) {
+    test_local_variables();
+    test_increment_or_decrement_array_element();
+    test_global_variables();
+    assert("test/variables.c", 507, (10), (local_var_independent()), "local_var_independent()");
+    test_static_local_variable();
+    test_access_results_in_array();
+    test_extern_variable();
+    testDeclArray();
+    testSubBetweenPointers();
+    testIndexedAccess();
+    testLongTokens();
+    return 0;
+}
@@ -0,0 +1,4383 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl test_global_variables
+test_global_variables:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov rdi, 10
+  lea rax, QWORD PTR g_num1[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 100
+  lea rax, QWORD PTR g_array[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 200
+  lea rax, QWORD PTR g_array[rip]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 300
+  lea rax, QWORD PTR g_array[rip]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 100
+  lea rax, QWORD PTR g_marray2[rip]
+  add rax, 48
+  add rax, 32
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 200
+  lea rax, QWORD PTR g_marray2[rip]
+  add rax, 48
+  add rax, 32
+  mov DWORD PTR 12[rax], edi
+  mov rax, rdi
+  mov rdi, 400
+  lea rax, QWORD PTR g_num2[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_num1[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 20
+  lea rax, QWORD PTR .LiteralString0[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_array[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 21
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_array[rip]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 22
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_array[rip]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 300
+  mov rsi, 23
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_num2[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 400
+  mov rsi, 24
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_marray2[rip]
+  add rax, 48
+  add rax, 32
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 25
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_marray2[rip]
+  add rax, 48
+  add rax, 32
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 26
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jge .Lend0
+  .p2align 4
+.Lbegin0:
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend1
+  .p2align 4
+.Lbegin1:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR g_marray1[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rdi, rcx
+  mov DWORD PTR 0[rsi+rax*4], edi
+  mov rax, rdi
+.Literator1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin1
+.Lend1:
+.Literator0:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lbegin0
+.Lend0:
+  mov rdi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jge .Lend2
+  .p2align 4
+.Lbegin2:
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend3
+  .p2align 4
+.Lbegin3:
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_marray1[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov r9, rax
+  mov rsi, 33
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin3
+.Lend3:
+.Literator2:
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lbegin2
+.Lend2:
+  lea rax, QWORD PTR g_num2[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 42
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 42
+  mov rsi, 37
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_num2[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 42
+  mov rsi, 38
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_array[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 41
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 42
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 43
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 300
+  mov rsi, 44
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 1000
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1000
+  mov rsi, 47
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_array[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1000
+  mov rsi, 48
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 4
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 51
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  sub rax, 4
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1000
+  mov rsi, 54
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 300
+  mov rsi, 57
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov r8, rax
+  lea rax, QWORD PTR g_ptr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1000
+  mov rsi, 60
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_global_variables:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_local_variables
+test_local_variables:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov rdi, 10
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 67
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 75
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 75
+  mov rsi, 72
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 10
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 78
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 79
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 10
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 84
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 85
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 3
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 91
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov r9, 30
+  mov rsi, 92
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setl al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 93
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setl al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 94
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 10
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 99
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 10
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 20
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 105
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 20
+  mov rsi, 106
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 107
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 110
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 111
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  cmp rax, 100
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 114
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 117
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 5
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  cmp rax, 5
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 120
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 121
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 4
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 129
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 4
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 138
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 139
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 140
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 141
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 10
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 146
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov DWORD PTR 0[rdi], eax
+  mov r9, 11
+  mov rsi, 147
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 148
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov DWORD PTR 0[rdi], eax
+  mov r9, 10
+  mov rsi, 149
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 150
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov r9, 10
+  mov rsi, 151
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 152
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov r9, 11
+  mov rsi, 153
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 154
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 100
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 110
+  mov rsi, 157
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 50
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 60
+  mov rsi, 160
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 165
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 166
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 5
+  mov DWORD PTR -4[rbp], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 169
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 170
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 171
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 10
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 5
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 100
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 10
+  mov rsi, 181
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 182
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -8[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 183
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 184
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov al, 0
+  call allocInt4
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 191
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 192
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 193
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 194
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString139[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 195
+  lea rax, QWORD PTR .LiteralString138[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 100
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString141[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 202
+  lea rax, QWORD PTR .LiteralString140[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString143[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 203
+  lea rax, QWORD PTR .LiteralString142[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 200
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString145[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 205
+  lea rax, QWORD PTR .LiteralString144[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 100
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString147[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 212
+  lea rax, QWORD PTR .LiteralString146[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 200
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString149[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 200
+  mov rsi, 214
+  lea rax, QWORD PTR .LiteralString148[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jge .Lend4
+  .p2align 4
+.Lbegin4:
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend5
+  .p2align 4
+.Lbegin5:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rdi, rcx
+  mov DWORD PTR 0[rsi+rax*4], edi
+  mov rax, rdi
+.Literator5:
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin5
+.Lend5:
+.Literator4:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lbegin4
+.Lend4:
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jge .Lend6
+  .p2align 4
+.Lbegin6:
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend7
+  .p2align 4
+.Lbegin7:
+  lea rax, QWORD PTR .LiteralString151[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov r9, rax
+  mov rsi, 225
+  lea rax, QWORD PTR .LiteralString150[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Literator7:
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jl .Lbegin7
+.Lend7:
+.Literator6:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lbegin6
+.Lend6:
+  mov rdi, 3
+  lea rax, QWORD PTR -1[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -2[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 231
+  lea rax, QWORD PTR .LiteralString152[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString155[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -2[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 232
+  lea rax, QWORD PTR .LiteralString154[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString157[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -2[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, rsi
+  add al, dil
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 233
+  lea rax, QWORD PTR .LiteralString156[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString159[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -2[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 234
+  lea rax, QWORD PTR .LiteralString158[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -1[rbp]
+  mov rdi, rax
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  add al, 1
+  movsx rax, al
+  mov BYTE PTR 0[rdi], al
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString161[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 4
+  mov rsi, 237
+  lea rax, QWORD PTR .LiteralString160[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -1[rbp]
+  mov rdi, rax
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  sub al, 1
+  movsx rax, al
+  mov BYTE PTR 0[rdi], al
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString163[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 239
+  lea rax, QWORD PTR .LiteralString162[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 97
+  lea rax, QWORD PTR -1[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString165[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -1[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 242
+  lea rax, QWORD PTR .LiteralString164[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 2
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  mov rdi, -1
+  mov BYTE PTR -2[rbp], dil
+  mov rax, rdi
+  mov rdi, 4
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString167[rip]
+  mov r8, rax
+  mov al, BYTE PTR -2[rbp]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add al, dil
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 250
+  lea rax, QWORD PTR .LiteralString166[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 1
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  mov rdi, 2
+  mov BYTE PTR -2[rbp], dil
+  mov rax, rdi
+  mov rdi, 3
+  mov BYTE PTR -1[rbp], dil
+  lea rax, QWORD PTR -3[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString169[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 260
+  lea rax, QWORD PTR .LiteralString168[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString170[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString172[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 97
+  mov rsi, 266
+  lea rax, QWORD PTR .LiteralString171[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString174[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 98
+  mov rsi, 267
+  lea rax, QWORD PTR .LiteralString173[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString176[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 99
+  mov rsi, 268
+  lea rax, QWORD PTR .LiteralString175[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString177[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString179[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 271
+  lea rax, QWORD PTR .LiteralString178[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString181[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 101
+  mov rsi, 272
+  lea rax, QWORD PTR .LiteralString180[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString183[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 102
+  mov rsi, 273
+  lea rax, QWORD PTR .LiteralString182[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString185[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 279
+  lea rax, QWORD PTR .LiteralString184[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString187[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 286
+  lea rax, QWORD PTR .LiteralString186[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString189[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 291
+  lea rax, QWORD PTR .LiteralString188[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString191[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 292
+  lea rax, QWORD PTR .LiteralString190[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 13
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString193[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 295
+  lea rax, QWORD PTR .LiteralString192[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString195[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 296
+  lea rax, QWORD PTR .LiteralString194[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString197[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 300
+  lea rax, QWORD PTR .LiteralString196[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString199[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 301
+  lea rax, QWORD PTR .LiteralString198[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 15
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString201[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 304
+  lea rax, QWORD PTR .LiteralString200[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString203[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 305
+  lea rax, QWORD PTR .LiteralString202[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_local_variables:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_increment_or_decrement_array_element
+test_increment_or_decrement_array_element:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -12[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov DWORD PTR 8[rdi], 0
+  mov rdi, 3
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 5
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  mov rdi, 7
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString205[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 312
+  lea rax, QWORD PTR .LiteralString204[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString207[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 314
+  lea rax, QWORD PTR .LiteralString206[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString209[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 8
+  mov rsi, 316
+  lea rax, QWORD PTR .LiteralString208[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString211[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -4[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 318
+  lea rax, QWORD PTR .LiteralString210[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_increment_or_decrement_array_element:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl local_var_independent
+local_var_independent:
+  mov rdi, 5
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, 10
+  jmp .Lreturn_local_var_independent
+.Lreturn_local_var_independent:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl helper_countup
+helper_countup:
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lreturn_helper_countup
+.Lreturn_helper_countup:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl helper_countup2
+helper_countup2:
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .StaticVar2[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar2[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_helper_countup2
+.Lreturn_helper_countup2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_static_local_variable
+test_static_local_variable:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  lea rax, QWORD PTR .LiteralString213[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup
+  mov rcx, rax
+  mov r8, 1
+  mov rsi, 341
+  lea rax, QWORD PTR .LiteralString212[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString215[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup
+  mov rcx, rax
+  mov r8, 2
+  mov rsi, 342
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString217[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup
+  mov rcx, rax
+  mov r8, 3
+  mov rsi, 343
+  lea rax, QWORD PTR .LiteralString216[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString219[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup2
+  mov rcx, rax
+  mov r8, 2
+  mov rsi, 345
+  lea rax, QWORD PTR .LiteralString218[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString221[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup2
+  mov rcx, rax
+  mov r8, 4
+  mov rsi, 346
+  lea rax, QWORD PTR .LiteralString220[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString223[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup2
+  mov rcx, rax
+  mov r8, 6
+  mov rsi, 347
+  lea rax, QWORD PTR .LiteralString222[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString225[rip]
+  mov rbx, rax
+  mov al, 0
+  call helper_countup
+  mov rcx, rax
+  mov r8, 4
+  mov rsi, 349
+  lea rax, QWORD PTR .LiteralString224[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+.Lreturn_test_static_local_variable:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_access_results_in_array
+test_access_results_in_array:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  mov QWORD PTR 32[rdi], 0
+  mov rdi, 3
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 9
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 12[rax], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 16[rax], edi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 12[rax], edi
+  mov rax, rdi
+  mov rdi, 29
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 16[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString227[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 356
+  lea rax, QWORD PTR .LiteralString226[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString229[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 4[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 17
+  mov rsi, 357
+  lea rax, QWORD PTR .LiteralString228[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString231[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 8[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 19
+  mov rsi, 358
+  lea rax, QWORD PTR .LiteralString230[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString233[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 12[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 23
+  mov rsi, 359
+  lea rax, QWORD PTR .LiteralString232[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString235[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 16[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 29
+  mov rsi, 360
+  lea rax, QWORD PTR .LiteralString234[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_access_results_in_array:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl test_extern_variable
+test_extern_variable:
+  push rbp
+  mov rbp, rsp
+  mov rdi, 101
+  lea rax, QWORD PTR gExternVar[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString237[rip]
+  mov r8, rax
+  lea rax, QWORD PTR gExternVar[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 101
+  mov rsi, 365
+  lea rax, QWORD PTR .LiteralString236[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_test_extern_variable:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testDeclArray
+testDeclArray:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rax, QWORD PTR .LiteralString239[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 371
+  lea rax, QWORD PTR .LiteralString238[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString241[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 375
+  lea rax, QWORD PTR .LiteralString240[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString243[rip]
+  mov r8, rax
+  mov rcx, 5
+  mov r9, 5
+  mov rsi, 379
+  lea rax, QWORD PTR .LiteralString242[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString245[rip]
+  mov r8, rax
+  mov rcx, 22
+  mov r9, 22
+  mov rsi, 383
+  lea rax, QWORD PTR .LiteralString244[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString247[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 387
+  lea rax, QWORD PTR .LiteralString246[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString249[rip]
+  mov r8, rax
+  mov rcx, 8
+  mov r9, 8
+  mov rsi, 391
+  lea rax, QWORD PTR .LiteralString248[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString251[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 395
+  lea rax, QWORD PTR .LiteralString250[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString253[rip]
+  mov r8, rax
+  mov rcx, 3
+  mov r9, 3
+  mov rsi, 399
+  lea rax, QWORD PTR .LiteralString252[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString255[rip]
+  mov r8, rax
+  mov rcx, 2
+  mov r9, 2
+  mov rsi, 403
+  lea rax, QWORD PTR .LiteralString254[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString257[rip]
+  mov r8, rax
+  mov rcx, 1
+  mov r9, 1
+  mov rsi, 407
+  lea rax, QWORD PTR .LiteralString256[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString259[rip]
+  mov r8, rax
+  mov rcx, 0
+  mov r9, 0
+  mov rsi, 411
+  lea rax, QWORD PTR .LiteralString258[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testDeclArray:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testSubBetweenPointers
+testSubBetweenPointers:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 52
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString261[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  sar rax, 2
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 424
+  lea rax, QWORD PTR .LiteralString260[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString263[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  sar rax, 2
+  mov rcx, rax
+  mov r9, -13
+  mov rsi, 425
+  lea rax, QWORD PTR .LiteralString262[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 13
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString265[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, 13
+  mov rsi, 430
+  lea rax, QWORD PTR .LiteralString264[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString267[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, -13
+  mov rsi, 431
+  lea rax, QWORD PTR .LiteralString266[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -16[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString269[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  sar rax, 2
+  mov rcx, rax
+  mov r9, 3
+  mov rsi, 437
+  lea rax, QWORD PTR .LiteralString268[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString271[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  sar rax, 2
+  mov rcx, rax
+  mov r9, -3
+  mov rsi, 438
+  lea rax, QWORD PTR .LiteralString270[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -10[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov BYTE PTR 8[rdi], 0
+  mov BYTE PTR 9[rdi], 0
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -10[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -5[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString273[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, 5
+  mov rsi, 444
+  lea rax, QWORD PTR .LiteralString272[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString275[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, -5
+  mov rsi, 445
+  lea rax, QWORD PTR .LiteralString274[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rdi, QWORD PTR -200[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  movdqu XMMWORD PTR 144[rdi], xmm0
+  movdqu XMMWORD PTR 160[rdi], xmm0
+  movdqu XMMWORD PTR 176[rdi], xmm0
+  mov QWORD PTR 192[rdi], 0
+  lea rdi, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -200[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -60[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString277[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rsi, 20
+  cqo
+  idiv rsi
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 451
+  lea rax, QWORD PTR .LiteralString276[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString279[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rsi, 20
+  cqo
+  idiv rsi
+  mov rcx, rax
+  mov r9, -7
+  mov rsi, 452
+  lea rax, QWORD PTR .LiteralString278[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testSubBetweenPointers:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testIndexedAccess
+testIndexedAccess:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  mov BYTE PTR -4[rbp], dil
+  mov rax, rdi
+  mov rdi, 2
+  mov BYTE PTR -3[rbp], dil
+  mov rax, rdi
+  mov rdi, 3
+  mov BYTE PTR -2[rbp], dil
+  mov rax, rdi
+  mov rdi, 4
+  mov BYTE PTR -1[rbp], dil
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov rdi, 10
+  mov DWORD PTR -20[rbp], edi
+  mov rax, rdi
+  mov rdi, 20
+  mov DWORD PTR -16[rbp], edi
+  mov rax, rdi
+  mov rdi, 30
+  mov DWORD PTR -12[rbp], edi
+  mov rax, rdi
+  mov rdi, 40
+  mov DWORD PTR -8[rbp], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -44[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  mov rdi, 4
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 4[rax], edi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 8[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString281[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov al, BYTE PTR -4[rbp+rax*1]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 468
+  lea rax, QWORD PTR .LiteralString280[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString283[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR -20[rbp+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 20
+  mov rsi, 469
+  lea rax, QWORD PTR .LiteralString282[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString285[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR -20[rbp+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 20
+  mov rsi, 470
+  lea rax, QWORD PTR .LiteralString284[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString287[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  mov eax, DWORD PTR -20[rbp+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 40
+  mov rsi, 471
+  lea rax, QWORD PTR .LiteralString286[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString289[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rcx, 0
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 20
+  mov rsi, 472
+  lea rax, QWORD PTR .LiteralString288[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString291[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 40
+  mov rsi, 473
+  lea rax, QWORD PTR .LiteralString290[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString293[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 6
+  mov rsi, 474
+  lea rax, QWORD PTR .LiteralString292[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR -72[rbp+rax*8], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString295[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -72[rbp+rax*8]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 30
+  mov rsi, 476
+  lea rax, QWORD PTR .LiteralString294[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString297[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -72[rbp+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 40
+  mov rsi, 477
+  lea rax, QWORD PTR .LiteralString296[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rdi, 100
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR -4[rbp+rax*1], dil
+  mov rax, rdi
+  mov rdi, 33
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR -20[rbp+rax*4], edi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, -2
+  mov DWORD PTR 0[rsi+rax*4], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString299[rip]
+  mov r8, rax
+  mov al, BYTE PTR -3[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 100
+  mov rsi, 481
+  lea rax, QWORD PTR .LiteralString298[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString301[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -12[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 33
+  mov rsi, 482
+  lea rax, QWORD PTR .LiteralString300[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString303[rip]
+  mov r8, rax
+  mov eax, DWORD PTR -20[rbp]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 11
+  mov rsi, 483
+  lea rax, QWORD PTR .LiteralString302[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  mov rcx, 7
+  lea rax, QWORD PTR -96[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  add rax, 4
+  mov rdi, rcx
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString305[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 7
+  mov rsi, 485
+  lea rax, QWORD PTR .LiteralString304[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString307[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 12
+  imul rax, rsi
+  add rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  mov r9, 12
+  mov rsi, 486
+  lea rax, QWORD PTR .LiteralString306[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testIndexedAccess:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl testLongTokens
+testLongTokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 2
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -45[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  mov DWORD PTR 32[rdi], 0
+  mov BYTE PTR 36[rdi], 0
+  mov rdi, 48
+  mov BYTE PTR -45[rbp], dil
+  mov rax, rdi
+  mov rdi, 49
+  mov BYTE PTR -44[rbp], dil
+  mov rax, rdi
+  mov rdi, 50
+  mov BYTE PTR -43[rbp], dil
+  mov rax, rdi
+  mov rdi, 51
+  mov BYTE PTR -42[rbp], dil
+  mov rax, rdi
+  mov rdi, 52
+  mov BYTE PTR -41[rbp], dil
+  mov rax, rdi
+  mov rdi, 53
+  mov BYTE PTR -40[rbp], dil
+  mov rax, rdi
+  mov rdi, 54
+  mov BYTE PTR -39[rbp], dil
+  mov rax, rdi
+  mov rdi, 55
+  mov BYTE PTR -38[rbp], dil
+  mov rax, rdi
+  mov rdi, 56
+  mov BYTE PTR -37[rbp], dil
+  mov rax, rdi
+  mov rdi, 57
+  mov BYTE PTR -36[rbp], dil
+  mov rax, rdi
+  mov rdi, 97
+  mov BYTE PTR -35[rbp], dil
+  mov rax, rdi
+  mov rdi, 98
+  mov BYTE PTR -34[rbp], dil
+  mov rax, rdi
+  mov rdi, 99
+  mov BYTE PTR -33[rbp], dil
+  mov rax, rdi
+  mov rdi, 100
+  mov BYTE PTR -32[rbp], dil
+  mov rax, rdi
+  mov rdi, 101
+  mov BYTE PTR -31[rbp], dil
+  mov rax, rdi
+  mov rdi, 102
+  mov BYTE PTR -30[rbp], dil
+  mov rax, rdi
+  mov rdi, 34
+  mov BYTE PTR -29[rbp], dil
+  mov rax, rdi
+  mov rdi, 48
+  mov BYTE PTR -28[rbp], dil
+  mov rax, rdi
+  mov rdi, 49
+  mov BYTE PTR -27[rbp], dil
+  mov rax, rdi
+  mov rdi, 50
+  mov BYTE PTR -26[rbp], dil
+  mov rax, rdi
+  mov rdi, 51
+  mov BYTE PTR -25[rbp], dil
+  mov rax, rdi
+  mov rdi, 52
+  mov BYTE PTR -24[rbp], dil
+  mov rax, rdi
+  mov rdi, 53
+  mov BYTE PTR -23[rbp], dil
+  mov rax, rdi
+  mov rdi, 54
+  mov BYTE PTR -22[rbp], dil
+  mov rax, rdi
+  mov rdi, 55
+  mov BYTE PTR -21[rbp], dil
+  mov rax, rdi
+  mov rdi, 56
+  mov BYTE PTR -20[rbp], dil
+  mov rax, rdi
+  mov rdi, 57
+  mov BYTE PTR -19[rbp], dil
+  mov rax, rdi
+  mov rdi, 92
+  mov BYTE PTR -18[rbp], dil
+  mov rax, rdi
+  mov rdi, 97
+  mov BYTE PTR -17[rbp], dil
+  mov rax, rdi
+  mov rdi, 98
+  mov BYTE PTR -16[rbp], dil
+  mov rax, rdi
+  mov rdi, 99
+  mov BYTE PTR -15[rbp], dil
+  mov rax, rdi
+  mov rdi, 100
+  mov BYTE PTR -14[rbp], dil
+  mov rax, rdi
+  mov rdi, 101
+  mov BYTE PTR -13[rbp], dil
+  mov rax, rdi
+  mov rdi, 102
+  mov BYTE PTR -12[rbp], dil
+  mov rax, rdi
+  mov rdi, 42
+  mov BYTE PTR -11[rbp], dil
+  mov rax, rdi
+  mov rdi, 47
+  mov BYTE PTR -10[rbp], dil
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString310[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 1
+  mov rsi, 495
+  lea rax, QWORD PTR .LiteralString309[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString312[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 2
+  mov rsi, 496
+  lea rax, QWORD PTR .LiteralString311[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString314[rip]
+  mov r8, rax
+  mov rcx, 37
+  mov r9, 37
+  mov rsi, 497
+  lea rax, QWORD PTR .LiteralString313[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString316[rip]
+  mov r8, rax
+  mov al, BYTE PTR -29[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 34
+  mov rsi, 498
+  lea rax, QWORD PTR .LiteralString315[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString318[rip]
+  mov r8, rax
+  mov al, BYTE PTR -18[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 92
+  mov rsi, 499
+  lea rax, QWORD PTR .LiteralString317[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+  lea rax, QWORD PTR .LiteralString320[rip]
+  mov r8, rax
+  mov al, BYTE PTR -10[rbp]
+  movsx rax, al
+  mov rcx, rax
+  mov r9, 47
+  mov rsi, 500
+  lea rax, QWORD PTR .LiteralString319[rip]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call assert
+.Lreturn_testLongTokens:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rbx
+  mov al, 0
+  call test_local_variables
+  mov al, 0
+  call test_increment_or_decrement_array_element
+  mov al, 0
+  call test_global_variables
+  lea rax, QWORD PTR .LiteralString322[rip]
+  mov rbx, rax
+  mov al, 0
+  call local_var_independent
+  mov rcx, rax
+  mov r8, 10
+  mov rsi, 507
+  lea rax, QWORD PTR .LiteralString321[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov r8, rbx
+  mov al, 0
+  call assert
+  mov al, 0
+  call test_static_local_variable
+  mov al, 0
+  call test_access_results_in_array
+  mov al, 0
+  call test_extern_variable
+  mov al, 0
+  call testDeclArray
+  mov al, 0
+  call testSubBetweenPointers
+  mov al, 0
+  call testIndexedAccess
+  mov al, 0
+  call testLongTokens
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rbx, QWORD PTR -8[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "test/variables.c"
+.LiteralString1:
+  .string  "g_num1"
+.LiteralString2:
+  .string  "test/variables.c"
+.LiteralString3:
+  .string  "g_array[0]"
+.LiteralString4:
+  .string  "test/variables.c"
+.LiteralString5:
+  .string  "g_array[1]"
+.LiteralString6:
+  .string  "test/variables.c"
+.LiteralString7:
+  .string  "g_array[2]"
+.LiteralString8:
+  .string  "test/variables.c"
+.LiteralString9:
+  .string  "g_num2"
+.LiteralString10:
+  .string  "test/variables.c"
+.LiteralString11:
+  .string  "g_marray2[1][2][2]"
+.LiteralString12:
+  .string  "test/variables.c"
+.LiteralString13:
+  .string  "g_marray2[1][2][3]"
+.LiteralString14:
+  .string  "test/variables.c"
+.LiteralString15:
+  .string  "g_marray1[i][j]"
+.LiteralString16:
+  .string  "test/variables.c"
+.LiteralString17:
+  .string  "*g_ptr"
+.LiteralString18:
+  .string  "test/variables.c"
+.LiteralString19:
+  .string  "g_num2"
+.LiteralString20:
+  .string  "test/variables.c"
+.LiteralString21:
+  .string  "*g_ptr"
+.LiteralString22:
+  .string  "test/variables.c"
+.LiteralString23:
+  .string  "g_ptr[0]"
+.LiteralString24:
+  .string  "test/variables.c"
+.LiteralString25:
+  .string  "g_ptr[1]"
+.LiteralString26:
+  .string  "test/variables.c"
+.LiteralString27:
+  .string  "g_ptr[2]"
+.LiteralString28:
+  .string  "test/variables.c"
+.LiteralString29:
+  .string  "*g_ptr"
+.LiteralString30:
+  .string  "test/variables.c"
+.LiteralString31:
+  .string  "g_array[0]"
+.LiteralString32:
+  .string  "test/variables.c"
+.LiteralString33:
+  .string  "*g_ptr"
+.LiteralString34:
+  .string  "test/variables.c"
+.LiteralString35:
+  .string  "*g_ptr"
+.LiteralString36:
+  .string  "test/variables.c"
+.LiteralString37:
+  .string  "*g_ptr"
+.LiteralString38:
+  .string  "test/variables.c"
+.LiteralString39:
+  .string  "*g_ptr"
+.LiteralString40:
+  .string  "test/variables.c"
+.LiteralString41:
+  .string  "a"
+.LiteralString42:
+  .string  "test/variables.c"
+.LiteralString43:
+  .string  "a"
+.LiteralString44:
+  .string  "test/variables.c"
+.LiteralString45:
+  .string  "a"
+.LiteralString46:
+  .string  "test/variables.c"
+.LiteralString47:
+  .string  "b"
+.LiteralString48:
+  .string  "test/variables.c"
+.LiteralString49:
+  .string  "a"
+.LiteralString50:
+  .string  "test/variables.c"
+.LiteralString51:
+  .string  "b"
+.LiteralString52:
+  .string  "test/variables.c"
+.LiteralString53:
+  .string  "a + b"
+.LiteralString54:
+  .string  "test/variables.c"
+.LiteralString55:
+  .string  "a * b"
+.LiteralString56:
+  .string  "test/variables.c"
+.LiteralString57:
+  .string  "a < b"
+.LiteralString58:
+  .string  "test/variables.c"
+.LiteralString59:
+  .string  "a > b"
+.LiteralString60:
+  .string  "test/variables.c"
+.LiteralString61:
+  .string  "foo"
+.LiteralString62:
+  .string  "test/variables.c"
+.LiteralString63:
+  .string  "foo"
+.LiteralString64:
+  .string  "test/variables.c"
+.LiteralString65:
+  .string  "bar"
+.LiteralString66:
+  .string  "test/variables.c"
+.LiteralString67:
+  .string  "foo * bar"
+.LiteralString68:
+  .string  "test/variables.c"
+.LiteralString69:
+  .string  "foo"
+.LiteralString70:
+  .string  "test/variables.c"
+.LiteralString71:
+  .string  "bar"
+.LiteralString72:
+  .string  "test/variables.c"
+.LiteralString73:
+  .string  "bar"
+.LiteralString74:
+  .string  "test/variables.c"
+.LiteralString75:
+  .string  "bar"
+.LiteralString76:
+  .string  "test/variables.c"
+.LiteralString77:
+  .string  "foo"
+.LiteralString78:
+  .string  "test/variables.c"
+.LiteralString79:
+  .string  "bar"
+.LiteralString80:
+  .string  "test/variables.c"
+.LiteralString81:
+  .string  "a + b + c + d"
+.LiteralString82:
+  .string  "test/variables.c"
+.LiteralString83:
+  .string  "a"
+.LiteralString84:
+  .string  "test/variables.c"
+.LiteralString85:
+  .string  "b"
+.LiteralString86:
+  .string  "test/variables.c"
+.LiteralString87:
+  .string  "c"
+.LiteralString88:
+  .string  "test/variables.c"
+.LiteralString89:
+  .string  "d"
+.LiteralString90:
+  .string  "test/variables.c"
+.LiteralString91:
+  .string  "n"
+.LiteralString92:
+  .string  "test/variables.c"
+.LiteralString93:
+  .string  "++n"
+.LiteralString94:
+  .string  "test/variables.c"
+.LiteralString95:
+  .string  "n"
+.LiteralString96:
+  .string  "test/variables.c"
+.LiteralString97:
+  .string  "--n"
+.LiteralString98:
+  .string  "test/variables.c"
+.LiteralString99:
+  .string  "n"
+.LiteralString100:
+  .string  "test/variables.c"
+.LiteralString101:
+  .string  "n++"
+.LiteralString102:
+  .string  "test/variables.c"
+.LiteralString103:
+  .string  "n"
+.LiteralString104:
+  .string  "test/variables.c"
+.LiteralString105:
+  .string  "n--"
+.LiteralString106:
+  .string  "test/variables.c"
+.LiteralString107:
+  .string  "n"
+.LiteralString108:
+  .string  "test/variables.c"
+.LiteralString109:
+  .string  "n"
+.LiteralString110:
+  .string  "test/variables.c"
+.LiteralString111:
+  .string  "n"
+.LiteralString112:
+  .string  "test/variables.c"
+.LiteralString113:
+  .string  "*a"
+.LiteralString114:
+  .string  "test/variables.c"
+.LiteralString115:
+  .string  "a[0]"
+.LiteralString116:
+  .string  "test/variables.c"
+.LiteralString117:
+  .string  "*(a+1)"
+.LiteralString118:
+  .string  "test/variables.c"
+.LiteralString119:
+  .string  "a[1]"
+.LiteralString120:
+  .string  "test/variables.c"
+.LiteralString121:
+  .string  "*a"
+.LiteralString122:
+  .string  "test/variables.c"
+.LiteralString123:
+  .string  "a"
+.LiteralString124:
+  .string  "test/variables.c"
+.LiteralString125:
+  .string  "b[0]"
+.LiteralString126:
+  .string  "test/variables.c"
+.LiteralString127:
+  .string  "b[1]"
+.LiteralString128:
+  .string  "test/variables.c"
+.LiteralString129:
+  .string  "c"
+.LiteralString130:
+  .string  "test/variables.c"
+.LiteralString131:
+  .string  "p[0]"
+.LiteralString132:
+  .string  "test/variables.c"
+.LiteralString133:
+  .string  "p[1]"
+.LiteralString134:
+  .string  "test/variables.c"
+.LiteralString135:
+  .string  "p[2]"
+.LiteralString136:
+  .string  "test/variables.c"
+.LiteralString137:
+  .string  "p[3]"
+.LiteralString138:
+  .string  "test/variables.c"
+.LiteralString139:
+  .string  "*(++p)"
+.LiteralString140:
+  .string  "test/variables.c"
+.LiteralString141:
+  .string  "n"
+.LiteralString142:
+  .string  "test/variables.c"
+.LiteralString143:
+  .string  "*p"
+.LiteralString144:
+  .string  "test/variables.c"
+.LiteralString145:
+  .string  "n"
+.LiteralString146:
+  .string  "test/variables.c"
+.LiteralString147:
+  .string  "**pp"
+.LiteralString148:
+  .string  "test/variables.c"
+.LiteralString149:
+  .string  "n"
+.LiteralString150:
+  .string  "test/variables.c"
+.LiteralString151:
+  .string  "x[i][j]"
+.LiteralString152:
+  .string  "test/variables.c"
+.LiteralString153:
+  .string  "a"
+.LiteralString154:
+  .string  "test/variables.c"
+.LiteralString155:
+  .string  "b"
+.LiteralString156:
+  .string  "test/variables.c"
+.LiteralString157:
+  .string  "a + b"
+.LiteralString158:
+  .string  "test/variables.c"
+.LiteralString159:
+  .string  "a == b"
+.LiteralString160:
+  .string  "test/variables.c"
+.LiteralString161:
+  .string  "a"
+.LiteralString162:
+  .string  "test/variables.c"
+.LiteralString163:
+  .string  "a"
+.LiteralString164:
+  .string  "test/variables.c"
+.LiteralString165:
+  .string  "a"
+.LiteralString166:
+  .string  "test/variables.c"
+.LiteralString167:
+  .string  "x[1] + y"
+.LiteralString168:
+  .string  "test/variables.c"
+.LiteralString169:
+  .string  "*p"
+.LiteralString170:
+  .string  "abc"
+.LiteralString171:
+  .string  "test/variables.c"
+.LiteralString172:
+  .string  "*s"
+.LiteralString173:
+  .string  "test/variables.c"
+.LiteralString174:
+  .string  "s[1]"
+.LiteralString175:
+  .string  "test/variables.c"
+.LiteralString176:
+  .string  "s[2]"
+.LiteralString177:
+  .string  "def"
+.LiteralString178:
+  .string  "test/variables.c"
+.LiteralString179:
+  .string  "*s"
+.LiteralString180:
+  .string  "test/variables.c"
+.LiteralString181:
+  .string  "s[1]"
+.LiteralString182:
+  .string  "test/variables.c"
+.LiteralString183:
+  .string  "s[2]"
+.LiteralString184:
+  .string  "test/variables.c"
+.LiteralString185:
+  .string  "p == &n"
+.LiteralString186:
+  .string  "test/variables.c"
+.LiteralString187:
+  .string  "vp == &p"
+.LiteralString188:
+  .string  "test/variables.c"
+.LiteralString189:
+  .string  "p == 0"
+.LiteralString190:
+  .string  "test/variables.c"
+.LiteralString191:
+  .string  "p != 0"
+.LiteralString192:
+  .string  "test/variables.c"
+.LiteralString193:
+  .string  "p == 0"
+.LiteralString194:
+  .string  "test/variables.c"
+.LiteralString195:
+  .string  "p != 0"
+.LiteralString196:
+  .string  "test/variables.c"
+.LiteralString197:
+  .string  "p == 0"
+.LiteralString198:
+  .string  "test/variables.c"
+.LiteralString199:
+  .string  "p != 0"
+.LiteralString200:
+  .string  "test/variables.c"
+.LiteralString201:
+  .string  "p == 0"
+.LiteralString202:
+  .string  "test/variables.c"
+.LiteralString203:
+  .string  "p != 0"
+.LiteralString204:
+  .string  "test/variables.c"
+.LiteralString205:
+  .string  "x[2]"
+.LiteralString206:
+  .string  "test/variables.c"
+.LiteralString207:
+  .string  "x[2]"
+.LiteralString208:
+  .string  "test/variables.c"
+.LiteralString209:
+  .string  "x[2]"
+.LiteralString210:
+  .string  "test/variables.c"
+.LiteralString211:
+  .string  "x[2]"
+.LiteralString212:
+  .string  "test/variables.c"
+.LiteralString213:
+  .string  "helper_countup()"
+.LiteralString214:
+  .string  "test/variables.c"
+.LiteralString215:
+  .string  "helper_countup()"
+.LiteralString216:
+  .string  "test/variables.c"
+.LiteralString217:
+  .string  "helper_countup()"
+.LiteralString218:
+  .string  "test/variables.c"
+.LiteralString219:
+  .string  "helper_countup2()"
+.LiteralString220:
+  .string  "test/variables.c"
+.LiteralString221:
+  .string  "helper_countup2()"
+.LiteralString222:
+  .string  "test/variables.c"
+.LiteralString223:
+  .string  "helper_countup2()"
+.LiteralString224:
+  .string  "test/variables.c"
+.LiteralString225:
+  .string  "helper_countup()"
+.LiteralString226:
+  .string  "test/variables.c"
+.LiteralString227:
+  .string  "par[0]"
+.LiteralString228:
+  .string  "test/variables.c"
+.LiteralString229:
+  .string  "par[1]"
+.LiteralString230:
+  .string  "test/variables.c"
+.LiteralString231:
+  .string  "par[2]"
+.LiteralString232:
+  .string  "test/variables.c"
+.LiteralString233:
+  .string  "par[3]"
+.LiteralString234:
+  .string  "test/variables.c"
+.LiteralString235:
+  .string  "par[4]"
+.LiteralString236:
+  .string  "test/variables.c"
+.LiteralString237:
+  .string  "gExternVar"
+.LiteralString238:
+  .string  "test/variables.c"
+.LiteralString239:
+  .string  "sizeof(a)"
+.LiteralString240:
+  .string  "test/variables.c"
+.LiteralString241:
+  .string  "sizeof(a)"
+.LiteralString242:
+  .string  "test/variables.c"
+.LiteralString243:
+  .string  "sizeof(a)"
+.LiteralString244:
+  .string  "test/variables.c"
+.LiteralString245:
+  .string  "sizeof(a)"
+.LiteralString246:
+  .string  "test/variables.c"
+.LiteralString247:
+  .string  "sizeof(a)"
+.LiteralString248:
+  .string  "test/variables.c"
+.LiteralString249:
+  .string  "sizeof(a)"
+.LiteralString250:
+  .string  "test/variables.c"
+.LiteralString251:
+  .string  "sizeof(a)"
+.LiteralString252:
+  .string  "test/variables.c"
+.LiteralString253:
+  .string  "sizeof(a)"
+.LiteralString254:
+  .string  "test/variables.c"
+.LiteralString255:
+  .string  "sizeof(a)"
+.LiteralString256:
+  .string  "test/variables.c"
+.LiteralString257:
+  .string  "sizeof(a)"
+.LiteralString258:
+  .string  "test/variables.c"
+.LiteralString259:
+  .string  "sizeof(a)"
+.LiteralString260:
+  .string  "test/variables.c"
+.LiteralString261:
+  .string  "q - p"
+.LiteralString262:
+  .string  "test/variables.c"
+.LiteralString263:
+  .string  "p - q"
+.LiteralString264:
+  .string  "test/variables.c"
+.LiteralString265:
+  .string  "q - p"
+.LiteralString266:
+  .string  "test/variables.c"
+.LiteralString267:
+  .string  "p - q"
+.LiteralString268:
+  .string  "test/variables.c"
+.LiteralString269:
+  .string  "q - p"
+.LiteralString270:
+  .string  "test/variables.c"
+.LiteralString271:
+  .string  "p - q"
+.LiteralString272:
+  .string  "test/variables.c"
+.LiteralString273:
+  .string  "q - p"
+.LiteralString274:
+  .string  "test/variables.c"
+.LiteralString275:
+  .string  "p - q"
+.LiteralString276:
+  .string  "test/variables.c"
+.LiteralString277:
+  .string  "q - p"
+.LiteralString278:
+  .string  "test/variables.c"
+.LiteralString279:
+  .string  "p - q"
+.LiteralString280:
+  .string  "test/variables.c"
+.LiteralString281:
+  .string  "c[i]"
+.LiteralString282:
+  .string  "test/variables.c"
+.LiteralString283:
+  .string  "n[i]"
+.LiteralString284:
+  .string  "test/variables.c"
+.LiteralString285:
+  .string  "*(i + n)"
+.LiteralString286:
+  .string  "test/variables.c"
+.LiteralString287:
+  .string  "n[i + 2]"
+.LiteralString288:
+  .string  "test/variables.c"
+.LiteralString289:
+  .string  "p[-i]"
+.LiteralString290:
+  .string  "test/variables.c"
+.LiteralString291:
+  .string  "*(p + i)"
+.LiteralString292:
+  .string  "test/variables.c"
+.LiteralString293:
+  .string  "m[i][i + 1]"
+.LiteralString294:
+  .string  "test/variables.c"
+.LiteralString295:
+  .string  "*ps[i]"
+.LiteralString296:
+  .string  "test/variables.c"
+.LiteralString297:
+  .string  "ps[i][i]"
+.LiteralString298:
+  .string  "test/variables.c"
+.LiteralString299:
+  .string  "c[1]"
+.LiteralString300:
+  .string  "test/variables.c"
+.LiteralString301:
+  .string  "n[2]"
+.LiteralString302:
+  .string  "test/variables.c"
+.LiteralString303:
+  .string  "n[0]"
+.LiteralString304:
+  .string  "test/variables.c"
+.LiteralString305:
+  .string  "s[1].b"
+.LiteralString306:
+  .string  "test/variables.c"
+.LiteralString307:
+  .string  "(char *)&s[i] - (char *)&s[0]"
+.LiteralString308:
+  .string  "0123456789abcdef\"0123456789\\abcdef*/"
+.LiteralString309:
+  .string  "test/variables.c"
+.LiteralString310:
+  .string  "a_rather_long_variable_name_0"
+.LiteralString311:
+  .string  "test/variables.c"
+.LiteralString312:
+  .string  "a_rather_long_variable_name_1"
+.LiteralString313:
+  .string  "test/variables.c"
+.LiteralString314:
+  .string  "sizeof(s)"
+.LiteralString315:
+  .string  "test/variables.c"
+.LiteralString316:
+  .string  "s[16]"
+.LiteralString317:
+  .string  "test/variables.c"
+.LiteralString318:
+  .string  "s[27]"
+.LiteralString319:
+  .string  "test/variables.c"
+.LiteralString320:
+  .string  "s[35]"
+.LiteralString321:
+  .string  "test/variables.c"
+.LiteralString322:
+  .string  "local_var_independent()"
+.globl gExternVar
+gExternVar:
+  .zero 4
+.globl g_num2
+g_num2:
+  .zero 4
+.globl g_marray2
+g_marray2:
+  .zero 96
+.globl g_marray1
+g_marray1:
+  .zero 24
+.globl g_array
+g_array:
+  .zero 12
+.globl g_ptr
+g_ptr:
+  .zero 8
+.globl g_num1
+g_num1:
+  .zero 4
+.StaticVar2:
+  .zero 4
+.StaticVar1:
+  .zero 4
+.StaticVar0:
+  .zero 4
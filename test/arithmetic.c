@@ -115,10 +115,88 @@ void testOctalNumber(void) {
     ASSERT(59, 073);
 }
 
+void testImmediateOperands(void) {
+    int n = 7;
+    int a[4] = {1, 2, 3, 4};
+    int *p = &a[1];
+
+    ASSERT(10, n + 3);
+    ASSERT(10, 3 + n);
+    ASSERT(4, n - 3);
+    ASSERT(-4, 3 - n);
+    ASSERT(28, n * 4);
+    ASSERT(-28, -4 * n);
+    ASSERT(3, n & 3);
+    ASSERT(15, 8 | n);
+    ASSERT(5, n ^ 2);
+    ASSERT(56, n << 3);
+    ASSERT(1, n >> 2);
+    ASSERT(1, n < 8);
+    ASSERT(0, 7 < n);
+    ASSERT(1, 7 <= n);
+    ASSERT(1, 7 == n);
+    ASSERT(0, n != 7);
+    ASSERT(4, *(p + 2));
+    ASSERT(4, *(2 + p));
+    ASSERT(1, *(p - 1));
+}
+
+void testConstantExpressions(void) {
+    int zero = 0;
+    ASSERT(4095, (1 << 12) - 1);
+    ASSERT(-7, 7 / -1);
+    ASSERT(1, 7 % -2);
+    ASSERT(44, (char)300);
+    ASSERT(-56, (char)200);
+    ASSERT(1, 3 < 5 && !(2 == 3));
+    ASSERT(0, zero && 1);
+    ASSERT(1, 2 || zero);
+    ASSERT(6, 0 ? 5 : 6);
+    ASSERT(13, (1 + 2) * 4 + 1);
+}
+
+void testConstantDivisors(void) {
+    int d3 = 3, d8 = 8, d10 = 10, d641 = 641, dbig = 1000000007;
+    int values[8] = {0, 1, -1, 7919, -104729, 2147483647, -2147483647 - 1, 65536};
+
+    for (int i = 0; i < 8; ++i) {
+        int n = values[i];
+        ASSERT(n / d3, n / 3);
+        ASSERT(n % d3, n % 3);
+        ASSERT(n / d8, n / 8);
+        ASSERT(n % d8, n % 8);
+        ASSERT(n / d10, n / 10);
+        ASSERT(n % d10, n % 10);
+        ASSERT(n / d641, n / 641);
+        ASSERT(n % d641, n % 641);
+        ASSERT(n / dbig, n / 1000000007);
+        ASSERT(n % dbig, n % 1000000007);
+        ASSERT(n, n / 1);
+        ASSERT(0, n % 1);
+    }
+    ASSERT(-2, -7 / 3);
+    ASSERT(-1, -7 % 3);
+    ASSERT(-3, -25 / 8);
+    ASSERT(-1, -25 % 8);
+}
+
+void testConstantMultipliers(void) {
+    int n = 13;
+    ASSERT(104, n * 8);
+    ASSERT(117, n * 9);
+    ASSERT(91, n * 7);
+    ASSERT(-403, -n * 31);
+    ASSERT(143, 11 * n);
+}
+
 int main(void) {
     testArithmeticComputation();
     testArithmeticAssignment();
     testHexNumber();
     testOctalNumber();
+    testImmediateOperands();
+    testConstantExpressions();
+    testConstantDivisors();
+    testConstantMultipliers();
     return 0;
 }
@@ -227,6 +227,70 @@ NE__;
     }
 }
 
+void testLineContinuationInsideTokens(void) {
+    int n = 1;
+    char *s = "ab\
+cd";
+
+    n +\
+= 2;
+    if (n != 3) {
+        printf("testLineContinuationInsideTokens(): n != 3: %d\n", n);
+        exit(1);
+    }
+
+    if (strcmp(s, "abcd")) {
+        printf("testLineContinuationInsideTokens(): s != \"abcd\": %s\n", s);
+        exit(1);
+    }
+
+    // Continued comment \
+    n = 0;
+    if (n != 3) {
+        printf("testLineContinuationInsideTokens(): n != 3: %d\n", n);
+        exit(1);
+    }
+
+    /* A comment
+       across lines */
+    n = __LINE__;
+    if (n != 256) {
+        printf("testLineContinuationInsideTokens(): __LINE__ != 256: %d\n", n);
+        exit(1);
+    }
+
+    n = /\
+/ 0
+    __LINE__;
+    if (n != 264) {
+        printf("testLineContinuationInsideTokens(): __LINE__ != 264: %d\n", n);
+        exit(1);
+    }
+
+    if ('\
+a' != 'a' || 'b\
+' != 'b' || '\\
+n' != '\n') {
+        printf("testLineContinuationInsideTokens(): Broken character literal.\n");
+        exit(1);
+    }
+}
+
+#define FN_EMPTY()
+#
+#define LINE_END_MACRO  67
+void testDirectiveLineEnds(void) {
+    int n = ADD2(1,
+            LINE_END_MACRO) FN_EMPTY();
+#ifdef LINE_END_MACRO
+#
+    if (n != 68) {
+        printf("testDirectiveLineEnds(): n != 68: %d\n", n);
+        exit(1);
+    }
+#endif
+}
+
 int main(void) {
     testObjectiveMacro();
     testEmptyObjectiveMacro();
@@ -239,5 +303,7 @@ int main(void) {
     testFuncLikeMacroWithOneParam();
     testFuncLikeMacroWithMultiParam();
     testLineContinuation();
+    testLineContinuationInsideTokens();
+    testDirectiveLineEnds();
     printf("OK\n");
 }
@@ -0,0 +1,1518 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl todo
+todo:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  mov al, 0
+  call error
+.Lreturn_todo:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getRegName:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  ja .Lswitch_default_0
+  lea rdi, QWORD PTR .Lswitch_table_0[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_0:
+  .long .Lswitch_case_0_0 - .Lswitch_table_0
+  .long .Lswitch_case_0_1 - .Lswitch_table_0
+  .long .Lswitch_case_0_2 - .Lswitch_table_0
+  .long .Lswitch_case_0_3 - .Lswitch_table_0
+  .long .Lswitch_case_0_4 - .Lswitch_table_0
+.previous
+.Lswitch_case_0_0:
+  mov rdi, 3
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend0
+.Lswitch_case_0_1:
+  mov rdi, 2
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend0
+.Lswitch_case_0_2:
+  mov rdi, 1
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend0
+.Lswitch_case_0_3:
+.Lswitch_case_0_4:
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend0
+.Lswitch_default_0:
+  mov rcx, 47
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend0:
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 32
+  imul rax, rsi
+  add rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  jmp .Lreturn_getRegName
+.Lreturn_getRegName:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+stringifyOperand:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lswitch_case_1_0
+  cmp rax, 1
+  je .Lswitch_case_1_1
+  cmp rax, 2
+  je .Lswitch_case_1_2
+  jmp .Lend1
+.Lswitch_case_1_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  mov al, 0
+  call getRegName
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  jmp .Lreturn_stringifyOperand
+.Lswitch_case_1_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse2_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  jmp .Lreturn_stringifyOperand
+  jmp .Lend2
+.Lelse2_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  jmp .Lreturn_stringifyOperand
+  jmp .Lend2
+.Lend2:
+.Lswitch_case_1_2:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -88[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rax, QWORD PTR -96[rbp]
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse3_0
+  mov rdi, 0
+  lea rax, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  ja .Lend4
+  lea rdi, QWORD PTR .Lswitch_table_4[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_4:
+  .long .Lswitch_case_4_0 - .Lswitch_table_4
+  .long .Lswitch_case_4_1 - .Lswitch_table_4
+  .long .Lswitch_case_4_2 - .Lswitch_table_4
+  .long .Lswitch_case_4_3 - .Lswitch_table_4
+  .long .Lswitch_case_4_4 - .Lswitch_table_4
+.previous
+.Lswitch_case_4_0:
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend4
+.Lswitch_case_4_1:
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend4
+.Lswitch_case_4_2:
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend4
+.Lswitch_case_4_3:
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend4
+.Lswitch_case_4_4:
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend4
+.Lend4:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lend5
+  mov rcx, 102
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend5:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse6_0
+  lea rdi, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov rdx, r10
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin7:
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend8
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend8:
+.Literator7:
+.Lend7:
+  jmp .Lend6
+.Lelse6_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend6
+.Lend6:
+  jmp .Lend3
+.Lelse3_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend3
+.Lend3:
+  .p2align 4
+.Lbegin9:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend10
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend10:
+.Literator9:
+.Lend9:
+  .p2align 4
+.Lbegin11:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend12
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend12:
+.Literator11:
+.Lend11:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stringifyOperand
+.Lend1:
+  mov rcx, 126
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lreturn_stringifyOperand:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getMnemonic:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 3
+  cmp rax, 26
+  ja .Lswitch_default_13
+  lea rdi, QWORD PTR .Lswitch_table_13[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_13:
+  .long .Lswitch_case_13_3 - .Lswitch_table_13
+  .long .Lswitch_default_13 - .Lswitch_table_13
+  .long .Lswitch_default_13 - .Lswitch_table_13
+  .long .Lswitch_default_13 - .Lswitch_table_13
+  .long .Lswitch_default_13 - .Lswitch_table_13
+  .long .Lswitch_case_13_8 - .Lswitch_table_13
+  .long .Lswitch_case_13_9 - .Lswitch_table_13
+  .long .Lswitch_case_13_a - .Lswitch_table_13
+  .long .Lswitch_case_13_b - .Lswitch_table_13
+  .long .Lswitch_case_13_c - .Lswitch_table_13
+  .long .Lswitch_case_13_d - .Lswitch_table_13
+  .long .Lswitch_case_13_e - .Lswitch_table_13
+  .long .Lswitch_case_13_f - .Lswitch_table_13
+  .long .Lswitch_case_13_10 - .Lswitch_table_13
+  .long .Lswitch_case_13_11 - .Lswitch_table_13
+  .long .Lswitch_case_13_12 - .Lswitch_table_13
+  .long .Lswitch_case_13_13 - .Lswitch_table_13
+  .long .Lswitch_case_13_14 - .Lswitch_table_13
+  .long .Lswitch_case_13_15 - .Lswitch_table_13
+  .long .Lswitch_case_13_16 - .Lswitch_table_13
+  .long .Lswitch_case_13_17 - .Lswitch_table_13
+  .long .Lswitch_case_13_18 - .Lswitch_table_13
+  .long .Lswitch_case_13_19 - .Lswitch_table_13
+  .long .Lswitch_case_13_1a - .Lswitch_table_13
+  .long .Lswitch_case_13_1b - .Lswitch_table_13
+  .long .Lswitch_case_13_1c - .Lswitch_table_13
+  .long .Lswitch_case_13_1d - .Lswitch_table_13
+.previous
+.Lswitch_case_13_3:
+  lea rax, QWORD PTR .LiteralString85[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_8:
+  lea rax, QWORD PTR .LiteralString86[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_9:
+  lea rax, QWORD PTR .LiteralString87[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_a:
+  lea rax, QWORD PTR .LiteralString88[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_b:
+  lea rax, QWORD PTR .LiteralString89[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_c:
+  lea rax, QWORD PTR .LiteralString90[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_d:
+  lea rax, QWORD PTR .LiteralString91[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_e:
+  lea rax, QWORD PTR .LiteralString92[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_f:
+  lea rax, QWORD PTR .LiteralString93[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_10:
+  lea rax, QWORD PTR .LiteralString94[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_11:
+  lea rax, QWORD PTR .LiteralString95[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_12:
+  lea rax, QWORD PTR .LiteralString96[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_13:
+  lea rax, QWORD PTR .LiteralString97[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_14:
+  lea rax, QWORD PTR .LiteralString98[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_15:
+  lea rax, QWORD PTR .LiteralString99[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_16:
+  lea rax, QWORD PTR .LiteralString100[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_17:
+  lea rax, QWORD PTR .LiteralString101[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_18:
+  lea rax, QWORD PTR .LiteralString102[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_19:
+  lea rax, QWORD PTR .LiteralString103[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_1a:
+  lea rax, QWORD PTR .LiteralString104[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_1b:
+  lea rax, QWORD PTR .LiteralString105[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_1c:
+  lea rax, QWORD PTR .LiteralString106[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_case_13_1d:
+  lea rax, QWORD PTR .LiteralString107[rip]
+  jmp .Lreturn_getMnemonic
+.Lswitch_default_13:
+  mov rcx, 179
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend13:
+.Lreturn_getMnemonic:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getCondSuffix:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  ja .Lend14
+  lea rdi, QWORD PTR .Lswitch_table_14[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_14:
+  .long .Lswitch_case_14_0 - .Lswitch_table_14
+  .long .Lswitch_case_14_1 - .Lswitch_table_14
+  .long .Lswitch_case_14_2 - .Lswitch_table_14
+  .long .Lswitch_case_14_3 - .Lswitch_table_14
+  .long .Lswitch_case_14_4 - .Lswitch_table_14
+  .long .Lswitch_case_14_5 - .Lswitch_table_14
+  .long .Lswitch_case_14_6 - .Lswitch_table_14
+  .long .Lswitch_case_14_7 - .Lswitch_table_14
+  .long .Lswitch_case_14_8 - .Lswitch_table_14
+  .long .Lswitch_case_14_9 - .Lswitch_table_14
+.previous
+.Lswitch_case_14_0:
+  lea rax, QWORD PTR .LiteralString108[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_1:
+  lea rax, QWORD PTR .LiteralString109[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_2:
+  lea rax, QWORD PTR .LiteralString110[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_3:
+  lea rax, QWORD PTR .LiteralString111[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_4:
+  lea rax, QWORD PTR .LiteralString112[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_5:
+  lea rax, QWORD PTR .LiteralString113[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_6:
+  lea rax, QWORD PTR .LiteralString114[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_7:
+  lea rax, QWORD PTR .LiteralString115[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_8:
+  lea rax, QWORD PTR .LiteralString116[rip]
+  jmp .Lreturn_getCondSuffix
+.Lswitch_case_14_9:
+  lea rax, QWORD PTR .LiteralString117[rip]
+  jmp .Lreturn_getCondSuffix
+.Lend14:
+  mov rcx, 207
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lreturn_getCondSuffix:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeOne:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -32[rbp], rbx
+  mov QWORD PTR -40[rbp], r12
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 33
+  ja .Lend15
+  lea rdi, QWORD PTR .Lswitch_table_15[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_15:
+  .long .Lswitch_case_15_0 - .Lswitch_table_15
+  .long .Lswitch_case_15_1 - .Lswitch_table_15
+  .long .Lswitch_case_15_2 - .Lswitch_table_15
+  .long .Lswitch_case_15_3 - .Lswitch_table_15
+  .long .Lswitch_case_15_4 - .Lswitch_table_15
+  .long .Lswitch_case_15_5 - .Lswitch_table_15
+  .long .Lswitch_case_15_6 - .Lswitch_table_15
+  .long .Lswitch_case_15_7 - .Lswitch_table_15
+  .long .Lswitch_case_15_8 - .Lswitch_table_15
+  .long .Lswitch_case_15_9 - .Lswitch_table_15
+  .long .Lswitch_case_15_a - .Lswitch_table_15
+  .long .Lswitch_case_15_b - .Lswitch_table_15
+  .long .Lswitch_case_15_c - .Lswitch_table_15
+  .long .Lswitch_case_15_d - .Lswitch_table_15
+  .long .Lswitch_case_15_e - .Lswitch_table_15
+  .long .Lswitch_case_15_f - .Lswitch_table_15
+  .long .Lswitch_case_15_10 - .Lswitch_table_15
+  .long .Lswitch_case_15_11 - .Lswitch_table_15
+  .long .Lswitch_case_15_12 - .Lswitch_table_15
+  .long .Lswitch_case_15_13 - .Lswitch_table_15
+  .long .Lswitch_case_15_14 - .Lswitch_table_15
+  .long .Lswitch_case_15_15 - .Lswitch_table_15
+  .long .Lswitch_case_15_16 - .Lswitch_table_15
+  .long .Lswitch_case_15_17 - .Lswitch_table_15
+  .long .Lswitch_case_15_18 - .Lswitch_table_15
+  .long .Lswitch_case_15_19 - .Lswitch_table_15
+  .long .Lswitch_case_15_1a - .Lswitch_table_15
+  .long .Lswitch_case_15_1b - .Lswitch_table_15
+  .long .Lswitch_case_15_1c - .Lswitch_table_15
+  .long .Lswitch_case_15_1d - .Lswitch_table_15
+  .long .Lswitch_case_15_1e - .Lswitch_table_15
+  .long .Lswitch_case_15_1f - .Lswitch_table_15
+  .long .Lswitch_case_15_20 - .Lswitch_table_15
+  .long .Lswitch_case_15_21 - .Lswitch_table_15
+.previous
+.Lswitch_case_15_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call dumps
+  jmp .Lend15
+.Lswitch_case_15_1:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+  .p2align 4
+.Lbegin16:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend17
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend17:
+.Literator16:
+.Lend16:
+  jmp .Lend15
+.Lswitch_case_15_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call getRegName
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+  jmp .Lend15
+.Lswitch_case_15_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+  jmp .Lend15
+.Lswitch_case_15_3:
+.Lswitch_case_15_8:
+.Lswitch_case_15_9:
+.Lswitch_case_15_a:
+.Lswitch_case_15_b:
+.Lswitch_case_15_c:
+.Lswitch_case_15_d:
+.Lswitch_case_15_e:
+.Lswitch_case_15_f:
+.Lswitch_case_15_10:
+.Lswitch_case_15_11:
+.Lswitch_case_15_12:
+.Lswitch_case_15_13:
+.Lswitch_case_15_14:
+.Lswitch_case_15_19:
+.Lswitch_case_15_1a:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call getMnemonic
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov rdi, rax
+  mov rdx, r12
+  mov rcx, rbx
+  mov al, 0
+  call dumpf
+  .p2align 4
+.Lbegin18:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend19
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend19:
+.Literator18:
+.Lend18:
+  .p2align 4
+.Lbegin20:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend21
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend21:
+.Literator20:
+.Lend20:
+  jmp .Lend15
+.Lswitch_case_15_15:
+.Lswitch_case_15_16:
+.Lswitch_case_15_17:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call stringifyOperand
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call getMnemonic
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rdi, rax
+  mov rdx, rbx
+  mov al, 0
+  call dumpf
+  .p2align 4
+.Lbegin22:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend23
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend23:
+.Literator22:
+.Lend22:
+  jmp .Lend15
+.Lswitch_case_15_18:
+.Lswitch_case_15_1b:
+.Lswitch_case_15_1c:
+.Lswitch_case_15_1d:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call getMnemonic
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+  jmp .Lend15
+.Lswitch_case_15_1e:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+  jmp .Lend15
+.Lswitch_case_15_1f:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call getCondSuffix
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov rdi, rax
+  mov rdx, rbx
+  mov al, 0
+  call dumpf
+  jmp .Lend15
+.Lswitch_case_15_20:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov rdi, rax
+  mov al, 0
+  call getRegName
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call getCondSuffix
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rdi, rax
+  mov rdx, rbx
+  mov al, 0
+  call dumpf
+  jmp .Lend15
+.Lswitch_case_15_5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend24
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+.Lend24:
+  jmp .Lend15
+.Lswitch_case_15_6:
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend25
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumpf
+.Lend25:
+  jmp .Lend15
+.Lswitch_case_15_7:
+  mov rcx, 288
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lswitch_case_15_21:
+  mov rcx, 290
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend15:
+.Lreturn_genCodeOne:
+  mov rbx, QWORD PTR -32[rbp]
+  mov r12, QWORD PTR -40[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl genCode
+genCode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend26
+  .p2align 4
+.Lbegin26:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeOne
+.Literator26:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin26
+.Lend26:
+.Lreturn_genCode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "not yet implemented"
+.LiteralString2:
+  .string  "rax"
+.LiteralString3:
+  .string  "eax"
+.LiteralString4:
+  .string  "ax"
+.LiteralString5:
+  .string  "al"
+.LiteralString6:
+  .string  "rdi"
+.LiteralString7:
+  .string  "edi"
+.LiteralString8:
+  .string  "di"
+.LiteralString9:
+  .string  "dil"
+.LiteralString10:
+  .string  "rsi"
+.LiteralString11:
+  .string  "esi"
+.LiteralString12:
+  .string  "si"
+.LiteralString13:
+  .string  "sil"
+.LiteralString14:
+  .string  "rdx"
+.LiteralString15:
+  .string  "edx"
+.LiteralString16:
+  .string  "dx"
+.LiteralString17:
+  .string  "dl"
+.LiteralString18:
+  .string  "rcx"
+.LiteralString19:
+  .string  "ecx"
+.LiteralString20:
+  .string  "cx"
+.LiteralString21:
+  .string  "cl"
+.LiteralString22:
+  .string  "rbp"
+.LiteralString23:
+  .string  "ebp"
+.LiteralString24:
+  .string  "bp"
+.LiteralString25:
+  .string  "bpl"
+.LiteralString26:
+  .string  "rsp"
+.LiteralString27:
+  .string  "esp"
+.LiteralString28:
+  .string  "sp"
+.LiteralString29:
+  .string  "spl"
+.LiteralString30:
+  .string  "rbx"
+.LiteralString31:
+  .string  "ebx"
+.LiteralString32:
+  .string  "bx"
+.LiteralString33:
+  .string  "bl"
+.LiteralString34:
+  .string  "r8"
+.LiteralString35:
+  .string  "r8d"
+.LiteralString36:
+  .string  "r8w"
+.LiteralString37:
+  .string  "r8b"
+.LiteralString38:
+  .string  "r9"
+.LiteralString39:
+  .string  "r9d"
+.LiteralString40:
+  .string  "r9w"
+.LiteralString41:
+  .string  "r9b"
+.LiteralString42:
+  .string  "r10"
+.LiteralString43:
+  .string  "r10d"
+.LiteralString44:
+  .string  "r10w"
+.LiteralString45:
+  .string  "r10b"
+.LiteralString46:
+  .string  "r11"
+.LiteralString47:
+  .string  "r11d"
+.LiteralString48:
+  .string  "r11w"
+.LiteralString49:
+  .string  "r11b"
+.LiteralString50:
+  .string  "r12"
+.LiteralString51:
+  .string  "r12d"
+.LiteralString52:
+  .string  "r12w"
+.LiteralString53:
+  .string  "r12b"
+.LiteralString54:
+  .string  "r13"
+.LiteralString55:
+  .string  "r13d"
+.LiteralString56:
+  .string  "r13w"
+.LiteralString57:
+  .string  "r13b"
+.LiteralString58:
+  .string  "r14"
+.LiteralString59:
+  .string  "r14d"
+.LiteralString60:
+  .string  "r14w"
+.LiteralString61:
+  .string  "r14b"
+.LiteralString62:
+  .string  "r15"
+.LiteralString63:
+  .string  "r15d"
+.LiteralString64:
+  .string  "r15w"
+.LiteralString65:
+  .string  "r15b"
+.LiteralString66:
+  .string  "xmm0"
+.LiteralString67:
+  .string  "xmm0"
+.LiteralString68:
+  .string  "xmm0"
+.LiteralString69:
+  .string  "xmm0"
+.LiteralString70:
+  .string  "rip"
+.LiteralString71:
+  .string  "eip"
+.LiteralString72:
+  .string  "ip"
+.LiteralString73:
+  .string  "ip"
+.LiteralString74:
+  .string  "%s"
+.LiteralString75:
+  .string  "%s"
+.LiteralString76:
+  .string  "%d"
+.LiteralString77:
+  .string  "BYTE"
+.LiteralString78:
+  .string  "WORD"
+.LiteralString79:
+  .string  "DWORD"
+.LiteralString80:
+  .string  "QWORD"
+.LiteralString81:
+  .string  "XMMWORD"
+.LiteralString82:
+  .string  "%s PTR %s[%s+%s*%d]"
+.LiteralString83:
+  .string  "%s PTR %s[%s]"
+.LiteralString84:
+  .string  "%s"
+.LiteralString85:
+  .string  "mov"
+.LiteralString86:
+  .string  "add"
+.LiteralString87:
+  .string  "sub"
+.LiteralString88:
+  .string  "imul"
+.LiteralString89:
+  .string  "and"
+.LiteralString90:
+  .string  "or"
+.LiteralString91:
+  .string  "xor"
+.LiteralString92:
+  .string  "sal"
+.LiteralString93:
+  .string  "sar"
+.LiteralString94:
+  .string  "cmp"
+.LiteralString95:
+  .string  "test"
+.LiteralString96:
+  .string  "lea"
+.LiteralString97:
+  .string  "movsx"
+.LiteralString98:
+  .string  "movzx"
+.LiteralString99:
+  .string  "idiv"
+.LiteralString100:
+  .string  "call"
+.LiteralString101:
+  .string  "jmp"
+.LiteralString102:
+  .string  "cqo"
+.LiteralString103:
+  .string  "movdqu"
+.LiteralString104:
+  .string  "pxor"
+.LiteralString105:
+  .string  "rep movsq"
+.LiteralString106:
+  .string  "rep stosq"
+.LiteralString107:
+  .string  "ret"
+.LiteralString108:
+  .string  "e"
+.LiteralString109:
+  .string  "ne"
+.LiteralString110:
+  .string  "l"
+.LiteralString111:
+  .string  "le"
+.LiteralString112:
+  .string  "g"
+.LiteralString113:
+  .string  "ge"
+.LiteralString114:
+  .string  "b"
+.LiteralString115:
+  .string  "be"
+.LiteralString116:
+  .string  "a"
+.LiteralString117:
+  .string  "ae"
+.LiteralString118:
+  .string  "  push %s\n"
+.LiteralString119:
+  .string  "  pop %s\n"
+.LiteralString120:
+  .string  "%s:\n"
+.LiteralString121:
+  .string  "  %s %s, %s\n"
+.LiteralString122:
+  .string  "  %s %s\n"
+.LiteralString123:
+  .string  "  %s\n"
+.LiteralString124:
+  .string  "  jmp %s\n"
+.LiteralString125:
+  .string  "  j%s %s\n"
+.LiteralString126:
+  .string  "  set%s %s\n"
+.LiteralString127:
+  .string  "  sub rsp, %d /* RSP alignment */\n"
+.LiteralString128:
+  .string  "  add rsp, %d\n"
+.LiteralString129:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString130:
+  .string  "%d:%d: Internal error: assert: %s"
+.LiteralString131:
+  .string  "codegen.c"
+.LiteralString132:
+  .string  "codegen.c"
+.LiteralString133:
+  .string  "codegen.c"
+.LiteralString134:
+  .string  "codegen.c"
+.LiteralString135:
+  .string  "codegen.c"
+.LiteralString136:
+  .string  "codegen.c"
+.LiteralString137:
+  .string  "codegen.c"
+.StaticVar0:
+  .quad .LiteralString2
+  .quad .LiteralString3
+  .quad .LiteralString4
+  .quad .LiteralString5
+  .quad .LiteralString6
+  .quad .LiteralString7
+  .quad .LiteralString8
+  .quad .LiteralString9
+  .quad .LiteralString10
+  .quad .LiteralString11
+  .quad .LiteralString12
+  .quad .LiteralString13
+  .quad .LiteralString14
+  .quad .LiteralString15
+  .quad .LiteralString16
+  .quad .LiteralString17
+  .quad .LiteralString18
+  .quad .LiteralString19
+  .quad .LiteralString20
+  .quad .LiteralString21
+  .quad .LiteralString22
+  .quad .LiteralString23
+  .quad .LiteralString24
+  .quad .LiteralString25
+  .quad .LiteralString26
+  .quad .LiteralString27
+  .quad .LiteralString28
+  .quad .LiteralString29
+  .quad .LiteralString30
+  .quad .LiteralString31
+  .quad .LiteralString32
+  .quad .LiteralString33
+  .quad .LiteralString34
+  .quad .LiteralString35
+  .quad .LiteralString36
+  .quad .LiteralString37
+  .quad .LiteralString38
+  .quad .LiteralString39
+  .quad .LiteralString40
+  .quad .LiteralString41
+  .quad .LiteralString42
+  .quad .LiteralString43
+  .quad .LiteralString44
+  .quad .LiteralString45
+  .quad .LiteralString46
+  .quad .LiteralString47
+  .quad .LiteralString48
+  .quad .LiteralString49
+  .quad .LiteralString50
+  .quad .LiteralString51
+  .quad .LiteralString52
+  .quad .LiteralString53
+  .quad .LiteralString54
+  .quad .LiteralString55
+  .quad .LiteralString56
+  .quad .LiteralString57
+  .quad .LiteralString58
+  .quad .LiteralString59
+  .quad .LiteralString60
+  .quad .LiteralString61
+  .quad .LiteralString62
+  .quad .LiteralString63
+  .quad .LiteralString64
+  .quad .LiteralString65
+  .quad .LiteralString66
+  .quad .LiteralString67
+  .quad .LiteralString68
+  .quad .LiteralString69
+  .quad .LiteralString70
+  .quad .LiteralString71
+  .quad .LiteralString72
+  .quad .LiteralString73
@@ -0,0 +1,2341 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl safeAlloc
+safeAlloc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call malloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend0
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  mov al, 0
+  call error
+.Lend0:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memset
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_safeAlloc
+.Lreturn_safeAlloc:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl format
+format:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rax, QWORD PTR -80[rbp]
+  mov DWORD PTR 0[rax], 8
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call vformat
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_format
+.Lreturn_format:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl vformat
+vformat:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 24
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, 0
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call vsnprintf
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend1
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov al, 0
+  call error
+.Lend1:
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rdi, rsi
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call vsnprintf
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_vformat
+.Lreturn_vformat:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl error
+error:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 8
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call vfprintf
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fprintf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lreturn_error:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl errorAt
+errorAt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -76[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -76[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -80[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend2
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  mov al, 0
+  call fputs
+  lea rax, QWORD PTR -104[rbp]
+  mov DWORD PTR 0[rax], 16
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call vfprintf
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fprintf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lend2:
+  lea rax, QWORD PTR -104[rbp]
+  mov DWORD PTR 0[rax], 16
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenFile
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenColumn
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rsi
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rsi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  mov rsi, 1
+  imul rdi, rsi
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond3
+  .p2align 4
+.Lbegin3:
+  lea rax, QWORD PTR -64[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator3:
+.Lcond3:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Llogicaland4
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lbegin3
+.Llogicaland4:
+.Lend3:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenLine
+  mov rcx, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fprintf
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fprintf
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  test rax, rax
+  je .Lend5
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fprintf
+.Lend5:
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fprintf
+  lea rax, QWORD PTR -104[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call vfprintf
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fprintf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lreturn_errorAt:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl dumpc
+dumpc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend6
+  mov rcx, 115
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend6:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp fputc
+.Lreturn_dumpc:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl dumps
+dumps:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend7
+  mov rcx, 122
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend7:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp fprintf
+.Lreturn_dumps:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl dumpf
+dumpf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend8
+  mov rcx, 132
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend8:
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 8
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call vfprintf
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_dumpf
+.Lreturn_dumpf:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl analyzeFilepath
+analyzeFilepath:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 72
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jle .Lend9
+  .p2align 4
+.Lbegin9:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  cmp rax, 47
+  jne .Lend10
+  jmp .Lend9
+.Lend10:
+.Literator9:
+  lea rax, QWORD PTR -36[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jg .Lbegin9
+.Lend9:
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_analyzeFilepath
+.Lreturn_analyzeFilepath:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl readFile
+readFile:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fopen
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend11
+  mov al, 0
+  call __errno_location
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call strerror
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend11:
+  mov rcx, 2
+  mov rsi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call fseek
+  cmp rax, -1
+  jne .Lend12
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fclose
+  mov al, 0
+  call __errno_location
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call strerror
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend12:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call ftell
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rcx, 0
+  mov rsi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call fseek
+  cmp rax, -1
+  jne .Lend13
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fclose
+  mov al, 0
+  call __errno_location
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call strerror
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend13:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  add eax, 16
+  movsx rax, eax
+  sal rax, 0
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  mov r8, 1
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fread
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fclose
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogicalor15
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  cmp rax, 10
+  je .Lend14
+.Llogicalor15:
+  mov rcx, 10
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+.Lend14:
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR 0[rsi+rax*1], dil
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_readFile
+.Lreturn_readFile:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl cmdlineArgsError
+cmdlineArgsError:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -40[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  mov DWORD PTR -16[rbp], edx
+  mov QWORD PTR -24[rbp], rcx
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend16
+  .p2align 4
+.Lbegin16:
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call fprintf
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Lend17
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend17:
+.Literator16:
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin16
+.Lend16:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR stderr[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call fprintf
+  mov rdi, 1
+  mov al, 0
+  call exit
+.Lreturn_cmdlineArgsError:
+  mov rbx, QWORD PTR -40[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+benchmarkTokenize:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call readFile
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  add eax, 16
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call analyzeFilepath
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov al, 0
+  call clock
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jge .Lend18
+  .p2align 4
+.Lbegin18:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  mov rdi, 0
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenize
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend19
+  .p2align 4
+.Lbegin19:
+  lea rax, QWORD PTR -44[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator19:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin19
+.Lend19:
+.Literator18:
+  lea rax, QWORD PTR -56[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jl .Lbegin18
+.Lend18:
+  mov al, 0
+  call clock
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend20
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend20:
+  sub rsp, 8 /* RSP alignment */
+  lea rax, QWORD PTR globals[rip]
+  add rax, 184
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_21
+  lea rax, QWORD PTR .LiteralString21[rip]
+  jmp .Lcond_end_21
+.Lcond_falsy_21:
+  lea rax, QWORD PTR .LiteralString22[rip]
+.Lcond_end_21:
+  push rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  imul rax, 10
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov r9, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcccccccd
+  imul rdi, rax
+  sar rdi, 35
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  mov r8, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r10, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov rdx, r10
+  mov al, 0
+  call printf
+  add rsp, 16
+.Lreturn_benchmarkTokenize:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 400
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 24
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -76[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -76[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend22
+  .p2align 4
+.Lbegin22:
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_0
+  lea rax, QWORD PTR -76[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend24
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call cmdlineArgsError
+.Lend24:
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_0:
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_1
+  jmp .Lend23
+.Lelse23_1:
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_2
+  mov rdi, 0
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_2:
+  mov rcx, 15
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, r8
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  jne .Lelse23_3
+  mov rcx, 10
+  mov r8, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  add rax, 15
+  mov rdi, rax
+  mov rsi, r8
+  mov rdx, rcx
+  mov al, 0
+  call strtol
+  mov rdi, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_3:
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_4
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_4:
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_5
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_5:
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_6
+  mov rdi, 1
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_6:
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_7
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_7:
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call strcmp
+  test rax, rax
+  jne .Lelse23_8
+  mov rdi, 1
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_8:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse23_9
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend23
+.Lelse23_9:
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call cmdlineArgsError
+  jmp .Lend23
+.Lend23:
+.Literator22:
+  lea rax, QWORD PTR -76[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -76[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin22
+.Lend22:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse25_0
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call cmdlineArgsError
+  jmp .Lend25
+.Lelse25_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend25
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend25
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rcx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call cmdlineArgsError
+  jmp .Lend25
+.Lend25:
+  lea rax, QWORD PTR Types[rip]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -128[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -136[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 64
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -256[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 192
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -328[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -320[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -328[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -392[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 4
+  lea rax, QWORD PTR -384[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -392[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  mov rcx, 192
+  mov rsi, 0
+  lea rax, QWORD PTR globals[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memset
+  lea rax, QWORD PTR globals[rip]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 176
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 180
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 184
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call analyzeFilepath
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 160
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 160
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  add eax, 9
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 168
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 160
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 168
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call sprintf
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend27
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call benchmarkTokenize
+  mov rax, 0
+  jmp .Lreturn_main
+.Lend27:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call readFile
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call analyzeFilepath
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenize
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call preprocess
+  mov al, 0
+  call program
+  lea rax, QWORD PTR globals[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call verifyType
+  lea rax, QWORD PTR globals[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call verifyFlow
+  lea rax, QWORD PTR globals[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineFunctions
+  lea rax, QWORD PTR globals[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstants
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fopen
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend28
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov al, 0
+  call error
+.Lend28:
+  lea rax, QWORD PTR globals[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genAsm
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call genAsmGlobals
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call optimizeAsm
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rdi, rax
+  mov al, 0
+  call dumps
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCode
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCode
+  lea rax, QWORD PTR globals[rip]
+  add rax, 152
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call fclose
+  mov rax, 0
+  jmp .Lreturn_main
+  mov rax, 0
+.Lreturn_main:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "Allocating memory failed."
+.LiteralString2:
+  .string  "vsnprintf() error: returned: %d"
+.LiteralString3:
+  .string  "\n"
+.LiteralString4:
+  .string  "Error while processing internal node: "
+.LiteralString5:
+  .string  "\n"
+.LiteralString6:
+  .string  "%s:%d: "
+.LiteralString7:
+  .string  "%.*s\n"
+.LiteralString8:
+  .string  "%*s"
+.LiteralString9:
+  .string  " "
+.LiteralString10:
+  .string  "^ "
+.LiteralString11:
+  .string  "\n"
+.LiteralString12:
+  .string  "%s\n"
+.LiteralString13:
+  .string  "r"
+.LiteralString14:
+  .string  "File open failed: %s: %s\n"
+.LiteralString15:
+  .string  "%s: fseek: %s\n"
+.LiteralString16:
+  .string  "%s: fseek: %s\n"
+.LiteralString17:
+  .string  "%s "
+.LiteralString18:
+  .string  "\n%*s %s\n"
+.LiteralString19:
+  .string  "^"
+.LiteralString20:
+  .string  "%s: %d bytes, %d tokens, %d us/round, %d MB/s (%s)\n"
+.LiteralString21:
+  .string  "fast"
+.LiteralString22:
+  .string  "scalar"
+.LiteralString23:
+  .string  "-o"
+.LiteralString24:
+  .string  "File name must follow after \"-o\""
+.LiteralString25:
+  .string  "-S"
+.LiteralString26:
+  .string  "-fno-inline"
+.LiteralString27:
+  .string  "-finline-limit="
+.LiteralString28:
+  .string  "-foptimize-sibling-calls"
+.LiteralString29:
+  .string  "-fno-optimize-sibling-calls"
+.LiteralString30:
+  .string  "-ffast-lex"
+.LiteralString31:
+  .string  "-fno-fast-lex"
+.LiteralString32:
+  .string  "--bench-tokenize"
+.LiteralString33:
+  .string  "Invalid argument"
+.LiteralString34:
+  .string  "No input file is specified"
+.LiteralString35:
+  .string  "No output file is specified"
+.LiteralString36:
+  .string  "%sinclude/"
+.LiteralString37:
+  .string  "wb"
+.LiteralString38:
+  .string  "Failed to open file: %s"
+.LiteralString39:
+  .string  ".intel_syntax noprefix"
+.LiteralString40:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString41:
+  .string  "%d:%d: Internal error: assert: %s"
+.LiteralString42:
+  .string  "main.c"
+.LiteralString43:
+  .string  "main.c"
+.LiteralString44:
+  .string  "main.c"
+.globl globals
+globals:
+  .zero 192
+.globl Types
+Types:
+  .zero 320
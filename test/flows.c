@@ -259,6 +259,119 @@ void test_switch_constFolding(void) {
     ASSERT(5, n);
 }
 
+int switch_dense(int n) {
+    switch (n) {
+    case -2: return 10;
+    case -1: return 11;
+    case 0: return 12;
+    case 1: return 13;
+    case 3: return 15;
+    case 4: return 16;
+    default: return 99;
+    }
+}
+
+int switch_dense_no_default(int n) {
+    int r = 0;
+    switch (n) {
+    case 10: r = 1;
+    case 11: r += 2; break;
+    case 12: r = 4; break;
+    case 14: r = 8; break;
+    }
+    return r;
+}
+
+int switch_sparse(int n) {
+    switch (n) {
+    case -1000: return 1;
+    case -7: return 2;
+    case 3: return 3;
+    case 90: return 4;
+    case 512: return 5;
+    case 4096: return 6;
+    case 100000: return 7;
+    case 2147483647: return 8;
+    default: return 0;
+    }
+}
+
+void test_switch_dispatch(void) {
+    ASSERT(99, switch_dense(-3));
+    ASSERT(10, switch_dense(-2));
+    ASSERT(11, switch_dense(-1));
+    ASSERT(12, switch_dense(0));
+    ASSERT(13, switch_dense(1));
+    ASSERT(99, switch_dense(2));
+    ASSERT(15, switch_dense(3));
+    ASSERT(16, switch_dense(4));
+    ASSERT(99, switch_dense(5));
+    ASSERT(99, switch_dense(-2147483647));
+
+    ASSERT(0, switch_dense_no_default(9));
+    ASSERT(3, switch_dense_no_default(10));
+    ASSERT(2, switch_dense_no_default(11));
+    ASSERT(4, switch_dense_no_default(12));
+    ASSERT(0, switch_dense_no_default(13));
+    ASSERT(8, switch_dense_no_default(14));
+    ASSERT(0, switch_dense_no_default(15));
+
+    ASSERT(1, switch_sparse(-1000));
+    ASSERT(2, switch_sparse(-7));
+    ASSERT(3, switch_sparse(3));
+    ASSERT(4, switch_sparse(90));
+    ASSERT(5, switch_sparse(512));
+    ASSERT(6, switch_sparse(4096));
+    ASSERT(7, switch_sparse(100000));
+    ASSERT(8, switch_sparse(2147483647));
+    ASSERT(0, switch_sparse(0));
+    ASSERT(0, switch_sparse(-8));
+    ASSERT(0, switch_sparse(91));
+    ASSERT(0, switch_sparse(100001));
+}
+
+int never_called(void) {
+    UNREACHABLE();
+    return 0;
+}
+
+void test_constant_condition(void) {
+    int n = 0;
+
+    if (0)
+        n = never_called();
+    else if (1 - 1)
+        n = never_called();
+    else if (2)
+        n = 3;
+    else
+        n = never_called();
+    ASSERT(3, n);
+
+    if (1)
+        n = 5;
+    else
+        n = never_called();
+    ASSERT(5, n);
+
+    for (; 0;)
+        n = never_called();
+    ASSERT(5, n);
+
+    n = 1 ? 7 : never_called();
+    ASSERT(7, n);
+
+    // Case label inside of a dead branch is still reachable.
+    switch (n) {
+    case 1:
+        if (0) {
+        case 7:
+            n = 11;
+        }
+    }
+    ASSERT(11, n);
+}
+
 int test_for_return_1(void) {
     for (;;)
         return 10;
@@ -606,6 +719,54 @@ void test_conditional_operator(void) {
     ASSERT(13, g_test_cond_operator_validator);
 }
 
+void test_rotated_loops(void) {
+    int i, j, n = 0;
+    for (i = 0; i < 0; ++i)
+        n = 100;
+    ASSERT(0, n);
+    for (i = 0; i < 10 && n < 20; ++i) {
+        if (i == 3)
+            continue;
+        n += i;
+    }
+    ASSERT(8, i);
+    ASSERT(25, n);
+    for (i = 0, n = 0; i < 5 || i == 7; ++i) {
+        for (j = 0; j < i ? 1 : 0; ++j)
+            ++n;
+        if (i == 4)
+            i = 6;
+    }
+    ASSERT(8, i);
+    ASSERT(17, n);
+    n = 0;
+    while (!n && i)
+        n = i--;
+    ASSERT(8, n);
+}
+
+void test_keyword_like_names(void) {
+    int iffy = 1;
+    int doit = 2;
+    int interval = 3;
+    int elsewhere = 0;
+    int n = 0;
+
+    if (iffy == 2)
+        n = 1;
+    else{if (doit == 2)
+            n = interval;
+    }
+    ASSERT(3, n);
+
+    if (elsewhere)
+        n = 1;
+    else
+    if (n == 3)
+        n = 4;
+    ASSERT(4, n);
+}
+
 int main(void) {
     ASSERT(42, test_if_return_1());
     ASSERT(42, test_if_return_2());
@@ -624,6 +785,8 @@ int main(void) {
     test_switch_break_in_loop();
     test_switch_nest();
     test_switch_constFolding();
+    test_switch_dispatch();
+    test_constant_condition();
     ASSERT(10, test_for_return_1());
     ASSERT(10, test_for_return_2());
     ASSERT(10, test_for_return_3());
@@ -655,5 +818,7 @@ int main(void) {
     test_cond_not();
     test_not();
     test_conditional_operator();
+    test_rotated_loops();
+    test_keyword_like_names();
     return 0;
 }
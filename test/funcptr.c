@@ -193,6 +193,14 @@ void testFptrDereference(void) {
     ASSERT(5, counter);
 }
 
+static int static_add3(int n1, int n2, int n3) {
+    return n1 + n2 + n3;
+}
+void testFptrToStaticFunction(void) {
+    int (*fp)(int, int, int) = static_add3;
+    ASSERT(6, fp(1, 2, 3));
+}
+
 int main(void) {
     testFptrInGlobalScope();
     testFptrInLocalScope();
@@ -201,5 +209,6 @@ int main(void) {
     testFptrCallAtArgument();
     testFptrAddress();
     testFptrDereference();
+    testFptrToStaticFunction();
     return 0;
 }
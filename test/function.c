@@ -75,6 +75,147 @@ void testFuncArgConflictOnStack(void) {
     ASSERT(3, funcArgConflict(3));
 }
 
+// Temporary values kept in registers must survive function calls, and ones
+// spilled on stack must not break stack arguments.
+int funcIdentity(int n) {
+    return n;
+}
+void testTmpValuesAcrossFuncCall(void) {
+    ASSERT(21, 1 + (2 + (3 + (4 + (5 + (6 + funcIdentity(0)))))));
+    ASSERT(28, 1 + (2 + (3 + (4 + (5 + (6 + (7 + funcIdentity(0))))))));
+    ASSERT(37, funcArg8(1, 2, 3, 4, 5, 6, 7, 8) +
+            (1 + (2 + (3 + (4 + (5 + (6 + funcArg8(1, 2, 3, 4, 5, 6, 7, 8))))))));
+    ASSERT(15, funcArg8(1, 2, 3, 4, 5, 6, 7,
+                        1 + (2 + (3 + (4 + (5 + funcIdentity(0))))) - 0));
+}
+
+int leafReassignArgs(int a, char c, int *p) {
+    a = a * 2;
+    c = c + 1;
+    a += *p;
+    return a + c;
+}
+
+int leafArgAddress(int a, int b) {
+    int *p = &b;
+    *p = *p + a;
+    return b;
+}
+
+int leafArgIncrement(int a, int b) {
+    a++;
+    --b;
+    return a * 10 + b;
+}
+
+int leafArg6(int n1, int n2, int n3, int n4, int n5, int n6) {
+    n6 = n6 - n1;
+    return n1 + n2 * 2 + n3 * 3 + n4 * 4 + n5 * 5 + n6 * 6;
+}
+
+int leafArg8(int n1, int n2, int n3, int n4, int n5, int n6, int n7, int n8) {
+    int local = n7 - n8;
+    return n1 + n2 + n3 + n4 + n5 + n6 + local;
+}
+
+void testLeafFunctions(void) {
+    int n = 5;
+    ASSERT(35, leafReassignArgs(10, 9, &n));
+    ASSERT(7, leafArgAddress(3, 4));
+    ASSERT(43, leafArgIncrement(3, 4));
+    ASSERT(91, leafArg6(1, 2, 3, 4, 5, 7));
+    ASSERT(20, leafArg8(1, 2, 3, 4, 5, 6, 9, 10));
+}
+
+static int inlineSquare(int n) { return n * n; }
+static char inlineLowByte(int n) { return n; }
+static int inlineIncrement(int n) { return ++n; }
+static int inlineSumOfSquares(int a, int b) { return inlineSquare(a) + inlineSquare(b); }
+static int inlineRecursive(int n) { return n ? n + inlineRecursive(n - 1) : 0; }
+int inlineIsPositive(int n);
+inline int inlineIsPositive(int n) { return n > 0 && n; }
+static void inlineStore(int *p, int v) { *p = v; *p += 1; }
+static int (*inlineSquarePtr)(int) = inlineSquare;
+static int inlineLocal(int a) { int t; t = a * a; return t + 1; }
+static int inlineLocalInit(int a) {
+    char c = a;
+    int t = c + 1;
+    return t * inlineLocal(t);
+}
+void testInlineFunctions(void) {
+    int n = 3;
+    int arr[3];
+    ASSERT(9, inlineSquare(n));
+    ASSERT(9, inlineSquare(n++));
+    ASSERT(4, n);
+    ASSERT(44, inlineLowByte(300));
+    ASSERT(44, inlineLowByte(n + 296));
+    ASSERT(6, inlineIncrement(5));
+    ASSERT(5, inlineIncrement(n));
+    ASSERT(4, n);
+    ASSERT(25, inlineSumOfSquares(3, n));
+    ASSERT(55, inlineRecursive(10));
+    ASSERT(1, inlineIsPositive(n));
+    ASSERT(0, inlineIsPositive(-n));
+    inlineStore(&n, 41);
+    ASSERT(42, n);
+    inlineStore(&arr[inlineSquare(1)], 7);
+    ASSERT(8, arr[1]);
+    ASSERT(49, inlineSquarePtr(7));
+    ASSERT(10, inlineLocal(3));
+    ASSERT(170, inlineLocal(inlineLocal(3) + 3));
+    ASSERT(10, inlineLocalInit(1));
+    ASSERT(10, inlineLocalInit(257));
+}
+
+int tailCount(int n, int acc) {
+    if (n == 0)
+        return acc;
+    return tailCount(n - 1, acc + 1);
+}
+int tailIsOdd(int n);
+int tailIsEven(int n) {
+    if (n == 0)
+        return 1;
+    return tailIsOdd(n - 1);
+}
+int tailIsOdd(int n) {
+    if (n == 0)
+        return 0;
+    return tailIsEven(n - 1);
+}
+int tailRotate(int n, int a, int b, int c, int d, int e, int f, int g, int h) {
+    if (n == 0)
+        return a * 10000000 + b * 1000000 + c * 100000 + d * 10000 + e * 1000 +
+               f * 100 + g * 10 + h;
+    return tailRotate(n - 1, h, a, b, c, d, e, f, g);
+}
+int tailMoreStackArgs(int n) { return tailRotate(n, 1, 2, 3, 4, 5, 6, 7, 8); }
+int tailIdentity(int n) { return n; }
+int tailApply(int (*f)(int), int n) { return f(n); }
+char tailLowByte(int n) { return tailIdentity(n); }
+int tailDeref(int *p) { return *p; }
+int tailLocalAddress(int n) {
+    int x = n;
+    return tailDeref(&x);
+}
+int tailLocalArray(int n) {
+    int arr[2];
+    arr[0] = n;
+    return tailDeref(arr);
+}
+void testTailCalls(void) {
+    ASSERT(10000, tailCount(10000, 0));
+    ASSERT(1, tailIsEven(1000));
+    ASSERT(0, tailIsEven(1001));
+    ASSERT(81234567, tailRotate(1, 1, 2, 3, 4, 5, 6, 7, 8));
+    ASSERT(23456781, tailRotate(7, 1, 2, 3, 4, 5, 6, 7, 8));
+    ASSERT(67812345, tailMoreStackArgs(3));
+    ASSERT(7, tailApply(tailIdentity, 7));
+    ASSERT(44, tailLowByte(300));
+    ASSERT(5, tailLocalAddress(5));
+    ASSERT(6, tailLocalArray(6));
+}
 
 int main(void) {
     ASSERT(10, add(3, 7));
@@ -83,5 +224,10 @@ int main(void) {
     testFuncArg7();
     testFuncArg8();
     testFuncArgConflictOnStack();
+    testTmpValuesAcrossFuncCall();
+    testFuncCallWithVaArgs();
+    testLeafFunctions();
+    testInlineFunctions();
+    testTailCalls();
     return 0;
 }
@@ -186,6 +186,27 @@ void test_init_local_structs(void) {
     }
 }
 
+void fill_stack_garbage(void) {
+    char garbage[5000];
+    for (int i = 0; i < 5000; ++i)
+        garbage[i] = 85;
+    ASSERT(85, garbage[4999]);
+}
+
+int sum_zero_cleared_arrays(void) {
+    int large[1024] = {7};
+    char odd[301] = {1};
+    int medium[13] = {3};
+    int sum = 0;
+    for (int i = 1; i < 1024; ++i)
+        sum += large[i];
+    for (int i = 1; i < 301; ++i)
+        sum += odd[i];
+    for (int i = 1; i < 13; ++i)
+        sum += medium[i];
+    return sum + large[0] + odd[0] + medium[0];
+}
+
 void test_zero_clear_local_array(void) {
     {
         int n[3][3] = {{}, {101, 103},};
@@ -207,6 +228,8 @@ void test_zero_clear_local_array(void) {
         ASSERT(0, s[3]);
         ASSERT(0, s[4]);
     }
+    fill_stack_garbage();
+    ASSERT(11, sum_zero_cleared_arrays());
 }
 
 void test_zero_clear_local_struct(void) {
@@ -509,7 +532,15 @@ void test_init_static_structs(void) {
 
 void test_init_with_NULL(void) {
     int *p = (void *)0;
+    static int *sp1 = (void *)0;
+    static int n = 7;
+    static int *sp2 = (void *)0;
     ASSERT(1, p == 0);
+    ASSERT(1, sp1 == 0);
+    ASSERT(1, sp2 == 0);
+    sp1 = &n;
+    sp2 = &n;
+    ASSERT(7, n);
 }
 
 void test_init_static_primitive_with_negative_value(void) {
@@ -145,11 +145,34 @@ void test_logical_AND_OR_mixtured(void) {
     ASSERT(3, g_counter);
 }
 
+void test_logical_cond_in_flows(void) {
+    int n = 0;
+    int i;
+
+    for (i = 0; i < 10 && !(i == 5 || i == 7); i++)
+        n++;
+    ASSERT(5, n);
+
+    n = 0;
+    i = 0;
+    do {
+        n += i;
+    } while (++i <= 4 || i == 8);
+    ASSERT(10, n);
+
+    ASSERT(3, (1 < 2 && !(3 <= 2)) ? 3 : 4);
+    ASSERT(4, (2 != 2 || !1) ? 3 : 4);
+    ASSERT(1, 5 > 3 && 2 >= 2);
+    ASSERT(0, 5 < 3 || 2 > 2);
+    ASSERT(1, !(5 < 3) && !!3);
+}
+
 int main(void) {
     test_logicalAND();
     test_logicalAND_short_circuit();
     test_logicalOR();
     test_logicalOR_short_circuit();
     test_logical_AND_OR_mixtured();
+    test_logical_cond_in_flows();
     return 0;
 }
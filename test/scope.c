@@ -36,8 +36,41 @@ void test_inner_scope_independent(void) {
     ASSERT(5, n);
 }
 
+void test_names_dropped_on_scope_exit(void) {
+    {
+        struct S { int a; } s;
+        enum { ItemA, ItemB } e;
+        typedef int T;
+        int v;
+        s.a = 3;
+        v = ItemB;
+        ASSERT(4, sizeof(T));
+        ASSERT(3, s.a);
+        ASSERT(1, v);
+    }
+    {
+        struct S { char a; char b; } s;
+        enum { ItemB, ItemA } e;
+        typedef char T;
+        char v;
+        s.b = 7;
+        v = ItemB;
+        ASSERT(1, sizeof(T));
+        ASSERT(2, sizeof(s));
+        ASSERT(0, v);
+    }
+    for (int i = 0; i < 1; ++i) {
+        int v;
+        v = 5;
+        ASSERT(5, v);
+    }
+    for (int i = 2; i < 3; ++i)
+        ASSERT(2, i);
+}
+
 int main(void) {
     test_find_var_in_outer_scope();
     test_inner_scope_independent();
+    test_names_dropped_on_scope_exit();
     return 0;
 }
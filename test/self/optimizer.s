@@ -0,0 +1,5419 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+foldConstantsList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend0
+  .p2align 4
+.Lbegin0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsNode
+.Literator0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin0
+.Lend0:
+.Lreturn_foldConstantsList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isConstNode:
+  mov r10, rdi
+  mov rax, r10
+  test rax, rax
+  je .Llogical_false1
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false1
+  mov rax, 1
+  jmp .Llogical_end1
+.Llogical_false1:
+  mov rax, 0
+.Llogical_end1:
+  jmp .Lreturn_isConstNode
+.Lreturn_isConstNode:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isArithmeticType:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor4
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor4
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor4
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false4
+.Llogicalor4:
+  mov rax, 1
+  jmp .Llogical_end4
+.Llogical_false4:
+  mov rax, 0
+.Llogical_end4:
+  jmp .Lreturn_isArithmeticType
+.Lreturn_isArithmeticType:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+hasSwitchCase:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend5
+  .p2align 4
+.Lbegin5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 37
+  jne .Lelse6_0
+  mov rax, 1
+  jmp .Lreturn_hasSwitchCase
+  jmp .Lend6
+.Lelse6_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 36
+  jne .Lend6
+  jmp .Literator5
+  jmp .Lend6
+.Lend6:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Llogicalor13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Llogicalor13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Llogicalor13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Llogicalor13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Llogicalor13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Llogicalor13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  je .Lend7
+.Llogicalor13:
+  mov rax, 1
+  jmp .Lreturn_hasSwitchCase
+.Lend7:
+.Literator5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin5
+.Lend5:
+  mov rax, 0
+  jmp .Lreturn_hasSwitchCase
+.Lreturn_hasSwitchCase:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+replaceWithNum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  jne .Lend14
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend14:
+  mov rdi, 25
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_replaceWithNum:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+replaceNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse15_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  jmp .Lend15
+.Lelse15_0:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 136
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memset
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend15
+.Lend15:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_replaceNode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+evalBinaryOperator:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  mov r9, rcx
+  movsx rax, r10d
+  sub rax, 1
+  cmp rax, 23
+  ja .Lswitch_default_16
+  lea rdi, QWORD PTR .Lswitch_table_16[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_16:
+  .long .Lswitch_case_16_1 - .Lswitch_table_16
+  .long .Lswitch_case_16_2 - .Lswitch_table_16
+  .long .Lswitch_case_16_3 - .Lswitch_table_16
+  .long .Lswitch_case_16_4 - .Lswitch_table_16
+  .long .Lswitch_case_16_5 - .Lswitch_table_16
+  .long .Lswitch_case_16_6 - .Lswitch_table_16
+  .long .Lswitch_case_16_7 - .Lswitch_table_16
+  .long .Lswitch_case_16_8 - .Lswitch_table_16
+  .long .Lswitch_case_16_9 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_default_16 - .Lswitch_table_16
+  .long .Lswitch_case_16_14 - .Lswitch_table_16
+  .long .Lswitch_case_16_15 - .Lswitch_table_16
+  .long .Lswitch_case_16_16 - .Lswitch_table_16
+  .long .Lswitch_case_16_17 - .Lswitch_table_16
+  .long .Lswitch_case_16_18 - .Lswitch_table_16
+.previous
+.Lswitch_case_16_16:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  xor rax, rdi
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_15:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_14:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  and rax, rdi
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_6:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_7:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setne al
+  movzx rax, al
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_8:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setl al
+  movzx rax, al
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_9:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setle al
+  movzx rax, al
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_17:
+  movsx rax, r8d
+  test rax, rax
+  jl .Llogicalor18
+  movsx rax, r8d
+  cmp rax, 32
+  jl .Lend17
+.Llogicalor18:
+  mov rax, 0
+  jmp .Lreturn_evalBinaryOperator
+.Lend17:
+  movsx rax, r11d
+  mov rdi, rax
+  movsx rax, r8d
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_18:
+  movsx rax, r8d
+  test rax, rax
+  jl .Llogicalor20
+  movsx rax, r8d
+  cmp rax, 32
+  jl .Lend19
+.Llogicalor20:
+  mov rax, 0
+  jmp .Lreturn_evalBinaryOperator
+.Lend19:
+  movsx rax, r11d
+  mov rdi, rax
+  movsx rax, r8d
+  mov rcx, rax
+  mov rax, rdi
+  sar eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_1:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_2:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_3:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_case_16_4:
+.Lswitch_case_16_5:
+  movsx rax, r8d
+  test rax, rax
+  je .Llogicalor22
+  movsx rax, r8d
+  cmp rax, -1
+  jne .Lend21
+.Llogicalor22:
+  mov rax, 0
+  jmp .Lreturn_evalBinaryOperator
+.Lend21:
+  movsx rax, r10d
+  cmp rax, 4
+  jne .Lcond_falsy_23
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  jmp .Lcond_end_23
+.Lcond_falsy_23:
+  movsx rax, r11d
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rax, rdx
+.Lcond_end_23:
+  mov rdi, rax
+  mov rax, r9
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_evalBinaryOperator
+.Lswitch_default_16:
+  mov rax, 0
+  jmp .Lreturn_evalBinaryOperator
+.Lend16:
+.Lreturn_evalBinaryOperator:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+foldConstantsIf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend24
+  .p2align 4
+.Lbegin24:
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 34
+  jne .Llogicalor26
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false180
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false180
+  mov rax, 1
+  jmp .Llogical_end180
+.Llogical_false180:
+  mov rax, 0
+.Llogical_end180:
+  test rax, rax
+  jne .Lelse25_0
+.Llogicalor26:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend25
+.Lelse25_0:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse25_1
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  je .Lend27
+  jmp .Lend24
+.Lend27:
+  mov rdi, 35
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend25
+.Lelse25_1:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  je .Lelse25_2
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend25
+.Lelse25_2:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend25
+.Lend25:
+.Literator24:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin24
+.Lend24:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond28
+  .p2align 4
+.Lbegin28:
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse30_0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  je .Lend31
+  jmp .Lreturn_foldConstantsIf
+.Lend31:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceNode
+  jmp .Lend30
+.Lelse30_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  je .Lend32
+  jmp .Lreturn_foldConstantsIf
+.Lend32:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse33_0
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceNode
+  jmp .Lend33
+.Lelse33_0:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 35
+  jne .Lelse33_1
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceNode
+  jmp .Lend33
+.Lelse33_1:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend33
+.Lend33:
+  jmp .Lend30
+.Lend30:
+.Literator28:
+.Lcond28:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 33
+  jne .Llogicaland29
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false181
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false181
+  mov rax, 1
+  jmp .Llogical_end181
+.Llogical_false181:
+  mov rax, 0
+.Llogical_end181:
+  test rax, rax
+  jne .Lbegin28
+.Llogicaland29:
+.Lend28:
+.Lreturn_foldConstantsIf:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+foldConstantsNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -48[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend34
+  jmp .Lreturn_foldConstantsNode
+.Lend34:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend35
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+.Lend35:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 48
+  ja .Lswitch_default_36
+  lea rdi, QWORD PTR .Lswitch_table_36[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_36:
+  .long .Lswitch_case_36_1 - .Lswitch_table_36
+  .long .Lswitch_case_36_2 - .Lswitch_table_36
+  .long .Lswitch_case_36_3 - .Lswitch_table_36
+  .long .Lswitch_case_36_4 - .Lswitch_table_36
+  .long .Lswitch_case_36_5 - .Lswitch_table_36
+  .long .Lswitch_case_36_6 - .Lswitch_table_36
+  .long .Lswitch_case_36_7 - .Lswitch_table_36
+  .long .Lswitch_case_36_8 - .Lswitch_table_36
+  .long .Lswitch_case_36_9 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_case_36_11 - .Lswitch_table_36
+  .long .Lswitch_case_36_12 - .Lswitch_table_36
+  .long .Lswitch_case_36_13 - .Lswitch_table_36
+  .long .Lswitch_case_36_14 - .Lswitch_table_36
+  .long .Lswitch_case_36_15 - .Lswitch_table_36
+  .long .Lswitch_case_36_16 - .Lswitch_table_36
+  .long .Lswitch_case_36_17 - .Lswitch_table_36
+  .long .Lswitch_case_36_18 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_case_36_20 - .Lswitch_table_36
+  .long .Lswitch_case_36_21 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_case_36_26 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_default_36 - .Lswitch_table_36
+  .long .Lswitch_case_36_31 - .Lswitch_table_36
+.previous
+.Lswitch_case_36_21:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsIf
+  jmp .Lend36
+.Lswitch_case_36_20:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false182
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false182
+  mov rax, 1
+  jmp .Llogical_end182
+.Llogical_false182:
+  mov rax, 0
+.Llogical_end182:
+  test rax, rax
+  je .Lend37
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_38
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_38
+.Lcond_falsy_38:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_38:
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Llogicalor42
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor185
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor185
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor185
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false185
+.Llogicalor185:
+  mov rax, 1
+  jmp .Llogical_end185
+.Llogical_false185:
+  mov rax, 0
+.Llogical_end185:
+  test rax, rax
+  je .Lend39
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor188
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor188
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor188
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false188
+.Llogicalor188:
+  mov rax, 1
+  jmp .Llogical_end188
+.Llogical_false188:
+  mov rax, 0
+.Llogical_end188:
+  test rax, rax
+  je .Lend39
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  cmp rax, rdi
+  jne .Lend39
+.Llogicalor42:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceNode
+.Lend39:
+.Lend37:
+  jmp .Lend36
+.Lswitch_case_36_26:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false189
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false189
+  mov rax, 1
+  jmp .Llogical_end189
+.Llogical_false189:
+  mov rax, 0
+.Llogical_end189:
+  test rax, rax
+  je .Lend43
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend43
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasSwitchCase
+  test rax, rax
+  jne .Lend43
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend43:
+  jmp .Lend36
+.Lswitch_case_36_13:
+.Lswitch_case_36_12:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false190
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false190
+  mov rax, 1
+  jmp .Llogical_end190
+.Llogical_false190:
+  mov rax, 0
+.Llogical_end190:
+  test rax, rax
+  je .Lend46
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lelse47_0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceWithNum
+  jmp .Lend47
+.Lelse47_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false191
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false191
+  mov rax, 1
+  jmp .Llogical_end191
+.Llogical_false191:
+  mov rax, 0
+.Llogical_end191:
+  test rax, rax
+  je .Lend47
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceWithNum
+  jmp .Lend47
+.Lend47:
+.Lend46:
+  jmp .Lend36
+.Lswitch_case_36_11:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false192
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false192
+  mov rax, 1
+  jmp .Llogical_end192
+.Llogical_false192:
+  mov rax, 0
+.Llogical_end192:
+  test rax, rax
+  je .Lend48
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceWithNum
+.Lend48:
+  jmp .Lend36
+.Lswitch_case_36_31:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false193
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false193
+  mov rax, 1
+  jmp .Llogical_end193
+.Llogical_false193:
+  mov rax, 0
+.Llogical_end193:
+  test rax, rax
+  je .Lend49
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor196
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor196
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor196
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false196
+.Llogicalor196:
+  mov rax, 1
+  jmp .Llogical_end196
+.Llogical_false196:
+  mov rax, 0
+.Llogical_end196:
+  test rax, rax
+  je .Lend49
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor199
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor199
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor199
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false199
+.Llogicalor199:
+  mov rax, 1
+  jmp .Llogical_end199
+.Llogical_false199:
+  mov rax, 0
+.Llogical_end199:
+  test rax, rax
+  je .Lend49
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceWithNum
+.Lend49:
+  jmp .Lend36
+.Lswitch_case_36_16:
+.Lswitch_case_36_15:
+.Lswitch_case_36_14:
+.Lswitch_case_36_6:
+.Lswitch_case_36_7:
+.Lswitch_case_36_8:
+.Lswitch_case_36_9:
+.Lswitch_case_36_17:
+.Lswitch_case_36_18:
+.Lswitch_case_36_1:
+.Lswitch_case_36_2:
+.Lswitch_case_36_3:
+.Lswitch_case_36_4:
+.Lswitch_case_36_5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false200
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false200
+  mov rax, 1
+  jmp .Llogical_end200
+.Llogical_false200:
+  mov rax, 0
+.Llogical_end200:
+  test rax, rax
+  je .Llogicalor53
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false201
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Llogical_false201
+  mov rax, 1
+  jmp .Llogical_end201
+.Llogical_false201:
+  mov rax, 0
+.Llogical_end201:
+  test rax, rax
+  jne .Lend52
+.Llogicalor53:
+  jmp .Lend36
+.Lend52:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor204
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor204
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor204
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false204
+.Llogicalor204:
+  mov rax, 1
+  jmp .Llogical_end204
+.Llogical_false204:
+  mov rax, 0
+.Llogical_end204:
+  test rax, rax
+  je .Llogicalor56
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor207
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor207
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor207
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false207
+.Llogicalor207:
+  mov rax, 1
+  jmp .Llogical_end207
+.Llogical_false207:
+  mov rax, 0
+.Llogical_end207:
+  test rax, rax
+  je .Llogicalor56
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor210
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor210
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor210
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false210
+.Llogicalor210:
+  mov rax, 1
+  jmp .Llogical_end210
+.Llogical_false210:
+  mov rax, 0
+.Llogical_end210:
+  test rax, rax
+  jne .Lend54
+.Llogicalor56:
+  jmp .Lend36
+.Lend54:
+  lea rax, QWORD PTR -12[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call evalBinaryOperator
+  test rax, rax
+  je .Lend57
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceWithNum
+.Lend57:
+  jmp .Lend36
+.Lswitch_default_36:
+  jmp .Lend36
+.Lend36:
+.Lreturn_foldConstantsNode:
+  mov rbx, QWORD PTR -48[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl foldConstants
+foldConstants:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call foldConstantsList
+.Lreturn_foldConstants:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isScalarType:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor60
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor60
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor60
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false60
+.Llogicalor60:
+  mov rax, 1
+  jmp .Llogical_end60
+.Llogical_false60:
+  mov rax, 0
+.Llogical_end60:
+  jmp .Lreturn_isScalarType
+.Lreturn_isScalarType:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isArg:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r11
+  test rax, rax
+  je .Lend61
+  .p2align 4
+.Lbegin61:
+  mov rax, r11
+  mov rsi, rax
+  mov rax, r10
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend62
+  mov rax, 1
+  jmp .Lreturn_isArg
+.Lend62:
+.Literator61:
+  mov rax, r11
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r11, rdi
+  mov rax, r11
+  test rax, rax
+  jne .Lbegin61
+.Lend61:
+  mov rax, 0
+  jmp .Lreturn_isArg
+.Lreturn_isArg:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isInlinableExprList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend63
+  .p2align 4
+.Lbegin63:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExpr
+  test rax, rax
+  jne .Lend64
+  mov rax, 0
+  jmp .Lreturn_isInlinableExprList
+.Lend64:
+.Literator63:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin63
+.Lend63:
+  mov rax, 1
+  jmp .Lreturn_isInlinableExprList
+.Lreturn_isInlinableExprList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isFrameVar:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogicalor66
+  mov rax, r10
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor66
+  mov rax, r10
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false66
+.Llogicalor66:
+  mov rax, 1
+  jmp .Llogical_end66
+.Llogical_false66:
+  mov rax, 0
+.Llogical_end66:
+  test rax, rax
+  sete al
+  movzx rax, al
+  jmp .Lreturn_isFrameVar
+.Lreturn_isFrameVar:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isInlinableExpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend67
+  mov rax, 1
+  jmp .Lreturn_isInlinableExpr
+.Lend67:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 51
+  ja .Lswitch_default_68
+  lea rdi, QWORD PTR .Lswitch_table_68[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_68:
+  .long .Lswitch_case_68_0 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_case_68_1b - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_case_68_1f - .Lswitch_table_68
+  .long .Lswitch_case_68_20 - .Lswitch_table_68
+  .long .Lswitch_case_68_21 - .Lswitch_table_68
+  .long .Lswitch_case_68_22 - .Lswitch_table_68
+  .long .Lswitch_case_68_23 - .Lswitch_table_68
+  .long .Lswitch_case_68_24 - .Lswitch_table_68
+  .long .Lswitch_case_68_25 - .Lswitch_table_68
+  .long .Lswitch_case_68_26 - .Lswitch_table_68
+  .long .Lswitch_case_68_27 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_case_68_29 - .Lswitch_table_68
+  .long .Lswitch_case_68_2a - .Lswitch_table_68
+  .long .Lswitch_case_68_2b - .Lswitch_table_68
+  .long .Lswitch_case_68_2c - .Lswitch_table_68
+  .long .Lswitch_case_68_2d - .Lswitch_table_68
+  .long .Lswitch_case_68_2e - .Lswitch_table_68
+  .long .Lswitch_case_68_2f - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_default_68 - .Lswitch_table_68
+  .long .Lswitch_case_68_32 - .Lswitch_table_68
+  .long .Lswitch_case_68_33 - .Lswitch_table_68
+.previous
+.Lswitch_case_68_1b:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogicalor212
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor212
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false212
+.Llogicalor212:
+  mov rax, 1
+  jmp .Llogical_end212
+.Llogical_false212:
+  mov rax, 0
+.Llogical_end212:
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend69
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArg
+  test rax, rax
+  jne .Lend69
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor215
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor215
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor215
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false215
+.Llogicalor215:
+  mov rax, 1
+  jmp .Llogical_end215
+.Llogical_false215:
+  mov rax, 0
+.Llogical_end215:
+  test rax, rax
+  jne .Lend69
+  mov rax, 0
+  jmp .Lreturn_isInlinableExpr
+.Lend69:
+  jmp .Lend68
+.Lswitch_case_68_20:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend72
+  mov rax, 0
+  jmp .Lreturn_isInlinableExpr
+.Lend72:
+  jmp .Lend68
+.Lswitch_case_68_1f:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExprList
+  test rax, rax
+  jne .Lend73
+  mov rax, 0
+  jmp .Lreturn_isInlinableExpr
+.Lend73:
+  jmp .Lend68
+.Lswitch_case_68_33:
+.Lswitch_case_68_29:
+.Lswitch_case_68_2a:
+.Lswitch_case_68_32:
+.Lswitch_case_68_21:
+.Lswitch_case_68_22:
+.Lswitch_case_68_23:
+.Lswitch_case_68_24:
+.Lswitch_case_68_25:
+.Lswitch_case_68_26:
+.Lswitch_case_68_27:
+.Lswitch_case_68_2b:
+.Lswitch_case_68_2c:
+.Lswitch_case_68_2d:
+.Lswitch_case_68_2e:
+.Lswitch_case_68_2f:
+.Lswitch_case_68_0:
+  mov rax, 0
+  jmp .Lreturn_isInlinableExpr
+.Lswitch_default_68:
+  jmp .Lend68
+.Lend68:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExpr
+  test rax, rax
+  je .Llogical_false76
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExpr
+  test rax, rax
+  je .Llogical_false76
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExpr
+  test rax, rax
+  je .Llogical_false76
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExprList
+  test rax, rax
+  je .Llogical_false76
+  mov rax, 1
+  jmp .Llogical_end76
+.Llogical_false76:
+  mov rax, 0
+.Llogical_end76:
+  jmp .Lreturn_isInlinableExpr
+.Lreturn_isInlinableExpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+countNodes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -24[rbp], rbx
+  mov QWORD PTR -32[rbp], r12
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend77
+  .p2align 4
+.Lbegin77:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  add eax, 1
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, r12
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend78
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend78:
+.Literator77:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin77
+.Lend77:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_countNodes
+.Lreturn_countNodes:
+  mov rbx, QWORD PTR -24[rbp]
+  mov r12, QWORD PTR -32[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newInlineNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  mov QWORD PTR -20[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newInlineNode
+.Lreturn_newInlineNode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+castForInline:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -56[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Llogicalor80
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rbx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  cmp rax, rdi
+  jg .Lend79
+.Llogicalor80:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_castForInline
+.Lend79:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 49
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_castForInline
+.Lreturn_castForInline:
+  mov rbx, QWORD PTR -56[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+cloneNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lend81
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend82
+  .p2align 4
+.Lbegin82:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend83
+  jmp .Literator82
+.Lend83:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend84
+  mov rsi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp cloneNode
+.Lend84:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 27
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_cloneNode
+.Literator82:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin82
+.Lend82:
+.Lend81:
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNodeList
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNodeList
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNodeList
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNodeList
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend85
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNodeList
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend85:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 32
+  je .Llogicalor88
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  je .Llogicalor88
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  jne .Lend86
+.Llogicalor88:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend86:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_cloneNode
+.Lreturn_cloneNode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+cloneNodeList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend89
+  .p2align 4
+.Lbegin89:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNode
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator89:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin89
+.Lend89:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_cloneNodeList
+.Lreturn_cloneNodeList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+addInlineLocals:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend90
+  .p2align 4
+.Lbegin90:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lend91
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogicalor217
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor217
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false217
+.Llogicalor217:
+  mov rax, 1
+  jmp .Llogical_end217
+.Llogical_false217:
+  mov rax, 0
+.Llogical_end217:
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend91
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArg
+  test rax, rax
+  jne .Lend91
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond94
+  .p2align 4
+.Lbegin94:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator94:
+.Lcond94:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland95
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lbegin94
+.Llogicaland95:
+.Lend94:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend96
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend96:
+.Lend91:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineLocals
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineLocals
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineLocals
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineLocals
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend97
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineLocals
+.Lend97:
+.Literator90:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin90
+.Lend90:
+.Lreturn_addInlineLocals:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendInlineDecl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov QWORD PTR -24[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend98
+  .p2align 4
+.Lbegin98:
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 50
+  jne .Lend99
+  jmp .Literator98
+.Lend99:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 41
+  jne .Llogicalor101
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  jne .Lend100
+.Llogicalor101:
+  mov rax, 0
+  jmp .Lreturn_appendInlineDecl
+.Lend100:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 28
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExpr
+  test rax, rax
+  jne .Lend102
+  .p2align 4
+.Lbegin103:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend104
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend104:
+.Literator103:
+.Lend103:
+  mov rax, 0
+  jmp .Lreturn_appendInlineDecl
+.Lend102:
+  mov rsi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin105:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend106
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend106:
+.Literator105:
+.Lend105:
+.Literator98:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin98
+.Lend98:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_appendInlineDecl
+.Lreturn_appendInlineDecl:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+addInlineCandidate:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov QWORD PTR -216[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findFunction
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend107
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend107
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend107
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend107
+  jmp .Lreturn_addInlineCandidate
+.Lend107:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor112
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 43
+  je .Lend111
+.Llogicalor112:
+  jmp .Lreturn_addInlineCandidate
+.Lend111:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lend113
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor220
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor220
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor220
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false220
+.Llogicalor220:
+  mov rax, 1
+  jmp .Llogical_end220
+.Llogical_false220:
+  mov rax, 0
+.Llogical_end220:
+  test rax, rax
+  jne .Lend113
+  jmp .Lreturn_addInlineCandidate
+.Lend113:
+  lea rdi, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend115
+  .p2align 4
+.Lbegin115:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor223
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor223
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor223
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false223
+.Llogicalor223:
+  mov rax, 1
+  jmp .Llogical_end223
+.Llogical_false223:
+  mov rax, 0
+.Llogical_end223:
+  test rax, rax
+  jne .Lend116
+  jmp .Lreturn_addInlineCandidate
+.Lend116:
+.Literator115:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin115
+.Lend115:
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend117
+  .p2align 4
+.Lbegin117:
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 46
+  jne .Lelse118_0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Llogicalor121
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend119
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lend119
+.Llogicalor121:
+  jmp .Lreturn_addInlineCandidate
+.Lend119:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend122
+  jmp .Lend117
+.Lend122:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend118
+.Lelse118_0:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse118_1
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lelse118_1
+  jmp .Lreturn_addInlineCandidate
+  jmp .Lend118
+.Lelse118_1:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 43
+  jne .Lend118
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendInlineDecl
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend124
+  jmp .Lreturn_addInlineCandidate
+.Lend124:
+  jmp .Literator117
+  jmp .Lend118
+.Lend118:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isInlinableExpr
+  test rax, rax
+  jne .Lend125
+  jmp .Lreturn_addInlineCandidate
+.Lend125:
+  mov rsi, 0
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNode
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend126
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call castForInline
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend126:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator117:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin117
+.Lend117:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 176
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call countNodes
+  mov rdi, rax
+  mov rax, rbx
+  cmp rax, rdi
+  jge .Lend127
+  jmp .Lreturn_addInlineCandidate
+.Lend127:
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineLocals
+  lea rax, QWORD PTR inliner[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR inliner[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_addInlineCandidate:
+  mov rbx, QWORD PTR -216[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findInlineCandidate:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Llogicalor129
+  mov rax, r10
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Lend128
+.Llogicalor129:
+  mov rax, 0
+  jmp .Lreturn_findInlineCandidate
+.Lend128:
+  lea rdi, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR inliner[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend130
+  .p2align 4
+.Lbegin130:
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, r10
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend131
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_findInlineCandidate
+.Lend131:
+.Literator130:
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin130
+.Lend130:
+  mov rax, 0
+  jmp .Lreturn_findInlineCandidate
+.Lreturn_findInlineCandidate:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isArgModified:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend132
+  .p2align 4
+.Lbegin132:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 15
+  je .Llogicalor135
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogicalor135
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 11
+  jne .Lelse133_0
+.Llogicalor135:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend133
+.Lelse133_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 28
+  je .Llogicalor137
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 12
+  je .Llogicalor137
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jne .Lend133
+.Llogicalor137:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend133
+.Lend133:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend138
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lend138
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend138
+  mov rax, 1
+  jmp .Lreturn_isArgModified
+.Lend138:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArgModified
+  test rax, rax
+  jne .Llogicalor144
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArgModified
+  test rax, rax
+  jne .Llogicalor144
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArgModified
+  test rax, rax
+  jne .Llogicalor144
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArgModified
+  test rax, rax
+  je .Lend141
+.Llogicalor144:
+  mov rax, 1
+  jmp .Lreturn_isArgModified
+.Lend141:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend145
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArgModified
+  test rax, rax
+  je .Lend145
+  mov rax, 1
+  jmp .Lreturn_isArgModified
+.Lend145:
+.Literator132:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin132
+.Lend132:
+  mov rax, 0
+  jmp .Lreturn_isArgModified
+.Lreturn_isArgModified:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newInlineTemp:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend147
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend147:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newInlineTemp
+.Lreturn_newInlineTemp:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineCallsList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend148
+  .p2align 4
+.Lbegin148:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCalls
+.Literator148:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin148
+.Lend148:
+.Lreturn_inlineCallsList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+expandInlineCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 256
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov DWORD PTR -20[rbp], edx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jl .Lend149
+  .p2align 4
+.Lbegin149:
+  lea rdi, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -228[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend150
+  .p2align 4
+.Lbegin150:
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator150:
+  lea rax, QWORD PTR -228[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -228[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin150
+.Lend150:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lend151
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Lend151
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isArgModified
+  test rax, rax
+  jne .Lend151
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call castForInline
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator149
+.Lend151:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call newInlineTemp
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 28
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 27
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator149:
+  lea rax, QWORD PTR -196[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lbegin149
+.Lend149:
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend154
+  .p2align 4
+.Lbegin154:
+  lea rdi, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call newInlineTemp
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator154:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin154
+.Lend154:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneNodeList
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend155
+  .p2align 4
+.Lbegin155:
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin156:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend157
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend157:
+.Literator156:
+.Lend156:
+.Literator155:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin155
+.Lend155:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 40
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call replaceNode
+  .p2align 4
+.Lbegin158:
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend159
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend159:
+.Literator158:
+.Lend158:
+.Lreturn_expandInlineCall:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+inlineCalls:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 47
+  jne .Lelse160_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCalls
+  mov rdi, 0
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lreturn_inlineCalls
+  jmp .Lend160
+.Lelse160_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 43
+  jne .Lend160
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend161
+  .p2align 4
+.Lbegin161:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCalls
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator161:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin161
+.Lend161:
+  jmp .Lreturn_inlineCalls
+  jmp .Lend160
+.Lend160:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  je .Lend162
+  jmp .Lreturn_inlineCalls
+.Lend162:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCallsList
+  lea rax, QWORD PTR inliner[rip]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor164
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jl .Lend163
+.Llogicalor164:
+  jmp .Lreturn_inlineCalls
+.Lend163:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findInlineCandidate
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend165
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend165
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call expandInlineCall
+.Lend165:
+.Lreturn_inlineCalls:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl inlineFunctions
+inlineFunctions:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 176
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jg .Lend167
+  jmp .Lreturn_inlineFunctions
+.Lend167:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend168
+  .p2align 4
+.Lbegin168:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 47
+  jne .Lend169
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call addInlineCandidate
+.Lend169:
+.Literator168:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin168
+.Lend168:
+  lea rax, QWORD PTR inliner[rip]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend170
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call inlineCalls
+.Lend170:
+.Lreturn_inlineFunctions:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString2:
+  .string  "%d:%d: Internal error: assert: %s"
+inliner:
+  .zero 24
@@ -0,0 +1,30067 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+isEqualRegister:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rax, r11
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false0
+  mov rax, r10
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rax, r11
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false0
+  mov rax, 1
+  jmp .Llogical_end0
+.Llogical_false0:
+  mov rax, 0
+.Llogical_end0:
+  jmp .Lreturn_isEqualRegister
+.Lreturn_isEqualRegister:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isEqualRegisterOperand:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false2
+  mov rax, r11
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false2
+  mov rax, r11
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r10
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false550
+  lea rax, QWORD PTR -40[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false550
+  mov rax, 1
+  jmp .Llogical_end550
+.Llogical_false550:
+  mov rax, 0
+.Llogical_end550:
+  test rax, rax
+  je .Llogical_false2
+  mov rax, 1
+  jmp .Llogical_end2
+.Llogical_false2:
+  mov rax, 0
+.Llogical_end2:
+  jmp .Lreturn_isEqualRegisterOperand
+.Lreturn_isEqualRegisterOperand:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getOperandSizeFromByteSize:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 7
+  ja .Lswitch_default_3
+  lea rdi, QWORD PTR .Lswitch_table_3[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_3:
+  .long .Lswitch_case_3_1 - .Lswitch_table_3
+  .long .Lswitch_case_3_2 - .Lswitch_table_3
+  .long .Lswitch_default_3 - .Lswitch_table_3
+  .long .Lswitch_case_3_4 - .Lswitch_table_3
+  .long .Lswitch_default_3 - .Lswitch_table_3
+  .long .Lswitch_default_3 - .Lswitch_table_3
+  .long .Lswitch_default_3 - .Lswitch_table_3
+  .long .Lswitch_case_3_8 - .Lswitch_table_3
+.previous
+.Lswitch_case_3_1:
+  mov rax, 0
+  jmp .Lreturn_getOperandSizeFromByteSize
+.Lswitch_case_3_2:
+  mov rax, 1
+  jmp .Lreturn_getOperandSizeFromByteSize
+.Lswitch_case_3_4:
+  mov rax, 2
+  jmp .Lreturn_getOperandSizeFromByteSize
+.Lswitch_case_3_8:
+  mov rax, 3
+  jmp .Lreturn_getOperandSizeFromByteSize
+.Lswitch_default_3:
+  mov rcx, 190
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend3:
+.Lreturn_getOperandSizeFromByteSize:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newAsmInst:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newAsmInst
+.Lreturn_newAsmInst:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newAsmInstAnyText:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newAsmInstAnyText
+.Lreturn_newAsmInstAnyText:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+freeAsmInst:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Lswitch_case_4_4
+  jg .Lswitch_upper_4_1
+  test rax, rax
+  je .Lswitch_case_4_0
+  jmp .Lswitch_default_4
+.Lswitch_upper_4_1:
+  cmp rax, 30
+  je .Lswitch_case_4_1e
+  cmp rax, 31
+  je .Lswitch_case_4_1f
+  jmp .Lswitch_default_4
+.Lswitch_case_4_0:
+  jmp .Lend4
+.Lswitch_case_4_4:
+.Lswitch_case_4_1e:
+.Lswitch_case_4_1f:
+  .p2align 4
+.Lbegin5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend6
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend6:
+.Literator5:
+.Lend5:
+  jmp .Lend4
+.Lswitch_default_4:
+  jmp .Lend4
+.Lend4:
+  .p2align 4
+.Lbegin7:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend8
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend8:
+.Literator7:
+.Lend7:
+.Lreturn_freeAsmInst:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getLastAsmInst:
+  mov r10, rdi
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend9
+  .p2align 4
+.Lbegin9:
+.Literator9:
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin9
+.Lend9:
+  mov rax, r10
+  jmp .Lreturn_getLastAsmInst
+.Lreturn_getLastAsmInst:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+initAsmInstList:
+  mov r10, rdi
+  mov rax, r10
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  mov rax, r10
+  mov rdi, rax
+  mov rax, r10
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_initAsmInstList:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInst:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse10_0
+  jmp .Lreturn_appendAsmInst
+  jmp .Lend10
+.Lelse10_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend10
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  mov al, 0
+  call error
+  jmp .Lend10
+.Lend10:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getLastAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_appendAsmInst:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstPush:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstPush:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstPop:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstPop:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstBinOp:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov QWORD PTR -20[rbp], rdx
+  mov QWORD PTR -28[rbp], rcx
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  .p2align 4
+.Lbegin11:
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend12
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend12:
+.Literator11:
+.Lend11:
+  .p2align 4
+.Lbegin13:
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend14
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend14:
+.Literator13:
+.Lend13:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstBinOp:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstUnOp:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov QWORD PTR -20[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  .p2align 4
+.Lbegin15:
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend16
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend16:
+.Literator15:
+.Lend15:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstUnOp:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstLabel:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 4
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 16
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call vformat
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstLabel:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstJmp:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 30
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 16
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call vformat
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstJmp:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstJcc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -48[rbp], rdi
+  mov DWORD PTR -40[rbp], esi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 31
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 24
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call vformat
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstJcc:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstSetcc:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov QWORD PTR -20[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstSetcc:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newOperandReg:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newOperandReg
+.Lreturn_newOperandReg:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newOperandImm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newOperandImm
+.Lreturn_newOperandImm:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newOperandLabel:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newOperandLabel
+.Lreturn_newOperandLabel:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newOperandMem:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  mov DWORD PTR -12[rbp], edx
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newOperandMem
+.Lreturn_newOperandMem:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newOperandMemIndex:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  mov DWORD PTR -12[rbp], edx
+  mov DWORD PTR -16[rbp], ecx
+  mov DWORD PTR -20[rbp], r8d
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 20
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 20
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newOperandMemIndex
+.Lreturn_newOperandMemIndex:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newOperandMemRIP:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rcx, 0
+  mov rsi, 17
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newOperandMemRIP
+.Lreturn_newOperandMemRIP:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstAnyText:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov QWORD PTR -48[rbp], rdi
+  mov QWORD PTR -40[rbp], rsi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 16
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call vformat
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lreturn_appendAsmInstAnyText:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendAsmInstList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend17
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  mov al, 0
+  call error
+.Lend17:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend18
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend18:
+  .p2align 4
+.Lbegin19:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend20
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend20:
+.Literator19:
+.Lend19:
+.Lreturn_appendAsmInstList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+takeAsmInstList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 144
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend21
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend21:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_takeAsmInstList
+.Lreturn_takeAsmInstList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+releaseAsmInstList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin22:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend23
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend23:
+.Literator22:
+.Lend22:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_releaseAsmInstList
+.Lreturn_releaseAsmInstList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getRawAsmInstList:
+  mov r10, rdi
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getRawAsmInstList
+.Lreturn_getRawAsmInstList:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isExprNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 51
+  ja .Lend24
+  lea rdi, QWORD PTR .Lswitch_table_24[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_24:
+  .long .Lswitch_case_24_0 - .Lswitch_table_24
+  .long .Lswitch_case_24_1 - .Lswitch_table_24
+  .long .Lswitch_case_24_2 - .Lswitch_table_24
+  .long .Lswitch_case_24_3 - .Lswitch_table_24
+  .long .Lswitch_case_24_4 - .Lswitch_table_24
+  .long .Lswitch_case_24_5 - .Lswitch_table_24
+  .long .Lswitch_case_24_6 - .Lswitch_table_24
+  .long .Lswitch_case_24_7 - .Lswitch_table_24
+  .long .Lswitch_case_24_8 - .Lswitch_table_24
+  .long .Lswitch_case_24_9 - .Lswitch_table_24
+  .long .Lswitch_case_24_a - .Lswitch_table_24
+  .long .Lswitch_case_24_b - .Lswitch_table_24
+  .long .Lswitch_case_24_c - .Lswitch_table_24
+  .long .Lswitch_case_24_d - .Lswitch_table_24
+  .long .Lswitch_case_24_e - .Lswitch_table_24
+  .long .Lswitch_case_24_f - .Lswitch_table_24
+  .long .Lswitch_case_24_10 - .Lswitch_table_24
+  .long .Lswitch_case_24_11 - .Lswitch_table_24
+  .long .Lswitch_case_24_12 - .Lswitch_table_24
+  .long .Lswitch_case_24_13 - .Lswitch_table_24
+  .long .Lswitch_case_24_14 - .Lswitch_table_24
+  .long .Lswitch_case_24_15 - .Lswitch_table_24
+  .long .Lswitch_case_24_16 - .Lswitch_table_24
+  .long .Lswitch_case_24_17 - .Lswitch_table_24
+  .long .Lswitch_case_24_18 - .Lswitch_table_24
+  .long .Lswitch_case_24_19 - .Lswitch_table_24
+  .long .Lswitch_case_24_1a - .Lswitch_table_24
+  .long .Lswitch_case_24_1b - .Lswitch_table_24
+  .long .Lswitch_case_24_1c - .Lswitch_table_24
+  .long .Lswitch_case_24_1d - .Lswitch_table_24
+  .long .Lswitch_case_24_1e - .Lswitch_table_24
+  .long .Lswitch_case_24_1f - .Lswitch_table_24
+  .long .Lswitch_case_24_20 - .Lswitch_table_24
+  .long .Lswitch_case_24_21 - .Lswitch_table_24
+  .long .Lswitch_case_24_22 - .Lswitch_table_24
+  .long .Lswitch_case_24_23 - .Lswitch_table_24
+  .long .Lswitch_case_24_24 - .Lswitch_table_24
+  .long .Lswitch_case_24_25 - .Lswitch_table_24
+  .long .Lswitch_case_24_26 - .Lswitch_table_24
+  .long .Lswitch_case_24_27 - .Lswitch_table_24
+  .long .Lswitch_case_24_28 - .Lswitch_table_24
+  .long .Lswitch_case_24_29 - .Lswitch_table_24
+  .long .Lswitch_case_24_2a - .Lswitch_table_24
+  .long .Lswitch_case_24_2b - .Lswitch_table_24
+  .long .Lswitch_case_24_2c - .Lswitch_table_24
+  .long .Lswitch_case_24_2d - .Lswitch_table_24
+  .long .Lswitch_case_24_2e - .Lswitch_table_24
+  .long .Lswitch_case_24_2f - .Lswitch_table_24
+  .long .Lswitch_case_24_30 - .Lswitch_table_24
+  .long .Lswitch_case_24_31 - .Lswitch_table_24
+  .long .Lswitch_case_24_32 - .Lswitch_table_24
+  .long .Lswitch_case_24_33 - .Lswitch_table_24
+.previous
+.Lswitch_case_24_1:
+.Lswitch_case_24_2:
+.Lswitch_case_24_3:
+.Lswitch_case_24_4:
+.Lswitch_case_24_5:
+.Lswitch_case_24_6:
+.Lswitch_case_24_7:
+.Lswitch_case_24_8:
+.Lswitch_case_24_9:
+.Lswitch_case_24_a:
+.Lswitch_case_24_b:
+.Lswitch_case_24_c:
+.Lswitch_case_24_d:
+.Lswitch_case_24_e:
+.Lswitch_case_24_f:
+.Lswitch_case_24_10:
+.Lswitch_case_24_11:
+.Lswitch_case_24_13:
+.Lswitch_case_24_12:
+.Lswitch_case_24_19:
+.Lswitch_case_24_14:
+.Lswitch_case_24_15:
+.Lswitch_case_24_16:
+.Lswitch_case_24_17:
+.Lswitch_case_24_18:
+.Lswitch_case_24_1a:
+.Lswitch_case_24_1b:
+.Lswitch_case_24_1c:
+.Lswitch_case_24_1d:
+.Lswitch_case_24_1e:
+.Lswitch_case_24_1f:
+.Lswitch_case_24_28:
+.Lswitch_case_24_30:
+.Lswitch_case_24_31:
+  mov rax, 1
+  jmp .Lreturn_isExprNode
+.Lswitch_case_24_21:
+.Lswitch_case_24_22:
+.Lswitch_case_24_23:
+.Lswitch_case_24_24:
+.Lswitch_case_24_25:
+.Lswitch_case_24_26:
+.Lswitch_case_24_27:
+.Lswitch_case_24_2b:
+.Lswitch_case_24_2c:
+.Lswitch_case_24_2d:
+.Lswitch_case_24_2e:
+.Lswitch_case_24_2f:
+.Lswitch_case_24_32:
+.Lswitch_case_24_33:
+.Lswitch_case_24_0:
+.Lswitch_case_24_29:
+  mov rax, 0
+  jmp .Lreturn_isExprNode
+.Lswitch_case_24_20:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend25
+  mov rax, 0
+  jmp .Lreturn_isExprNode
+.Lend25:
+  mov rax, 1
+  jmp .Lreturn_isExprNode
+.Lswitch_case_24_2a:
+  mov rcx, 535
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend24:
+  mov rcx, 537
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  mov rax, 0
+  jmp .Lreturn_isExprNode
+.Lreturn_isExprNode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isRegisterStorableValue:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  ja .Lend26
+  lea rdi, QWORD PTR .Lswitch_table_26[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_26:
+  .long .Lswitch_case_26_0 - .Lswitch_table_26
+  .long .Lswitch_case_26_1 - .Lswitch_table_26
+  .long .Lswitch_case_26_2 - .Lswitch_table_26
+  .long .Lswitch_case_26_3 - .Lswitch_table_26
+  .long .Lswitch_case_26_4 - .Lswitch_table_26
+  .long .Lswitch_case_26_5 - .Lswitch_table_26
+  .long .Lswitch_case_26_6 - .Lswitch_table_26
+  .long .Lswitch_case_26_7 - .Lswitch_table_26
+  .long .Lswitch_case_26_8 - .Lswitch_table_26
+  .long .Lswitch_case_26_9 - .Lswitch_table_26
+  .long .Lswitch_case_26_a - .Lswitch_table_26
+.previous
+.Lswitch_case_26_5:
+.Lswitch_case_26_7:
+.Lswitch_case_26_8:
+.Lswitch_case_26_a:
+  mov rax, 0
+  jmp .Lreturn_isRegisterStorableValue
+.Lswitch_case_26_2:
+.Lswitch_case_26_3:
+.Lswitch_case_26_4:
+.Lswitch_case_26_6:
+.Lswitch_case_26_9:
+  mov rax, 1
+  jmp .Lreturn_isRegisterStorableValue
+.Lswitch_case_26_0:
+.Lswitch_case_26_1:
+  mov rcx, 560
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend26:
+.Lreturn_isRegisterStorableValue:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isCompareNode:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor29
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor29
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Llogicalor29
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false29
+.Llogicalor29:
+  mov rax, 1
+  jmp .Llogical_end29
+.Llogical_false29:
+  mov rax, 0
+.Llogical_end29:
+  jmp .Lreturn_isCompareNode
+.Lreturn_isCompareNode:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isImmediateNode:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  jmp .Lreturn_isImmediateNode
+.Lreturn_isImmediateNode:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isScaledImmediate:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  jmp .Lreturn_isScaledImmediate
+.Lreturn_isScaledImmediate:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+exactLog2:
+  mov r10, rdi
+  lea rdi, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  movsx rax, r10d
+  test rax, rax
+  jg .Lend30
+  mov rax, -1
+  jmp .Lreturn_exactLog2
+.Lend30:
+  movsx rax, r10d
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 1
+  add rdi, rax
+  and rdi, -2
+  sub rax, rdi
+  test rax, rax
+  jne .Lend31
+  .p2align 4
+.Lbegin31:
+  movsx rax, r10d
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 1
+  add rax, rdi
+  sar rax, 1
+  mov rdi, rax
+  mov r10d, edi
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator31:
+  movsx rax, r10d
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 1
+  add rdi, rax
+  and rdi, -2
+  sub rax, rdi
+  test rax, rax
+  je .Lbegin31
+.Lend31:
+  movsx rax, r10d
+  cmp rax, 1
+  jne .Lcond_falsy_32
+  lea rax, QWORD PTR -16[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lcond_end_32
+.Lcond_falsy_32:
+  mov rax, -1
+.Lcond_end_32:
+  jmp .Lreturn_exactLog2
+.Lreturn_exactLog2:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+fillNodeNum:
+  mov r10, rdi
+  mov r11, rsi
+  mov rdi, 25
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, r10
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  mov rax, r10
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_fillNodeNum:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+fillNodeAdd:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  mov r9, rcx
+  mov rdi, 1
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, r11
+  mov rdi, rax
+  mov rax, r10
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r8
+  mov rdi, rax
+  mov rax, r10
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r9
+  mov rdi, rax
+  mov rax, r10
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_fillNodeAdd:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+fillNodeInitVar:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  mov r9, rcx
+  mov rdi, 41
+  mov rax, r10
+  mov DWORD PTR 0[rax], edi
+  mov rax, r11
+  mov rdi, rax
+  mov rax, r10
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r8
+  mov rdi, rax
+  mov rax, r10
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r9
+  mov rdi, rax
+  mov rax, r10
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 64
+  mov rdi, rax
+  mov rax, r10
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_fillNodeInitVar:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+alignTo:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r10d
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  jmp .Lreturn_alignTo
+.Lreturn_alignTo:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getAlternativeOfOneForType:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor34
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lend33
+.Llogicalor34:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp sizeOf
+.Lend33:
+  mov rax, 1
+  jmp .Lreturn_getAlternativeOfOneForType
+.Lreturn_getAlternativeOfOneForType:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findRegisterArg:
+  mov r10, rdi
+  mov r11, rsi
+  lea rdi, QWORD PTR -28[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend35
+  .p2align 4
+.Lbegin35:
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rsi, rax
+  mov rax, r10
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend36
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 64
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r11
+  mov DWORD PTR 0[rax], edi
+  mov rax, 1
+  jmp .Lreturn_findRegisterArg
+.Lend36:
+.Literator35:
+  lea rax, QWORD PTR -28[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin35
+.Lend35:
+  mov rax, 0
+  jmp .Lreturn_findRegisterArg
+.Lreturn_findRegisterArg:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeGVarInit:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend37
+  .p2align 4
+.Lbegin37:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse38_0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend38
+.Lelse38_0:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lelse38_1
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lswitch_case_39_1
+  cmp rax, 4
+  je .Lswitch_case_39_4
+  cmp rax, 8
+  je .Lswitch_case_39_8
+  jmp .Lswitch_default_39
+.Lswitch_case_39_8:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend39
+.Lswitch_case_39_4:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend39
+.Lswitch_case_39_1:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend39
+.Lswitch_default_39:
+  mov rcx, 722
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend39:
+  jmp .Lend38
+.Lelse38_1:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lelse38_2
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend38
+.Lelse38_2:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse38_3
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse40_0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend40
+.Lelse40_0:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 48
+  jne .Lelse40_1
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend40
+.Lelse40_1:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lelse40_2
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse40_2
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend40
+.Lelse40_2:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lelse40_3
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend40
+.Lelse40_3:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lelse40_4
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend40
+.Lelse40_4:
+  mov rcx, 744
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend40
+.Lend40:
+  jmp .Lend38
+.Lelse38_3:
+  mov rcx, 747
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend38
+.Lend38:
+.Literator37:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin37
+.Lend37:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeGVarInit
+.Lreturn_genCodeGVarInit:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl genAsmGlobals
+genAsmGlobals:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lend42
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lend42
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lend42
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_genAsmGlobals
+.Lend42:
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend45
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 3
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend46
+  .p2align 4
+.Lbegin46:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  mov rax, rdi
+.Literator46:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin46
+.Lend46:
+  lea rdi, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend47
+  .p2align 4
+.Lbegin47:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+.Literator47:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin47
+.Lend47:
+  .p2align 4
+.Lbegin48:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend49
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend49:
+.Literator48:
+.Lend48:
+.Lend45:
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend50
+  .p2align 4
+.Lbegin50:
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend51
+  jmp .Literator50
+.Lend51:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend52
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstAnyText
+.Lend52:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeGVarInit
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+.Literator50:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin50
+.Lend50:
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend53
+  .p2align 4
+.Lbegin53:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeGVarInit
+  mov rsi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+.Literator53:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin53
+.Lend53:
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_genAsmGlobals
+.Lreturn_genAsmGlobals:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeLVal:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov QWORD PTR -272[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend54
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeLVal
+.Lend54:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 16
+  jne .Lelse55_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeLVal
+  jmp .Lend55
+.Lelse55_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 40
+  jne .Lelse55_1
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend56
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend56:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend57
+  .p2align 4
+.Lbegin57:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator57:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin57
+.Lend57:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isLvalue
+  test rax, rax
+  jne .Lend58
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend58:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeLVal
+  jmp .Lend55
+.Lelse55_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isLvalue
+  test rax, rax
+  jne .Lend55
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend55
+.Lend55:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 48
+  je .Llogicalor61
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lelse59_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse59_0
+.Llogicalor61:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rax, 0
+  mov rsi, 17
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin62:
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -212[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator62:
+.Lend62:
+  jmp .Lend59
+.Lelse59_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 14
+  jne .Lelse59_1
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lcond_falsy_63
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_63
+.Lcond_falsy_63:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_63:
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStructOrUnionMember
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin64:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator64:
+.Lend64:
+  jmp .Lend59
+.Lelse59_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse59_2
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rax, 0
+  mov rsi, 17
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin65:
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -212[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator65:
+.Lend65:
+  jmp .Lend59
+.Lelse59_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lelse59_3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse59_3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rax, 0
+  mov rsi, 17
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin67:
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -212[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator67:
+.Lend67:
+  jmp .Lend59
+.Lelse59_3:
+  mov rax, 3
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin68:
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -212[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator68:
+.Lend68:
+  jmp .Lend59
+.Lend59:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeLVal
+.Lreturn_genCodeLVal:
+  mov rbx, QWORD PTR -272[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isFrameArray:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Llogical_false71
+  mov rax, r10
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Llogical_false71
+  mov rax, r10
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false71
+  mov rax, r10
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false71
+  mov rax, 1
+  jmp .Llogical_end71
+.Llogical_false71:
+  mov rax, 0
+.Llogical_end71:
+  jmp .Lreturn_isFrameArray
+.Lreturn_isFrameArray:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeMemOperand:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov QWORD PTR -20[rbp], rdx
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend72
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isWorkLikePointer
+  test rax, rax
+  je .Lend72
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isWorkLikePointer
+  test rax, rax
+  je .Lcond_falsy_74
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_74
+.Lcond_falsy_74:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_74:
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lcond_falsy_75
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_75
+.Lcond_falsy_75:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_75:
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend72:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse76_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse76_0
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -212[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -212[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -212[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse76_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isFrameArray
+  test rax, rax
+  je .Lelse79_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov rsi, 5
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend79
+.Lelse79_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rcx, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend79
+.Lend79:
+  jmp .Lend76
+.Lelse76_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse76_1
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Llogicalor82
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor82
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor82
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse76_1
+.Llogicalor82:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isFrameArray
+  test rax, rax
+  je .Lelse84_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rsi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 5
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call newOperandMemIndex
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend84
+.Lelse84_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 2
+  lea rax, QWORD PTR -200[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov r8, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  mov rsi, 2
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call newOperandMemIndex
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend84
+.Lend84:
+  jmp .Lend76
+.Lelse76_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rcx, 0
+  mov rsi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend76
+.Lend76:
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeMemOperand
+.Lreturn_genCodeMemOperand:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeDeref:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov QWORD PTR -264[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend85
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDeref
+.Lend85:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isRegisterStorableValue
+  test rax, rax
+  jne .Lend86
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDeref
+.Lend86:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 16
+  jne .Lelse87_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call genCodeMemOperand
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend87
+.Lelse87_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rcx, 0
+  mov rsi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend87
+.Lend87:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_88_1
+  cmp rax, 4
+  je .Lswitch_case_88_4
+  cmp rax, 8
+  je .Lswitch_case_88_8
+  jmp .Lswitch_default_88
+.Lswitch_case_88_8:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend88
+.Lswitch_case_88_4:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend88
+.Lswitch_case_88_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend88
+.Lswitch_default_88:
+  mov rcx, 957
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend88:
+  .p2align 4
+.Lbegin89:
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator89:
+.Lend89:
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDeref
+.Lreturn_genCodeDeref:
+  mov rbx, QWORD PTR -264[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeAssign:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov QWORD PTR -280[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend90
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAssign
+.Lend90:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lend91
+  lea rax, QWORD PTR -12[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findRegisterArg
+  test rax, rax
+  je .Lend91
+  lea rdi, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 1
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin93:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 1
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator93:
+.Lend93:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAssign
+.Lend91:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 16
+  jne .Lend94
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -168[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call genCodeMemOperand
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 1
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -180[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin95:
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rcx, rax
+  mov rdi, 1
+  lea rax, QWORD PTR -248[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator95:
+.Lend95:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAssign
+.Lend94:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 1
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_96_1
+  cmp rax, 4
+  je .Lswitch_case_96_4
+  cmp rax, 8
+  je .Lswitch_case_96_8
+  jmp .Lswitch_default_96
+.Lswitch_case_96_8:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend96
+.Lswitch_case_96_4:
+  mov rax, 2
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend96
+.Lswitch_case_96_1:
+  mov rax, 0
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend96
+.Lswitch_default_96:
+  mov rcx, 1022
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend96:
+  .p2align 4
+.Lbegin97:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 1
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator97:
+.Lend97:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAssign
+.Lreturn_genCodeAssign:
+  mov rbx, QWORD PTR -280[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeReturn:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov QWORD PTR -200[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend98
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeReturn
+.Lend98:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse99_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call canTailCall
+  test rax, rax
+  je .Lelse99_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeTailCall
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeReturn
+  jmp .Lend99
+.Lelse99_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend99
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  jne .Lend101
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend101:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor104
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor104
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lend102
+.Llogicalor104:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  cmp rax, rdi
+  jge .Lend102
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend102:
+  jmp .Lend99
+.Lend99:
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstJmp
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeReturn
+.Lreturn_genCodeReturn:
+  mov rbx, QWORD PTR -200[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+negateCond:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  ja .Lend106
+  lea rdi, QWORD PTR .Lswitch_table_106[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_106:
+  .long .Lswitch_case_106_0 - .Lswitch_table_106
+  .long .Lswitch_case_106_1 - .Lswitch_table_106
+  .long .Lswitch_case_106_2 - .Lswitch_table_106
+  .long .Lswitch_case_106_3 - .Lswitch_table_106
+  .long .Lswitch_case_106_4 - .Lswitch_table_106
+  .long .Lswitch_case_106_5 - .Lswitch_table_106
+  .long .Lswitch_case_106_6 - .Lswitch_table_106
+  .long .Lswitch_case_106_7 - .Lswitch_table_106
+  .long .Lswitch_case_106_8 - .Lswitch_table_106
+  .long .Lswitch_case_106_9 - .Lswitch_table_106
+.previous
+.Lswitch_case_106_0:
+  mov rax, 1
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_1:
+  mov rax, 0
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_2:
+  mov rax, 5
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_3:
+  mov rax, 4
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_4:
+  mov rax, 3
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_5:
+  mov rax, 2
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_6:
+  mov rax, 9
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_7:
+  mov rax, 8
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_8:
+  mov rax, 7
+  jmp .Lreturn_negateCond
+.Lswitch_case_106_9:
+  mov rax, 6
+  jmp .Lreturn_negateCond
+.Lend106:
+  mov rcx, 1083
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  mov rax, 0
+  jmp .Lreturn_negateCond
+.Lreturn_negateCond:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+swapCond:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  ja .Lend107
+  lea rdi, QWORD PTR .Lswitch_table_107[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_107:
+  .long .Lswitch_case_107_0 - .Lswitch_table_107
+  .long .Lswitch_case_107_1 - .Lswitch_table_107
+  .long .Lswitch_case_107_2 - .Lswitch_table_107
+  .long .Lswitch_case_107_3 - .Lswitch_table_107
+  .long .Lswitch_case_107_4 - .Lswitch_table_107
+  .long .Lswitch_case_107_5 - .Lswitch_table_107
+  .long .Lswitch_case_107_6 - .Lswitch_table_107
+  .long .Lswitch_case_107_7 - .Lswitch_table_107
+  .long .Lswitch_case_107_8 - .Lswitch_table_107
+  .long .Lswitch_case_107_9 - .Lswitch_table_107
+.previous
+.Lswitch_case_107_0:
+.Lswitch_case_107_1:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_2:
+  mov rax, 4
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_3:
+  mov rax, 5
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_4:
+  mov rax, 2
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_5:
+  mov rax, 3
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_6:
+  mov rax, 8
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_7:
+  mov rax, 9
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_8:
+  mov rax, 6
+  jmp .Lreturn_swapCond
+.Lswitch_case_107_9:
+  mov rax, 7
+  jmp .Lreturn_swapCond
+.Lend107:
+  mov rcx, 1112
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  mov rax, 0
+  jmp .Lreturn_swapCond
+.Lreturn_swapCond:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeCompare:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  mov QWORD PTR -232[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lelse108_0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lelse108_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse108_1
+  mov rdi, 1
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lelse108_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse108_2
+  mov rdi, 2
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lelse108_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lelse108_3
+  mov rdi, 3
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lelse108_3:
+  mov rcx, 1135
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend108
+.Lend108:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse109_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend109
+.Lelse109_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse109_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -204[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -204[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call swapCond
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend109
+.Lelse109_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 1
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend109
+.Lend109:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeCompare
+.Lreturn_genCodeCompare:
+  mov rbx, QWORD PTR -232[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeCondJump:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov QWORD PTR -288[rbp], rbx
+  mov QWORD PTR -48[rbp], rdi
+  mov DWORD PTR -40[rbp], esi
+  mov QWORD PTR -32[rbp], rdx
+  mov QWORD PTR -24[rbp], rcx
+  mov QWORD PTR -16[rbp], r8
+  mov QWORD PTR -8[rbp], r9
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], 24
+  mov DWORD PTR 4[rax], 48
+  lea rdi, QWORD PTR 16[rbp]
+  mov QWORD PTR 8[rax], rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 16[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call vformat
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 17
+  jne .Lelse110_0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend110
+.Lelse110_0:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  je .Llogicalor111
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  jne .Lelse110_1
+.Llogicalor111:
+  lea rdi, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -236[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lelse112_0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend112
+.Lelse112_0:
+  lea rdi, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  jne .Lcond_falsy_113
+  lea rax, QWORD PTR .LiteralString31[rip]
+  jmp .Lcond_end_113
+.Lcond_falsy_113:
+  lea rax, QWORD PTR .LiteralString32[rip]
+.Lcond_end_113:
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -236[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  jmp .Lend112
+.Lend112:
+  jmp .Lend110
+.Lelse110_1:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lelse110_2
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  setne al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend114
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+.Lend114:
+  jmp .Lend110
+.Lelse110_2:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor553
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor553
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Llogicalor553
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false553
+.Llogicalor553:
+  mov rax, 1
+  jmp .Llogical_end553
+.Llogical_false553:
+  mov rax, 0
+.Llogical_end553:
+  test rax, rax
+  je .Lelse115_0
+  lea rax, QWORD PTR -84[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeCompare
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend115
+.Lelse115_0:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  jne .Lend116
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend116:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 1
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend115
+.Lend115:
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend117
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call negateCond
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend117:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov r8, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstJcc
+  jmp .Lend110
+.Lend110:
+  .p2align 4
+.Lbegin118:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend119
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend119:
+.Literator118:
+.Lend118:
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeCondJump
+.Lreturn_genCodeCondJump:
+  mov rbx, QWORD PTR -288[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeIf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend120
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeIf
+.Lend120:
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse121_0
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov r9, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend121
+.Lelse121_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend121
+.Lend121:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend122
+  mov rdi, 0
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend122:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend123
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+.Lend123:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend124
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend125
+  .p2align 4
+.Lbegin125:
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -156[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 34
+  jne .Lend126
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse127_0
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov r9, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend127
+.Lelse127_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend127
+.Lend127:
+.Lend126:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend128
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend128:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+.Literator125:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin125
+.Lend125:
+.Lend124:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeIf
+.Lreturn_genCodeIf:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isDenseSwitch:
+  mov r10, rdi
+  mov r11, rsi
+  movsx rax, r11d
+  cmp rax, 4
+  jge .Lend129
+  mov rax, 0
+  jmp .Lreturn_isDenseSwitch
+.Lend129:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, r10
+  mov rdi, rax
+  movsx rax, r11d
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lcond_falsy_131
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 4096
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setl al
+  movzx rax, al
+  jmp .Lcond_end_131
+.Lcond_falsy_131:
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 4096
+  setg al
+  movzx rax, al
+.Lcond_end_131:
+  test rax, rax
+  je .Lend130
+  mov rax, 0
+  jmp .Lreturn_isDenseSwitch
+.Lend130:
+  lea rax, QWORD PTR -28[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r11d
+  lea rax, QWORD PTR 0[rax+rax*2]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setle al
+  movzx rax, al
+  jmp .Lreturn_isDenseSwitch
+.Lreturn_isDenseSwitch:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeSwitchJumpTable:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov QWORD PTR -216[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov DWORD PTR -20[rbp], edx
+  mov QWORD PTR -28[rbp], rcx
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend132
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend132:
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov r8, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstJcc
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rax, 0
+  mov rsi, 17
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 14
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 23
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend133
+  .p2align 4
+.Lbegin133:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lelse134_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend134
+.Lelse134_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstAnyText
+  jmp .Lend134
+.Lend134:
+.Literator133:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin133
+.Lend133:
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitchJumpTable
+.Lreturn_genCodeSwitchJumpTable:
+  mov rbx, QWORD PTR -216[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeSwitchBinarySearch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov QWORD PTR -208[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov DWORD PTR -20[rbp], edx
+  mov DWORD PTR -24[rbp], ecx
+  mov QWORD PTR -32[rbp], r8
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 3
+  jge .Lend135
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Lend136
+  .p2align 4
+.Lbegin136:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov r9, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call appendAsmInstJcc
+.Literator136:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jle .Lbegin136
+.Lend136:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitchBinarySearch
+.Lend135:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 1
+  add rax, rdi
+  sar rax, 1
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov r9, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call appendAsmInstJcc
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov r9, rax
+  mov rsi, 4
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call appendAsmInstJcc
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call genCodeSwitchBinarySearch
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov r9, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call genCodeSwitchBinarySearch
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitchBinarySearch
+.Lreturn_genCodeSwitchBinarySearch:
+  mov rbx, QWORD PTR -208[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeSwitch:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 240
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend137
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitch
+.Lend137:
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend138
+  .p2align 4
+.Lbegin138:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse139_0
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend139
+.Lelse139_0:
+  mov rdi, 1
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend139
+.Lend139:
+.Literator138:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin138
+.Lend138:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend140
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 2
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend141
+  .p2align 4
+.Lbegin141:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend142
+  jmp .Literator141
+.Lend142:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -204[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond143
+  .p2align 4
+.Lbegin143:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov DWORD PTR 0[rsi+rax*4], edi
+  mov rax, rdi
+.Literator143:
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lcond143:
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jle .Llogicaland144
+  lea rax, QWORD PTR -204[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  cmp rax, rdi
+  jl .Lbegin143
+.Llogicaland144:
+.Lend143:
+  lea rax, QWORD PTR -204[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov DWORD PTR 0[rsi+rax*4], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator141:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin141
+.Lend141:
+.Lend140:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse145_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend145
+.Lelse145_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend145
+.Lend145:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse146_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  jmp .Lend146
+.Lelse146_0:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isDenseSwitch
+  test rax, rax
+  je .Lelse146_1
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeSwitchJumpTable
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend146
+.Lelse146_1:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov r9, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r9
+  mov al, 0
+  call genCodeSwitchBinarySearch
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend146
+.Lend146:
+  .p2align 4
+.Lbegin147:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend148
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend148:
+.Literator147:
+.Lend147:
+  .p2align 4
+.Lbegin149:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend150
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend150:
+.Literator149:
+.Lend149:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitch
+.Lreturn_genCodeSwitch:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeSwitchCase:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend151
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitchCase
+.Lend151:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse152_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstLabel
+  jmp .Lend152
+.Lelse152_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  jmp .Lend152
+.Lend152:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSwitchCase
+.Lreturn_genCodeSwitchCase:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+hasLabel:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend153
+  .p2align 4
+.Lbegin153:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  je .Llogicalor156
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  je .Llogicalor156
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 32
+  jne .Lend154
+.Llogicalor156:
+  mov rax, 1
+  jmp .Lreturn_hasLabel
+.Lend154:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend157
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  je .Lend157
+  mov rax, 1
+  jmp .Lreturn_hasLabel
+.Lend157:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  jne .Llogicalor163
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  jne .Llogicalor163
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  jne .Llogicalor163
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  jne .Llogicalor163
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  je .Lend159
+.Llogicalor163:
+  mov rax, 1
+  jmp .Lreturn_hasLabel
+.Lend159:
+.Literator153:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin153
+.Lend153:
+  mov rax, 0
+  jmp .Lreturn_hasLabel
+.Lreturn_hasLabel:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeFor:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend164
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeFor
+.Lend164:
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend165
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend166
+  mov rdi, 0
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend166:
+.Lend165:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse167_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  je .Lelse167_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  jmp .Lend167
+.Lelse167_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend167
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend167
+.Lend167:
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend169
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend169
+  mov rdi, 0
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend169:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend171
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend171:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse172_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasLabel
+  test rax, rax
+  je .Lend173
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+.Lend173:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov r8, rax
+  mov rsi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend172
+.Lelse172_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  jmp .Lend172
+.Lend172:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeFor
+.Lreturn_genCodeFor:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeDoWhile:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend174
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDoWhile
+.Lend174:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend175
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend175:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov r8, rax
+  mov rsi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDoWhile
+.Lreturn_genCodeDoWhile:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeFCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov QWORD PTR -272[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend176
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeFCall
+.Lend176:
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jle .Lend177
+  mov rdi, 6
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend177:
+  mov rdi, 5
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  sal rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend178
+  .p2align 4
+.Lbegin178:
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+.Literator178:
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin178
+.Lend178:
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend179
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 10
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend179:
+  lea rdi, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend180
+  .p2align 4
+.Lbegin180:
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 8
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator180:
+  lea rax, QWORD PTR -180[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin180
+.Lend180:
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse181_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call format
+  mov rdi, rax
+  mov al, 0
+  call newOperandLabel
+  mov rcx, rax
+  mov rsi, 22
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  jmp .Lend181
+.Lelse181_0:
+  mov rax, 3
+  mov rdi, 10
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 22
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  jmp .Lend181
+.Lend181:
+  mov rdi, 6
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  .p2align 4
+.Lbegin182:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator182:
+.Lend182:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeFCall
+.Lreturn_genCodeFCall:
+  mov rbx, QWORD PTR -272[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+canTailCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -32[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 92
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogicalor184
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  je .Lend183
+.Llogicalor184:
+  mov rax, 0
+  jmp .Lreturn_canTailCall
+.Lend183:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jle .Lend185
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend185
+  mov rax, 0
+  jmp .Lreturn_canTailCall
+.Lend185:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor189
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor189
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lend187
+.Llogicalor189:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lend187
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  cmp rax, rdi
+  jge .Lend187
+  mov rax, 0
+  jmp .Lreturn_canTailCall
+.Lend187:
+  mov rax, 1
+  jmp .Lreturn_canTailCall
+.Lreturn_canTailCall:
+  mov rbx, QWORD PTR -32[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeTailCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov QWORD PTR -208[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jle .Lend192
+  mov rdi, 6
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend192:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend193
+  .p2align 4
+.Lbegin193:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+.Literator193:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin193
+.Lend193:
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend194
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 10
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend194:
+  lea rdi, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend195
+  .p2align 4
+.Lbegin195:
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 8
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator195:
+  lea rax, QWORD PTR -164[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin195
+.Lend195:
+  lea rdi, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend196
+  .p2align 4
+.Lbegin196:
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 2
+  movsx rax, eax
+  sal rax, 3
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Literator196:
+  lea rax, QWORD PTR -164[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin196
+.Lend196:
+  mov rdi, 7
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse197_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstJmp
+  jmp .Lend197
+.Lelse197_0:
+  mov rax, 3
+  mov rdi, 10
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 23
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  jmp .Lend197
+.Lend197:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeTailCall
+.Lreturn_genCodeTailCall:
+  mov rbx, QWORD PTR -208[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeMulImm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov QWORD PTR -176[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  test rax, rax
+  jl .Lelse198_0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 14
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend198
+.Lelse198_0:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor200
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Llogicalor200
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lelse198_1
+.Llogicalor200:
+  mov r8, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rcx, 0
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rcx
+  mov rcx, rax
+  mov al, 0
+  call newOperandMemIndex
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend198
+.Lelse198_1:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jle .Lelse198_2
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  test rax, rax
+  jl .Lelse198_2
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 14
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend198
+.Lelse198_2:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jle .Lelse198_3
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  test rax, rax
+  jl .Lelse198_3
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 14
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend198
+.Lelse198_3:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 10
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend198
+.Lend198:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeMulImm
+.Lreturn_genCodeMulImm:
+  mov rbx, QWORD PTR -176[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeDivImm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov QWORD PTR -200[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lelse203_0
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend204
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend204:
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDivImm
+  jmp .Lend203
+.Lelse203_0:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jl .Lend203
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 63
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 15
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 11
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse205_0
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rsi, 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 11
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend205
+.Lelse205_0:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 15
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend205
+.Lend205:
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDivImm
+  jmp .Lend203
+.Lend203:
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend206
+  .p2align 4
+.Lbegin206:
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator206:
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin206
+.Lend206:
+  lea rdi, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 31
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend207
+  .p2align 4
+.Lbegin207:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 1
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 1
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 32767
+  add rax, rdi
+  sar rax, 15
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 1
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 65535
+  add rdi, rax
+  and rdi, -65536
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Lend208
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend208:
+.Literator207:
+  lea rax, QWORD PTR -180[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 31
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin207
+.Lend207:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  cmp rax, 65536
+  jne .Lend209
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend209:
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 32768
+  jge .Lelse210_0
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 16
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend210
+.Lelse210_0:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call format
+  mov rdi, rax
+  mov al, 0
+  call newOperandLabel
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend210
+.Lend210:
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 10
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 31
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 15
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 63
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 15
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse211_0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 10
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend211
+.Lelse211_0:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend211
+.Lend211:
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDivImm
+.Lreturn_genCodeDivImm:
+  mov rbx, QWORD PTR -200[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeMoveBlockTail:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov QWORD PTR -184[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  mov DWORD PTR -8[rbp], esi
+  mov DWORD PTR -12[rbp], edx
+  mov DWORD PTR -16[rbp], ecx
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend212
+  .p2align 4
+.Lbegin212:
+  lea rdi, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 8
+  jl .Lelse213_0
+  mov rdi, 8
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend213
+.Lelse213_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 4
+  jl .Lend213
+  mov rdi, 4
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend213
+.Lend213:
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  jne .Lelse214_0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend214
+.Lelse214_0:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend214
+.Lend214:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator212:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin212
+.Lend212:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeMoveBlockTail
+.Lreturn_genCodeMoveBlockTail:
+  mov rbx, QWORD PTR -184[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeClearBlock:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov QWORD PTR -176[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 256
+  jl .Lelse215_0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rax, rdi
+  sar rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 28
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rdi, rax
+  and rdi, -8
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend215
+.Lelse215_0:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 16
+  jl .Lend215
+  mov rax, 4
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 4
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 26
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 16
+  jl .Lend216
+  .p2align 4
+.Lbegin216:
+  mov rax, 4
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 1
+  mov rdi, 4
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 25
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Literator216:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 16
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 16
+  jge .Lbegin216
+.Lend216:
+  jmp .Lend215
+.Lend215:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 18
+  mov rdi, 1
+  mov rdx, rax
+  mov al, 0
+  call genCodeMoveBlockTail
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeClearBlock
+.Lreturn_genCodeClearBlock:
+  mov rbx, QWORD PTR -176[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeCopyBlock:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov QWORD PTR -176[rbp], rbx
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 256
+  jl .Lelse217_0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rax, rdi
+  sar rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 27
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rdi, rax
+  and rdi, -8
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend217
+.Lelse217_0:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 16
+  jl .Lend217
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 16
+  jl .Lend218
+  .p2align 4
+.Lbegin218:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 2
+  mov rdi, 4
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 4
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 25
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 4
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 1
+  mov rdi, 4
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 25
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Literator218:
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 16
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  cmp rax, 16
+  jge .Lbegin218
+.Lend218:
+  jmp .Lend217
+.Lend217:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 2
+  mov rdi, 1
+  mov rdx, rax
+  mov al, 0
+  call genCodeMoveBlockTail
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeCopyBlock
+.Lreturn_genCodeCopyBlock:
+  mov rbx, QWORD PTR -176[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeVaStart:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 224
+  mov QWORD PTR -216[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 120
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend219
+  .p2align 4
+.Lbegin219:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend220
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend220:
+.Literator219:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin219
+.Lend219:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 120
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jge .Lelse221_0
+  mov rsi, 56
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend221
+.Lelse221_0:
+  mov rdi, 48
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend221
+.Lend221:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 48
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 120
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jg .Lelse222_0
+  mov rax, 16
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend222
+.Lelse222_0:
+  lea rdi, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rsi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend222
+.Lend222:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 120
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeVaStart
+.Lreturn_genCodeVaStart:
+  mov rbx, QWORD PTR -216[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+hasFunctionCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend223
+  .p2align 4
+.Lbegin223:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  je .Llogicalor225
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 51
+  jne .Lend224
+.Llogicalor225:
+  mov rax, 1
+  jmp .Lreturn_hasFunctionCall
+.Lend224:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogicalor232
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogicalor232
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogicalor232
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogicalor232
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogicalor232
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogicalor232
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  je .Lend226
+.Llogicalor232:
+  mov rax, 1
+  jmp .Lreturn_hasFunctionCall
+.Lend226:
+.Literator223:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin223
+.Lend223:
+  mov rax, 0
+  jmp .Lreturn_hasFunctionCall
+.Lreturn_hasFunctionCall:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isFrameObject:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 14
+  jne .Lend233
+  .p2align 4
+.Lbegin233:
+  mov rax, r10
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, rdi
+.Literator233:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 14
+  je .Lbegin233
+.Lend233:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Llogical_false236
+  mov rax, r10
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false236
+  mov rax, r10
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false236
+  mov rax, r10
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogical_false236
+  mov rax, 1
+  jmp .Llogical_end236
+.Llogical_false236:
+  mov rax, 0
+.Llogical_end236:
+  jmp .Lreturn_isFrameObject
+.Lreturn_isFrameObject:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+takesFrameAddress:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend237
+  .p2align 4
+.Lbegin237:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 15
+  jne .Lend238
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isFrameObject
+  test rax, rax
+  je .Lend238
+  mov rax, 1
+  jmp .Lreturn_takesFrameAddress
+.Lend238:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend240
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lend240
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isFrameObject
+  test rax, rax
+  je .Lend240
+  mov rax, 1
+  jmp .Lreturn_takesFrameAddress
+.Lend240:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lend243
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  je .Lend243
+  mov rax, 1
+  jmp .Lreturn_takesFrameAddress
+.Lend243:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogicalor251
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogicalor251
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogicalor251
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogicalor251
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogicalor251
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogicalor251
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  je .Lend245
+.Llogicalor251:
+  mov rax, 1
+  jmp .Lreturn_takesFrameAddress
+.Lend245:
+.Literator237:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin237
+.Lend237:
+  mov rax, 0
+  jmp .Lreturn_takesFrameAddress
+.Lreturn_takesFrameAddress:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+keepArgOnStack:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 40
+  jne .Lend252
+  mov rax, r10
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend252
+  mov rax, r10
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, r10
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend254
+  .p2align 4
+.Lbegin254:
+.Literator254:
+  mov rax, r10
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, r10
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin254
+.Lend254:
+.Lend252:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  je .Lend255
+  jmp .Lreturn_keepArgOnStack
+.Lend255:
+  lea rdi, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend256
+  .p2align 4
+.Lbegin256:
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rsi, rax
+  mov rax, r10
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend257
+  mov rdi, 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  mov rax, rdi
+.Lend257:
+.Literator256:
+  lea rax, QWORD PTR -20[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin256
+.Lend256:
+.Lreturn_keepArgOnStack:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findStackArgs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend258
+  .p2align 4
+.Lbegin258:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 10
+  cmp rax, 20
+  ja .Lswitch_default_259
+  lea rdi, QWORD PTR .Lswitch_table_259[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_259:
+  .long .Lswitch_case_259_a - .Lswitch_table_259
+  .long .Lswitch_case_259_b - .Lswitch_table_259
+  .long .Lswitch_case_259_c - .Lswitch_table_259
+  .long .Lswitch_case_259_d - .Lswitch_table_259
+  .long .Lswitch_case_259_e - .Lswitch_table_259
+  .long .Lswitch_case_259_f - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_default_259 - .Lswitch_table_259
+  .long .Lswitch_case_259_1c - .Lswitch_table_259
+  .long .Lswitch_case_259_1d - .Lswitch_table_259
+  .long .Lswitch_case_259_1e - .Lswitch_table_259
+.previous
+.Lswitch_case_259_f:
+.Lswitch_case_259_a:
+.Lswitch_case_259_b:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call keepArgOnStack
+  jmp .Lend259
+.Lswitch_case_259_c:
+.Lswitch_case_259_d:
+.Lswitch_case_259_e:
+.Lswitch_case_259_1d:
+.Lswitch_case_259_1e:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call keepArgOnStack
+  jmp .Lend259
+.Lswitch_case_259_1c:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  je .Lend260
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call keepArgOnStack
+.Lend260:
+  jmp .Lend259
+.Lswitch_default_259:
+  jmp .Lend259
+.Lend259:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+.Literator258:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin258
+.Lend258:
+.Lreturn_findStackArgs:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+assignRegisterArgs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rsi, 10
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rcx
+  mov rdi, rsi
+  mov DWORD PTR -28[rbp+rax*4], edi
+  mov rax, rdi
+  mov rsi, 11
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rcx
+  mov rdi, rsi
+  mov DWORD PTR -28[rbp+rax*4], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jg .Lend261
+  mov rsi, 8
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rcx
+  mov rdi, rsi
+  mov DWORD PTR -28[rbp+rax*4], edi
+  mov rax, rdi
+.Lend261:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jg .Lend262
+  mov rsi, 9
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rcx
+  mov rdi, rsi
+  mov DWORD PTR -28[rbp+rax*4], edi
+  mov rax, rdi
+.Lend262:
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend263
+  .p2align 4
+.Lbegin263:
+  lea rdi, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor267
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor267
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor267
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lelse264_0
+.Llogicalor267:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  mov rax, rdi
+  jmp .Lend264
+.Lelse264_0:
+  mov rdi, 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  mov rax, rdi
+  jmp .Lend264
+.Lend264:
+.Literator263:
+  lea rax, QWORD PTR -52[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin263
+.Lend263:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStackArgs
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend268
+  .p2align 4
+.Lbegin268:
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  test rax, rax
+  jne .Lend269
+  jmp .Literator268
+.Lend269:
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  cmp rax, 8
+  je .Llogicalor271
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lelse270_0
+.Llogicalor271:
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend270
+.Lelse270_0:
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lelse270_1
+  lea rax, QWORD PTR -36[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  mov eax, DWORD PTR -28[rbp+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend270
+.Lelse270_1:
+  jmp .Literator268
+  jmp .Lend270
+.Lend270:
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 16
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 64
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov DWORD PTR 0[rsi+rax*4], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator268:
+  lea rax, QWORD PTR -52[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin268
+.Lend268:
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_assignRegisterArgs:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isFrameRegisterOperand:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse272_0
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Llogicalor273
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Llogical_false273
+.Llogicalor273:
+  mov rax, 1
+  jmp .Llogical_end273
+.Llogical_false273:
+  mov rax, 0
+.Llogical_end273:
+  jmp .Lreturn_isFrameRegisterOperand
+  jmp .Lend272
+.Lelse272_0:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend272
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false274
+  mov rax, r10
+  add rax, 8
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Llogical_false274
+  mov rax, 1
+  jmp .Llogical_end274
+.Llogical_false274:
+  mov rax, 0
+.Llogical_end274:
+  jmp .Lreturn_isFrameRegisterOperand
+  jmp .Lend272
+.Lend272:
+  mov rax, 0
+  jmp .Lreturn_isFrameRegisterOperand
+.Lreturn_isFrameRegisterOperand:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+needsFrame:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend275
+  .p2align 4
+.Lbegin275:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 25
+  ja .Lswitch_default_276
+  lea rdi, QWORD PTR .Lswitch_table_276[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_276:
+  .long .Lswitch_case_276_1 - .Lswitch_table_276
+  .long .Lswitch_case_276_2 - .Lswitch_table_276
+  .long .Lswitch_case_276_3 - .Lswitch_table_276
+  .long .Lswitch_default_276 - .Lswitch_table_276
+  .long .Lswitch_case_276_5 - .Lswitch_table_276
+  .long .Lswitch_case_276_6 - .Lswitch_table_276
+  .long .Lswitch_default_276 - .Lswitch_table_276
+  .long .Lswitch_case_276_8 - .Lswitch_table_276
+  .long .Lswitch_case_276_9 - .Lswitch_table_276
+  .long .Lswitch_case_276_a - .Lswitch_table_276
+  .long .Lswitch_case_276_b - .Lswitch_table_276
+  .long .Lswitch_case_276_c - .Lswitch_table_276
+  .long .Lswitch_case_276_d - .Lswitch_table_276
+  .long .Lswitch_case_276_e - .Lswitch_table_276
+  .long .Lswitch_case_276_f - .Lswitch_table_276
+  .long .Lswitch_case_276_10 - .Lswitch_table_276
+  .long .Lswitch_case_276_11 - .Lswitch_table_276
+  .long .Lswitch_case_276_12 - .Lswitch_table_276
+  .long .Lswitch_case_276_13 - .Lswitch_table_276
+  .long .Lswitch_case_276_14 - .Lswitch_table_276
+  .long .Lswitch_case_276_15 - .Lswitch_table_276
+  .long .Lswitch_case_276_16 - .Lswitch_table_276
+  .long .Lswitch_case_276_17 - .Lswitch_table_276
+  .long .Lswitch_default_276 - .Lswitch_table_276
+  .long .Lswitch_case_276_19 - .Lswitch_table_276
+  .long .Lswitch_case_276_1a - .Lswitch_table_276
+.previous
+.Lswitch_case_276_1:
+.Lswitch_case_276_2:
+.Lswitch_case_276_16:
+.Lswitch_case_276_5:
+.Lswitch_case_276_6:
+  mov rax, 1
+  jmp .Lreturn_needsFrame
+.Lswitch_case_276_3:
+.Lswitch_case_276_8:
+.Lswitch_case_276_9:
+.Lswitch_case_276_a:
+.Lswitch_case_276_b:
+.Lswitch_case_276_c:
+.Lswitch_case_276_d:
+.Lswitch_case_276_e:
+.Lswitch_case_276_f:
+.Lswitch_case_276_10:
+.Lswitch_case_276_11:
+.Lswitch_case_276_12:
+.Lswitch_case_276_13:
+.Lswitch_case_276_14:
+.Lswitch_case_276_19:
+.Lswitch_case_276_1a:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call isFrameRegisterOperand
+  test rax, rax
+  jne .Llogicalor278
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  mov al, 0
+  call isFrameRegisterOperand
+  test rax, rax
+  je .Lend277
+.Llogicalor278:
+  mov rax, 1
+  jmp .Lreturn_needsFrame
+.Lend277:
+  jmp .Lend276
+.Lswitch_case_276_15:
+.Lswitch_case_276_17:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call isFrameRegisterOperand
+  test rax, rax
+  je .Lend279
+  mov rax, 1
+  jmp .Lreturn_needsFrame
+.Lend279:
+  jmp .Lend276
+.Lswitch_default_276:
+  jmp .Lend276
+.Lend276:
+.Literator275:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin275
+.Lend275:
+  mov rax, 0
+  jmp .Lreturn_needsFrame
+.Lreturn_needsFrame:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+rebaseOperandToRSP:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Llogicalor282
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogicalor282
+  mov rax, r10
+  add rax, 8
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Lend280
+.Llogicalor282:
+  jmp .Lreturn_rebaseOperandToRSP
+.Lend280:
+  mov rdi, 6
+  mov rax, r10
+  add rax, 8
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, r10
+  add rax, 8
+  add rax, 32
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r10
+  add rax, 8
+  add rax, 32
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_rebaseOperandToRSP:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+rebaseFrameToRSP:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend283
+  .p2align 4
+.Lbegin283:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 3
+  cmp rax, 23
+  ja .Lswitch_default_284
+  lea rdi, QWORD PTR .Lswitch_table_284[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_284:
+  .long .Lswitch_case_284_3 - .Lswitch_table_284
+  .long .Lswitch_default_284 - .Lswitch_table_284
+  .long .Lswitch_default_284 - .Lswitch_table_284
+  .long .Lswitch_default_284 - .Lswitch_table_284
+  .long .Lswitch_default_284 - .Lswitch_table_284
+  .long .Lswitch_case_284_8 - .Lswitch_table_284
+  .long .Lswitch_case_284_9 - .Lswitch_table_284
+  .long .Lswitch_case_284_a - .Lswitch_table_284
+  .long .Lswitch_case_284_b - .Lswitch_table_284
+  .long .Lswitch_case_284_c - .Lswitch_table_284
+  .long .Lswitch_case_284_d - .Lswitch_table_284
+  .long .Lswitch_case_284_e - .Lswitch_table_284
+  .long .Lswitch_case_284_f - .Lswitch_table_284
+  .long .Lswitch_case_284_10 - .Lswitch_table_284
+  .long .Lswitch_case_284_11 - .Lswitch_table_284
+  .long .Lswitch_case_284_12 - .Lswitch_table_284
+  .long .Lswitch_case_284_13 - .Lswitch_table_284
+  .long .Lswitch_case_284_14 - .Lswitch_table_284
+  .long .Lswitch_case_284_15 - .Lswitch_table_284
+  .long .Lswitch_default_284 - .Lswitch_table_284
+  .long .Lswitch_case_284_17 - .Lswitch_table_284
+  .long .Lswitch_default_284 - .Lswitch_table_284
+  .long .Lswitch_case_284_19 - .Lswitch_table_284
+  .long .Lswitch_case_284_1a - .Lswitch_table_284
+.previous
+.Lswitch_case_284_3:
+.Lswitch_case_284_8:
+.Lswitch_case_284_9:
+.Lswitch_case_284_a:
+.Lswitch_case_284_b:
+.Lswitch_case_284_c:
+.Lswitch_case_284_d:
+.Lswitch_case_284_e:
+.Lswitch_case_284_f:
+.Lswitch_case_284_10:
+.Lswitch_case_284_11:
+.Lswitch_case_284_12:
+.Lswitch_case_284_13:
+.Lswitch_case_284_14:
+.Lswitch_case_284_19:
+.Lswitch_case_284_1a:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call rebaseOperandToRSP
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  mov al, 0
+  call rebaseOperandToRSP
+  jmp .Lend284
+.Lswitch_case_284_15:
+.Lswitch_case_284_17:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call rebaseOperandToRSP
+  jmp .Lend284
+.Lswitch_default_284:
+  jmp .Lend284
+.Lend284:
+.Literator283:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin283
+.Lend283:
+.Lreturn_rebaseFrameToRSP:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+appendEpilogue:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -64[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov DWORD PTR -16[rbp], edx
+  mov DWORD PTR -20[rbp], ecx
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jge .Lend285
+  .p2align 4
+.Lbegin285:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  mov rdi, 1
+  lea rax, QWORD PTR calleeSavedRegs[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  and rax, rdi
+  test rax, rax
+  je .Lend286
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rsi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rcx, 3
+  lea rax, QWORD PTR calleeSavedRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend286:
+.Literator285:
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jl .Lbegin285
+.Lend285:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend287
+  mov rax, 3
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 6
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 5
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend287:
+.Lreturn_appendEpilogue:
+  mov rbx, QWORD PTR -64[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+expandEpilogues:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 192
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov DWORD PTR -16[rbp], edx
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend288
+  .p2align 4
+.Lbegin288:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend289
+  jmp .Literator288
+.Lend289:
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendEpilogue
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  .p2align 4
+.Lbegin290:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend291
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend291:
+.Literator290:
+.Lend290:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getLastAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator288:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin288
+.Lend288:
+.Lreturn_expandEpilogues:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeFunction:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov QWORD PTR -280[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse292_0
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeFunction
+  jmp .Lend292
+.Lelse292_0:
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend292
+  mov rcx, 2188
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend292
+.Lend292:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jle .Lend293
+  mov rdi, 6
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend293:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false294
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call hasFunctionCall
+  test rax, rax
+  jne .Llogical_false294
+  mov rax, 1
+  jmp .Llogical_end294
+.Llogical_false294:
+  mov rax, 0
+.Llogical_end294:
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend295
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call assignRegisterArgs
+.Lend295:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 180
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false298
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false298
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false298
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call takesFrameAddress
+  test rax, rax
+  jne .Llogical_false298
+  mov rax, 1
+  jmp .Llogical_end298
+.Llogical_false298:
+  mov rax, 0
+.Llogical_end298:
+  mov rdi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 92
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend299
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstAnyText
+.Lend299:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rdi, rax
+  mov al, 0
+  call releaseAsmInstList
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call optimizeAsm
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call allocateRegisters
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -252[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -252[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rax, rdi
+  sar rax, 3
+  sal rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jge .Lend300
+  .p2align 4
+.Lbegin300:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  mov rdi, 1
+  lea rax, QWORD PTR calleeSavedRegs[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  and rax, rdi
+  test rax, rax
+  je .Lend301
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend301:
+.Literator300:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jl .Lbegin300
+.Lend300:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false303
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  cmp rax, 128
+  jg .Llogical_false303
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call needsFrame
+  test rax, rax
+  jne .Llogical_false303
+  mov rax, 1
+  jmp .Llogical_end303
+.Llogical_false303:
+  mov rax, 0
+.Llogical_end303:
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -252[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -252[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 16
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 15
+  add rax, rdi
+  sar rax, 4
+  sal rax, 4
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call alignStackForCalls
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call expandEpilogues
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend304
+  .p2align 4
+.Lbegin305:
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rcx, rax
+  mov rdi, 5
+  lea rax, QWORD PTR -248[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator305:
+.Lend305:
+  mov rax, 3
+  mov rdi, 6
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend306
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -252[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -252[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 6
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend306:
+.Lend304:
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jge .Lend307
+  .p2align 4
+.Lbegin307:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  mov rdi, 1
+  lea rax, QWORD PTR calleeSavedRegs[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  and rax, rdi
+  test rax, rax
+  je .Lend308
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rcx, 3
+  lea rax, QWORD PTR calleeSavedRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend308:
+.Literator307:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jl .Lbegin307
+.Lend307:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend309
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend310
+  .p2align 4
+.Lbegin310:
+  lea rax, QWORD PTR -208[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findRegisterArg
+  test rax, rax
+  je .Lend311
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  cmp rax, rdi
+  je .Lend312
+  mov rcx, 3
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -208[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend312:
+  jmp .Literator310
+.Lend311:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call getOperandSizeFromByteSize
+  mov rdi, rax
+  lea rax, QWORD PTR -204[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -204[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  mov rsi, 5
+  lea rax, QWORD PTR -204[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Literator310:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin310
+.Lend310:
+.Lend309:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend313
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jge .Lend313
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend315
+  .p2align 4
+.Lbegin315:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend316
+  mov rsi, 0
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend316:
+.Literator315:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin315
+.Lend315:
+  lea rdi, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jge .Lend317
+  .p2align 4
+.Lbegin317:
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rcx, 3
+  lea rax, QWORD PTR argRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Literator317:
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -192[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jl .Lbegin317
+.Lend317:
+.Lend313:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jne .Lend318
+  mov rcx, 4
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcmp
+  test rax, rax
+  jne .Lend318
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend318:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call appendEpilogue
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend320
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call rebaseFrameToRSP
+.Lend320:
+  mov rdi, 29
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstAnyText
+  mov rdi, 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 92
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeFunction
+.Lreturn_genCodeFunction:
+  mov rbx, QWORD PTR -280[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeIncrement:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov QWORD PTR -272[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend321
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeIncrement
+.Lend321:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_322
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_322
+.Lcond_falsy_322:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_322:
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_323_1
+  cmp rax, 4
+  je .Lswitch_case_323_4
+  cmp rax, 8
+  je .Lswitch_case_323_8
+  jmp .Lswitch_default_323
+.Lswitch_case_323_8:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend323
+.Lswitch_case_323_4:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend323
+.Lswitch_case_323_1:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend323
+.Lswitch_default_323:
+  mov rcx, 2321
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend323:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend324
+  .p2align 4
+.Lbegin325:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator325:
+.Lend325:
+.Lend324:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_326_1
+  cmp rax, 4
+  je .Lswitch_case_326_4
+  cmp rax, 8
+  je .Lswitch_case_326_8
+  jmp .Lswitch_default_326
+.Lswitch_case_326_8:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend326
+.Lswitch_case_326_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend326
+.Lswitch_case_326_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend326
+.Lswitch_default_326:
+  mov rcx, 2342
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend326:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend327
+  .p2align 4
+.Lbegin328:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator328:
+.Lend328:
+.Lend327:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_329_1
+  cmp rax, 4
+  je .Lswitch_case_329_4
+  cmp rax, 8
+  je .Lswitch_case_329_8
+  jmp .Lswitch_default_329
+.Lswitch_case_329_8:
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 1
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend329
+.Lswitch_case_329_4:
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 1
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend329
+.Lswitch_case_329_1:
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 1
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend329
+.Lswitch_default_329:
+  mov rcx, 2361
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend329:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeIncrement
+.Lreturn_genCodeIncrement:
+  mov rbx, QWORD PTR -272[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeDecrement:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov QWORD PTR -272[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend330
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDecrement
+.Lend330:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_331
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_331
+.Lcond_falsy_331:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_331:
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_332_1
+  cmp rax, 4
+  je .Lswitch_case_332_4
+  cmp rax, 8
+  je .Lswitch_case_332_8
+  jmp .Lswitch_default_332
+.Lswitch_case_332_8:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend332
+.Lswitch_case_332_4:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend332
+.Lswitch_case_332_1:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend332
+.Lswitch_default_332:
+  mov rcx, 2391
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend332:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend333
+  .p2align 4
+.Lbegin334:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator334:
+.Lend334:
+.Lend333:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_335_1
+  cmp rax, 4
+  je .Lswitch_case_335_4
+  cmp rax, 8
+  je .Lswitch_case_335_8
+  jmp .Lswitch_default_335
+.Lswitch_case_335_8:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend335
+.Lswitch_case_335_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend335
+.Lswitch_case_335_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend335
+.Lswitch_default_335:
+  mov rcx, 2412
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend335:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend336
+  .p2align 4
+.Lbegin337:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator337:
+.Lend337:
+.Lend336:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_338_1
+  cmp rax, 4
+  je .Lswitch_case_338_4
+  cmp rax, 8
+  je .Lswitch_case_338_8
+  jmp .Lswitch_default_338
+.Lswitch_case_338_8:
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 1
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend338
+.Lswitch_case_338_4:
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 1
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend338
+.Lswitch_case_338_1:
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rsi, 1
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend338
+.Lswitch_default_338:
+  mov rcx, 2431
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend338:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeDecrement
+.Lreturn_genCodeDecrement:
+  mov rbx, QWORD PTR -272[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeAdd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov QWORD PTR -288[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend339
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAdd
+.Lend339:
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isWorkLikePointer
+  test rax, rax
+  jne .Llogicalor340
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isWorkLikePointer
+  test rax, rax
+  je .Llogical_false340
+.Llogicalor340:
+  mov rax, 1
+  jmp .Llogical_end340
+.Llogical_false340:
+  mov rax, 0
+.Llogical_end340:
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse341_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend341
+.Lelse341_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend341
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend341
+.Lend341:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend342
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend342
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Lend342
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend342:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend345
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse346_0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend346
+.Lelse346_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_347_1
+  cmp rax, 4
+  je .Lswitch_case_347_4
+  cmp rax, 8
+  je .Lswitch_case_347_8
+  jmp .Lswitch_default_347
+.Lswitch_case_347_8:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend347
+.Lswitch_case_347_4:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend347
+.Lswitch_case_347_1:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend347
+.Lswitch_default_347:
+  mov rcx, 2479
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend347:
+  jmp .Lend346
+.Lend346:
+  .p2align 4
+.Lbegin348:
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -248[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -248[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -240[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator348:
+.Lend348:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAdd
+.Lend345:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse349_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isWorkLikePointer
+  test rax, rax
+  je .Lelse350_0
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 1
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  jmp .Lend350
+.Lelse350_0:
+  mov rdi, 1
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  jmp .Lend350
+.Lend350:
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Llogicalor354
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor354
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor354
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse351_0
+.Llogicalor354:
+  mov r8, 0
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, 0
+  mov rsi, 1
+  mov rdi, 3
+  mov rdx, rcx
+  mov rcx, rax
+  mov al, 0
+  call newOperandMemIndex
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend351
+.Lelse351_0:
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 10
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend351
+.Lend351:
+  .p2align 4
+.Lbegin355:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator355:
+.Lend355:
+  jmp .Lend349
+.Lelse349_0:
+  mov rdi, 1
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -192[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_356_1
+  cmp rax, 4
+  je .Lswitch_case_356_4
+  cmp rax, 8
+  je .Lswitch_case_356_8
+  jmp .Lswitch_default_356
+.Lswitch_case_356_8:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend356
+.Lswitch_case_356_4:
+  mov rax, 2
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend356
+.Lswitch_case_356_1:
+  mov rax, 0
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 8
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend356
+.Lswitch_default_356:
+  mov rcx, 2522
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend356:
+  .p2align 4
+.Lbegin357:
+  mov rdi, 0
+  lea rax, QWORD PTR -248[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -256[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -252[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -248[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator357:
+.Lend357:
+  jmp .Lend349
+.Lend349:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeAdd
+.Lreturn_genCodeAdd:
+  mov rbx, QWORD PTR -288[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeSub:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov QWORD PTR -288[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend358
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSub
+.Lend358:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend359
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_360
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  jmp .Lcond_end_360
+.Lcond_falsy_360:
+  mov rax, 1
+.Lcond_end_360:
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -252[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -252[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -252[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend361
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse362_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend362
+.Lelse362_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_363_1
+  cmp rax, 4
+  je .Lswitch_case_363_4
+  cmp rax, 8
+  je .Lswitch_case_363_8
+  jmp .Lswitch_default_363
+.Lswitch_case_363_8:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend363
+.Lswitch_case_363_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend363
+.Lswitch_case_363_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend363
+.Lswitch_default_363:
+  mov rcx, 2561
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend363:
+  jmp .Lend362
+.Lend362:
+  .p2align 4
+.Lbegin364:
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator364:
+.Lend364:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSub
+.Lend361:
+.Lend359:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 1
+  lea rax, QWORD PTR -160[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lelse365_0
+  lea rdi, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getAlternativeOfOneForType
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend366
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 3
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 10
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend366:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse367_0
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  test rax, rax
+  jl .Lelse367_0
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jle .Lend369
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call exactLog2
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 15
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+.Lend369:
+  jmp .Lend367
+.Lelse367_0:
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend367
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -244[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -244[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 24
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 21
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  jmp .Lend367
+.Lend367:
+  .p2align 4
+.Lbegin370:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator370:
+.Lend370:
+  jmp .Lend365
+.Lelse365_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_371_1
+  cmp rax, 4
+  je .Lswitch_case_371_4
+  cmp rax, 8
+  je .Lswitch_case_371_8
+  jmp .Lswitch_default_371
+.Lswitch_case_371_8:
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend371
+.Lswitch_case_371_4:
+  mov rax, 2
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend371
+.Lswitch_case_371_1:
+  mov rax, 0
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend371
+.Lswitch_default_371:
+  mov rcx, 2608
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend371:
+  .p2align 4
+.Lbegin372:
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator372:
+.Lend372:
+  jmp .Lend365
+.Lend365:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeSub
+.Lreturn_genCodeSub:
+  mov rbx, QWORD PTR -288[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeInitVarArray:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 928
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend373
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeInitVarArray
+.Lend373:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse374_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  jne .Lelse375_0
+  lea rdi, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend376
+  .p2align 4
+.Lbegin376:
+  lea rdi, QWORD PTR -320[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -456[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -592[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -888[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -320[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -888[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -320[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -904[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -912[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -456[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -912[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -904[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -456[rbp]
+  mov r8, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -592[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fillNodeInitVar
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -592[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeInitVarArray
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+.Literator376:
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin376
+.Lend376:
+  jmp .Lend375
+.Lelse375_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse375_1
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend377
+  mov rcx, 2647
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend377:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend378
+  .p2align 4
+.Lbegin378:
+  lea rdi, QWORD PTR -328[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -464[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -600[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -736[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -872[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -873[rbp]
+  mov BYTE PTR 0[rdi], 0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -873[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -873[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lend379
+  lea rdi, QWORD PTR -874[rbp]
+  mov BYTE PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -874[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  lea rax, QWORD PTR -874[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov r8, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rdi, rax
+  mov rsi, rcx
+  mov al, 0
+  call checkEscapeChar
+  test rax, rax
+  je .Lelse380_0
+  lea rax, QWORD PTR -874[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -873[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  jmp .Lend380
+.Lelse380_0:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend380
+.Lend380:
+.Lend379:
+  lea rax, QWORD PTR -873[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -888[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -328[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -888[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -888[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -464[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -888[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -464[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -904[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -912[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -600[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -912[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -904[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -920[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 16
+  lea rax, QWORD PTR -736[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -600[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -712[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -656[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 28
+  lea rax, QWORD PTR -872[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -736[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -856[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -328[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -848[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -656[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -792[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -784[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -872[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeAssign
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -884[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -880[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -884[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -904[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -912[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -912[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -896[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -912[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -904[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator378:
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -188[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin378
+.Lend378:
+  jmp .Lend375
+.Lelse375_1:
+  mov rcx, 2688
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend375
+.Lend375:
+  jmp .Lend374
+.Lelse374_0:
+  lea rdi, QWORD PTR -304[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -440[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  mov rdi, 16
+  lea rax, QWORD PTR -304[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov r8, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -440[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fillNodeInitVar
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -440[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeInitVar
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend374
+.Lend374:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeInitVarArray
+.Lreturn_genCodeInitVarArray:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeInitVarStruct:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 480
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend381
+  mov rcx, 2710
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend381:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse382_0
+  lea rdi, QWORD PTR -304[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rax, QWORD PTR -304[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  mov rdi, 29
+  lea rax, QWORD PTR -304[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -304[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -312[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -308[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -312[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -472[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -480[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -480[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -480[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -472[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  jmp .Lend382
+.Lelse382_0:
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond383
+  .p2align 4
+.Lbegin383:
+  lea rdi, QWORD PTR -320[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -456[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  mov rdi, 14
+  lea rax, QWORD PTR -320[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -320[rbp]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -456[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fillNodeInitVar
+  lea rax, QWORD PTR -456[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+.Literator383:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lcond383:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland384
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin383
+.Llogicaland384:
+.Lend383:
+  jmp .Lend382
+.Lend382:
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeInitVarStruct
+.Lreturn_genCodeInitVarStruct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeInitVarUnion:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 480
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend385
+  mov rcx, 2746
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend385:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse386_0
+  lea rdi, QWORD PTR -304[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rax, QWORD PTR -304[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  mov rdi, 30
+  lea rax, QWORD PTR -304[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -304[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -312[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -308[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -312[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -472[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -480[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -480[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -464[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -480[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -472[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  jmp .Lend386
+.Lelse386_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend386
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -320[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -456[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  mov rdi, 14
+  lea rax, QWORD PTR -320[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -320[rbp]
+  mov r8, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -456[rbp]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call fillNodeInitVar
+  lea rax, QWORD PTR -456[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend386
+.Lend386:
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeInitVarUnion
+.Lreturn_genCodeInitVarUnion:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeInitVar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 336
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse387_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeInitVarArray
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend387
+.Lelse387_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse387_1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeInitVarStruct
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend387
+.Lelse387_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse387_2
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeInitVarUnion
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend387
+.Lelse387_2:
+  lea rdi, QWORD PTR -296[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rax, QWORD PTR -296[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov rdx, QWORD PTR 128[rsi]
+  mov QWORD PTR 128[rdi], rdx
+  mov rdi, 28
+  lea rax, QWORD PTR -296[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -296[rbp]
+  mov rdi, rax
+  mov al, 0
+  call genCodeAssign
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -304[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -300[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -304[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -320[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -328[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -328[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -328[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -320[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  jmp .Lend387
+.Lend387:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeInitVar
+.Lreturn_genCodeInitVar:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+genCodeNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 320
+  mov QWORD PTR -320[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 112[rsi]
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 128[rsi]
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 136
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend388
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeNode
+.Lend388:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse389_0
+  jmp .Lend389
+.Lelse389_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 41
+  jne .Lelse389_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeInitVar
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 50
+  jne .Lelse389_2
+  mov rax, 3
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 9
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call genCodeClearBlock
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 49
+  jne .Lelse389_3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jl .Lend390
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeNode
+.Lend390:
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  je .Lswitch_case_391_1
+  cmp rax, 4
+  je .Lswitch_case_391_4
+  jmp .Lswitch_default_391
+.Lswitch_case_391_4:
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend391
+.Lswitch_case_391_1:
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend391
+.Lswitch_default_391:
+  mov rcx, 2836
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend391:
+  .p2align 4
+.Lbegin392:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator392:
+.Lend392:
+  jmp .Lend389
+.Lelse389_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 15
+  jne .Lelse389_4
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 16
+  jne .Lelse389_5
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeDeref
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 43
+  jne .Lelse389_6
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend393
+  .p2align 4
+.Lbegin393:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend394
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend394:
+.Literator393:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin393
+.Lend393:
+  jmp .Lend389
+.Lelse389_6:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 40
+  jne .Lelse389_7
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend395
+  .p2align 4
+.Lbegin396:
+  mov rdi, 1
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -204[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator396:
+.Lend396:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeNode
+.Lend395:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend397
+  .p2align 4
+.Lbegin397:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend398
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend398
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend398:
+.Literator397:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin397
+.Lend397:
+  jmp .Lend389
+.Lelse389_7:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  jne .Lelse389_8
+  mov rcx, 2867
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend389
+.Lelse389_8:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 17
+  jne .Lelse389_9
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 16
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 20
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin400:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator400:
+.Lend400:
+  jmp .Lend389
+.Lelse389_9:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  je .Llogicalor401
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  jne .Lelse389_10
+.Llogicalor401:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  .p2align 4
+.Lbegin402:
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -220[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator402:
+.Lend402:
+  jmp .Lend389
+.Lelse389_10:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 23
+  je .Llogicalor403
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 24
+  jne .Lelse389_11
+.Llogicalor403:
+  lea rdi, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 23
+  jne .Lcond_falsy_404
+  mov rax, 14
+  jmp .Lcond_end_404
+.Lcond_falsy_404:
+  mov rax, 15
+.Lcond_end_404:
+  mov rdi, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse405_0
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -268[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -268[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend405
+.Lelse405_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 4
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -180[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 0
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend405
+.Lend405:
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin406:
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator406:
+.Lend406:
+  jmp .Lend389
+.Lelse389_11:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lelse389_12
+  .p2align 4
+.Lbegin407:
+  mov rdi, 1
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -204[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator407:
+.Lend407:
+  jmp .Lend389
+.Lelse389_12:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse389_13
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov rdi, rax
+  mov al, 0
+  call format
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rax, 0
+  mov rsi, 17
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 32
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 18
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin408:
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -220[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator408:
+.Lend408:
+  jmp .Lend389
+.Lelse389_13:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lelse389_14
+  lea rax, QWORD PTR -12[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findRegisterArg
+  test rax, rax
+  je .Lelse389_14
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_410_1
+  cmp rax, 4
+  je .Lswitch_case_410_4
+  cmp rax, 8
+  je .Lswitch_case_410_8
+  jmp .Lswitch_default_410
+.Lswitch_case_410_8:
+  mov rsi, 3
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend410
+.Lswitch_case_410_4:
+  mov rsi, 2
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend410
+.Lswitch_case_410_1:
+  mov rsi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend410
+.Lswitch_default_410:
+  mov rcx, 2920
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend410:
+  .p2align 4
+.Lbegin411:
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -220[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator411:
+.Lend411:
+  jmp .Lend389
+.Lelse389_14:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  je .Llogicalor413
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 48
+  je .Llogicalor413
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 14
+  jne .Lelse389_15
+.Llogicalor413:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isRegisterStorableValue
+  test rax, rax
+  jne .Lend414
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeNode
+.Lend414:
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  cmp rax, 1
+  je .Lswitch_case_415_1
+  cmp rax, 4
+  je .Lswitch_case_415_4
+  cmp rax, 8
+  je .Lswitch_case_415_8
+  jmp .Lswitch_default_415
+.Lswitch_case_415_8:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend415
+.Lswitch_case_415_4:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 2
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 2
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend415
+.Lswitch_case_415_1:
+  mov rax, 0
+  mov rsi, 0
+  mov rdi, 0
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rbx, rax
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 19
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend415
+.Lswitch_default_415:
+  mov rcx, 2951
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend415:
+  .p2align 4
+.Lbegin416:
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator416:
+.Lend416:
+  jmp .Lend389
+.Lelse389_15:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 28
+  jne .Lelse389_16
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeAssign
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_16:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 29
+  je .Llogicalor417
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 30
+  jne .Lelse389_17
+.Llogicalor417:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeLVal
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 2
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov al, 0
+  call genCodeCopyBlock
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  .p2align 4
+.Lbegin418:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator418:
+.Lend418:
+  jmp .Lend389
+.Lelse389_17:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 44
+  jne .Lelse389_18
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  jmp .Lend389
+.Lelse389_18:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 45
+  jne .Lelse389_19
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  jmp .Lend389
+.Lelse389_19:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 46
+  jne .Lelse389_20
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeReturn
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_20:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 32
+  jne .Lelse389_21
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov r8, rax
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call genCodeCondJump
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend419
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend419:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstJmp
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend420
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Lend420:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstLabel
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isExprNode
+  test rax, rax
+  je .Lend421
+  .p2align 4
+.Lbegin422:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator422:
+.Lend422:
+.Lend421:
+  jmp .Lend389
+.Lelse389_21:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 33
+  jne .Lelse389_22
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeIf
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_22:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 36
+  jne .Lelse389_23
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeSwitch
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_23:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 37
+  jne .Lelse389_24
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeSwitchCase
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_24:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 38
+  jne .Lelse389_25
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeFor
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_25:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 39
+  jne .Lelse389_26
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeDoWhile
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_26:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 31
+  jne .Lelse389_27
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeFCall
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_27:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 51
+  jne .Lelse389_28
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeVaStart
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_28:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 47
+  jne .Lelse389_29
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeFunction
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_29:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogicalor423
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 12
+  jne .Lelse389_30
+.Llogicalor423:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeIncrement
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_30:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 11
+  je .Llogicalor424
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jne .Lelse389_31
+.Llogicalor424:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 11
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeDecrement
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_31:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lelse389_32
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeAdd
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_32:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lelse389_33
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeSub
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend389
+.Lelse389_33:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor556
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor556
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Llogicalor556
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Llogical_false556
+.Llogicalor556:
+  mov rax, 1
+  jmp .Llogical_end556
+.Llogical_false556:
+  mov rax, 0
+.Llogical_end556:
+  test rax, rax
+  je .Lelse389_34
+  lea rax, QWORD PTR -164[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeCompare
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -276[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -276[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 0
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 20
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  .p2align 4
+.Lbegin425:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator425:
+.Lend425:
+  jmp .Lend389
+.Lelse389_34:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor428
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 20
+  je .Llogicalor428
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  je .Llogicalor428
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 22
+  jne .Lelse389_35
+.Llogicalor428:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor429
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse389_35
+.Llogicalor429:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend431
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend431:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse432_0
+  mov rdi, 10
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend432
+.Lelse432_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 20
+  jne .Lelse432_1
+  mov rdi, 11
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend432
+.Lelse432_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Lelse432_2
+  mov rdi, 12
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend432
+.Lelse432_2:
+  mov rdi, 13
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend432
+.Lend432:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -188[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -184[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -188[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse433_0
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call genCodeMulImm
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  jmp .Lend433
+.Lelse433_0:
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -284[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -284[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend433
+.Lend433:
+  .p2align 4
+.Lbegin434:
+  mov rdi, 0
+  lea rax, QWORD PTR -248[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -256[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -252[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -256[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -248[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator434:
+.Lend434:
+  jmp .Lend389
+.Lelse389_35:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor435
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse389_36
+.Llogicalor435:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lelse389_36
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jle .Lelse389_36
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1073741824
+  jg .Lelse389_36
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call genCodeDivImm
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  .p2align 4
+.Lbegin439:
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -228[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -232[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -224[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator439:
+.Lend439:
+  jmp .Lend389
+.Lelse389_36:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInstList
+  mov rdi, 1
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse440_0
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 10
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend440
+.Lelse440_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jne .Lelse440_1
+  mov rdi, 24
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 21
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  jmp .Lend440
+.Lelse440_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse440_2
+  mov rdi, 24
+  mov al, 0
+  call newAsmInst
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 21
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call appendAsmInstUnOp
+  .p2align 4
+.Lbegin441:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 3
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator441:
+.Lend441:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeNode
+  jmp .Lend440
+.Lelse440_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 20
+  jne .Lelse440_3
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 11
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend440
+.Lelse440_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Lelse440_4
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 12
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend440
+.Lelse440_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 22
+  jne .Lelse440_5
+  mov rax, 3
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rbx, rax
+  mov rax, 3
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newOperandReg
+  mov rcx, rax
+  mov rsi, 13
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov rdx, rcx
+  mov rcx, rbx
+  mov al, 0
+  call appendAsmInstBinOp
+  jmp .Lend440
+.Lelse440_5:
+  mov rcx, 3076
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend440
+.Lend440:
+  .p2align 4
+.Lbegin442:
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -224[rbp]
+  mov rcx, rax
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -240[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -232[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  mov al, 0
+  call newAsmInst
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call appendAsmInst
+.Literator442:
+.Lend442:
+  jmp .Lend389
+.Lend389:
+  lea rax, QWORD PTR -160[rbp]
+  mov rdi, rax
+  mov al, 0
+  call takeAsmInstList
+  jmp .Lreturn_genCodeNode
+.Lreturn_genCodeNode:
+  mov rbx, QWORD PTR -320[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getOperandRegs:
+  mov r10, rdi
+  lea rdi, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse443_0
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rdi, 1
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend443
+.Lelse443_0:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend443
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend443
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rdi, 1
+  mov rax, r10
+  add rax, 8
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, r10
+  add rax, 8
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend445
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rdi, 1
+  mov rax, r10
+  add rax, 8
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend445:
+  jmp .Lend443
+.Lend443:
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_getOperandRegs
+.Lreturn_getOperandRegs:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getTouchedRegs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -16[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 31
+  ja .Lswitch_default_446
+  lea rdi, QWORD PTR .Lswitch_table_446[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_446:
+  .long .Lswitch_case_446_1 - .Lswitch_table_446
+  .long .Lswitch_case_446_2 - .Lswitch_table_446
+  .long .Lswitch_case_446_3 - .Lswitch_table_446
+  .long .Lswitch_case_446_4 - .Lswitch_table_446
+  .long .Lswitch_case_446_5 - .Lswitch_table_446
+  .long .Lswitch_case_446_6 - .Lswitch_table_446
+  .long .Lswitch_default_446 - .Lswitch_table_446
+  .long .Lswitch_case_446_8 - .Lswitch_table_446
+  .long .Lswitch_case_446_9 - .Lswitch_table_446
+  .long .Lswitch_case_446_a - .Lswitch_table_446
+  .long .Lswitch_case_446_b - .Lswitch_table_446
+  .long .Lswitch_case_446_c - .Lswitch_table_446
+  .long .Lswitch_case_446_d - .Lswitch_table_446
+  .long .Lswitch_case_446_e - .Lswitch_table_446
+  .long .Lswitch_case_446_f - .Lswitch_table_446
+  .long .Lswitch_case_446_10 - .Lswitch_table_446
+  .long .Lswitch_case_446_11 - .Lswitch_table_446
+  .long .Lswitch_case_446_12 - .Lswitch_table_446
+  .long .Lswitch_case_446_13 - .Lswitch_table_446
+  .long .Lswitch_case_446_14 - .Lswitch_table_446
+  .long .Lswitch_case_446_15 - .Lswitch_table_446
+  .long .Lswitch_default_446 - .Lswitch_table_446
+  .long .Lswitch_case_446_17 - .Lswitch_table_446
+  .long .Lswitch_case_446_18 - .Lswitch_table_446
+  .long .Lswitch_case_446_19 - .Lswitch_table_446
+  .long .Lswitch_case_446_1a - .Lswitch_table_446
+  .long .Lswitch_case_446_1b - .Lswitch_table_446
+  .long .Lswitch_case_446_1c - .Lswitch_table_446
+  .long .Lswitch_default_446 - .Lswitch_table_446
+  .long .Lswitch_case_446_1e - .Lswitch_table_446
+  .long .Lswitch_case_446_1f - .Lswitch_table_446
+  .long .Lswitch_case_446_20 - .Lswitch_table_446
+.previous
+.Lswitch_case_446_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp getOperandRegs
+.Lswitch_case_446_2:
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_case_446_3:
+.Lswitch_case_446_8:
+.Lswitch_case_446_9:
+.Lswitch_case_446_a:
+.Lswitch_case_446_b:
+.Lswitch_case_446_c:
+.Lswitch_case_446_d:
+.Lswitch_case_446_e:
+.Lswitch_case_446_f:
+.Lswitch_case_446_10:
+.Lswitch_case_446_11:
+.Lswitch_case_446_12:
+.Lswitch_case_446_13:
+.Lswitch_case_446_14:
+.Lswitch_case_446_19:
+.Lswitch_case_446_1a:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call getOperandRegs
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  mov al, 0
+  call getOperandRegs
+  mov rdi, rax
+  mov rax, rbx
+  or rax, rdi
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_case_446_15:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov al, 0
+  call getOperandRegs
+  or rax, 1
+  or rax, 8
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_case_446_18:
+  mov rax, 9
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_case_446_17:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp getOperandRegs
+.Lswitch_case_446_1b:
+.Lswitch_case_446_1c:
+  mov rax, 23
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_case_446_20:
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_case_446_4:
+.Lswitch_case_446_1e:
+.Lswitch_case_446_1f:
+.Lswitch_case_446_5:
+.Lswitch_case_446_6:
+  mov rax, 0
+  jmp .Lreturn_getTouchedRegs
+.Lswitch_default_446:
+  mov rax, -1
+  jmp .Lreturn_getTouchedRegs
+.Lend446:
+.Lreturn_getTouchedRegs:
+  mov rbx, QWORD PTR -16[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+closeLiveRange:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -16[rbp], rbx
+  mov QWORD PTR -24[rbp], r12
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend447
+  jmp .Lreturn_closeLiveRange
+.Lend447:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r12, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTouchedRegs
+  mov rdi, rax
+  mov rax, r12
+  or rax, rdi
+  mov rdi, rax
+  mov rax, rbx
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend448
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTouchedRegs
+  mov rdi, rax
+  mov rax, rbx
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend448:
+.Lreturn_closeLiveRange:
+  mov rbx, QWORD PTR -16[rbp]
+  mov r12, QWORD PTR -24[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+canHoldLiveRange:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  movsx rax, r11d
+  cmp rax, 8
+  jl .Lend449
+  mov rax, 1
+  jmp .Lreturn_canHoldLiveRange
+.Lend449:
+  mov rax, r10
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r8d
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov r9, rax
+  mov rdi, 1
+  lea rax, QWORD PTR allocatableRegs[rip]
+  mov rsi, rax
+  movsx rax, r11d
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r9
+  and rax, rdi
+  test rax, rax
+  sete al
+  movzx rax, al
+  jmp .Lreturn_canHoldLiveRange
+.Lreturn_canHoldLiveRange:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+allocateRegisters:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov QWORD PTR -288[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -140[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -140[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -144[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -144[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -148[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -148[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend450
+  .p2align 4
+.Lbegin450:
+  lea rax, QWORD PTR -140[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  mov rdi, 1
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 64
+  mov rsi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -140[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator450:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR dumpEnv[rip]
+  add rax, 88
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin450
+.Lend450:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend451
+  .p2align 4
+.Lbegin451:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lelse452_0
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -148[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, -1
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse453_0
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend453
+.Lelse453_0:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend453
+.Lend453:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend452
+.Lelse452_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lelse452_1
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend454
+  mov rcx, 3198
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend454:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -148[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call closeLiveRange
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend452
+.Lelse452_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lelse452_2
+  lea rdi, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 7
+  add rax, rdi
+  sar rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jle .Lend455
+  .p2align 4
+.Lbegin455:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend456
+  mov rcx, 3207
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend456:
+  mov rdi, 1
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call closeLiveRange
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator455:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jg .Lbegin455
+.Lend455:
+  jmp .Lend452
+.Lelse452_2:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend452
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTouchedRegs
+  mov rdi, rax
+  mov rax, rbx
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend452
+.Lend452:
+.Literator451:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -148[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin451
+.Lend451:
+  lea rdi, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jge .Lend457
+  .p2align 4
+.Lbegin457:
+  mov rdi, 0
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR -136[rbp+rax*8], rdi
+  mov rax, rdi
+.Literator457:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -152[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jl .Lbegin457
+.Lend457:
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend458
+  .p2align 4
+.Lbegin458:
+  lea rdi, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, -1
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor460
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend459
+.Llogicalor460:
+  jmp .Literator458
+.Lend459:
+  lea rdi, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jge .Lend461
+  .p2align 4
+.Lbegin461:
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  test rax, rax
+  je .Lend462
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend462
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR -136[rbp+rax*8], rdi
+  mov rax, rdi
+.Lend462:
+.Literator461:
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jl .Lbegin461
+.Lend461:
+  lea rdi, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jge .Lend464
+  .p2align 4
+.Lbegin464:
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  test rax, rax
+  jne .Lend465
+  lea rax, QWORD PTR -140[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call canHoldLiveRange
+  test rax, rax
+  je .Lend465
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend464
+.Lend465:
+.Literator464:
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jl .Lbegin464
+.Lend464:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend467
+  lea rdi, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jge .Lend468
+  .p2align 4
+.Lbegin468:
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  test rax, rax
+  je .Lend469
+  lea rax, QWORD PTR -140[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call canHoldLiveRange
+  test rax, rax
+  je .Lend469
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jl .Llogicalor471
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend469
+.Llogicalor471:
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -164[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend469:
+.Literator468:
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 13
+  jl .Lbegin468
+.Lend468:
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend473
+  jmp .Literator458
+.Lend473:
+  mov rdi, -1
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rax, QWORD PTR -136[rbp+rax*8]
+  add rax, 48
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend467:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR -136[rbp+rax*8], rdi
+  mov rax, rdi
+.Literator458:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin458
+.Lend458:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend474
+  .p2align 4
+.Lbegin474:
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jl .Lend475
+  lea rdi, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -280[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR allocatableRegs[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -276[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -280[rbp]
+  mov rsi, rax
+  mov rax, rcx
+  mov rdi, rax
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rdi, 0
+  lea rax, QWORD PTR -272[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -264[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  lea rax, QWORD PTR -216[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  mov rdi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  lea rax, QWORD PTR -264[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -208[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rdi, 3
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  lea rax, QWORD PTR -144[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  mov rdi, 1
+  lea rax, QWORD PTR allocatableRegs[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend475:
+  .p2align 4
+.Lbegin476:
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend477
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend477:
+.Literator476:
+.Lend476:
+.Literator474:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin474
+.Lend474:
+  lea rax, QWORD PTR -144[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_allocateRegisters
+.Lreturn_allocateRegisters:
+  mov rbx, QWORD PTR -288[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+alignStackForCalls:
+  mov r10, rdi
+  lea rdi, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, r10
+  test rax, rax
+  je .Lend478
+  .p2align 4
+.Lbegin478:
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 5
+  ja .Lswitch_default_479
+  lea rdi, QWORD PTR .Lswitch_table_479[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_479:
+  .long .Lswitch_case_479_1 - .Lswitch_table_479
+  .long .Lswitch_case_479_2 - .Lswitch_table_479
+  .long .Lswitch_default_479 - .Lswitch_table_479
+  .long .Lswitch_default_479 - .Lswitch_table_479
+  .long .Lswitch_case_479_5 - .Lswitch_table_479
+  .long .Lswitch_case_479_6 - .Lswitch_table_479
+.previous
+.Lswitch_case_479_1:
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend479
+.Lswitch_case_479_2:
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend479
+.Lswitch_case_479_5:
+  mov rdi, 0
+  mov rax, r10
+  add rax, 24
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rax, r10
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 15
+  add rdi, rax
+  and rdi, -16
+  sub rax, rdi
+  test rax, rax
+  je .Lend480
+  mov rdi, 8
+  mov rax, r10
+  add rax, 24
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend480:
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rax, r10
+  add rax, 24
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend479
+.Lswitch_case_479_6:
+  lea rax, QWORD PTR -20[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rax, r10
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, r10
+  add rax, 24
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rsp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend479
+.Lswitch_default_479:
+  jmp .Lend479
+.Lend479:
+.Literator478:
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, r10
+  test rax, rax
+  jne .Lbegin478
+.Lend478:
+.Lreturn_alignStackForCalls:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl genAsm
+genAsm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call genCodeNode
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp releaseAsmInstList
+.Lreturn_genAsm:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isOperandUsingReg:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse481_0
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  jmp .Lreturn_isOperandUsingReg
+  jmp .Lend481
+.Lelse481_0:
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend481
+  mov rax, r10
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false484
+  mov rax, r10
+  add rax, 8
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Llogicalor483
+  mov rax, r10
+  add rax, 8
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false484
+  mov rax, r10
+  add rax, 8
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false484
+.Llogicalor483:
+  mov rax, 1
+  jmp .Llogical_end484
+.Llogical_false484:
+  mov rax, 0
+.Llogical_end484:
+  jmp .Lreturn_isOperandUsingReg
+  jmp .Lend481
+.Lend481:
+  mov rax, 0
+  jmp .Lreturn_isOperandUsingReg
+.Lreturn_isOperandUsingReg:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isOperandReg64:
+  mov r10, rdi
+  mov rax, r10
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false485
+  mov rax, r10
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false485
+  mov rax, 1
+  jmp .Llogical_end485
+.Llogical_false485:
+  mov rax, 0
+.Llogical_end485:
+  jmp .Lreturn_isOperandReg64
+.Lreturn_isOperandReg64:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+unlinkAsmInst:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+.Lreturn_unlinkAsmInst:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeFoldPushPop:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  movsx rax, al
+  lea rax, QWORD PTR -80[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  mov rdi, 0
+  lea rax, QWORD PTR -136[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -128[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rsi, rax
+  mov rax, rdi
+  mov rdx, QWORD PTR 0[rsi]
+  mov QWORD PTR 0[rdi], rdx
+  mov rdi, 3
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 64[rsi]
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 80[rsi]
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 96[rsi]
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeFoldPushPop
+.Lreturn_peepholeFoldPushPop:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeRemoveSelfMov:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor487
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false558
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false558
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false559
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false559
+  mov rax, 1
+  jmp .Llogical_end559
+.Llogical_false559:
+  mov rax, 0
+.Llogical_end559:
+  test rax, rax
+  je .Llogical_false558
+  mov rax, 1
+  jmp .Llogical_end558
+.Llogical_false558:
+  mov rax, 0
+.Llogical_end558:
+  test rax, rax
+  jne .Lend486
+.Llogicalor487:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveSelfMov
+.Lend486:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend488
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveSelfMov
+.Lend488:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeRemoveSelfMov
+.Lreturn_peepholeRemoveSelfMov:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeRemoveDeadMov:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor491
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false560
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false560
+  mov rax, 1
+  jmp .Llogical_end560
+.Llogical_false560:
+  mov rax, 0
+.Llogical_end560:
+  test rax, rax
+  je .Llogicalor491
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false561
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false561
+  mov rax, 1
+  jmp .Llogical_end561
+.Llogical_false561:
+  mov rax, 0
+.Llogical_end561:
+  test rax, rax
+  jne .Lend489
+.Llogicalor491:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveDeadMov
+.Lend489:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogicalor493
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  mov al, 0
+  call isOperandUsingReg
+  test rax, rax
+  je .Lend492
+.Llogicalor493:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveDeadMov
+.Lend492:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeRemoveDeadMov
+.Lreturn_peepholeRemoveDeadMov:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeRemoveMovBack:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  movsx rax, al
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false562
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false562
+  mov rax, 1
+  jmp .Llogical_end562
+.Llogical_false562:
+  mov rax, 0
+.Llogical_end562:
+  test rax, rax
+  je .Llogicalor495
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false563
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false563
+  mov rax, 1
+  jmp .Llogical_end563
+.Llogical_false563:
+  mov rax, 0
+.Llogical_end563:
+  test rax, rax
+  jne .Lend494
+.Llogicalor495:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveMovBack
+.Lend494:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false565
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false565
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false566
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false566
+  mov rax, 1
+  jmp .Llogical_end566
+.Llogical_false566:
+  mov rax, 0
+.Llogical_end566:
+  test rax, rax
+  je .Llogical_false565
+  mov rax, 1
+  jmp .Llogical_end565
+.Llogical_false565:
+  mov rax, 0
+.Llogical_end565:
+  test rax, rax
+  je .Llogicalor497
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false568
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false568
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false569
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false569
+  mov rax, 1
+  jmp .Llogical_end569
+.Llogical_false569:
+  mov rax, 0
+.Llogical_end569:
+  test rax, rax
+  je .Llogical_false568
+  mov rax, 1
+  jmp .Llogical_end568
+.Llogical_false568:
+  mov rax, 0
+.Llogical_end568:
+  test rax, rax
+  jne .Lend496
+.Llogicalor497:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveMovBack
+.Lend496:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeRemoveMovBack
+.Lreturn_peepholeRemoveMovBack:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeFoldFrameAddress:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  movsx rax, al
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false570
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false570
+  mov rax, 1
+  jmp .Llogical_end570
+.Llogical_false570:
+  mov rax, 0
+.Llogical_end570:
+  test rax, rax
+  je .Llogicalor500
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false571
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false571
+  mov rax, 1
+  jmp .Llogical_end571
+.Llogical_false571:
+  mov rax, 0
+.Llogical_end571:
+  test rax, rax
+  je .Llogicalor500
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Lend498
+.Llogicalor500:
+  mov rax, 0
+  jmp .Lreturn_peepholeFoldFrameAddress
+.Lend498:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false573
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false573
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false574
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false574
+  mov rax, 1
+  jmp .Llogical_end574
+.Llogical_false574:
+  mov rax, 0
+.Llogical_end574:
+  test rax, rax
+  je .Llogical_false573
+  mov rax, 1
+  jmp .Llogical_end573
+.Llogical_false573:
+  mov rax, 0
+.Llogical_end573:
+  test rax, rax
+  je .Llogicalor503
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Llogicalor503
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend501
+.Llogicalor503:
+  mov rax, 0
+  jmp .Lreturn_peepholeFoldFrameAddress
+.Lend501:
+  mov rsi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rsi, 5
+  mov rdi, 3
+  mov rdx, rax
+  mov al, 0
+  call newOperandMem
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 18
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  .p2align 4
+.Lbegin504:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend505
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend505:
+.Literator504:
+.Lend504:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeFoldFrameAddress
+.Lreturn_peepholeFoldFrameAddress:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeFoldLeaAdd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  movsx rax, al
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false575
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false575
+  mov rax, 1
+  jmp .Llogical_end575
+.Llogical_false575:
+  mov rax, 0
+.Llogical_end575:
+  test rax, rax
+  je .Llogicalor507
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend506
+.Llogicalor507:
+  mov rax, 0
+  jmp .Lreturn_peepholeFoldLeaAdd
+.Lend506:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false577
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false577
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false578
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false578
+  mov rax, 1
+  jmp .Llogical_end578
+.Llogical_false578:
+  mov rax, 0
+.Llogical_end578:
+  test rax, rax
+  je .Llogical_false577
+  mov rax, 1
+  jmp .Llogical_end577
+.Llogical_false577:
+  mov rax, 0
+.Llogical_end577:
+  test rax, rax
+  je .Llogicalor510
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Llogicalor510
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend508
+.Llogicalor510:
+  mov rax, 0
+  jmp .Lreturn_peepholeFoldLeaAdd
+.Lend508:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 32
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 32
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeFoldLeaAdd
+.Lreturn_peepholeFoldLeaAdd:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeRemoveAddZero:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor515
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor515
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Llogicalor515
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor515
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend511
+.Llogicalor515:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveAddZero
+.Lend511:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend516
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveAddZero
+.Lend516:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeRemoveAddZero
+.Lreturn_peepholeRemoveAddZero:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeRemoveSelfLea:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor522
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false579
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Llogical_false579
+  mov rax, 1
+  jmp .Llogical_end579
+.Llogical_false579:
+  mov rax, 0
+.Llogical_end579:
+  test rax, rax
+  je .Llogicalor522
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor522
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 32
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor522
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor522
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend517
+.Llogicalor522:
+  mov rax, 0
+  jmp .Lreturn_peepholeRemoveSelfLea
+.Lend517:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call freeAsmInst
+  mov rax, 1
+  jmp .Lreturn_peepholeRemoveSelfLea
+.Lreturn_peepholeRemoveSelfLea:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+peepholeCmpZeroToTest:
+  mov r10, rdi
+  mov r11, rsi
+  lea rdi, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, r11
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r10
+  movsx rax, al
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor526
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Llogicalor526
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor526
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  add rax, 8
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend523
+.Llogicalor526:
+  mov rax, 0
+  jmp .Lreturn_peepholeCmpZeroToTest
+.Lend523:
+  mov rdi, 17
+  mov rax, r11
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdx, QWORD PTR 48[rsi]
+  mov QWORD PTR 48[rdi], rdx
+  mov rax, 1
+  jmp .Lreturn_peepholeCmpZeroToTest
+.Lreturn_peepholeCmpZeroToTest:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl optimizeAsm
+optimizeAsm:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -152[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  movdqu XMMWORD PTR 128[rdi], xmm0
+  mov rdi, 1
+  lea rax, QWORD PTR -152[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -148[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeFoldPushPop@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -136[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 33
+  lea rax, QWORD PTR -132[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeRemoveSelfMov@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -120[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -116[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeRemoveDeadMov@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -104[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeRemoveMovBack@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 9
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeFoldFrameAddress@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 18
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeFoldLeaAdd@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 33
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeRemoveAddZero@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 18
+  lea rax, QWORD PTR -40[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 33
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeRemoveSelfLea@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 16
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 33
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, QWORD PTR peepholeCmpZeroToTest@GOTPCREL[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 9
+  lea rax, QWORD PTR -156[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend527
+  .p2align 4
+.Lbegin527:
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator527:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin527
+.Lend527:
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  sal rax, 3
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend528
+  .p2align 4
+.Lbegin528:
+  lea rdi, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_529
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  jmp .Lcond_end_529
+.Lcond_falsy_529:
+  mov rax, 0
+.Lcond_end_529:
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -196[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond530
+  .p2align 4
+.Lbegin530:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 16
+  imul rax, rsi
+  add rax, rdi
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend532
+  jmp .Literator530
+.Lend532:
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 16
+  imul rax, rsi
+  add rax, rdi
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 33
+  je .Lend533
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland534
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 16
+  imul rax, rsi
+  add rax, rdi
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend533
+.Llogicaland534:
+  jmp .Literator530
+.Lend533:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, 16
+  imul rax, rsi
+  add rax, rdi
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov r10, rax
+  mov rdi, r8
+  mov rsi, rcx
+  mov al, 0
+  call r10
+  mov rdi, rax
+  lea rax, QWORD PTR -180[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator530:
+  lea rax, QWORD PTR -196[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lcond530:
+  lea rax, QWORD PTR -196[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -156[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Llogicaland531
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lbegin530
+.Llogicaland531:
+.Lend530:
+  lea rax, QWORD PTR -180[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse536_0
+  lea rax, QWORD PTR -176[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend537
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rcx
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend537:
+  jmp .Lend536
+.Lelse536_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend536
+.Lend536:
+.Literator528:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin528
+.Lend528:
+  .p2align 4
+.Lbegin538:
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend539
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend539:
+.Literator538:
+.Lend538:
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_optimizeAsm
+.Lreturn_optimizeAsm:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "Internal error: Given asm list already has next element."
+.LiteralString2:
+  .string  "Internal error: Given asm list already has next element."
+.LiteralString3:
+  .string  "  # %s:%d"
+.LiteralString4:
+  .string  "  .zero %d"
+.LiteralString5:
+  .string  "  .quad %d"
+.LiteralString6:
+  .string  "  .long %d"
+.LiteralString7:
+  .string  "  .byte %d"
+.LiteralString8:
+  .string  "  .string \"%s\""
+.LiteralString9:
+  .string  "  .quad .LiteralString%d"
+.LiteralString10:
+  .string  "  .quad %.*s"
+.LiteralString11:
+  .string  "  .quad %.*s"
+.LiteralString12:
+  .string  "  .quad .StaticVar%d"
+.LiteralString13:
+  .string  "  .quad %d"
+.LiteralString14:
+  .string  "\n.data"
+.LiteralString15:
+  .string  ".LiteralString%d:"
+.LiteralString16:
+  .string  "  .string  \"%s\""
+.LiteralString17:
+  .string  ".globl %.*s"
+.LiteralString18:
+  .string  "%.*s:"
+.LiteralString19:
+  .string  ".StaticVar%d:"
+.LiteralString20:
+  .string  "Not a lvalue"
+.LiteralString21:
+  .string  "Not a lvalue"
+.LiteralString22:
+  .string  "Not a lvalue"
+.LiteralString23:
+  .string  "%.*s"
+.LiteralString24:
+  .string  "%.*s@GOTPCREL"
+.LiteralString25:
+  .string  ".StaticVar%d"
+.LiteralString26:
+  .string  "Expression doesn't leave value."
+.LiteralString27:
+  .string  ".Lreturn_%.*s"
+.LiteralString28:
+  .string  "%s"
+.LiteralString29:
+  .string  "%s"
+.LiteralString30:
+  .string  "%s"
+.LiteralString31:
+  .string  ".Llogicaland%d"
+.LiteralString32:
+  .string  ".Llogicalor%d"
+.LiteralString33:
+  .string  "%s"
+.LiteralString34:
+  .string  "%s"
+.LiteralString35:
+  .string  "Expression doesn't leave value."
+.LiteralString36:
+  .string  "%s"
+.LiteralString37:
+  .string  ".Lelse%d_%d"
+.LiteralString38:
+  .string  ".Lend%d"
+.LiteralString39:
+  .string  ".Lend%d"
+.LiteralString40:
+  .string  ".Lelse%d_%d"
+.LiteralString41:
+  .string  ".Lelse%d_%d"
+.LiteralString42:
+  .string  ".Lend%d"
+.LiteralString43:
+  .string  ".Lend%d"
+.LiteralString44:
+  .string  ".Lend%d"
+.LiteralString45:
+  .string  "%s"
+.LiteralString46:
+  .string  ".Lswitch_table_%d"
+.LiteralString47:
+  .string  ".section .rodata"
+.LiteralString48:
+  .string  "  .align 4"
+.LiteralString49:
+  .string  ".Lswitch_table_%d"
+.LiteralString50:
+  .string  "  .long .Lswitch_case_%d_%x - .Lswitch_table_%d"
+.LiteralString51:
+  .string  "  .long %s - .Lswitch_table_%d"
+.LiteralString52:
+  .string  ".previous"
+.LiteralString53:
+  .string  ".Lswitch_case_%d_%x"
+.LiteralString54:
+  .string  "%s"
+.LiteralString55:
+  .string  ".Lswitch_case_%d_%x"
+.LiteralString56:
+  .string  ".Lswitch_upper_%d_%d"
+.LiteralString57:
+  .string  ".Lswitch_upper_%d_%d"
+.LiteralString58:
+  .string  ".Lswitch_default_%d"
+.LiteralString59:
+  .string  ".Lend%d"
+.LiteralString60:
+  .string  "%s"
+.LiteralString61:
+  .string  ".Lend%d"
+.LiteralString62:
+  .string  ".Lswitch_case_%d_%x"
+.LiteralString63:
+  .string  ".Lswitch_default_%d"
+.LiteralString64:
+  .string  ".Lcond%d"
+.LiteralString65:
+  .string  ".Lend%d"
+.LiteralString66:
+  .string  "  .p2align 4"
+.LiteralString67:
+  .string  ".Lbegin%d"
+.LiteralString68:
+  .string  ".Literator%d"
+.LiteralString69:
+  .string  ".Lcond%d"
+.LiteralString70:
+  .string  ".Lbegin%d"
+.LiteralString71:
+  .string  ".Lbegin%d"
+.LiteralString72:
+  .string  ".Lend%d"
+.LiteralString73:
+  .string  "  .p2align 4"
+.LiteralString74:
+  .string  ".Lbegin%d"
+.LiteralString75:
+  .string  ".Literator%d"
+.LiteralString76:
+  .string  ".Lbegin%d"
+.LiteralString77:
+  .string  ".Lend%d"
+.LiteralString78:
+  .string  "%.*s"
+.LiteralString79:
+  .string  "%.*s"
+.LiteralString80:
+  .string  "0x%04x%04x"
+.LiteralString81:
+  .string  ".section .text.startup,\"ax\",@progbits"
+.LiteralString82:
+  .string  ".globl %.*s"
+.LiteralString83:
+  .string  "%.*s"
+.LiteralString84:
+  .string  "main"
+.LiteralString85:
+  .string  ".Lreturn_%.*s"
+.LiteralString86:
+  .string  ".section .note.GNU-stack,\"\",@progbits"
+.LiteralString87:
+  .string  ".Llogical_false%d"
+.LiteralString88:
+  .string  ".Llogical_end%d"
+.LiteralString89:
+  .string  ".Llogical_false%d"
+.LiteralString90:
+  .string  ".Llogical_end%d"
+.LiteralString91:
+  .string  ".LiteralString%d"
+.LiteralString92:
+  .string  ".Lend%d"
+.LiteralString93:
+  .string  ".Literator%d"
+.LiteralString94:
+  .string  ".Lcond_falsy_%d"
+.LiteralString95:
+  .string  ".Lcond_end_%d"
+.LiteralString96:
+  .string  ".Lcond_falsy_%d"
+.LiteralString97:
+  .string  ".Lcond_end_%d"
+.LiteralString98:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString99:
+  .string  "%d:%d: Internal error: assert: %s"
+.LiteralString100:
+  .string  "asm.c"
+.LiteralString101:
+  .string  "asm.c"
+.LiteralString102:
+  .string  "asm.c"
+.LiteralString103:
+  .string  "asm.c"
+.LiteralString104:
+  .string  "asm.c"
+.LiteralString105:
+  .string  "asm.c"
+.LiteralString106:
+  .string  "asm.c"
+.LiteralString107:
+  .string  "asm.c"
+.LiteralString108:
+  .string  "asm.c"
+.LiteralString109:
+  .string  "asm.c"
+.LiteralString110:
+  .string  "asm.c"
+.LiteralString111:
+  .string  "asm.c"
+.LiteralString112:
+  .string  "asm.c"
+.LiteralString113:
+  .string  "asm.c"
+.LiteralString114:
+  .string  "asm.c"
+.LiteralString115:
+  .string  "asm.c"
+.LiteralString116:
+  .string  "asm.c"
+.LiteralString117:
+  .string  "asm.c"
+.LiteralString118:
+  .string  "asm.c"
+.LiteralString119:
+  .string  "asm.c"
+.LiteralString120:
+  .string  "asm.c"
+.LiteralString121:
+  .string  "asm.c"
+.LiteralString122:
+  .string  "asm.c"
+.LiteralString123:
+  .string  "asm.c"
+.LiteralString124:
+  .string  "asm.c"
+.LiteralString125:
+  .string  "asm.c"
+.LiteralString126:
+  .string  "asm.c"
+.LiteralString127:
+  .string  "asm.c"
+.LiteralString128:
+  .string  "asm.c"
+.LiteralString129:
+  .string  "asm.c"
+.LiteralString130:
+  .string  "asm.c"
+.LiteralString131:
+  .string  "asm.c"
+.LiteralString132:
+  .string  "asm.c"
+.LiteralString133:
+  .string  "asm.c"
+allocatableRegs:
+  .long 0
+  .long 1
+  .long 2
+  .long 4
+  .long 8
+  .long 9
+  .long 10
+  .long 11
+  .long 7
+  .long 12
+  .long 13
+  .long 14
+  .long 15
+calleeSavedRegs:
+  .long 7
+  .long 12
+  .long 13
+  .long 14
+  .long 15
+argRegs:
+  .long 1
+  .long 2
+  .long 3
+  .long 4
+  .long 8
+  .long 9
+dumpEnv:
+  .zero 96
+.StaticVar1:
+  .zero 144
+.StaticVar0:
+  .zero 136
@@ -0,0 +1,19246 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+errorIdentExpected:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lreturn_errorIdentExpected:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+errorTypeExpected:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lreturn_errorTypeExpected:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+errorUnexpectedEOF:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lreturn_errorUnexpectedEOF:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl matchToken
+matchToken:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov DWORD PTR -20[rbp], edx
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogical_false0
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcmp
+  test rax, rax
+  jne .Llogical_false0
+  mov rax, 1
+  jmp .Llogical_end0
+.Llogical_false0:
+  mov rax, 0
+.Llogical_end0:
+  jmp .Lreturn_matchToken
+.Lreturn_matchToken:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+matchReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  .p2align 4
+.Lbegin1:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend2
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend2:
+.Literator1:
+.Lend1:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Lend3
+  mov rax, 1
+  jmp .Lreturn_matchReserved
+.Lend3:
+  mov rax, 0
+  jmp .Lreturn_matchReserved
+.Lreturn_matchReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+matchCertainTokenType:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  .p2align 4
+.Lbegin5:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend6
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend6:
+.Literator5:
+.Lend5:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend7
+  mov rax, 1
+  jmp .Lreturn_matchCertainTokenType
+.Lend7:
+  mov rax, 0
+  jmp .Lreturn_matchCertainTokenType
+.Lreturn_matchCertainTokenType:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lend8
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 1
+  jmp .Lreturn_consumeReserved
+.Lend8:
+  mov rax, 0
+  jmp .Lreturn_consumeReserved
+.Lreturn_consumeReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeTypeName:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  .p2align 4
+.Lbegin9:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend10
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend10:
+.Literator9:
+.Lend9:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend11
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_consumeTypeName
+.Lend11:
+  mov rax, 0
+  jmp .Lreturn_consumeTypeName
+.Lreturn_consumeTypeName:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeIdent:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  .p2align 4
+.Lbegin12:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend13
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend13:
+.Literator12:
+.Lend12:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend14
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_consumeIdent
+.Lend14:
+  mov rax, 0
+  jmp .Lreturn_consumeIdent
+.Lreturn_consumeIdent:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeLiteralString:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  .p2align 4
+.Lbegin15:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend16
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend16:
+.Literator15:
+.Lend15:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Lend17
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_consumeLiteralString
+.Lend17:
+  mov rax, 0
+  jmp .Lreturn_consumeLiteralString
+.Lreturn_consumeLiteralString:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeNumber:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  .p2align 4
+.Lbegin18:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend19
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend19:
+.Literator18:
+.Lend18:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lend20
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 1
+  jmp .Lreturn_consumeNumber
+.Lend20:
+  mov rax, 0
+  jmp .Lreturn_consumeNumber
+.Lreturn_consumeNumber:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeCertainTokenType:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  .p2align 4
+.Lbegin21:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend22
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend22:
+.Literator21:
+.Lend21:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend23
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 1
+  jmp .Lreturn_consumeCertainTokenType
+.Lend23:
+  mov rax, 0
+  jmp .Lreturn_consumeCertainTokenType
+.Lreturn_consumeCertainTokenType:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+expectReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lend24
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lreturn_expectReserved
+.Lend24:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call errorAt
+.Lreturn_expectReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+expectNumber:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  .p2align 4
+.Lbegin25:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend26
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend26:
+.Literator25:
+.Lend25:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lend27
+  lea rdi, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_expectNumber
+.Lend27:
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lreturn_expectNumber:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+expectIdent:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend28
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_expectIdent
+.Lend28:
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lreturn_expectIdent:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+assureReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lend29
+  jmp .Lreturn_assureReserved
+.Lend29:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call errorAt
+.Lreturn_assureReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+atEOF:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  jmp .Lreturn_atEOF
+.Lreturn_atEOF:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+buildTagNameForAnonymousObject:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcccccccd
+  imul rdi, rax
+  sar rdi, 35
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend30
+  .p2align 4
+.Lbegin30:
+  lea rax, QWORD PTR -20[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator30:
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  movsx rax, eax
+  mov edi, 0xcccccccd
+  imul rdi, rax
+  sar rdi, 35
+  mov rdx, rax
+  sar rdx, 63
+  sub rdi, rdx
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lbegin30
+.Lend30:
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call sprintf
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildTagNameForAnonymousObject
+.Lreturn_buildTagNameForAnonymousObject:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+hashSymbol:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r11
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sal rax, 5
+  sub rax, rdi
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  and rax, 4095
+  jmp .Lreturn_hashSymbol
+.Lreturn_hashSymbol:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+registerSymbol:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  mov QWORD PTR -20[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sal rax, 5
+  sub rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  and rax, 4095
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR symbolTable[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR symbolTable[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_registerSymbol:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findSymbol:
+  mov r10, rdi
+  mov r11, rsi
+  lea rdi, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR symbolTable[rip]
+  mov rsi, rax
+  mov rax, r11
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  movsx rax, r10d
+  mov rdi, rax
+  lea rax, QWORD PTR -44[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sal rax, 5
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -44[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  and rax, 4095
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend31
+  .p2align 4
+.Lbegin31:
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, r11
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend32
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r10d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend32
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_findSymbol
+.Lend32:
+.Literator31:
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin31
+.Lend31:
+  mov rax, 0
+  jmp .Lreturn_findSymbol
+.Lreturn_findSymbol:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+enterNewEnv:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_enterNewEnv:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+exitCurrentEnv:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend34
+  mov rcx, 257
+  lea rax, QWORD PTR .LiteralString216[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend34:
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend35
+  .p2align 4
+.Lbegin35:
+  lea rax, QWORD PTR symbolTable[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend36
+  mov rcx, 260
+  lea rax, QWORD PTR .LiteralString217[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend36:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR symbolTable[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  mov rax, rdi
+.Literator35:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin35
+.Lend35:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_exitCurrentEnv:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newObj:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov DWORD PTR -20[rbp], edx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newObj
+.Lreturn_newObj:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newObjFunction:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rcx, 0
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newObj
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newObjFunction
+.Lreturn_newObjFunction:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newGVar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newGVar
+.Lreturn_newGVar:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newStruct:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, -1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newStruct
+.Lreturn_newStruct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newTypedef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newTypedef
+.Lreturn_newTypedef:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNode
+.Lreturn_newNode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeBinary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  mov QWORD PTR -20[rbp], rdx
+  mov QWORD PTR -28[rbp], rcx
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeBinary
+.Lreturn_newNodeBinary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeNum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeNum
+.Lreturn_newNodeNum:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeLVar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 27
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeLVar
+.Lreturn_newNodeLVar:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeFor:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 38
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeFor
+.Lreturn_newNodeFor:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeFCall:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 31
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeFCall
+.Lreturn_newNodeFCall:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeFunction:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 47
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 0
+  mov rsi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newObj
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeFunction
+.Lreturn_newNodeFunction:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl findGlobalVar
+findGlobalVar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 7
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findGlobalVar:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl findLVar
+findLVar:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findLVar:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl findFunction
+findFunction:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 6
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findFunction:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findStruct:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findStruct:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findUnion:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 2
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findUnion:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl findStructOrUnionMember
+findStructOrUnionMember:
+  mov r10, rdi
+  mov r11, rsi
+  lea rdi, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, r10
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend37
+  .p2align 4
+.Lbegin37:
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, r11
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend38
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_findStructOrUnionMember
+.Lend38:
+.Literator37:
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin37
+.Lend37:
+  mov rax, 0
+  jmp .Lreturn_findStructOrUnionMember
+.Lreturn_findStructOrUnionMember:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findEnum:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findEnum:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findEnumItem:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 4
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findEnumItem:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findTypedef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 5
+  mov rsi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp findSymbol
+.Lreturn_findTypedef:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newTypeInfo:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newTypeInfo
+.Lreturn_newTypeInfo:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+cloneTypeInfo:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_cloneTypeInfo
+.Lreturn_cloneTypeInfo:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newGVarInit:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  mov DWORD PTR -16[rbp], edx
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newGVarInit
+.Lreturn_newGVarInit:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseBaseType:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend39
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin40:
+  mov rdi, 4
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse41_0
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend41
+.Lelse41_0:
+  mov rdi, 5
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse41_1
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend41
+.Lelse41_1:
+  mov rdi, 6
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse41_2
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend41
+.Lelse41_2:
+  mov rdi, 7
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse41_3
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend41
+.Lelse41_3:
+  jmp .Lend40
+  jmp .Lend41
+.Lend41:
+.Literator40:
+  jmp .Lbegin40
+.Lend40:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  cmp rax, 2
+  jl .Lend42
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend42:
+.Lend39:
+  mov al, 0
+  call consumeTypeName
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse43_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseBaseType
+  jmp .Lend43
+.Lelse43_0:
+  mov rdi, 22
+  mov al, 0
+  call matchCertainTokenType
+  test rax, rax
+  je .Lelse43_1
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rsi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call structOrUnionDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseBaseType
+  jmp .Lend43
+.Lelse43_1:
+  mov rdi, 23
+  mov al, 0
+  call matchCertainTokenType
+  test rax, rax
+  je .Lelse43_2
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rsi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call structOrUnionDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseBaseType
+  jmp .Lend43
+.Lelse43_2:
+  mov rdi, 24
+  mov al, 0
+  call matchCertainTokenType
+  test rax, rax
+  je .Lelse43_3
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call enumDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 9
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseBaseType
+  jmp .Lend43
+.Lelse43_3:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend44
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse45_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseBaseType
+  jmp .Lend45
+.Lelse45_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 0
+  jmp .Lreturn_parseBaseType
+  jmp .Lend45
+.Lend45:
+.Lend44:
+  jmp .Lend43
+.Lend43:
+  mov rax, 0
+  jmp .Lreturn_parseBaseType
+.Lreturn_parseBaseType:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseEntireDeclaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend46
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend46:
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseEntireDeclaration
+.Lreturn_parseEntireDeclaration:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseAdvancedTypeDeclaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 56
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend47
+  .p2align 4
+.Lbegin47:
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator47:
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin47
+.Lend47:
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse48_0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend48
+.Lelse48_0:
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend48
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rsi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  jmp .Lend48
+.Lend48:
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lelse49_0
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend50
+  .p2align 4
+.Lbegin50:
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, -1
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse51_0
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend52
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend52:
+  jmp .Lend51
+.Lelse51_0:
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call conditional
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend53
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend53:
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  je .Lend54
+  mov rcx, 542
+  lea rax, QWORD PTR .LiteralString218[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend54:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend51
+.Lend51:
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator50:
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin50
+.Lend50:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend49
+.Lelse49_0:
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lend49
+  mov al, 0
+  call parseFuncArgDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend49
+.Lend49:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse55_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  jmp .Lend55
+.Lelse55_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend55
+.Lend55:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lcond_falsy_56
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_56
+.Lcond_falsy_56:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_56:
+  jmp .Lreturn_parseAdvancedTypeDeclaration
+.Lreturn_parseAdvancedTypeDeclaration:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseFuncArgDeclaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend57
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseFuncArgDeclaration
+.Lend57:
+  .p2align 4
+.Lbegin58:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend59
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend58
+.Lend59:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend60
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend61
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend61:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend60:
+  mov rdi, 1
+  mov al, 0
+  call parseEntireDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor63
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend62
+.Llogicalor63:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend64
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend64
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend64:
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend58
+.Lend62:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lend66
+  .p2align 4
+.Lbegin66:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 48[rsi]
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator66:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Lbegin66
+.Lend66:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend67
+  jmp .Lend58
+.Lend67:
+.Literator58:
+  jmp .Lbegin58
+.Lend58:
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseFuncArgDeclaration
+.Lreturn_parseFuncArgDeclaration:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+registerTypedef:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  test rax, rax
+  je .Lend68
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend68:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 5
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lreturn_registerTypedef:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl sizeOf
+sizeOf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor70
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jne .Lelse69_0
+.Llogicalor70:
+  mov rax, 4
+  jmp .Lreturn_sizeOf
+  jmp .Lend69
+.Lelse69_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lelse69_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse71_0
+  mov rax, 4
+  jmp .Lreturn_sizeOf
+  jmp .Lend71
+.Lelse71_0:
+  mov rax, -1
+  jmp .Lreturn_sizeOf
+  jmp .Lend71
+.Lend71:
+  jmp .Lend69
+.Lelse69_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor72
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lelse69_2
+.Llogicalor72:
+  mov rax, 1
+  jmp .Lreturn_sizeOf
+  jmp .Lend69
+.Lelse69_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Llogicalor73
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse69_3
+.Llogicalor73:
+  mov rax, 8
+  jmp .Lreturn_sizeOf
+  jmp .Lend69
+.Lelse69_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse69_4
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend74
+  mov rax, -1
+  jmp .Lreturn_sizeOf
+.Lend74:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  jmp .Lreturn_sizeOf
+  jmp .Lend69
+.Lelse69_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse69_5
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_sizeOf
+  jmp .Lend69
+.Lelse69_5:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lend69
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_sizeOf
+  jmp .Lend69
+.Lend69:
+  mov rcx, 646
+  lea rax, QWORD PTR .LiteralString219[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lreturn_sizeOf:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+alignOf:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor76
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lelse75_0
+.Llogicalor76:
+  mov rax, 1
+  jmp .Lreturn_alignOf
+  jmp .Lend75
+.Lelse75_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Llogicalor78
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  je .Llogicalor78
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lelse75_1
+.Llogicalor78:
+  mov rax, 4
+  jmp .Lreturn_alignOf
+  jmp .Lend75
+.Lelse75_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lelse75_2
+  mov rax, 8
+  jmp .Lreturn_alignOf
+  jmp .Lend75
+.Lelse75_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse75_3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp alignOf
+  jmp .Lend75
+.Lelse75_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor79
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lend75
+.Llogicalor79:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lcond_falsy_80
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lcond_end_80
+.Lcond_falsy_80:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+.Lcond_end_80:
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lend81
+  mov rax, 1
+  jmp .Lreturn_alignOf
+.Lend81:
+  mov rdi, -1
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend82
+  .p2align 4
+.Lbegin82:
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call alignOf
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend83
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend83:
+.Literator82:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin82
+.Lend82:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_alignOf
+  jmp .Lend75
+.Lend75:
+  mov rcx, 678
+  lea rax, QWORD PTR .LiteralString220[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lreturn_alignOf:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+getTypeForArithmeticOperands:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lelse84_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lelse84_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jne .Lelse84_1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lelse84_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jne .Lelse84_2
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lelse84_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse84_3
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lelse84_3:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse84_4
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lelse84_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lelse84_5
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lelse84_5:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend84
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_getTypeForArithmeticOperands
+  jmp .Lend84
+.Lend84:
+  mov rcx, 701
+  lea rax, QWORD PTR .LiteralString221[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lreturn_getTypeForArithmeticOperands:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isAnonymousObject:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Llogical_false85
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .StaticVar2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcmp
+  test rax, rax
+  jne .Llogical_false85
+  mov rax, 1
+  jmp .Llogical_end85
+.Llogical_false85:
+  mov rax, 0
+.Llogical_end85:
+  jmp .Lreturn_isAnonymousObject
+.Lreturn_isAnonymousObject:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+buildGVarInitSection:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov QWORD PTR -120[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse86_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend86
+.Lelse86_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse86_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse86_1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse86_1
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lelse89_0
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend89
+.Lelse89_0:
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend89
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call errorAt
+  jmp .Lend89
+.Lend89:
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend90
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend90:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend86
+.Lelse86_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse86_2
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  je .Lend91
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend91:
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend92
+  .p2align 4
+.Lbegin92:
+  lea rax, QWORD PTR -52[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator92:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin92
+.Lend92:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lelse93_0
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend93
+.Lelse93_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend93
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call errorAt
+  jmp .Lend93
+.Lend93:
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend94
+  .p2align 4
+.Lbegin94:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend95
+  .p2align 4
+.Lbegin95:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator95:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin95
+.Lend95:
+.Literator94:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin94
+.Lend94:
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend96
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend96:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend86
+.Lelse86_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse86_3
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -64[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkTypeEqual
+  test rax, rax
+  je .Lend97
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend98
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Llogical_false391
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .StaticVar2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcmp
+  test rax, rax
+  jne .Llogical_false391
+  mov rax, 1
+  jmp .Llogical_end391
+.Llogical_false391:
+  mov rax, 0
+.Llogical_end391:
+  test rax, rax
+  je .Lend98
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend100
+  .p2align 4
+.Lbegin100:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend101
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+.Lend101:
+.Literator100:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin100
+.Lend100:
+.Lend98:
+.Lend97:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  je .Lend102
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend102:
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend103
+  .p2align 4
+.Lbegin103:
+  lea rax, QWORD PTR -60[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator103:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin103
+.Lend103:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend104
+  .p2align 4
+.Lbegin104:
+  lea rax, QWORD PTR -64[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator104:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin104
+.Lend104:
+  lea rax, QWORD PTR -64[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend105
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend105:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend106
+  .p2align 4
+.Lbegin106:
+  lea rdi, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend107
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend107:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend108
+  .p2align 4
+.Lbegin108:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator108:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin108
+.Lend108:
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator106:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin106
+.Lend106:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  test rax, rax
+  je .Lend109
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend109:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend86
+.Lelse86_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse86_4
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkTypeEqual
+  test rax, rax
+  je .Lend110
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend111
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Llogical_false392
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .StaticVar2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcmp
+  test rax, rax
+  jne .Llogical_false392
+  mov rax, 1
+  jmp .Llogical_end392
+.Llogical_false392:
+  mov rax, 0
+.Llogical_end392:
+  test rax, rax
+  je .Lend111
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend113
+  .p2align 4
+.Lbegin113:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend114
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+.Lend114:
+.Literator113:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin113
+.Lend113:
+.Lend111:
+.Lend110:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  je .Lelse115_0
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend115
+.Lelse115_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lelse115_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  je .Lelse116_0
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend116
+.Lelse116_0:
+  mov rax, 0
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend116
+.Lend116:
+  jmp .Lend115
+.Lelse115_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  je .Lend115
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend115
+.Lend115:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend117
+  .p2align 4
+.Lbegin117:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator117:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin117
+.Lend117:
+  lea rax, QWORD PTR -72[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend118
+  lea rax, QWORD PTR -72[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend118:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend86
+.Lelse86_4:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lelse86_5
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkAssignable
+  test rax, rax
+  jne .Lend119
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend119:
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend120
+  .p2align 4
+.Lbegin120:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 15
+  je .Lswitch_case_121_f
+  cmp rax, 49
+  je .Lswitch_case_121_31
+  jmp .Lswitch_default_121
+.Lswitch_case_121_31:
+.Lswitch_case_121_f:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend121
+.Lswitch_default_121:
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend121
+.Lend121:
+.Literator120:
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lbegin120
+.Lend120:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lelse122_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 48
+  je .Llogicalor126
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  je .Llogicalor126
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  je .Llogicalor126
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lend123
+.Llogicalor126:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+.Lend123:
+  jmp .Lend122
+.Lelse122_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 48
+  je .Llogicalor130
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  je .Llogicalor130
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 27
+  jne .Lend127
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend127
+.Llogicalor130:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+.Lend127:
+  jmp .Lend122
+.Lend122:
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend86
+.Lelse86_5:
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend131
+  .p2align 4
+.Lbegin131:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  je .Lswitch_case_132_2
+  jmp .Lswitch_default_132
+.Lswitch_case_132_2:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lelse133_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  jne .Lelse133_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend133
+.Lelse133_0:
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend133
+.Lend133:
+  jmp .Lend132
+.Lswitch_default_132:
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend132
+.Lend132:
+.Literator131:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lbegin131
+.Lend131:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4
+  jge .Lend135
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  mov rdi, 1
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 3
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  and rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend135:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  je .Lelse136_0
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend136
+.Lelse136_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend136
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call errorAt
+  jmp .Lend136
+.Lend136:
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_buildGVarInitSection
+  jmp .Lend86
+.Lend86:
+.Lreturn_buildGVarInitSection:
+  mov rbx, QWORD PTR -120[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl program
+program:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  lea rdi, QWORD PTR -136[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  jne .Lend137
+  mov rcx, 936
+  lea rax, QWORD PTR .LiteralString222[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend137:
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 43
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Lend138
+  .p2align 4
+.Lbegin138:
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call decl
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend139
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend139:
+.Literator138:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lbegin138
+.Lend138:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_program:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+decl:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov QWORD PTR -144[rbp], rbx
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rdi, rax
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse140_0
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend140
+.Lelse140_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor142
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Llogicalor142
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lend140
+.Llogicalor142:
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend143
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 125
+  jne .Lend143
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend143
+  mov rax, 0
+  jmp .Lreturn_decl
+.Lend143:
+  jmp .Lend140
+.Lend140:
+  .p2align 4
+.Lbegin146:
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rsi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend147
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend147:
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend148
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call registerTypedef
+  mov rax, 0
+  jmp .Lreturn_decl
+.Lend148:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse149_0
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lelse149_0
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend151
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend151:
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend152
+  .p2align 4
+.Lbegin152:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse153_0
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend153
+.Lelse153_0:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend153
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend153
+.Lend153:
+.Literator152:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin152
+.Lend152:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findFunction
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse154_0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend155
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend155:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkTypeEqual
+  test rax, rax
+  jne .Lelse156_0
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend156
+.Lelse156_0:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogicalor157
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lelse156_1
+.Llogicalor157:
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend156
+.Lelse156_1:
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend158
+  .p2align 4
+.Lbegin158:
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkTypeEqual
+  test rax, rax
+  jne .Lend159
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend159:
+.Literator158:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin158
+.Lend158:
+  jmp .Lend156
+.Lend156:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend154
+.Lelse154_0:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 6
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+  jmp .Lend154
+.Lend154:
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 47
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 0
+  mov rsi, 0
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newObj
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend160
+  .p2align 4
+.Lbegin160:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend161
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lend161:
+.Literator160:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin160
+.Lend160:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse162_0
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend163
+  .p2align 4
+.Lbegin163:
+  lea rax, QWORD PTR -88[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jle .Lelse164_0
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 6
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  imul rax, -8
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend164
+.Lelse164_0:
+  mov rsi, 6
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  sal rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend164
+.Lend164:
+.Literator163:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin163
+.Lend163:
+  mov rdi, 48
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend162
+.Lelse162_0:
+  mov rdi, 0
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend165
+  .p2align 4
+.Lbegin165:
+  lea rax, QWORD PTR -88[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jle .Lelse166_0
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 8
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend166
+.Lelse166_0:
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rbx, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lend167
+  mov rdi, -8
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend167:
+  jmp .Lend166
+.Lend166:
+.Literator165:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin165
+.Lend165:
+  jmp .Lend162
+.Lend162:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call exitCurrentEnv
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_decl
+  jmp .Lend149
+.Lelse149_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse149_1
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findFunction
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse168_0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkTypeEqual
+  test rax, rax
+  jne .Lelse169_0
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend169
+.Lelse169_0:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Llogicalor170
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 4
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lelse169_1
+.Llogicalor170:
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend169
+.Lelse169_1:
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend171
+  .p2align 4
+.Lbegin171:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call checkTypeEqual
+  test rax, rax
+  jne .Lend172
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend172:
+.Literator171:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin171
+.Lend171:
+  jmp .Lend169
+.Lend169:
+  jmp .Lend168
+.Lelse168_0:
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 6
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+  jmp .Lend168
+.Lend168:
+  jmp .Lend149
+.Lelse149_1:
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findGlobalVar
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse173_0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse173_0
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend173
+.Lelse173_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend173
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend173
+.Lend173:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse175_0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend176
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend176:
+  jmp .Lend175
+.Lelse175_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend175
+.Lend175:
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse177_0
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend178
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend178:
+  mov al, 0
+  call varInitializer
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend177
+.Lelse177_0:
+  mov rsi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend177
+.Lend177:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  test rax, rax
+  jge .Lend179
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend179:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend180
+  lea rax, QWORD PTR globals[rip]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 7
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lend180:
+  jmp .Lend149
+.Lend149:
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend181
+  jmp .Lend146
+.Lend181:
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator146:
+  jmp .Lbegin146
+.Lend146:
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov rax, 0
+  jmp .Lreturn_decl
+.Lreturn_decl:
+  mov rbx, QWORD PTR -144[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+stmt:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 208
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call varDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend182
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+.Lend182:
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse183_0
+  lea rdi, QWORD PTR -152[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 43
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend184
+  .p2align 4
+.Lbegin184:
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend185
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend185:
+.Literator184:
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lbegin184
+.Lend184:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call exitCurrentEnv
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_0:
+  mov rdi, 17
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_1
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 44
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_1:
+  mov rdi, 18
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_2
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 45
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_2:
+  mov rdi, 19
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_3
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend186
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Lend186:
+  lea rax, QWORD PTR Types[rip]
+  add rax, 64
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 46
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend187
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend187:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_3:
+  mov rdi, 8
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_4
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 33
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -152[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 9
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lend188
+  .p2align 4
+.Lbegin188:
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 34
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator188:
+  mov rdi, 9
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  jne .Lbegin188
+.Lend188:
+  mov rdi, 10
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lend189
+  lea rdi, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 35
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend189:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_4:
+  mov rdi, 11
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_5
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 36
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_5:
+  mov rdi, 12
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_6
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend190
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend190:
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 37
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call conditional
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend191
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend191:
+  mov rdi, 16
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse192_0
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend193
+  .p2align 4
+.Lbegin193:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator193:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin193
+.Lend193:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend192
+.Lelse192_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend192
+.Lend192:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_6:
+  mov rdi, 13
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_7
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend194
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend194:
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 37
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 16
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse195_0
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend196
+  .p2align 4
+.Lbegin196:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator196:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin196
+.Lend196:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend195
+.Lelse195_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend195
+.Lend195:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_7:
+  mov rdi, 14
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_8
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 43
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newNodeFor
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend197
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  mov al, 0
+  call parseBaseType
+  test rax, rax
+  je .Lelse198_0
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 43
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call varDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend198
+.Lelse198_0:
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  jmp .Lend198
+.Lend198:
+.Lend197:
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend199
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Lend199:
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend200
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Lend200:
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call exitCurrentEnv
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_8:
+  mov rdi, 15
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_9
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newNodeFor
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_9:
+  mov rdi, 16
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse183_10
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newNodeFor
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 39
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov al, 0
+  call stmt
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 15
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  jne .Lend201
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend201:
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_10:
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse183_11
+  mov rax, 0
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lelse183_11:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stmt
+  jmp .Lend183
+.Lend183:
+.Lreturn_stmt:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+structOrUnionDeclaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false202
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false202
+  mov rax, 1
+  jmp .Llogical_end202
+.Llogical_false202:
+  mov rax, 0
+.Llogical_end202:
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse203_0
+  mov rdi, 22
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  jne .Lend204
+  mov rax, 0
+  jmp .Lreturn_structOrUnionDeclaration
+.Lend204:
+  jmp .Lend203
+.Lelse203_0:
+  mov rdi, 23
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  jne .Lend205
+  mov rax, 0
+  jmp .Lreturn_structOrUnionDeclaration
+.Lend205:
+  jmp .Lend203
+.Lend203:
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lelse206_0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse207_0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse208_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend209
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend209
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend209:
+  jmp .Lend208
+.Lelse208_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend211
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend211
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend211:
+  jmp .Lend208
+.Lend208:
+  jmp .Lend207
+.Lelse207_0:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse213_0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 136
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rdi, rsi
+  mov al, 0
+  call buildTagNameForAnonymousObject
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend213
+.Lelse213_0:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 140
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rdi, rsi
+  mov al, 0
+  call buildTagNameForAnonymousObject
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend213
+.Lend213:
+  jmp .Lend207
+.Lend207:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend214
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_215
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  jmp .Lcond_end_215
+.Lcond_falsy_215:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+.Lcond_end_215:
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, -1
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_216
+  mov rax, 1
+  jmp .Lcond_end_216
+.Lcond_falsy_216:
+  mov rax, 2
+.Lcond_end_216:
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lend214:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call structorUnionBody
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_structOrUnionDeclaration
+  jmp .Lend206
+.Lelse206_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse206_1
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse217_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend217
+.Lelse217_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend217
+.Lend217:
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse218_0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend219
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_220
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  jmp .Lcond_end_220
+.Lcond_falsy_220:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+.Lcond_end_220:
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, -1
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_221
+  mov rax, 1
+  jmp .Lcond_end_221
+.Lcond_falsy_221:
+  mov rax, 2
+.Lcond_end_221:
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lend219:
+  jmp .Lend218
+.Lelse218_0:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland222
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend218
+.Llogicaland222:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_223
+  lea rax, QWORD PTR .LiteralString97[rip]
+  jmp .Lcond_end_223
+.Lcond_falsy_223:
+  lea rax, QWORD PTR .LiteralString98[rip]
+.Lcond_end_223:
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call errorAt
+  jmp .Lend218
+.Lend218:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_structOrUnionDeclaration
+  jmp .Lend206
+.Lelse206_1:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lcond_falsy_224
+  lea rax, QWORD PTR .LiteralString100[rip]
+  jmp .Lcond_end_224
+.Lcond_falsy_224:
+  lea rax, QWORD PTR .LiteralString101[rip]
+.Lcond_end_224:
+  mov rcx, rax
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call errorAt
+  jmp .Lend206
+.Lend206:
+.Lreturn_structOrUnionDeclaration:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+structorUnionBody:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  .p2align 4
+.Lbegin225:
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend226
+  jmp .Lend225
+.Lend226:
+  .p2align 4
+.Lbegin227:
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rsi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse228_0
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend228
+.Lelse228_0:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse228_1
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lelse228_1
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend228
+.Lelse228_1:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lend228
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend228
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend228
+.Lend228:
+  lea rdi, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend231
+  .p2align 4
+.Lbegin231:
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend232
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend232:
+.Literator231:
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin231
+.Lend231:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString107[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend233
+  jmp .Lend227
+.Lend233:
+.Literator227:
+  jmp .Lbegin227
+.Lend227:
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Literator225:
+  jmp .Lbegin225
+.Lend225:
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse234_0
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend235
+  .p2align 4
+.Lbegin235:
+  lea rdi, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend236
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend236:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call alignOf
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rdi, rdx
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend237
+  lea rax, QWORD PTR -104[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend237:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend238
+  lea rax, QWORD PTR -104[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend238:
+.Literator235:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin235
+.Lend235:
+  jmp .Lend234
+.Lelse234_0:
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend239
+  .p2align 4
+.Lbegin239:
+  lea rdi, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend240
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend240:
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call alignOf
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend241
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend241:
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend242
+  lea rax, QWORD PTR -104[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend242:
+.Literator239:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin239
+.Lend239:
+  jmp .Lend234
+.Lend234:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend243
+  lea rdi, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rdi, rdx
+  lea rax, QWORD PTR -88[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend244
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -84[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend244:
+.Lend243:
+.Lreturn_structorUnionBody:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+enumDeclaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogical_false245
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogical_false245
+  mov rax, 1
+  jmp .Llogical_end245
+.Llogical_false245:
+  mov rax, 0
+.Llogical_end245:
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  jne .Lend246
+  mov rax, 0
+  jmp .Lreturn_enumDeclaration
+.Lend246:
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lelse247_0
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse248_0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend249
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend249
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend249:
+  jmp .Lend248
+.Lelse248_0:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 132
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rdi, rsi
+  mov al, 0
+  call buildTagNameForAnonymousObject
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend248
+.Lend248:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend251
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend251:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call enumBody
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend252
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lend252:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_enumDeclaration
+  jmp .Lend247
+.Lelse247_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse247_1
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse253_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend254
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+.Lend254:
+  jmp .Lend253
+.Lelse253_0:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland255
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend253
+.Llogicaland255:
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend253
+.Lend253:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_enumDeclaration
+  jmp .Lend247
+.Lelse247_1:
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend247
+.Lend247:
+.Lreturn_enumDeclaration:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+enumBody:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -32[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov QWORD PTR 16[rdi], 0
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString116[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  .p2align 4
+.Lbegin256:
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend257
+  jmp .Lend256
+.Lend257:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend258
+  lea rax, QWORD PTR .LiteralString117[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend258:
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -44[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 4
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+  lea rax, QWORD PTR .LiteralString118[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend259
+  jmp .Lend256
+.Lend259:
+.Literator256:
+  jmp .Lbegin256
+.Lend256:
+  lea rax, QWORD PTR .LiteralString119[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_enumBody:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+varDeclaration:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 304
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -144[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -144[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -168[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rdi, rax
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse260_0
+  mov rax, 0
+  jmp .Lreturn_varDeclaration
+  jmp .Lend260
+.Lelse260_0:
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor262
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Llogicalor262
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 9
+  jne .Lend260
+.Llogicalor262:
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 125
+  jne .Lend263
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend263
+  lea rax, QWORD PTR .LiteralString120[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lend263
+  mov rax, 0
+  jmp .Lreturn_varDeclaration
+.Lend263:
+  jmp .Lend260
+.Lend260:
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend266
+  .p2align 4
+.Lbegin266:
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator266:
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin266
+.Lend266:
+  .p2align 4
+.Lbegin267:
+  lea rdi, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rsi, 1
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend268
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend268:
+  lea rax, QWORD PTR -160[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend269
+  lea rax, QWORD PTR .LiteralString121[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call registerTypedef
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 0
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  jmp .Lreturn_varDeclaration
+.Lend269:
+  mov rdi, -1
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -168[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 1
+  jne .Lend270
+  lea rax, QWORD PTR .LiteralString122[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend270:
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findLVar
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend271
+  lea rax, QWORD PTR .LiteralString123[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend271:
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 27
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend272
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 128
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend272:
+  lea rax, QWORD PTR .LiteralString124[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse273_0
+  lea rdi, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -164[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend274
+  lea rax, QWORD PTR .LiteralString125[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend274:
+  mov al, 0
+  call varInitializer
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse275_0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend275
+.Lelse275_0:
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 50
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 41
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lend276
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, -1
+  jne .Lend276
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 42
+  jne .Lelse278_0
+  lea rdi, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -260[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend279
+  .p2align 4
+.Lbegin279:
+  lea rax, QWORD PTR -260[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Literator279:
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin279
+.Lend279:
+  lea rax, QWORD PTR -260[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend278
+.Lelse278_0:
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse278_1
+  lea rdi, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend280
+  mov rcx, 1737
+  lea rax, QWORD PTR .LiteralString223[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend280:
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend278
+.Lelse278_1:
+  lea rax, QWORD PTR .LiteralString126[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend278
+.Lend278:
+.Lend276:
+  jmp .Lend275
+.Lend275:
+  jmp .Lend273
+.Lelse273_0:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  jne .Lend273
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, -1
+  jne .Lend273
+  lea rax, QWORD PTR .LiteralString127[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend273
+.Lend273:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  test rax, rax
+  jge .Lend282
+  lea rax, QWORD PTR .LiteralString128[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend282:
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse283_0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend284
+  mov rsi, 0
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend284:
+  jmp .Lend283
+.Lelse283_0:
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse283_1
+  jmp .Lend283
+.Lelse283_1:
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call alignOf
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rdi, rdx
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -236[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend285
+  lea rax, QWORD PTR -240[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -236[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -236[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend285:
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -236[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -236[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend283
+.Lend283:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call registerSymbol
+  lea rax, QWORD PTR .LiteralString129[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend286
+  jmp .Lend267
+.Lend286:
+.Literator267:
+  jmp .Lbegin267
+.Lend267:
+  lea rax, QWORD PTR .LiteralString130[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend287
+  lea rax, QWORD PTR -172[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend287:
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 43
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_varDeclaration
+.Lreturn_varDeclaration:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+varInitializer:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString131[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse288_0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 42
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString132[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend289
+  mov al, 0
+  call varInitializerList
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString133[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Lend289:
+  jmp .Lend288
+.Lelse288_0:
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend288
+.Lend288:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_varInitializer
+.Lreturn_varInitializer:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+varInitializerList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  lea rdi, QWORD PTR -136[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  movdqu XMMWORD PTR 48[rdi], xmm0
+  movdqu XMMWORD PTR 64[rdi], xmm0
+  movdqu XMMWORD PTR 80[rdi], xmm0
+  movdqu XMMWORD PTR 96[rdi], xmm0
+  movdqu XMMWORD PTR 112[rdi], xmm0
+  mov QWORD PTR 128[rdi], 0
+  lea rdi, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -136[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin290:
+  lea rax, QWORD PTR .LiteralString134[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse291_0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 42
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString135[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend292
+  mov al, 0
+  call varInitializerList
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString136[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Lend292:
+  jmp .Lend291
+.Lelse291_0:
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend291
+.Lend291:
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString137[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Llogicalor294
+  lea rax, QWORD PTR .LiteralString138[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lend293
+.Llogicalor294:
+  jmp .Lend290
+.Lend293:
+.Literator290:
+  jmp .Lbegin290
+.Lend290:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_varInitializerList
+.Lreturn_varInitializerList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl evalConstantExpr
+evalConstantExpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 48
+  ja .Lswitch_default_295
+  lea rdi, QWORD PTR .Lswitch_table_295[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_295:
+  .long .Lswitch_case_295_1 - .Lswitch_table_295
+  .long .Lswitch_case_295_2 - .Lswitch_table_295
+  .long .Lswitch_case_295_3 - .Lswitch_table_295
+  .long .Lswitch_case_295_4 - .Lswitch_table_295
+  .long .Lswitch_case_295_5 - .Lswitch_table_295
+  .long .Lswitch_case_295_6 - .Lswitch_table_295
+  .long .Lswitch_case_295_7 - .Lswitch_table_295
+  .long .Lswitch_case_295_8 - .Lswitch_table_295
+  .long .Lswitch_case_295_9 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_case_295_11 - .Lswitch_table_295
+  .long .Lswitch_case_295_12 - .Lswitch_table_295
+  .long .Lswitch_case_295_13 - .Lswitch_table_295
+  .long .Lswitch_case_295_14 - .Lswitch_table_295
+  .long .Lswitch_case_295_15 - .Lswitch_table_295
+  .long .Lswitch_case_295_16 - .Lswitch_table_295
+  .long .Lswitch_case_295_17 - .Lswitch_table_295
+  .long .Lswitch_case_295_18 - .Lswitch_table_295
+  .long .Lswitch_case_295_19 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_case_295_20 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_default_295 - .Lswitch_table_295
+  .long .Lswitch_case_295_31 - .Lswitch_table_295
+.previous
+.Lswitch_case_295_20:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend296
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse297_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp evalConstantExpr
+  jmp .Lend297
+.Lelse297_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp evalConstantExpr
+  jmp .Lend297
+.Lend297:
+.Lend296:
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+.Lswitch_case_295_12:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse298_0
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend298
+.Lelse298_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend298
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend298
+.Lend298:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend299
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse300_0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend300
+.Lelse300_0:
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend300
+.Lend300:
+.Lend299:
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+.Lswitch_case_295_13:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse301_0
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend301
+.Lelse301_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend301
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend301
+.Lend301:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend302
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse303_0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend303
+.Lelse303_0:
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+  jmp .Lend303
+.Lend303:
+.Lend302:
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+.Lswitch_case_295_31:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp evalConstantExpr
+.Lswitch_case_295_16:
+.Lswitch_case_295_15:
+.Lswitch_case_295_14:
+.Lswitch_case_295_6:
+.Lswitch_case_295_7:
+.Lswitch_case_295_8:
+.Lswitch_case_295_9:
+.Lswitch_case_295_17:
+.Lswitch_case_295_18:
+.Lswitch_case_295_1:
+.Lswitch_case_295_2:
+.Lswitch_case_295_3:
+.Lswitch_case_295_4:
+.Lswitch_case_295_5:
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend304
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend304
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 23
+  ja .Lswitch_default_306
+  lea rdi, QWORD PTR .Lswitch_table_306[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_306:
+  .long .Lswitch_case_306_1 - .Lswitch_table_306
+  .long .Lswitch_case_306_2 - .Lswitch_table_306
+  .long .Lswitch_case_306_3 - .Lswitch_table_306
+  .long .Lswitch_case_306_4 - .Lswitch_table_306
+  .long .Lswitch_case_306_5 - .Lswitch_table_306
+  .long .Lswitch_case_306_6 - .Lswitch_table_306
+  .long .Lswitch_case_306_7 - .Lswitch_table_306
+  .long .Lswitch_case_306_8 - .Lswitch_table_306
+  .long .Lswitch_case_306_9 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_default_306 - .Lswitch_table_306
+  .long .Lswitch_case_306_14 - .Lswitch_table_306
+  .long .Lswitch_case_306_15 - .Lswitch_table_306
+  .long .Lswitch_case_306_16 - .Lswitch_table_306
+  .long .Lswitch_case_306_17 - .Lswitch_table_306
+  .long .Lswitch_case_306_18 - .Lswitch_table_306
+.previous
+.Lswitch_case_306_16:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  xor rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_15:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_14:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  and rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_6:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_7:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setne al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_8:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setl al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_9:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setle al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_17:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_18:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sar eax, cl
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_2:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_3:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_4:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_case_306_5:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rdi, rdx
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend306
+.Lswitch_default_306:
+  mov rcx, 1947
+  lea rax, QWORD PTR .LiteralString224[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString214[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend306:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+.Lend304:
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+.Lswitch_case_295_11:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalConstantExpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend307
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  sete al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -44[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -44[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+.Lend307:
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+.Lswitch_case_295_19:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_evalConstantExpr
+.Lswitch_default_295:
+  jmp .Lend295
+.Lend295:
+  mov rax, 0
+  jmp .Lreturn_evalConstantExpr
+.Lreturn_evalConstantExpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+expr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString139[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse308_0
+  lea rax, QWORD PTR Types[rip]
+  mov rdi, 40
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin309:
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString140[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend310
+  jmp .Lend309
+.Lend310:
+.Literator309:
+  jmp .Lbegin309
+.Lend309:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend308
+.Lelse308_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend308
+.Lend308:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_expr
+.Lreturn_expr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+assign:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call conditional
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString141[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse312_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 29
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend312
+.Lelse312_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lelse312_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 30
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend312
+.Lelse312_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend312
+.Lend312:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_0:
+  lea rax, QWORD PTR .LiteralString142[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_1
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_1:
+  lea rax, QWORD PTR .LiteralString143[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_2
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_2:
+  lea rax, QWORD PTR .LiteralString144[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_3
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_3:
+  lea rax, QWORD PTR .LiteralString145[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_4
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_4:
+  lea rax, QWORD PTR .LiteralString146[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_5
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 20
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_5:
+  lea rax, QWORD PTR .LiteralString147[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_6
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 21
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_6:
+  lea rax, QWORD PTR .LiteralString148[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_7
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 22
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_7:
+  lea rax, QWORD PTR .LiteralString149[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse311_8
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 23
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lelse311_8:
+  lea rax, QWORD PTR .LiteralString150[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend311
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 24
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 28
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend311
+.Lend311:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_assign
+.Lreturn_assign:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+constant:
+  push rbp
+  mov rbp, rsp
+  mov al, 0
+  call conditional
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp evalConstantExpr
+.Lreturn_constant:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+conditional:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call logicalOR
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString151[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend313
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString152[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  mov al, 0
+  call conditional
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 32
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend313:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_conditional
+.Lreturn_conditional:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+logicalOR:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call logicalAND
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend314
+  .p2align 4
+.Lbegin314:
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call logicalAND
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 18
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator314:
+  lea rax, QWORD PTR .LiteralString153[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin314
+.Lend314:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_logicalOR
+.Lreturn_logicalOR:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+logicalAND:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call XORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString154[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend315
+  .p2align 4
+.Lbegin315:
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call XORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 19
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 120
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 132
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator315:
+  lea rax, QWORD PTR .LiteralString154[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin315
+.Lend315:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_logicalAND
+.Lreturn_logicalAND:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+XORexpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call ORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString155[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend316
+  .p2align 4
+.Lbegin316:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call ORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 22
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator316:
+  lea rax, QWORD PTR .LiteralString155[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin316
+.Lend316:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_XORexpr
+.Lreturn_XORexpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+ORexpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call ANDexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString156[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend317
+  .p2align 4
+.Lbegin317:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call ANDexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 21
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator317:
+  lea rax, QWORD PTR .LiteralString156[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin317
+.Lend317:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_ORexpr
+.Lreturn_ORexpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+ANDexpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call equality
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString157[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend318
+  .p2align 4
+.Lbegin318:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call equality
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 20
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator318:
+  lea rax, QWORD PTR .LiteralString157[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lbegin318
+.Lend318:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_ANDexpr
+.Lreturn_ANDexpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+equality:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call relational
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin319:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString158[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse320_0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call relational
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 6
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend320
+.Lelse320_0:
+  lea rax, QWORD PTR .LiteralString159[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse320_1
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call relational
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 7
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend320
+.Lelse320_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_equality
+  jmp .Lend320
+.Lend320:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator319:
+  jmp .Lbegin319
+.Lend319:
+.Lreturn_equality:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+relational:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call shift
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin321:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString160[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse322_0
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call shift
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 8
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend322
+.Lelse322_0:
+  lea rax, QWORD PTR .LiteralString161[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse322_1
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call shift
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 8
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend322
+.Lelse322_1:
+  lea rax, QWORD PTR .LiteralString162[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse322_2
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call shift
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 9
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend322
+.Lelse322_2:
+  lea rax, QWORD PTR .LiteralString163[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse322_3
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call shift
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 9
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend322
+.Lelse322_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_relational
+  jmp .Lend322
+.Lend322:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator321:
+  jmp .Lbegin321
+.Lend321:
+.Lreturn_relational:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+shift:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call add
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin323:
+  lea rax, QWORD PTR .LiteralString164[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse324_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call add
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 23
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend324
+.Lelse324_0:
+  lea rax, QWORD PTR .LiteralString165[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse324_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call add
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 24
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend324
+.Lelse324_1:
+  jmp .Lend323
+  jmp .Lend324
+.Lend324:
+.Literator323:
+  jmp .Lbegin323
+.Lend323:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_shift
+.Lreturn_shift:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call mul
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin325:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString166[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse326_0
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call mul
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend326
+.Lelse326_0:
+  lea rax, QWORD PTR .LiteralString167[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse326_1
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call mul
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lend327
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lend327
+  lea rax, QWORD PTR Types[rip]
+  add rax, 128
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend327:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend326
+.Lelse326_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_add
+  jmp .Lend326
+.Lend326:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator325:
+  jmp .Lbegin325
+.Lend325:
+.Lreturn_add:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+mul:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin329:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString168[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse330_0
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 3
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend330
+.Lelse330_0:
+  lea rax, QWORD PTR .LiteralString169[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse330_1
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend330
+.Lelse330_1:
+  lea rax, QWORD PTR .LiteralString170[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse330_2
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call getTypeForArithmeticOperands
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 5
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend330
+.Lelse330_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_mul
+  jmp .Lend330
+.Lend330:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator329:
+  jmp .Lbegin329
+.Lend329:
+.Lreturn_mul:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+typecast:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString171[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend331
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend332
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp unary
+.Lend332:
+  mov rsi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend333
+  lea rax, QWORD PTR .LiteralString172[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend333:
+  lea rax, QWORD PTR .LiteralString173[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Llogicalor336
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Llogicalor336
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  jne .Lend334
+.Llogicalor336:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp unary
+.Lend334:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  test rax, rax
+  jge .Lend337
+  lea rax, QWORD PTR .LiteralString174[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend337:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 49
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_typecast
+.Lend331:
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp unary
+.Lreturn_typecast:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+unary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString175[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_0
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_0:
+  lea rax, QWORD PTR .LiteralString176[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_1
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 2
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_1:
+  lea rax, QWORD PTR .LiteralString177[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_2
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 15
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_2:
+  lea rax, QWORD PTR .LiteralString178[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_3
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Llogicalor341
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lelse339_0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lelse339_0
+.Llogicalor341:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_unary
+  jmp .Lend339
+.Lelse339_0:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  je .Lelse339_1
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Lelse339_1
+  lea rax, QWORD PTR .LiteralString179[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend339
+.Lelse339_1:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend339
+.Lend339:
+  jmp .Lend338
+.Lelse338_3:
+  lea rax, QWORD PTR .LiteralString180[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_4
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call unary
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 10
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_4:
+  lea rax, QWORD PTR .LiteralString181[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_5
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call unary
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 11
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_5:
+  lea rax, QWORD PTR .LiteralString182[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse338_6
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call typecast
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 17
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_6:
+  mov rdi, 20
+  mov al, 0
+  call consumeCertainTokenType
+  test rax, rax
+  je .Lelse338_7
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, -1
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString183[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lend343
+  mov rdi, 0
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend344
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rsi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseAdvancedTypeDeclaration
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend345
+  lea rax, QWORD PTR .LiteralString184[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend345:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString185[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+.Lend344:
+.Lend343:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse346_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend347
+  lea rax, QWORD PTR .LiteralString186[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend347:
+  jmp .Lend346
+.Lelse346_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call unary
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend348
+  lea rax, QWORD PTR .LiteralString187[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend348:
+  jmp .Lend346
+.Lend346:
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend338
+.Lelse338_7:
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp postfix
+  jmp .Lend338
+.Lend338:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_unary
+.Lreturn_unary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+compoundLiteral:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString188[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend349
+  mov rax, 0
+  jmp .Lreturn_compoundLiteral
+.Lend349:
+  mov rdi, 0
+  mov al, 0
+  call parseBaseType
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicalor352
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend350
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend350
+.Llogicalor352:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 0
+  jmp .Lreturn_compoundLiteral
+.Lend350:
+  lea rax, QWORD PTR .LiteralString189[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR .LiteralString190[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  jne .Lend353
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 0
+  jmp .Lreturn_compoundLiteral
+.Lend353:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  test rax, rax
+  jge .Lend354
+  lea rax, QWORD PTR .LiteralString191[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend354:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 8
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lelse355_0
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call varInitializer
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, -1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newObj
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 128
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call buildTagNameForAnonymousObject
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildGVarInitSection
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 27
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_compoundLiteral
+  jmp .Lend355
+.Lelse355_0:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call sizeOf
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call alignOf
+  mov rdi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend356
+  .p2align 4
+.Lbegin356:
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator356:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin356
+.Lend356:
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rax, rdx
+  test rax, rax
+  je .Lend357
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, r8
+  cqo
+  idiv rdi
+  mov rdi, rdx
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend357:
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 104
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend358
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend358:
+  lea rax, QWORD PTR -56[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  mov rsi, rax
+  mov rdx, rcx
+  mov al, 0
+  call newObj
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 27
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call varInitializer
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 40
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 41
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_compoundLiteral
+  jmp .Lend355
+.Lend355:
+.Lreturn_compoundLiteral:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+postfix:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call compoundLiteral
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse359_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend360
+  .p2align 4
+.Lbegin360:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator360:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin360
+.Lend360:
+  jmp .Lend359
+.Lelse359_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call primary
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend359
+.Lend359:
+  .p2align 4
+.Lbegin361:
+  lea rax, QWORD PTR .LiteralString192[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse362_0
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin363:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call isWorkLikePointer
+  test rax, rax
+  jne .Lend364
+  lea rax, QWORD PTR .LiteralString193[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend364:
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString194[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 1
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString195[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend365
+  jmp .Lend363
+.Lend365:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 5
+  je .Lend366
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend366:
+.Literator363:
+  jmp .Lbegin363
+.Lend363:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend362
+.Lelse362_0:
+  lea rax, QWORD PTR .LiteralString196[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  je .Lelse362_1
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 51
+  jne .Lelse367_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 64
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 31
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 51
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 120
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend367
+.Lelse367_0:
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Lend368
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend368:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  je .Lend369
+  lea rax, QWORD PTR .LiteralString197[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend369:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 31
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend367
+.Lend367:
+  mov al, 0
+  call funcArgList
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin370:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend371
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend371:
+.Literator370:
+.Lend370:
+  jmp .Lend362
+.Lelse362_1:
+  lea rax, QWORD PTR .LiteralString198[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse362_2
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 12
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend362
+.Lelse362_2:
+  lea rax, QWORD PTR .LiteralString199[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse362_3
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 13
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend362
+.Lelse362_3:
+  lea rax, QWORD PTR .LiteralString200[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Llogicalor372
+  lea rax, QWORD PTR .LiteralString201[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse362_4
+.Llogicalor372:
+  lea rax, QWORD PTR globals[rip]
+  add rax, 144
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 45
+  jne .Lend373
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 6
+  jne .Llogicalor376
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend374
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend374
+.Llogicalor376:
+  lea rax, QWORD PTR .LiteralString202[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend374:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 16
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend373:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  je .Lend377
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 8
+  je .Lend377
+  lea rax, QWORD PTR .LiteralString203[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend377:
+  mov al, 0
+  call expectIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 7
+  jne .Lelse379_0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStructOrUnionMember
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend380
+  lea rax, QWORD PTR .LiteralString204[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend380:
+  jmp .Lend379
+.Lelse379_0:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 80
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findStructOrUnionMember
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend381
+  lea rax, QWORD PTR .LiteralString205[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend381:
+  jmp .Lend379
+.Lend379:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 14
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend362
+.Lelse362_4:
+  jmp .Lend361
+  jmp .Lend362
+.Lend362:
+.Literator361:
+  jmp .Lbegin361
+.Lend361:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend382
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_postfix
+.Lend382:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_postfix
+.Lreturn_postfix:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+funcArgList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString206[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR .LiteralString207[rip]
+  mov rdi, rax
+  mov al, 0
+  call matchReserved
+  test rax, rax
+  jne .Lend383
+  .p2align 4
+.Lbegin384:
+  mov al, 0
+  call assign
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 72
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 12
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR .LiteralString208[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  jne .Lend385
+  jmp .Lend384
+.Lend385:
+.Literator384:
+  jmp .Lbegin384
+.Lend384:
+.Lend383:
+  lea rax, QWORD PTR .LiteralString209[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_funcArgList
+.Lreturn_funcArgList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+primary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call consumeIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse386_0
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findLVar
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse387_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 27
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend387
+.Lelse387_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findGlobalVar
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  cmp rax, rdi
+  je .Lelse387_1
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 48
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend387
+.Lelse387_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 4
+  mov rsi, rax
+  mov al, 0
+  call findSymbol
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  cmp rax, rdi
+  je .Lelse387_2
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -68[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -68[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend387
+.Lelse387_2:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findFunction
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  cmp rax, rdi
+  je .Lelse387_3
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 27
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 112
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend387
+.Lelse387_3:
+  mov rcx, 18
+  lea rax, QWORD PTR .LiteralString210[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Lelse387_4
+  lea rax, QWORD PTR Types[rip]
+  add rax, 64
+  mov rdi, 51
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 112
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 120
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend387
+.Lelse387_4:
+  lea rax, QWORD PTR .LiteralString211[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend387
+.Lend387:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend386
+.Lelse386_0:
+  lea rax, QWORD PTR .LiteralString212[rip]
+  mov rdi, rax
+  mov al, 0
+  call consumeReserved
+  test rax, rax
+  je .Lelse386_1
+  mov al, 0
+  call expr
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString213[rip]
+  mov rdi, rax
+  mov al, 0
+  call expectReserved
+  jmp .Lend386
+.Lelse386_1:
+  mov al, 0
+  call consumeLiteralString
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  test rax, rax
+  je .Lelse386_2
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 64
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 192
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 26
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend386
+.Lelse386_2:
+  mov al, 0
+  call expectNumber
+  mov rdi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR Types[rip]
+  add rax, 256
+  mov rdi, 25
+  mov rsi, rax
+  mov al, 0
+  call newNode
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend386
+.Lend386:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_primary
+.Lreturn_primary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "An identifier is expected"
+.LiteralString2:
+  .string  "A type is expected"
+.LiteralString3:
+  .string  "Unexpected EOF"
+.LiteralString4:
+  .string  "'%s' is expected."
+.LiteralString5:
+  .string  "Non number appears."
+.LiteralString6:
+  .string  "'%s' is expected."
+.LiteralString7:
+  .string  "anonymous-object-"
+.LiteralString8:
+  .string  "%s%d"
+.LiteralString9:
+  .string  "Cannot combine \"static\" ,\"extern\" and \"typedef\"."
+.LiteralString10:
+  .string  "*"
+.LiteralString11:
+  .string  "("
+.LiteralString12:
+  .string  ")"
+.LiteralString13:
+  .string  "["
+.LiteralString14:
+  .string  "["
+.LiteralString15:
+  .string  "]"
+.LiteralString16:
+  .string  "Array size required."
+.LiteralString17:
+  .string  "Constant expression required."
+.LiteralString18:
+  .string  "]"
+.LiteralString19:
+  .string  "("
+.LiteralString20:
+  .string  "("
+.LiteralString21:
+  .string  ")"
+.LiteralString22:
+  .string  "..."
+.LiteralString23:
+  .string  "Function parameter must be only one if \"void\" appears."
+.LiteralString24:
+  .string  ","
+.LiteralString25:
+  .string  ")"
+.LiteralString26:
+  .string  "Redefinition of typedef name."
+.LiteralString27:
+  .string  "anonymous-object-"
+.LiteralString28:
+  .string  "%d items given to array sized %d."
+.LiteralString29:
+  .string  "Initialzier-list required"
+.LiteralString30:
+  .string  "%d items given to array sized %d."
+.LiteralString31:
+  .string  "Initialzier-list required"
+.LiteralString32:
+  .string  "Too much items are given."
+.LiteralString33:
+  .string  "Initialzier-list required"
+.LiteralString34:
+  .string  "Value required in this initializer-list."
+.LiteralString35:
+  .string  "Too much items in initializer-list."
+.LiteralString36:
+  .string  "Different type."
+.LiteralString37:
+  .string  "Constant value required."
+.LiteralString38:
+  .string  "Constant value required."
+.LiteralString39:
+  .string  "Value overflows: value will be %d."
+.LiteralString40:
+  .string  ";"
+.LiteralString41:
+  .string  "Missing variable/function name."
+.LiteralString42:
+  .string  ";"
+.LiteralString43:
+  .string  "{"
+.LiteralString44:
+  .string  "Function definition is not expected here."
+.LiteralString45:
+  .string  "Argument name is missed."
+.LiteralString46:
+  .string  "Cannot declare function argument with type \"void\""
+.LiteralString47:
+  .string  "Redefinition of function."
+.LiteralString48:
+  .string  "Function return type mismatch with previous declaration."
+.LiteralString49:
+  .string  "Mismatch number of function arguments with previous declaration."
+.LiteralString50:
+  .string  "Argument type mismatch with previous declaration."
+.LiteralString51:
+  .string  "Function return type mismatch with previous declaration."
+.LiteralString52:
+  .string  "Mismatch number of function arguments with previous declaration."
+.LiteralString53:
+  .string  "Argument type mismatch with previous declaration."
+.LiteralString54:
+  .string  "Redefinition of variable."
+.LiteralString55:
+  .string  "Cannot declare variable with type \"void\""
+.LiteralString56:
+  .string  "="
+.LiteralString57:
+  .string  "Extern variable cannot have initializers"
+.LiteralString58:
+  .string  "Variable has incomplete type."
+.LiteralString59:
+  .string  ","
+.LiteralString60:
+  .string  ";"
+.LiteralString61:
+  .string  "{"
+.LiteralString62:
+  .string  "}"
+.LiteralString63:
+  .string  ";"
+.LiteralString64:
+  .string  ";"
+.LiteralString65:
+  .string  ";"
+.LiteralString66:
+  .string  ";"
+.LiteralString67:
+  .string  "("
+.LiteralString68:
+  .string  ")"
+.LiteralString69:
+  .string  "("
+.LiteralString70:
+  .string  ")"
+.LiteralString71:
+  .string  "("
+.LiteralString72:
+  .string  ")"
+.LiteralString73:
+  .string  "\"case\" label not within a switch statement"
+.LiteralString74:
+  .string  ":"
+.LiteralString75:
+  .string  "Constant expression required."
+.LiteralString76:
+  .string  ":"
+.LiteralString77:
+  .string  "\"default\" label not within a switch statement"
+.LiteralString78:
+  .string  "("
+.LiteralString79:
+  .string  ";"
+.LiteralString80:
+  .string  ";"
+.LiteralString81:
+  .string  ";"
+.LiteralString82:
+  .string  ";"
+.LiteralString83:
+  .string  ")"
+.LiteralString84:
+  .string  ")"
+.LiteralString85:
+  .string  "("
+.LiteralString86:
+  .string  ")"
+.LiteralString87:
+  .string  "\"while\" expected."
+.LiteralString88:
+  .string  "("
+.LiteralString89:
+  .string  ")"
+.LiteralString90:
+  .string  ";"
+.LiteralString91:
+  .string  ";"
+.LiteralString92:
+  .string  ";"
+.LiteralString93:
+  .string  "{"
+.LiteralString94:
+  .string  "Redefinition of struct."
+.LiteralString95:
+  .string  "Redefinition of union"
+.LiteralString96:
+  .string  "Undefiend %s."
+.LiteralString97:
+  .string  "struct"
+.LiteralString98:
+  .string  "union"
+.LiteralString99:
+  .string  "Missing %s tag name."
+.LiteralString100:
+  .string  "struct"
+.LiteralString101:
+  .string  "union"
+.LiteralString102:
+  .string  "{"
+.LiteralString103:
+  .string  "Member name required."
+.LiteralString104:
+  .string  "Cannot use struct itself for member type."
+.LiteralString105:
+  .string  "Cannot use union itself for member type."
+.LiteralString106:
+  .string  "Duplicate member name."
+.LiteralString107:
+  .string  ","
+.LiteralString108:
+  .string  ";"
+.LiteralString109:
+  .string  "}"
+.LiteralString110:
+  .string  "Cannot determine size of this."
+.LiteralString111:
+  .string  "Cannot determine size of this."
+.LiteralString112:
+  .string  "{"
+.LiteralString113:
+  .string  "Redefinition of enum."
+.LiteralString114:
+  .string  "Undefined enum."
+.LiteralString115:
+  .string  "Missing enum tag name."
+.LiteralString116:
+  .string  "{"
+.LiteralString117:
+  .string  "Duplicate enum item."
+.LiteralString118:
+  .string  ","
+.LiteralString119:
+  .string  "}"
+.LiteralString120:
+  .string  ";"
+.LiteralString121:
+  .string  ";"
+.LiteralString122:
+  .string  "Cannot declare variable with type \"void\""
+.LiteralString123:
+  .string  "Redefinition of variable"
+.LiteralString124:
+  .string  "="
+.LiteralString125:
+  .string  "Extern variable cannot have initializers"
+.LiteralString126:
+  .string  "Initializer-list is expected for array"
+.LiteralString127:
+  .string  "Initializer list required."
+.LiteralString128:
+  .string  "Variable has incomplete type."
+.LiteralString129:
+  .string  ","
+.LiteralString130:
+  .string  ";"
+.LiteralString131:
+  .string  "{"
+.LiteralString132:
+  .string  "}"
+.LiteralString133:
+  .string  "}"
+.LiteralString134:
+  .string  "{"
+.LiteralString135:
+  .string  "}"
+.LiteralString136:
+  .string  "}"
+.LiteralString137:
+  .string  ","
+.LiteralString138:
+  .string  "}"
+.LiteralString139:
+  .string  ","
+.LiteralString140:
+  .string  ","
+.LiteralString141:
+  .string  "="
+.LiteralString142:
+  .string  "+="
+.LiteralString143:
+  .string  "-="
+.LiteralString144:
+  .string  "*="
+.LiteralString145:
+  .string  "/="
+.LiteralString146:
+  .string  "&="
+.LiteralString147:
+  .string  "|="
+.LiteralString148:
+  .string  "^="
+.LiteralString149:
+  .string  "<<="
+.LiteralString150:
+  .string  ">>="
+.LiteralString151:
+  .string  "?"
+.LiteralString152:
+  .string  ":"
+.LiteralString153:
+  .string  "||"
+.LiteralString154:
+  .string  "&&"
+.LiteralString155:
+  .string  "^"
+.LiteralString156:
+  .string  "|"
+.LiteralString157:
+  .string  "&"
+.LiteralString158:
+  .string  "=="
+.LiteralString159:
+  .string  "!="
+.LiteralString160:
+  .string  "<"
+.LiteralString161:
+  .string  ">"
+.LiteralString162:
+  .string  "<="
+.LiteralString163:
+  .string  ">="
+.LiteralString164:
+  .string  "<<"
+.LiteralString165:
+  .string  ">>"
+.LiteralString166:
+  .string  "+"
+.LiteralString167:
+  .string  "-"
+.LiteralString168:
+  .string  "*"
+.LiteralString169:
+  .string  "/"
+.LiteralString170:
+  .string  "%"
+.LiteralString171:
+  .string  "("
+.LiteralString172:
+  .string  "Unexpected identifier."
+.LiteralString173:
+  .string  ")"
+.LiteralString174:
+  .string  "Incomplete type."
+.LiteralString175:
+  .string  "+"
+.LiteralString176:
+  .string  "-"
+.LiteralString177:
+  .string  "&"
+.LiteralString178:
+  .string  "*"
+.LiteralString179:
+  .string  "Cannot dereference a non-pointer value."
+.LiteralString180:
+  .string  "++"
+.LiteralString181:
+  .string  "--"
+.LiteralString182:
+  .string  "!"
+.LiteralString183:
+  .string  "("
+.LiteralString184:
+  .string  "Unexpected ident."
+.LiteralString185:
+  .string  ")"
+.LiteralString186:
+  .string  "Incomplete type."
+.LiteralString187:
+  .string  "Variable has incomplete type."
+.LiteralString188:
+  .string  "("
+.LiteralString189:
+  .string  ")"
+.LiteralString190:
+  .string  "{"
+.LiteralString191:
+  .string  "Incomplete type."
+.LiteralString192:
+  .string  "["
+.LiteralString193:
+  .string  "Array or pointer is needed."
+.LiteralString194:
+  .string  "]"
+.LiteralString195:
+  .string  "["
+.LiteralString196:
+  .string  "("
+.LiteralString197:
+  .string  "Not a function or function pointer."
+.LiteralString198:
+  .string  "++"
+.LiteralString199:
+  .string  "--"
+.LiteralString200:
+  .string  "."
+.LiteralString201:
+  .string  "->"
+.LiteralString202:
+  .string  "Pointer for struct or union required."
+.LiteralString203:
+  .string  "Struct or union required."
+.LiteralString204:
+  .string  "No such struct member."
+.LiteralString205:
+  .string  "No such union member."
+.LiteralString206:
+  .string  "("
+.LiteralString207:
+  .string  ")"
+.LiteralString208:
+  .string  ","
+.LiteralString209:
+  .string  ")"
+.LiteralString210:
+  .string  "__builtin_va_start"
+.LiteralString211:
+  .string  "Undefined variable"
+.LiteralString212:
+  .string  "("
+.LiteralString213:
+  .string  ")"
+.LiteralString214:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString215:
+  .string  "%d:%d: Internal error: assert: %s"
+.LiteralString216:
+  .string  "parser.c"
+.LiteralString217:
+  .string  "parser.c"
+.LiteralString218:
+  .string  "parser.c"
+.LiteralString219:
+  .string  "parser.c"
+.LiteralString220:
+  .string  "parser.c"
+.LiteralString221:
+  .string  "parser.c"
+.LiteralString222:
+  .string  "parser.c"
+.LiteralString223:
+  .string  "parser.c"
+.LiteralString224:
+  .string  "parser.c"
+symbolTable:
+  .zero 32768
+.StaticVar4:
+  .quad 0
+.StaticVar3:
+  .long 17
+.StaticVar2:
+  .string "anonymous-object-"
+.StaticVar1:
+  .long 18
+.StaticVar0:
+  .string "anonymous-object-"
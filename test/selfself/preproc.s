@@ -0,0 +1,8805 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+newMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newMacro
+.Lreturn_newMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+macroBucket:
+  mov r10, rdi
+  lea rax, QWORD PTR preproc[rip]
+  mov rdi, rax
+  mov rax, r10
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 1023
+  lea rax, QWORD PTR 0[rdi+rax*8]
+  jmp .Lreturn_macroBucket
+.Lreturn_macroBucket:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend0
+.Llogicaland1:
+  mov rax, 0
+  jmp .Lreturn_findMacro
+.Lend0:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR preproc[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 1023
+  lea rax, QWORD PTR 0[rdi+rax*8]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend2
+  .p2align 4
+.Lbegin2:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend3
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_findMacro
+.Lend3:
+.Literator2:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin2
+.Lend2:
+  mov rax, 0
+  jmp .Lreturn_findMacro
+.Lreturn_findMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+matchTokenReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false4
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false4
+  mov rax, 1
+  jmp .Llogical_end4
+.Llogical_false4:
+  mov rax, 0
+.Llogical_end4:
+  jmp .Lreturn_matchTokenReserved
+.Lreturn_matchTokenReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+matchTokenIdent:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Llogical_false5
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false5
+  mov rax, 1
+  jmp .Llogical_end5
+.Llogical_false5:
+  mov rax, 0
+.Llogical_end5:
+  jmp .Lreturn_matchTokenIdent
+.Lreturn_matchTokenIdent:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeTokenReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false177
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false177
+  mov rax, 1
+  jmp .Llogical_end177
+.Llogical_false177:
+  mov rax, 0
+.Llogical_end177:
+  test rax, rax
+  je .Lend6
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 1
+  jmp .Lreturn_consumeTokenReserved
+.Lend6:
+  mov rax, 0
+  jmp .Lreturn_consumeTokenReserved
+.Lreturn_consumeTokenReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeTokenIdent:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Llogical_false178
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false178
+  mov rax, 1
+  jmp .Llogical_end178
+.Llogical_false178:
+  mov rax, 0
+.Llogical_end178:
+  test rax, rax
+  je .Lend7
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 1
+  jmp .Lreturn_consumeTokenIdent
+.Lend7:
+  mov rax, 0
+  jmp .Lreturn_consumeTokenIdent
+.Lreturn_consumeTokenIdent:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeTokenAnyIdent:
+  mov r10, rdi
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend8
+  lea rdi, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, r10
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_consumeTokenAnyIdent
+.Lend8:
+  mov rax, 0
+  jmp .Lreturn_consumeTokenAnyIdent
+.Lreturn_consumeTokenAnyIdent:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+consumeTokenCertainType:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  movsx rax, r11d
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend9
+  mov rax, r10
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, r10
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 1
+  jmp .Lreturn_consumeTokenCertainType
+.Lend9:
+  mov rax, 0
+  jmp .Lreturn_consumeTokenCertainType
+.Lreturn_consumeTokenCertainType:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newTokenSOF:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newTokenSOF
+.Lreturn_newTokenSOF:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newTokenEOF:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  lea rdi, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 26
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newTokenEOF
+.Lreturn_newTokenEOF:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newTokenDummyReserved:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newTokenDummyReserved
+.Lreturn_newTokenDummyReserved:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+cloneToken:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_cloneToken
+.Lreturn_cloneToken:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+cloneTokenList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -64[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -64[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend10
+  .p2align 4
+.Lbegin10:
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdi, 0
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator10:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lbegin10
+.Lend10:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend11
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend11:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_cloneTokenList
+.Lreturn_cloneTokenList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+concatToken:
+  mov r10, rdi
+  mov r11, rsi
+  mov rax, r11
+  mov rdi, rax
+  mov rax, r10
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r10
+  mov rdi, rax
+  mov rax, r11
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_concatToken:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+insertTokens:
+  mov r10, rdi
+  mov r11, rsi
+  mov r8, rdx
+  lea rdi, QWORD PTR -40[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, r10
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r11
+  mov rdi, rax
+  mov rax, r10
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r10
+  mov rdi, rax
+  mov rax, r11
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, r8
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r8
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_insertTokens:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+insertToken:
+  mov r10, rdi
+  mov r11, rsi
+  lea rdi, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, r10
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r11
+  mov rdi, rax
+  mov rax, r10
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r10
+  mov rdi, rax
+  mov rax, r11
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, r11
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, r11
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_insertToken:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isLineHead:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor12
+  mov rax, r10
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false12
+.Llogicalor12:
+  mov rax, 1
+  jmp .Llogical_end12
+.Llogical_false12:
+  mov rax, 0
+.Llogical_end12:
+  jmp .Lreturn_isLineHead
+.Lreturn_isLineHead:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+skipLine:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, rdi
+  jmp .Lcond13
+  .p2align 4
+.Lbegin13:
+  mov rax, r10
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov r10, rdi
+  mov rax, rdi
+.Literator13:
+.Lcond13:
+  mov rax, r10
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor179
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false179
+.Llogicalor179:
+  mov rax, 1
+  jmp .Llogical_end179
+.Llogical_false179:
+  mov rax, 0
+.Llogical_end179:
+  test rax, rax
+  je .Lbegin13
+.Lend13:
+  mov rax, r10
+  jmp .Lreturn_skipLine
+.Lreturn_skipLine:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseDefineDirective:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Llogicaland15
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  jne .Lend14
+.Llogicaland15:
+  mov rcx, 201
+  lea rax, QWORD PTR .LiteralString108[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend14:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenAnyIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse16_0
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend16
+.Lelse16_0:
+  mov rcx, 7
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Lelse16_1
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend16
+.Lelse16_1:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findMacro
+  test rax, rax
+  je .Lend16
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend16
+.Lend16:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR preproc[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 1023
+  lea rax, QWORD PTR 0[rdi+rax*8]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR preproc[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 1023
+  lea rax, QWORD PTR 0[rdi+rax*8]
+  mov rdi, rsi
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false180
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false180
+  mov rax, 1
+  jmp .Llogical_end180
+.Llogical_false180:
+  mov rax, 0
+.Llogical_end180:
+  test rax, rax
+  je .Lend17
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend17
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend19
+  lea rdi, QWORD PTR -88[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -88[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin20:
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenAnyIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend21
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend21:
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdi, 0
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse22_0
+  jmp .Lend20
+  jmp .Lend22
+.Lelse22_0:
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend22
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend22
+.Lend22:
+.Literator20:
+  jmp .Lbegin20
+.Lend20:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend19:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend17:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call skipLine
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseDefineDirective
+.Lreturn_parseDefineDirective:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseUndefDirective:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Llogicaland24
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  jne .Lend23
+.Llogicaland24:
+  mov rcx, 265
+  lea rax, QWORD PTR .LiteralString109[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend23:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenAnyIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend25
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend25:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findMacro
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend26
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend26:
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR preproc[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  and rax, 1023
+  lea rax, QWORD PTR 0[rdi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend27
+  .p2align 4
+.Lbegin27:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend28
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend27
+.Lend28:
+.Literator27:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin27
+.Lend27:
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin29:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend30
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend30:
+.Literator29:
+.Lend29:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call skipLine
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseUndefDirective
+.Lreturn_parseUndefDirective:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIncludeDirective:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 144
+  mov QWORD PTR -136[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -24[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -40[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call skipLine
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Llogicaland32
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  jne .Lend31
+.Llogicaland32:
+  mov rcx, 303
+  lea rax, QWORD PTR .LiteralString110[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend31:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  je .Lend33
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false181
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false181
+  mov rax, 1
+  jmp .Llogical_end181
+.Llogical_false181:
+  mov rax, 0
+.Llogical_end181:
+  test rax, rax
+  jne .Lend33
+.Lend33:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Lelse35_0
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 47
+  jne .Lelse36_0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call analyzeFilepath
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend36
+.Lelse36_0:
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenFile
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rbx, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  mov rax, rbx
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call sprintf
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call analyzeFilepath
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend36
+.Lend36:
+  jmp .Lend35
+.Lelse35_0:
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse35_1
+  lea rdi, QWORD PTR -80[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin37:
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogical_false182
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Llogical_false182
+  mov rax, 1
+  jmp .Llogical_end182
+.Llogical_false182:
+  mov rax, 0
+.Llogical_end182:
+  test rax, rax
+  je .Lelse38_0
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend39
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend39:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend37
+  jmp .Lend38
+.Lelse38_0:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse38_1
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend38
+.Lelse38_1:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend38
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend38
+.Lend38:
+.Literator37:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lbegin37
+.Lend37:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 168
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -100[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 168
+  mov rax, QWORD PTR 0[rax]
+  mov r8, rax
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call sprintf
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call analyzeFilepath
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend35
+.Lelse35_1:
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend35
+.Lend35:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call readFile
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenize
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  je .Lend40
+  .p2align 4
+.Lbegin40:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator40:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lbegin40
+.Lend40:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call insertTokens
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIncludeDirective
+.Lreturn_parseIncludeDirective:
+  mov rbx, QWORD PTR -136[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNode:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNode
+.Lreturn_newNode:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+newNodeBinary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov DWORD PTR -4[rbp], edi
+  mov QWORD PTR -12[rbp], rsi
+  mov QWORD PTR -20[rbp], rdx
+  mov QWORD PTR -28[rbp], rcx
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -12[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -4[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -52[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -52[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -20[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -28[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_newNodeBinary
+.Lreturn_newNodeBinary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondPrimary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse41_0
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondConditional
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend42
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend42:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondPrimary
+  jmp .Lend41
+.Lelse41_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  jne .Lelse41_1
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondPrimary
+  jmp .Lend41
+.Lelse41_1:
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend41
+.Lend41:
+.Lreturn_parseIfCondPrimary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondUnary:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor44
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse43_0
+.Llogicalor44:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondUnary
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 45
+  jne .Lend45
+  mov rdi, 2
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend45:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondUnary
+  jmp .Lend43
+.Lelse43_0:
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse43_1
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondUnary
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondUnary
+  jmp .Lend43
+.Lelse43_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp parseIfCondPrimary
+  jmp .Lend43
+.Lend43:
+.Lreturn_parseIfCondUnary:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondMul:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondUnary
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin46:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor49
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor49
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse47_0
+.Llogicalor49:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondUnary
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 47
+  jne .Lelse50_0
+  mov rdi, 4
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend50
+.Lelse50_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 37
+  jne .Lend50
+  mov rdi, 5
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend50
+.Lend50:
+  jmp .Lend47
+.Lelse47_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondMul
+  jmp .Lend47
+.Lend47:
+.Literator46:
+  jmp .Lbegin46
+.Lend46:
+.Lreturn_parseIfCondMul:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondAdd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondMul
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin51:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor53
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse52_0
+.Llogicalor53:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondMul
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 45
+  jne .Lend54
+  mov rdi, 2
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend54:
+  jmp .Lend52
+.Lelse52_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondAdd
+  jmp .Lend52
+.Lend52:
+.Literator51:
+  jmp .Lbegin51
+.Lend51:
+.Lreturn_parseIfCondAdd:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondShift:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondAdd
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin55:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor57
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse56_0
+.Llogicalor57:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondAdd
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 62
+  jne .Lend58
+  mov rdi, 24
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend58:
+  jmp .Lend56
+.Lelse56_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondShift
+  jmp .Lend56
+.Lend56:
+.Literator55:
+  jmp .Lbegin55
+.Lend55:
+.Lreturn_parseIfCondShift:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondRelational:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondShift
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin59:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor61
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse60_0
+.Llogicalor61:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondShift
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend62
+  mov rdi, 9
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend62:
+  jmp .Lend60
+.Lelse60_0:
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor63
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse60_1
+.Llogicalor63:
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondShift
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 2
+  jne .Lend64
+  mov rdi, 9
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend64:
+  jmp .Lend60
+.Lelse60_1:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondRelational
+  jmp .Lend60
+.Lend60:
+.Literator59:
+  jmp .Lbegin59
+.Lend59:
+.Lreturn_parseIfCondRelational:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondEquality:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondRelational
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin65:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Llogicalor67
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse66_0
+.Llogicalor67:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondRelational
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 33
+  jne .Lend68
+  mov rdi, 7
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend68:
+  jmp .Lend66
+.Lelse66_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondEquality
+  jmp .Lend66
+.Lend66:
+.Literator65:
+  jmp .Lbegin65
+.Lend65:
+.Lreturn_parseIfCondEquality:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondANDexpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondEquality
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin69:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse70_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondEquality
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 20
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend70
+.Lelse70_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondANDexpr
+  jmp .Lend70
+.Lend70:
+.Literator69:
+  jmp .Lbegin69
+.Lend69:
+.Lreturn_parseIfCondANDexpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondORexpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondANDexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin71:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse72_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondANDexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 21
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend72
+.Lelse72_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondORexpr
+  jmp .Lend72
+.Lend72:
+.Literator71:
+  jmp .Lbegin71
+.Lend71:
+.Lreturn_parseIfCondORexpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondXORexpr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin73:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse74_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 22
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend74
+.Lelse74_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondXORexpr
+  jmp .Lend74
+.Lend74:
+.Literator73:
+  jmp .Lbegin73
+.Lend73:
+.Lreturn_parseIfCondXORexpr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondLogicalAND:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondXORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin75:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse76_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondXORexpr
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend76
+.Lelse76_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondLogicalAND
+  jmp .Lend76
+.Lend76:
+.Literator75:
+  jmp .Lbegin75
+.Lend75:
+.Lreturn_parseIfCondLogicalAND:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondLogicalOR:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondLogicalAND
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin77:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse78_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondLogicalAND
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 18
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend78
+.Lelse78_0:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondLogicalOR
+  jmp .Lend78
+.Lend78:
+.Literator77:
+  jmp .Lbegin77
+.Lend77:
+.Lreturn_parseIfCondLogicalOR:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCondConditional:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondLogicalOR
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lend79
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondConditional
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend80
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend80:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondConditional
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 136
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 32
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 88
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend79:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfCondConditional
+.Lreturn_parseIfCondConditional:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfCond:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp parseIfCondConditional
+.Lreturn_parseIfCond:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+evalIfCondNodes:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 19
+  jne .Lelse81_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend82
+  mov rax, 0
+  jmp .Lreturn_evalIfCondNodes
+.Lend82:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  test rax, rax
+  je .Lcond_falsy_83
+  mov rax, 1
+  jmp .Lcond_end_83
+.Lcond_falsy_83:
+  mov rax, 0
+.Lcond_end_83:
+  jmp .Lreturn_evalIfCondNodes
+  jmp .Lend81
+.Lelse81_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 18
+  jne .Lelse81_1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend84
+  mov rax, 1
+  jmp .Lreturn_evalIfCondNodes
+.Lend84:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  test rax, rax
+  je .Lcond_falsy_85
+  mov rax, 1
+  jmp .Lcond_end_85
+.Lcond_falsy_85:
+  mov rax, 0
+.Lcond_end_85:
+  jmp .Lreturn_evalIfCondNodes
+  jmp .Lend81
+.Lelse81_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 32
+  jne .Lend81
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse86_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp evalIfCondNodes
+  jmp .Lend86
+.Lelse86_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rsp, rbp
+  pop rbp
+  mov al, 0
+  jmp evalIfCondNodes
+  jmp .Lend86
+.Lend86:
+  jmp .Lend81
+.Lend81:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend87
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend87:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend88
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend88:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub rax, 1
+  cmp rax, 24
+  ja .Lswitch_default_89
+  lea rdi, QWORD PTR .Lswitch_table_89[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_89:
+  .long .Lswitch_case_89_1 - .Lswitch_table_89
+  .long .Lswitch_case_89_2 - .Lswitch_table_89
+  .long .Lswitch_case_89_3 - .Lswitch_table_89
+  .long .Lswitch_case_89_4 - .Lswitch_table_89
+  .long .Lswitch_case_89_5 - .Lswitch_table_89
+  .long .Lswitch_case_89_6 - .Lswitch_table_89
+  .long .Lswitch_case_89_7 - .Lswitch_table_89
+  .long .Lswitch_case_89_8 - .Lswitch_table_89
+  .long .Lswitch_case_89_9 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_case_89_11 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_default_89 - .Lswitch_table_89
+  .long .Lswitch_case_89_14 - .Lswitch_table_89
+  .long .Lswitch_case_89_15 - .Lswitch_table_89
+  .long .Lswitch_case_89_16 - .Lswitch_table_89
+  .long .Lswitch_case_89_17 - .Lswitch_table_89
+  .long .Lswitch_case_89_18 - .Lswitch_table_89
+  .long .Lswitch_case_89_19 - .Lswitch_table_89
+.previous
+.Lswitch_case_89_19:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 128
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_1:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_2:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_11:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  sete al
+  movzx rax, al
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_3:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  imul rax, rdi
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_4:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_5:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cqo
+  idiv rdi
+  mov rax, rdx
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_17:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sal eax, cl
+  movsx rax, eax
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_18:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  mov rax, rdi
+  sar eax, cl
+  movsx rax, eax
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_8:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setl al
+  movzx rax, al
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_9:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setle al
+  movzx rax, al
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_6:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  sete al
+  movzx rax, al
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_7:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  setne al
+  movzx rax, al
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_14:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  and rax, rdi
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_15:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_case_89_16:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  xor rax, rdi
+  jmp .Lreturn_evalIfCondNodes
+.Lswitch_default_89:
+  mov rcx, 649
+  lea rax, QWORD PTR .LiteralString111[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend89:
+.Lreturn_evalIfCondNodes:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+evalIfCondition:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -24[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 26
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR preproc[rip]
+  add rax, 8192
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call preprocess
+  lea rax, QWORD PTR preproc[rip]
+  add rax, 8192
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfCondConditional
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondNodes
+  test rax, rax
+  je .Lcond_falsy_90
+  mov rax, 1
+  jmp .Lcond_end_90
+.Lcond_falsy_90:
+  mov rax, 0
+.Lcond_end_90:
+  mov rdi, rax
+  lea rax, QWORD PTR -36[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -36[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_evalIfCondition
+.Lreturn_evalIfCondition:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfDirective:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 176
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -64[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov QWORD PTR 48[rdi], 0
+  lea rdi, QWORD PTR -104[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  mov QWORD PTR 32[rdi], 0
+  lea rdi, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -128[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Llogicaland92
+  mov rsi, 8
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenCertainType
+  test rax, rax
+  jne .Lend91
+.Llogicaland92:
+  mov rcx, 708
+  lea rax, QWORD PTR .LiteralString112[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend91:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor183
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false183
+.Llogicalor183:
+  mov rax, 1
+  jmp .Llogical_end183
+.Llogical_false183:
+  mov rax, 0
+.Llogical_end183:
+  test rax, rax
+  je .Lend93
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend93:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call skipLine
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -140[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -140[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -144[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -144[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  .p2align 4
+.Lbegin94:
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse95_0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor184
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false184
+.Llogicalor184:
+  mov rax, 1
+  jmp .Llogical_end184
+.Llogical_false184:
+  mov rax, 0
+.Llogical_end184:
+  test rax, rax
+  jne .Lelse95_0
+  mov rsi, 8
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenCertainType
+  test rax, rax
+  je .Lelse97_0
+  lea rax, QWORD PTR -140[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend97
+.Lelse97_0:
+  lea rax, QWORD PTR -140[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse97_1
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lelse97_1
+  lea rax, QWORD PTR -144[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse99_0
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend99
+.Lelse99_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor185
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false185
+.Llogicalor185:
+  mov rax, 1
+  jmp .Llogical_end185
+.Llogical_false185:
+  mov rax, 0
+.Llogical_end185:
+  test rax, rax
+  je .Lend99
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend99
+.Lend99:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call skipLine
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator94
+  jmp .Lend97
+.Lelse97_1:
+  lea rax, QWORD PTR -140[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse97_2
+  mov rsi, 10
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenCertainType
+  test rax, rax
+  je .Lelse97_2
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor186
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false186
+.Llogicalor186:
+  mov rax, 1
+  jmp .Llogical_end186
+.Llogical_false186:
+  mov rax, 0
+.Llogical_end186:
+  test rax, rax
+  jne .Lend101
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend101:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -144[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Literator94
+  jmp .Lend97
+.Lelse97_2:
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lend97
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor187
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false187
+.Llogicalor187:
+  mov rax, 1
+  jmp .Llogical_end187
+.Llogical_false187:
+  mov rax, 0
+.Llogical_end187:
+  test rax, rax
+  jne .Lend102
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend102:
+  lea rax, QWORD PTR -140[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lelse103_0
+  lea rax, QWORD PTR -140[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend103
+.Lelse103_0:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend94
+  jmp .Lend103
+.Lend103:
+  jmp .Lend97
+.Lend97:
+  jmp .Lend95
+.Lelse95_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lend95
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend95
+.Lend95:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call skipLine
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator94:
+  jmp .Lbegin94
+.Lend94:
+  lea rax, QWORD PTR -64[rbp]
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondition
+  test rax, rax
+  je .Lelse104_0
+  lea rax, QWORD PTR -128[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  jmp .Lend104
+.Lelse104_0:
+  lea rdi, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend105
+  .p2align 4
+.Lbegin105:
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, 0
+  cmp rax, rdi
+  je .Llogicalor107
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rdi, rax
+  mov al, 0
+  call evalIfCondition
+  test rax, rax
+  je .Lend106
+.Llogicalor107:
+  lea rax, QWORD PTR -128[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  jmp .Lend105
+.Lend106:
+.Literator105:
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin105
+.Lend105:
+  jmp .Lend104
+.Lend104:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend108
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend108
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call insertTokens
+.Lend108:
+  lea rdi, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend110
+  .p2align 4
+.Lbegin110:
+  lea rdi, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -144[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin111:
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend112
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call free
+  mov rdi, 0
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend112:
+.Literator111:
+.Lend111:
+.Literator110:
+  lea rax, QWORD PTR -144[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin110
+.Lend110:
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseIfDirective
+.Lreturn_parseIfDirective:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseIfdefDirective:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 80
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -32[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lelse113_0
+  mov rcx, 808
+  lea rax, QWORD PTR .LiteralString113[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend113
+.Lelse113_0:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Llogicaland114
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  jne .Lend113
+.Llogicaland114:
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  jne .Lend113
+  mov rcx, 811
+  lea rax, QWORD PTR .LiteralString114[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+  jmp .Lend113
+.Lend113:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenAnyIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lelse116_0
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend116
+.Lelse116_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor188
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false188
+.Llogicalor188:
+  mov rax, 1
+  jmp .Llogical_end188
+.Llogical_false188:
+  mov rax, 0
+.Llogical_end188:
+  test rax, rax
+  jne .Lend116
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend116
+.Lend116:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call insertToken
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call insertToken
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call insertToken
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call insertToken
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend117
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call insertToken
+.Lend117:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call insertToken
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfDirective
+  jmp .Lreturn_parseIfdefDirective
+.Lreturn_parseIfdefDirective:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+applyBuiltinDefinedMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  jne .Lelse118_0
+  mov rax, 0
+  jmp .Lreturn_applyBuiltinDefinedMacro
+  jmp .Lend118
+.Lelse118_0:
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lelse118_1
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend118
+.Lelse118_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenAnyIdent
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  cmp rax, rdi
+  jne .Lelse118_2
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend118
+.Lelse118_2:
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend118
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend118
+.Lend118:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  mov rdi, 3
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findMacro
+  mov rdi, 0
+  cmp rax, rdi
+  setne al
+  movzx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_applyBuiltinDefinedMacro
+.Lreturn_applyBuiltinDefinedMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+applyPredefinedMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov rcx, 8
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Lelse119_0
+  mov rdi, 3
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenLine
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend119
+.Lelse119_0:
+  mov rcx, 8
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Lelse119_1
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenFile
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 21
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend119
+.Lelse119_1:
+  mov rax, 0
+  jmp .Lreturn_applyPredefinedMacro
+  jmp .Lend119
+.Lend119:
+  mov rax, 1
+  jmp .Lreturn_applyPredefinedMacro
+.Lreturn_applyPredefinedMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+stringifyTokens:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov QWORD PTR -24[rbp], rdx
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend120
+  .p2align 4
+.Lbegin120:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_121_3
+  cmp rax, 21
+  je .Lswitch_case_121_15
+  jmp .Lswitch_default_121
+.Lswitch_case_121_15:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend122
+  .p2align 4
+.Lbegin122:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov rdi, rax
+  mov al, 0
+  call strchr
+  test rax, rax
+  je .Lend123
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend123:
+.Literator122:
+  lea rax, QWORD PTR -60[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin122
+.Lend122:
+  jmp .Lend121
+.Lswitch_case_121_3:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 39
+  jne .Lelse124_0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 3
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lelse125_0
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 2[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lend126
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend126:
+  jmp .Lend125
+.Lelse125_0:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 34
+  jne .Lend125
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend125
+.Lend125:
+  jmp .Lend124
+.Lelse124_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend124
+.Lend124:
+  jmp .Lend121
+.Lswitch_default_121:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend121
+.Lend121:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isSpace
+  test rax, rax
+  jne .Llogicalor129
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 47
+  jne .Lend127
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov al, 0
+  call strchr
+  test rax, rax
+  je .Lend127
+.Llogicalor129:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend127:
+.Literator120:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lbegin120
+.Lend120:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isSpace
+  test rax, rax
+  jne .Lend130
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 47
+  jne .Llogicaland131
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov al, 0
+  call strchr
+  test rax, rax
+  jne .Lend130
+.Llogicaland131:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend130:
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend133
+  .p2align 4
+.Lbegin133:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Lswitch_case_134_3
+  cmp rax, 21
+  je .Lswitch_case_134_15
+  jmp .Lswitch_default_134
+.Lswitch_case_134_15:
+.Lswitch_case_134_3:
+  lea rdi, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -60[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend135
+  .p2align 4
+.Lbegin135:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rdi, rax
+  mov al, 0
+  call strchr
+  test rax, rax
+  je .Lend136
+  mov rcx, 92
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+.Lend136:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rcx, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+.Literator135:
+  lea rax, QWORD PTR -60[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -60[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin135
+.Lend135:
+  jmp .Lend134
+.Lswitch_default_134:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend134
+.Lend134:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isSpace
+  test rax, rax
+  jne .Llogicalor139
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 47
+  jne .Lend137
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rdi, rax
+  mov al, 0
+  call strchr
+  test rax, rax
+  je .Lend137
+.Llogicalor139:
+  mov rcx, 32
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+.Lend137:
+.Literator133:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lbegin133
+.Lend133:
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov BYTE PTR 0[rsi+rax*1], dil
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_stringifyTokens
+.Lreturn_stringifyTokens:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+replaceMacroArgs:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 96
+  mov QWORD PTR -96[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov QWORD PTR -24[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend140
+  .p2align 4
+.Lbegin140:
+  lea rdi, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -80[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend141
+  .p2align 4
+.Lbegin141:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenAtom
+  mov rdi, rax
+  mov rax, rbx
+  cmp rax, rdi
+  jne .Lend142
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend141
+.Lend142:
+.Literator141:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin141
+.Lend141:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend143
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator140
+.Lend143:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 1
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call matchToken
+  test rax, rax
+  je .Lelse144_0
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rcx, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call stringifyTokens
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, rdi
+  movdqu xmm0, XMMWORD PTR 0[rsi]
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 16[rsi]
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu xmm0, XMMWORD PTR 32[rsi]
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  mov rdi, 21
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend144
+.Lelse144_0:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneTokenList
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend145
+  .p2align 4
+.Lbegin145:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator145:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin145
+.Lend145:
+  jmp .Lend144
+.Lend144:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call insertTokens
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator140:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lbegin140
+.Lend140:
+.Lreturn_replaceMacroArgs:
+  mov rbx, QWORD PTR -96[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+parseMacroArguments:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 112
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  mov QWORD PTR -24[rbp], rdx
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -64[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  lea rdi, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -64[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend146
+  mov rcx, 1025
+  lea rax, QWORD PTR .LiteralString115[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString106[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend146:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend147
+  lea rax, QWORD PTR .LiteralString89[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend147:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend148
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  jne .Lend149
+  lea rax, QWORD PTR .LiteralString91[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend149:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, 0
+  jmp .Lreturn_parseMacroArguments
+.Lend148:
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend150
+  .p2align 4
+.Lbegin150:
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 32
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR .LiteralString92[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend151
+  lea rax, QWORD PTR .LiteralString93[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend151:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin152:
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse153_0
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse153_0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend152
+  jmp .Lend153
+.Lelse153_0:
+  lea rax, QWORD PTR .LiteralString94[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse153_1
+  lea rax, QWORD PTR -92[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend153
+.Lelse153_1:
+  lea rax, QWORD PTR .LiteralString95[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse153_2
+  lea rax, QWORD PTR -92[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  sub eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jge .Lend155
+  lea rax, QWORD PTR .LiteralString96[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Lend155:
+  jmp .Lend153
+.Lelse153_2:
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lelse153_3
+  lea rax, QWORD PTR .LiteralString97[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse153_3
+  lea rax, QWORD PTR .LiteralString98[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend153
+.Lelse153_3:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lelse153_4
+  lea rax, QWORD PTR .LiteralString99[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+  jmp .Lend153
+.Lelse153_4:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend153
+.Lend153:
+.Literator152:
+  jmp .Lbegin152
+.Lend152:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator150:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin150
+.Lend150:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_parseMacroArguments
+.Lreturn_parseMacroArguments:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+applyMacro:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 128
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -56[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rdi, QWORD PTR -72[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findMacro
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend157
+  mov rax, 0
+  jmp .Lreturn_applyMacro
+.Lend157:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -56[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor189
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false189
+.Llogicalor189:
+  mov rax, 1
+  jmp .Llogical_end189
+.Llogical_false189:
+  mov rax, 0
+.Llogical_end189:
+  test rax, rax
+  jne .Lend158
+  jmp .Lcond159
+  .p2align 4
+.Lbegin159:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator159:
+.Lcond159:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor190
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false190
+.Llogicalor190:
+  mov rax, 1
+  jmp .Llogical_end190
+.Llogical_false190:
+  mov rax, 0
+.Llogical_end190:
+  test rax, rax
+  je .Lbegin159
+.Lend159:
+.Lend158:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend160
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor191
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false191
+.Llogicalor191:
+  mov rax, 1
+  jmp .Llogical_end191
+.Llogical_false191:
+  mov rax, 0
+.Llogical_end191:
+  test rax, rax
+  jne .Lend161
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneTokenList
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend162
+  .p2align 4
+.Lbegin162:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend163
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend163:
+.Literator162:
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin162
+.Lend162:
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call insertTokens
+.Lend161:
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_applyMacro
+.Lend160:
+  lea rax, QWORD PTR -48[rbp]
+  mov rcx, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call parseMacroArguments
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor192
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false192
+.Llogicalor192:
+  mov rax, 1
+  jmp .Llogical_end192
+.Llogical_false192:
+  mov rax, 0
+.Llogical_end192:
+  test rax, rax
+  jne .Lelse164_0
+  lea rdi, QWORD PTR -88[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 26
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call cloneTokenList
+  mov rdi, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend165
+  .p2align 4
+.Lbegin165:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend166
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -64[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend166:
+.Literator165:
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -96[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin165
+.Lend165:
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -72[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call replaceMacroArgs
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call insertTokens
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend164
+.Lelse164_0:
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -40[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -48[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -56[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  jmp .Lend164
+.Lend164:
+  lea rax, QWORD PTR -40[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_applyMacro
+.Lreturn_applyMacro:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl preprocess
+preprocess:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  jmp .Lcond167
+  .p2align 4
+.Lbegin167:
+  lea rax, QWORD PTR .LiteralString100[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenReserved
+  test rax, rax
+  je .Lelse169_0
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Llogicalor193
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Llogical_false193
+.Llogicalor193:
+  mov rax, 1
+  jmp .Llogical_end193
+.Llogical_false193:
+  mov rax, 0
+.Llogical_end193:
+  test rax, rax
+  je .Lelse170_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call popTokenRange
+  jmp .Lend170
+.Lelse170_0:
+  lea rax, QWORD PTR .LiteralString101[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lelse170_1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseDefineDirective
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend170
+.Lelse170_1:
+  lea rax, QWORD PTR .LiteralString102[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lelse170_2
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseUndefDirective
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend170
+.Lelse170_2:
+  lea rax, QWORD PTR .LiteralString103[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lelse170_3
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIncludeDirective
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend170
+.Lelse170_3:
+  lea rax, QWORD PTR .LiteralString104[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lelse170_4
+  mov rsi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfdefDirective
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend170
+.Lelse170_4:
+  lea rax, QWORD PTR .LiteralString105[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenIdent
+  test rax, rax
+  je .Lelse170_5
+  mov rsi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfdefDirective
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend170
+.Lelse170_5:
+  mov rsi, 8
+  lea rax, QWORD PTR -8[rbp]
+  mov rdi, rax
+  mov al, 0
+  call consumeTokenCertainType
+  test rax, rax
+  je .Lend170
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call parseIfDirective
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend170
+.Lend170:
+  jmp .Lend169
+.Lelse169_0:
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR preproc[rip]
+  add rax, 8192
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend171
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call applyBuiltinDefinedMacro
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend172
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator167
+.Lend172:
+.Lend171:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call applyMacro
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lelse173_0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend173
+.Lelse173_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call applyPredefinedMacro
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lend173
+.Lend173:
+  jmp .Lend169
+.Lend169:
+.Literator167:
+.Lcond167:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland168
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  jne .Lbegin167
+.Llogicaland168:
+.Lend167:
+.Lreturn_preprocess:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "#"
+.LiteralString2:
+  .string  "define"
+.LiteralString3:
+  .string  "Macro name expected."
+.LiteralString4:
+  .string  "defined"
+.LiteralString5:
+  .string  "Cannot define macro named \"defined\""
+.LiteralString6:
+  .string  "Redefinition of macro."
+.LiteralString7:
+  .string  "("
+.LiteralString8:
+  .string  "("
+.LiteralString9:
+  .string  ")"
+.LiteralString10:
+  .string  "An identifier is expected."
+.LiteralString11:
+  .string  ")"
+.LiteralString12:
+  .string  ","
+.LiteralString13:
+  .string  "',' or ')' is expected."
+.LiteralString14:
+  .string  "#"
+.LiteralString15:
+  .string  "undef"
+.LiteralString16:
+  .string  "Macro name expected."
+.LiteralString17:
+  .string  "Undefined macro."
+.LiteralString18:
+  .string  "#"
+.LiteralString19:
+  .string  "include"
+.LiteralString20:
+  .string  "<"
+.LiteralString21:
+  .string  "%s%s"
+.LiteralString22:
+  .string  "<"
+.LiteralString23:
+  .string  ">"
+.LiteralString24:
+  .string  "Missing file name."
+.LiteralString25:
+  .string  "Unexpected EOF."
+.LiteralString26:
+  .string  "\"#include <FILENAME>\" directive not terminated."
+.LiteralString27:
+  .string  "%s%s"
+.LiteralString28:
+  .string  "Must be <FILENAME> or \"FILENAME\"."
+.LiteralString29:
+  .string  "("
+.LiteralString30:
+  .string  ")"
+.LiteralString31:
+  .string  "\")\" is expected."
+.LiteralString32:
+  .string  "Unexpected token."
+.LiteralString33:
+  .string  "+"
+.LiteralString34:
+  .string  "-"
+.LiteralString35:
+  .string  "!"
+.LiteralString36:
+  .string  "*"
+.LiteralString37:
+  .string  "/"
+.LiteralString38:
+  .string  "%"
+.LiteralString39:
+  .string  "+"
+.LiteralString40:
+  .string  "-"
+.LiteralString41:
+  .string  "<<"
+.LiteralString42:
+  .string  ">>"
+.LiteralString43:
+  .string  "<"
+.LiteralString44:
+  .string  "<="
+.LiteralString45:
+  .string  ">"
+.LiteralString46:
+  .string  ">="
+.LiteralString47:
+  .string  "=="
+.LiteralString48:
+  .string  "!="
+.LiteralString49:
+  .string  "&"
+.LiteralString50:
+  .string  "|"
+.LiteralString51:
+  .string  "^"
+.LiteralString52:
+  .string  "&&"
+.LiteralString53:
+  .string  "||"
+.LiteralString54:
+  .string  "?"
+.LiteralString55:
+  .string  ":"
+.LiteralString56:
+  .string  "\":\" is expected"
+.LiteralString57:
+  .string  "#"
+.LiteralString58:
+  .string  "An expression is expected."
+.LiteralString59:
+  .string  "#"
+.LiteralString60:
+  .string  "elif"
+.LiteralString61:
+  .string  "#elif after #else."
+.LiteralString62:
+  .string  "An expression is expected."
+.LiteralString63:
+  .string  "Unexpected token."
+.LiteralString64:
+  .string  "endif"
+.LiteralString65:
+  .string  "Unexpected token."
+.LiteralString66:
+  .string  "Unexpected EOF"
+.LiteralString67:
+  .string  "#"
+.LiteralString68:
+  .string  "ifndef"
+.LiteralString69:
+  .string  "ifdef"
+.LiteralString70:
+  .string  "Macro name required after \"#ifdef\"."
+.LiteralString71:
+  .string  "Unexpected token"
+.LiteralString72:
+  .string  "defined"
+.LiteralString73:
+  .string  ")"
+.LiteralString74:
+  .string  "("
+.LiteralString75:
+  .string  "!"
+.LiteralString76:
+  .string  "defined"
+.LiteralString77:
+  .string  "("
+.LiteralString78:
+  .string  "\"(\" is expected."
+.LiteralString79:
+  .string  "A identifier is expected."
+.LiteralString80:
+  .string  ")"
+.LiteralString81:
+  .string  "\")\" is expected."
+.LiteralString82:
+  .string  "__LINE__"
+.LiteralString83:
+  .string  "__FILE__"
+.LiteralString84:
+  .string  "*/"
+.LiteralString85:
+  .string  "\"\\"
+.LiteralString86:
+  .string  "\"\\"
+.LiteralString87:
+  .string  "#"
+.LiteralString88:
+  .string  "("
+.LiteralString89:
+  .string  "'(' is expected."
+.LiteralString90:
+  .string  ")"
+.LiteralString91:
+  .string  "')' is expected."
+.LiteralString92:
+  .string  ","
+.LiteralString93:
+  .string  ")"
+.LiteralString94:
+  .string  "("
+.LiteralString95:
+  .string  ")"
+.LiteralString96:
+  .string  "Unmatched ')'."
+.LiteralString97:
+  .string  ","
+.LiteralString98:
+  .string  "Too many arguments for function-like macro."
+.LiteralString99:
+  .string  "Unexpected EOF."
+.LiteralString100:
+  .string  "#"
+.LiteralString101:
+  .string  "define"
+.LiteralString102:
+  .string  "undef"
+.LiteralString103:
+  .string  "include"
+.LiteralString104:
+  .string  "ifdef"
+.LiteralString105:
+  .string  "ifndef"
+.LiteralString106:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString107:
+  .string  "%d:%d: Internal error: assert: %s"
+.LiteralString108:
+  .string  "preproc.c"
+.LiteralString109:
+  .string  "preproc.c"
+.LiteralString110:
+  .string  "preproc.c"
+.LiteralString111:
+  .string  "preproc.c"
+.LiteralString112:
+  .string  "preproc.c"
+.LiteralString113:
+  .string  "preproc.c"
+.LiteralString114:
+  .string  "preproc.c"
+.LiteralString115:
+  .string  "preproc.c"
+preproc:
+  .zero 8200
@@ -0,0 +1,6965 @@
+.intel_syntax noprefix
+.section .text.startup,"ax",@progbits
+.globl isSpace
+isSpace:
+  mov r10, rdi
+  movsx rax, r10b
+  cmp rax, 32
+  je .Llogicalor1
+  movsx rax, r10b
+  cmp rax, 10
+  je .Llogicalor1
+  movsx rax, r10b
+  cmp rax, 9
+  jne .Llogical_false1
+.Llogicalor1:
+  mov rax, 1
+  jmp .Llogical_end1
+.Llogical_false1:
+  mov rax, 0
+.Llogical_end1:
+  jmp .Lreturn_isSpace
+.Lreturn_isSpace:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isDigit:
+  mov r10, rdi
+  movsx rax, r10b
+  sub al, 48
+  movsx rax, al
+  mov rdi, rax
+  mov r10b, dil
+  mov rax, rdi
+  movsx rax, r10b
+  test rax, rax
+  jl .Llogical_false2
+  movsx rax, r10b
+  cmp rax, 9
+  jg .Llogical_false2
+  mov rax, 1
+  jmp .Llogical_end2
+.Llogical_false2:
+  mov rax, 0
+.Llogical_end2:
+  jmp .Lreturn_isDigit
+.Lreturn_isDigit:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isHexDigit:
+  mov r10, rdi
+  movsx rax, r10b
+  mov rdi, rax
+  lea rax, QWORD PTR -10[rsp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -10[rsp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 48
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -10[rsp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -10[rsp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jl .Llogical_false159
+  lea rax, QWORD PTR -10[rsp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 9
+  jg .Llogical_false159
+  mov rax, 1
+  jmp .Llogical_end159
+.Llogical_false159:
+  mov rax, 0
+.Llogical_end159:
+  test rax, rax
+  jne .Llogicalor6
+  movsx rax, r10b
+  cmp rax, 97
+  jl .Llogicaland3
+  movsx rax, r10b
+  cmp rax, 102
+  jle .Llogicalor6
+.Llogicaland3:
+  movsx rax, r10b
+  cmp rax, 65
+  jl .Llogical_false6
+  movsx rax, r10b
+  cmp rax, 70
+  jg .Llogical_false6
+.Llogicalor6:
+  mov rax, 1
+  jmp .Llogical_end6
+.Llogical_false6:
+  mov rax, 0
+.Llogical_end6:
+  jmp .Lreturn_isHexDigit
+.Lreturn_isHexDigit:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isAlnum:
+  mov r10, rdi
+  movsx rax, r10b
+  cmp rax, 97
+  jl .Llogicaland8
+  movsx rax, r10b
+  cmp rax, 122
+  jle .Llogicalor13
+.Llogicaland8:
+  movsx rax, r10b
+  cmp rax, 65
+  jl .Llogicaland9
+  movsx rax, r10b
+  cmp rax, 90
+  jle .Llogicalor13
+.Llogicaland9:
+  movsx rax, r10b
+  cmp rax, 48
+  jl .Llogicaland11
+  movsx rax, r10b
+  cmp rax, 57
+  jle .Llogicalor13
+.Llogicaland11:
+  movsx rax, r10b
+  cmp rax, 95
+  jne .Lend7
+.Llogicalor13:
+  mov rax, 1
+  jmp .Lreturn_isAlnum
+.Lend7:
+  mov rax, 0
+  jmp .Lreturn_isAlnum
+.Lreturn_isAlnum:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+hasPrefix:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  jmp .Lreturn_hasPrefix
+.Lreturn_hasPrefix:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isToken:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov QWORD PTR -40[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Llogical_false14
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rbx
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isAlnum
+  test rax, rax
+  jne .Llogical_false14
+  mov rax, 1
+  jmp .Llogical_end14
+.Llogical_false14:
+  mov rax, 0
+.Llogical_end14:
+  jmp .Lreturn_isToken
+.Lreturn_isToken:
+  mov rbx, QWORD PTR -40[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+spanBlanks:
+  mov r10, rdi
+  lea rdi, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rdi], 0
+  mov rax, r10
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond15
+  .p2align 4
+.Lbegin15:
+  lea rax, QWORD PTR -24[rsp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator15:
+.Lcond15:
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 32
+  je .Lbegin15
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 9
+  je .Lbegin15
+.Lend15:
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  mov rax, r10
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  jmp .Lreturn_spanBlanks
+.Lreturn_spanBlanks:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+spanIdent:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isAlnum
+  test rax, rax
+  je .Lend17
+  .p2align 4
+.Lbegin17:
+  lea rax, QWORD PTR -16[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator17:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isAlnum
+  test rax, rax
+  jne .Lbegin17
+.Lend17:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  jmp .Lreturn_spanIdent
+.Lreturn_spanIdent:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findChars:
+  mov QWORD PTR -16[rsp], rdi
+  mov r10, rsi
+  mov r11, rdx
+  mov r8, rcx
+  jmp .Lcond18
+  .p2align 4
+.Lbegin18:
+  lea rax, QWORD PTR -16[rsp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator18:
+.Lcond18:
+  lea rax, QWORD PTR -16[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Llogicaland21
+  lea rax, QWORD PTR -16[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  movsx rax, r10b
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Llogicaland21
+  lea rax, QWORD PTR -16[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  movsx rax, r11b
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Llogicaland21
+  lea rax, QWORD PTR -16[rsp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  movsx rax, r8b
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lbegin18
+.Llogicaland21:
+.Lend18:
+  lea rax, QWORD PTR -16[rsp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_findChars
+.Lreturn_findChars:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl checkEscapeChar
+checkEscapeChar:
+  mov r10, rdi
+  mov r11, rsi
+  lea rdi, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rsp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 12
+  jge .Lend22
+  .p2align 4
+.Lbegin22:
+  movsx rax, r10b
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*2]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend23
+  lea rax, QWORD PTR .StaticVar0[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*2]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, r11
+  mov BYTE PTR 0[rax], dil
+  mov rax, 1
+  jmp .Lreturn_checkEscapeChar
+.Lend23:
+.Literator22:
+  lea rax, QWORD PTR -24[rsp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rsp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 12
+  jl .Lbegin22
+.Lend22:
+  movsx rax, r10b
+  mov rdi, rax
+  mov rax, r11
+  mov BYTE PTR 0[rax], dil
+  mov rax, 0
+  jmp .Lreturn_checkEscapeChar
+.Lreturn_checkEscapeChar:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl internAtom
+internAtom:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  lea rdi, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend24
+  .p2align 4
+.Lbegin24:
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  sal rax, 5
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rdi, rax
+  mov rax, rcx
+  add eax, edi
+  movsx rax, eax
+  and rax, 8191
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator24:
+  lea rax, QWORD PTR -28[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin24
+.Lend24:
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend25
+  .p2align 4
+.Lbegin25:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend26
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcmp
+  test rax, rax
+  jne .Lend26
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_internAtom
+.Lend26:
+.Literator25:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin25
+.Lend25:
+  mov rdi, 40
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar2[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov rax, QWORD PTR 0[rsi+rax*8]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar1[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov QWORD PTR 0[rsi+rax*8], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_internAtom
+.Lreturn_internAtom:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+registerKeyword:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov DWORD PTR -12[rbp], esi
+  mov DWORD PTR -16[rbp], edx
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_registerKeyword:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+registerKeywords:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -24[rbp], rbx
+  lea rax, QWORD PTR .LiteralString1[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString2[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString3[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString4[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 22
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString5[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 23
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString6[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 24
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString7[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 4
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString8[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 5
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString9[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 6
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString10[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 7
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString11[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 8
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString12[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString13[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 11
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString14[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 12
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString15[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 13
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString16[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 14
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString17[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 15
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString18[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 16
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString19[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 17
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString20[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 18
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString21[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 19
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .LiteralString22[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 20
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rbx, 1
+  mov rsi, 9
+  lea rax, QWORD PTR .LiteralString23[rip]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  add rax, 36
+  mov rdi, rbx
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rbx, 1
+  mov rsi, 5
+  lea rax, QWORD PTR .LiteralString24[rip]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  add rax, 36
+  mov rdi, rbx
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lreturn_registerKeywords:
+  mov rbx, QWORD PTR -24[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl newToken
+newToken:
+  push rbp
+  mov rbp, rsp
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 4096
+  jne .Lend28
+  mov rdi, 196608
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend28:
+  lea rax, QWORD PTR .StaticVar3[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .StaticVar4[rip]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rcx, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rcx
+  mov rdi, rsi
+  mov rsi, 48
+  imul rax, rsi
+  add rax, rdi
+  jmp .Lreturn_newToken
+.Lreturn_newToken:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tokenAtom
+tokenAtom:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 3
+  je .Llogicalor30
+  mov rax, r10
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Lend29
+.Llogicalor30:
+  mov rax, 0
+  jmp .Lreturn_tokenAtom
+.Lend29:
+  mov rax, r10
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_tokenAtom
+.Lreturn_tokenAtom:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tokenFile
+tokenFile:
+  mov r10, rdi
+  lea rdi, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR lastSource[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond31
+  .p2align 4
+.Lbegin31:
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator31:
+.Lcond31:
+  mov rax, r10
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Llogicaland32
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin31
+.Llogicaland32:
+.Lend31:
+  lea rax, QWORD PTR -24[rsp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_tokenFile
+.Lreturn_tokenFile:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+buildLineIndex:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 1
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Lend33
+  .p2align 4
+.Lbegin33:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lend34
+  lea rax, QWORD PTR -12[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+.Lend34:
+.Literator33:
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lbegin33
+.Lend33:
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 2
+  mov rdi, rax
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Lend35
+  .p2align 4
+.Lbegin35:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lend36
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  add eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov r8, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, r8
+  mov rdi, rcx
+  mov DWORD PTR 0[rsi+rax*4], edi
+  mov rax, rdi
+.Lend36:
+.Literator35:
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lbegin35
+.Lend35:
+.Lreturn_buildLineIndex:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+findLineIndex:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenFile
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend37
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call buildLineIndex
+.Lend37:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 64
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jge .Lend38
+  .p2align 4
+.Lbegin38:
+  lea rdi, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  sar rdi, 63
+  and rdi, 1
+  add rax, rdi
+  sar rax, 1
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -20[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jg .Lelse39_0
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend39
+.Lelse39_0:
+  lea rax, QWORD PTR -32[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend39
+.Lend39:
+.Literator38:
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -28[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jl .Lbegin38
+.Lend38:
+  lea rax, QWORD PTR -24[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  jmp .Lreturn_findLineIndex
+.Lreturn_findLineIndex:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tokenLine
+tokenLine:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findLineIndex
+  add eax, 1
+  movsx rax, eax
+  jmp .Lreturn_tokenLine
+.Lreturn_tokenLine:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tokenColumn
+tokenColumn:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  lea rdi, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call findLineIndex
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call tokenFile
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  sub eax, edi
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -12[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rdi
+  mov eax, DWORD PTR 0[rsi+rax*4]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rcx
+  sub eax, edi
+  movsx rax, eax
+  jmp .Lreturn_tokenColumn
+.Lreturn_tokenColumn:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+isSplittable:
+  mov r10, rdi
+  mov rax, r10
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  je .Llogicalor40
+  mov rax, r10
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Llogical_false40
+.Llogicalor40:
+  mov rax, 1
+  jmp .Llogical_end40
+.Llogical_false40:
+  mov rax, 0
+.Llogical_end40:
+  test rax, rax
+  sete al
+  movzx rax, al
+  jmp .Lreturn_isSplittable
+.Lreturn_isSplittable:
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+skipContinuations:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  jmp .Lcond41
+  .p2align 4
+.Lbegin41:
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memmove
+  mov rdi, 92
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 1[rax], dil
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator41:
+.Lcond41:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Llogicaland42
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 10
+  je .Lbegin41
+.Llogicaland42:
+.Lend41:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_skipContinuations
+.Lreturn_skipContinuations:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl popTokenRange
+popTokenRange:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Llogicaland44
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend43
+.Llogicaland44:
+  mov rcx, 323
+  lea rax, QWORD PTR .LiteralString90[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString88[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call error
+.Lend43:
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -32[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lreturn_popTokenRange:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl printToken
+printToken:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend45
+  lea rax, QWORD PTR .LiteralString25[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lreturn_printToken
+.Lend45:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 26
+  ja .Lend46
+  lea rdi, QWORD PTR .Lswitch_table_46[rip]
+  sal rax, 2
+  add rax, rdi
+  movsx rax, DWORD PTR 0[rax]
+  add rax, rdi
+  jmp rax
+.section .rodata
+  .align 4
+.Lswitch_table_46:
+  .long .Lswitch_case_46_0 - .Lswitch_table_46
+  .long .Lswitch_case_46_1 - .Lswitch_table_46
+  .long .Lswitch_case_46_2 - .Lswitch_table_46
+  .long .Lswitch_case_46_3 - .Lswitch_table_46
+  .long .Lswitch_case_46_4 - .Lswitch_table_46
+  .long .Lswitch_case_46_5 - .Lswitch_table_46
+  .long .Lswitch_case_46_6 - .Lswitch_table_46
+  .long .Lswitch_case_46_7 - .Lswitch_table_46
+  .long .Lswitch_case_46_8 - .Lswitch_table_46
+  .long .Lswitch_case_46_9 - .Lswitch_table_46
+  .long .Lswitch_case_46_a - .Lswitch_table_46
+  .long .Lswitch_case_46_b - .Lswitch_table_46
+  .long .Lswitch_case_46_c - .Lswitch_table_46
+  .long .Lswitch_case_46_d - .Lswitch_table_46
+  .long .Lswitch_case_46_e - .Lswitch_table_46
+  .long .Lswitch_case_46_f - .Lswitch_table_46
+  .long .Lswitch_case_46_10 - .Lswitch_table_46
+  .long .Lswitch_case_46_11 - .Lswitch_table_46
+  .long .Lswitch_case_46_12 - .Lswitch_table_46
+  .long .Lswitch_case_46_13 - .Lswitch_table_46
+  .long .Lswitch_case_46_14 - .Lswitch_table_46
+  .long .Lswitch_case_46_15 - .Lswitch_table_46
+  .long .Lswitch_case_46_16 - .Lswitch_table_46
+  .long .Lswitch_case_46_17 - .Lswitch_table_46
+  .long .Lswitch_case_46_18 - .Lswitch_table_46
+  .long .Lswitch_case_46_19 - .Lswitch_table_46
+  .long .Lswitch_case_46_1a - .Lswitch_table_46
+.previous
+.Lswitch_case_46_0:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString26[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  jmp .Lend46
+.Lswitch_case_46_1:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString27[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  jmp .Lend46
+.Lswitch_case_46_2:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString28[rip]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call printf
+  jmp .Lend46
+.Lswitch_case_46_3:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString29[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  jmp .Lend46
+.Lswitch_case_46_4:
+  lea rax, QWORD PTR .LiteralString30[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_5:
+  lea rax, QWORD PTR .LiteralString31[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_6:
+  lea rax, QWORD PTR .LiteralString32[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_7:
+  lea rax, QWORD PTR .LiteralString33[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_8:
+  lea rax, QWORD PTR .LiteralString34[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_9:
+  lea rax, QWORD PTR .LiteralString35[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_a:
+  lea rax, QWORD PTR .LiteralString36[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_b:
+  lea rax, QWORD PTR .LiteralString37[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_c:
+  lea rax, QWORD PTR .LiteralString38[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_d:
+  lea rax, QWORD PTR .LiteralString39[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_e:
+  lea rax, QWORD PTR .LiteralString40[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_f:
+  lea rax, QWORD PTR .LiteralString41[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_10:
+  lea rax, QWORD PTR .LiteralString42[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_11:
+  lea rax, QWORD PTR .LiteralString43[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_12:
+  lea rax, QWORD PTR .LiteralString44[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_13:
+  lea rax, QWORD PTR .LiteralString45[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_14:
+  lea rax, QWORD PTR .LiteralString46[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_15:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString47[rip]
+  mov rdi, rax
+  mov al, 0
+  call printf
+  jmp .Lend46
+.Lswitch_case_46_16:
+  lea rax, QWORD PTR .LiteralString48[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_17:
+  lea rax, QWORD PTR .LiteralString49[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_18:
+  lea rax, QWORD PTR .LiteralString50[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_19:
+  lea rax, QWORD PTR .LiteralString51[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lswitch_case_46_1a:
+  lea rax, QWORD PTR .LiteralString52[rip]
+  mov rdi, rax
+  mov al, 0
+  call puts
+  jmp .Lend46
+.Lend46:
+.Lreturn_printToken:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl printTokenList
+printTokenList:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov QWORD PTR -8[rbp], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend47
+  .p2align 4
+.Lbegin47:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call printToken
+.Literator47:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lbegin47
+.Lend47:
+.Lreturn_printTokenList:
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+.section .text.startup,"ax",@progbits
+.globl tokenize
+tokenize:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 448
+  mov QWORD PTR -440[rbp], rbx
+  mov QWORD PTR -8[rbp], rdi
+  mov QWORD PTR -16[rbp], rsi
+  lea rdi, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -72[rbp]
+  pxor xmm0, xmm0
+  movdqu XMMWORD PTR 0[rdi], xmm0
+  movdqu XMMWORD PTR 16[rdi], xmm0
+  movdqu XMMWORD PTR 32[rdi], xmm0
+  lea rdi, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -72[rbp]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR .StaticVar5[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  jne .Lend48
+  mov al, 0
+  call registerKeywords
+  mov rdi, 1
+  lea rax, QWORD PTR .StaticVar5[rip]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend48:
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 56
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR nextSourceBase[rip]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR lastSource[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend49
+  lea rax, QWORD PTR lastSource[rip]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 48
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend49:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR lastSource[rip]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin50:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 25
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator50:
+.Lend50:
+  mov rdi, 1
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Lend51
+  .p2align 4
+.Lbegin51:
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  je .Lend52
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  je .Lend52
+  lea rax, QWORD PTR -92[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend52:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lend54
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lend54
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  cmp rax, rdi
+  jne .Lend56
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 25
+  je .Llogicalor160
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 21
+  jne .Llogical_false160
+.Llogicalor160:
+  mov rax, 1
+  jmp .Llogical_end160
+.Llogical_false160:
+  mov rax, 0
+.Llogical_end160:
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend56
+  lea rdi, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -88[rbp]
+  mov rax, QWORD PTR 0[rax]
+  test rax, rax
+  jne .Lend58
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -92[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Lend58:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memmove
+  mov rdi, 92
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 1[rax], dil
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Lend56:
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator51
+.Lend54:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lend59
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov rdi, 1
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Literator51
+.Lend59:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isSpace
+  test rax, rax
+  je .Lend60
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call spanBlanks
+  mov rdi, rbx
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator51
+.Lend60:
+  lea rax, QWORD PTR .LiteralString53[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend61
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin62:
+  mov rcx, 42
+  mov r8, 42
+  mov rsi, 42
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call findChars
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lelse63_0
+  .p2align 4
+.Lbegin64:
+  .p2align 4
+.Lbegin65:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator65:
+.Lend65:
+  lea rax, QWORD PTR .LiteralString54[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator64:
+.Lend64:
+  jmp .Lend63
+.Lelse63_0:
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 47
+  jne .Lelse63_1
+  jmp .Lend62
+  jmp .Lend63
+.Lelse63_1:
+  lea rax, QWORD PTR -104[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  jmp .Lend63
+.Lend63:
+.Literator62:
+  jmp .Lbegin62
+.Lend62:
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator51
+.Lend61:
+  lea rax, QWORD PTR .LiteralString55[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend66
+  mov rdi, 0
+  lea rax, QWORD PTR -88[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 10
+  mov r8, 10
+  mov rsi, 10
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call findChars
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond67
+  .p2align 4
+.Lbegin67:
+  mov rcx, 10
+  mov r8, 10
+  mov rsi, 10
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call findChars
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+.Literator67:
+.Lcond67:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Llogicaland68
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR -1[rax]
+  movsx rax, al
+  cmp rax, 92
+  je .Lbegin67
+.Llogicaland68:
+.Lend67:
+  jmp .Literator51
+.Lend66:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 97
+  jl .Llogicaland70
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 122
+  jle .Llogicalor73
+.Llogicaland70:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 65
+  jl .Llogicaland71
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 90
+  jle .Llogicalor73
+.Llogicaland71:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 95
+  jne .Lend69
+.Llogicalor73:
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call spanIdent
+  mov rdi, rbx
+  lea rax, QWORD PTR 0[rdi+rax*1]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call internAtom
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  test rax, rax
+  je .Lend74
+  jmp .Literator51
+.Lend74:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  cmp rax, 10
+  jne .Lend75
+  lea rdi, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -120[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond76
+  .p2align 4
+.Lbegin76:
+  lea rax, QWORD PTR -120[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator76:
+.Lcond76:
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Llogicaland77
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isSpace
+  test rax, rax
+  jne .Lbegin76
+.Llogicaland77:
+.Lend76:
+  lea rax, QWORD PTR .LiteralString56[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Llogical_false161
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rbx, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rsi, rbx
+  mov al, BYTE PTR 0[rsi+rax*1]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call isAlnum
+  test rax, rax
+  jne .Llogical_false161
+  mov rax, 1
+  jmp .Llogical_end161
+.Llogical_false161:
+  mov rax, 0
+.Llogical_end161:
+  test rax, rax
+  je .Lend78
+  lea rax, QWORD PTR -120[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin79:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 9
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator79:
+.Lend79:
+  jmp .Literator51
+.Lend78:
+.Lend75:
+  .p2align 4
+.Lbegin80:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 28
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator80:
+.Lend80:
+  lea rax, QWORD PTR -112[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator51
+.Lend69:
+  lea rax, QWORD PTR .LiteralString57[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor83
+  lea rax, QWORD PTR .LiteralString58[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor83
+  lea rax, QWORD PTR .LiteralString59[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend81
+.Llogicalor83:
+  .p2align 4
+.Lbegin84:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator84:
+.Lend84:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 3
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator51
+.Lend81:
+  lea rax, QWORD PTR .LiteralString60[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -152[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -160[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString61[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -168[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -176[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString62[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -184[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -192[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString63[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -200[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -208[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString64[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -216[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -224[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString65[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -232[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -240[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString66[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -248[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -256[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString67[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -264[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -272[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString68[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -280[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -288[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString69[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -296[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -304[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString70[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -320[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -312[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -320[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString71[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -328[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -336[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -328[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -328[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -336[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString72[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -344[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -352[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -344[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -344[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -352[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString73[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -360[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -368[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -360[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -360[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -368[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString74[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -376[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -384[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -376[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -376[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -384[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString75[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -392[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -400[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -392[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -392[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -400[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString76[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -408[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -416[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -408[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -408[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -416[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  jne .Llogicalor102
+  lea rax, QWORD PTR .LiteralString77[rip]
+  mov rdi, rax
+  lea rax, QWORD PTR -424[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -432[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -424[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call strlen
+  mov rcx, rax
+  lea rax, QWORD PTR -424[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -432[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strncmp
+  test rax, rax
+  sete al
+  movzx rax, al
+  test rax, rax
+  je .Lend85
+.Llogicalor102:
+  .p2align 4
+.Lbegin103:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 2
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator103:
+.Lend103:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Literator51
+.Lend85:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rsi, rax
+  lea rax, QWORD PTR .LiteralString78[rip]
+  mov rdi, rax
+  mov al, 0
+  call strchr
+  test rax, rax
+  je .Lend104
+  .p2align 4
+.Lbegin105:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 1
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator105:
+.Lend105:
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  jmp .Literator51
+.Lend104:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -138[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -138[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 48
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -138[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -138[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jl .Llogical_false162
+  lea rax, QWORD PTR -138[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 9
+  jg .Llogical_false162
+  mov rax, 1
+  jmp .Llogical_end162
+.Llogical_false162:
+  mov rax, 0
+.Llogical_end162:
+  test rax, rax
+  je .Lend106
+  .p2align 4
+.Lbegin107:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator107:
+.Lend107:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 48
+  jne .Lelse108_0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 120
+  je .Llogicalor109
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 88
+  jne .Lelse108_0
+.Llogicalor109:
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  jmp .Lcond111
+  .p2align 4
+.Lbegin111:
+  lea rdi, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -141[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -141[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 48
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -141[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -141[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jl .Llogical_false168
+  lea rax, QWORD PTR -141[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 9
+  jg .Llogical_false168
+  mov rax, 1
+  jmp .Llogical_end168
+.Llogical_false168:
+  mov rax, 0
+.Llogical_end168:
+  test rax, rax
+  je .Lelse113_0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 48
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend113
+.Lelse113_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 97
+  jl .Lelse113_1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 102
+  jg .Lelse113_1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 97
+  movsx rax, al
+  add al, 10
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend113
+.Lelse113_1:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 65
+  movsx rax, al
+  add al, 10
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend113
+.Lend113:
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal eax, 4
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator111:
+.Lcond111:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Llogicaland112
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -139[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -139[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -140[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -140[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 48
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -140[rbp]
+  mov BYTE PTR 0[rax], dil
+  lea rax, QWORD PTR -140[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jl .Llogical_false167
+  lea rax, QWORD PTR -140[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 9
+  jg .Llogical_false167
+  mov rax, 1
+  jmp .Llogical_end167
+.Llogical_false167:
+  mov rax, 0
+.Llogical_end167:
+  test rax, rax
+  jne .Llogicalor166
+  lea rax, QWORD PTR -139[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 97
+  jl .Llogicaland163
+  lea rax, QWORD PTR -139[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 102
+  jle .Llogicalor166
+.Llogicaland163:
+  lea rax, QWORD PTR -139[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 65
+  jl .Llogical_false166
+  lea rax, QWORD PTR -139[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 70
+  jg .Llogical_false166
+.Llogicalor166:
+  mov rax, 1
+  jmp .Llogical_end166
+.Llogical_false166:
+  mov rax, 0
+.Llogical_end166:
+  test rax, rax
+  jne .Lbegin111
+.Llogicaland112:
+.Lend111:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  cmp rax, 2
+  jg .Lend115
+  .p2align 4
+.Lbegin116:
+  .p2align 4
+.Lbegin117:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator117:
+.Lend117:
+  lea rax, QWORD PTR .LiteralString79[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator116:
+.Lend116:
+.Lend115:
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lelse108_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 48
+  jne .Lelse108_1
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rdi, rsi
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lcond118
+  .p2align 4
+.Lbegin118:
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal eax, 3
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  sub al, 48
+  movsx rax, al
+  movsx rax, eax
+  mov rdi, rax
+  mov rax, rsi
+  or rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+.Literator118:
+.Lcond118:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Llogicaland120
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 48
+  jl .Llogicaland120
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 55
+  jle .Lbegin118
+.Llogicaland120:
+.Lend118:
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lelse108_1:
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rcx, 10
+  lea rax, QWORD PTR -24[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call strtol
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  jmp .Lend108
+.Lend108:
+  jmp .Literator51
+.Lend106:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 39
+  jne .Lend121
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rdi, rax
+  mov al, 0
+  call skipContinuations
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lelse122_0
+  .p2align 4
+.Lbegin123:
+  .p2align 4
+.Lbegin124:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator124:
+.Lend124:
+  lea rax, QWORD PTR .LiteralString80[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator123:
+.Lend123:
+  jmp .Lend122
+.Lelse122_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 39
+  jne .Lelse122_1
+  .p2align 4
+.Lbegin125:
+  .p2align 4
+.Lbegin126:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator126:
+.Lend126:
+  lea rax, QWORD PTR .LiteralString81[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator125:
+.Lend125:
+  jmp .Lend122
+.Lelse122_1:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lelse122_2
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rdi, rax
+  mov al, 0
+  call skipContinuations
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -109[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call checkEscapeChar
+  test rax, rax
+  jne .Lend127
+  .p2align 4
+.Lbegin128:
+  .p2align 4
+.Lbegin129:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 1
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 1
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator129:
+.Lend129:
+  lea rax, QWORD PTR .LiteralString82[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator128:
+.Lend128:
+.Lend127:
+  jmp .Lend122
+.Lelse122_2:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -109[rbp]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  jmp .Lend122
+.Lend122:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rdi, rax
+  mov al, 0
+  call skipContinuations
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 39
+  je .Lend130
+  .p2align 4
+.Lbegin131:
+  .p2align 4
+.Lbegin132:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator132:
+.Lend132:
+  lea rax, QWORD PTR .LiteralString83[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator131:
+.Lend131:
+.Lend130:
+  .p2align 4
+.Lbegin133:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 3
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator133:
+.Lend133:
+  lea rax, QWORD PTR -109[rbp]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  jmp .Literator51
+.Lend121:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 34
+  jne .Lend134
+  lea rdi, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rdi, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -116[rbp]
+  mov DWORD PTR 0[rdi], 0
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -116[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rdi, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rdi, 0
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Lend135
+  .p2align 4
+.Lbegin135:
+  lea rdi, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rdi], 0
+  mov rcx, 10
+  mov r8, 92
+  mov rsi, 34
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, r8
+  mov al, 0
+  call findChars
+  mov rdi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -112[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -112[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -136[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  je .Llogicalor137
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lend136
+.Llogicalor137:
+  jmp .Lend135
+.Lend136:
+  lea rax, QWORD PTR -112[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 34
+  jne .Lelse138_0
+  jmp .Lend135
+  jmp .Lend138
+.Lelse138_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lelse138_1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 1[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lelse138_1
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  mov rcx, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memmove
+  mov rdi, 92
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 0[rax], dil
+  mov rax, rdi
+  mov rdi, 10
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov BYTE PTR 1[rax], dil
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 2
+  mov rdi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR -112[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend138
+.Lelse138_1:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 92
+  jne .Lend138
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lelse140_0
+  lea rax, QWORD PTR -108[rbp]
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rsi, rax
+  mov DWORD PTR 0[rdi], eax
+  mov rax, rsi
+  jmp .Lend135
+  jmp .Lend140
+.Lelse140_0:
+  lea rax, QWORD PTR -137[rbp]
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  mov rdi, rax
+  mov al, 0
+  call checkEscapeChar
+  test rax, rax
+  jne .Lend140
+  .p2align 4
+.Lbegin141:
+  .p2align 4
+.Lbegin142:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 1
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 1
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator142:
+.Lend142:
+  lea rax, QWORD PTR .LiteralString84[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator141:
+.Lend141:
+  jmp .Lend140
+.Lend140:
+  jmp .Lend138
+.Lend138:
+.Literator135:
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lbegin135
+.Lend135:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  cmp rax, 10
+  jne .Lelse143_0
+  .p2align 4
+.Lbegin144:
+  .p2align 4
+.Lbegin145:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator145:
+.Lend145:
+  lea rax, QWORD PTR .LiteralString85[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator144:
+.Lend144:
+  jmp .Lend143
+.Lelse143_0:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lend143
+  .p2align 4
+.Lbegin146:
+  .p2align 4
+.Lbegin147:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 1
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  sub rax, 1
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator147:
+.Lend147:
+  lea rax, QWORD PTR .LiteralString86[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator146:
+.Lend146:
+  jmp .Lend143
+.Lend143:
+  mov rdi, 24
+  mov al, 0
+  call safeAlloc
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 124
+  mov rdi, rax
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  add eax, 1
+  movsx rax, eax
+  mov DWORD PTR 0[rdi], eax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 20
+  mov rdi, rsi
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -112[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sal rax, 0
+  mov rdi, rax
+  mov al, 0
+  call malloc
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov rcx, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 1
+  mov rsi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rdx, rcx
+  mov al, 0
+  call memcpy
+  mov rdi, 0
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -108[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  sub eax, 1
+  movsx rax, eax
+  mov BYTE PTR 0[rsi+rax*1], dil
+  mov rax, rdi
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR globals[rip]
+  add rax, 96
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  .p2align 4
+.Lbegin148:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 21
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rsi
+  sub rax, rdi
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -104[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator148:
+.Lend148:
+  lea rax, QWORD PTR -128[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 24
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -116[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rdi, rax
+  mov rax, QWORD PTR 0[rax]
+  mov rsi, rax
+  add rax, 1
+  mov QWORD PTR 0[rdi], rax
+  mov rax, rsi
+  jmp .Literator51
+.Lend134:
+  .p2align 4
+.Lbegin149:
+  .p2align 4
+.Lbegin150:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator150:
+.Lend150:
+  lea rax, QWORD PTR .LiteralString87[rip]
+  mov rsi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov al, 0
+  call errorAt
+.Literator149:
+.Lend149:
+.Literator51:
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov al, BYTE PTR 0[rax]
+  movsx rax, al
+  test rax, rax
+  jne .Lbegin51
+.Lend51:
+  .p2align 4
+.Lbegin151:
+  mov al, 0
+  call newToken
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov QWORD PTR 0[rax], rdi
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 8
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 26
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 32
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 16
+  mov QWORD PTR 0[rax], rdi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 36
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -96[rbp]
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR -80[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 44
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+  mov rdi, 0
+  lea rax, QWORD PTR -96[rbp]
+  mov DWORD PTR 0[rax], edi
+  mov rax, rdi
+.Literator151:
+.Lend151:
+  lea rax, QWORD PTR -16[rbp]
+  mov rax, QWORD PTR 0[rax]
+  add rax, 40
+  mov eax, DWORD PTR 0[rax]
+  movsx rax, eax
+  mov rsi, rax
+  lea rax, QWORD PTR -24[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rcx, rax
+  lea rax, QWORD PTR -8[rbp]
+  mov rax, QWORD PTR 0[rax]
+  mov rdi, rax
+  mov rax, rcx
+  sub rax, rdi
+  mov rdi, rax
+  mov rax, rsi
+  add eax, edi
+  movsx rax, eax
+  add eax, 1
+  movsx rax, eax
+  mov rdi, rax
+  lea rax, QWORD PTR nextSourceBase[rip]
+  mov DWORD PTR 0[rax], edi
+  lea rax, QWORD PTR -64[rbp]
+  mov rax, QWORD PTR 0[rax]
+  jmp .Lreturn_tokenize
+.Lreturn_tokenize:
+  mov rbx, QWORD PTR -440[rbp]
+  mov rsp, rbp
+  pop rbp
+  ret
+.section .note.GNU-stack,"",@progbits
+
+.data
+.LiteralString0:
+  .string  "mimicc.h"
+.LiteralString1:
+  .string  "void"
+.LiteralString2:
+  .string  "int"
+.LiteralString3:
+  .string  "char"
+.LiteralString4:
+  .string  "struct"
+.LiteralString5:
+  .string  "union"
+.LiteralString6:
+  .string  "enum"
+.LiteralString7:
+  .string  "static"
+.LiteralString8:
+  .string  "extern"
+.LiteralString9:
+  .string  "typedef"
+.LiteralString10:
+  .string  "inline"
+.LiteralString11:
+  .string  "if"
+.LiteralString12:
+  .string  "else"
+.LiteralString13:
+  .string  "switch"
+.LiteralString14:
+  .string  "case"
+.LiteralString15:
+  .string  "default"
+.LiteralString16:
+  .string  "for"
+.LiteralString17:
+  .string  "while"
+.LiteralString18:
+  .string  "do"
+.LiteralString19:
+  .string  "break"
+.LiteralString20:
+  .string  "continue"
+.LiteralString21:
+  .string  "return"
+.LiteralString22:
+  .string  "sizeof"
+.LiteralString23:
+  .string  "_Noreturn"
+.LiteralString24:
+  .string  "const"
+.LiteralString25:
+  .string  "(NULL)"
+.LiteralString26:
+  .string  "RESERVED: %.*s\n"
+.LiteralString27:
+  .string  "TYPENAME: %.*s\n"
+.LiteralString28:
+  .string  "IDENT   : %.*s\n"
+.LiteralString29:
+  .string  "NUMBER  : %d\n"
+.LiteralString30:
+  .string  "static"
+.LiteralString31:
+  .string  "extern"
+.LiteralString32:
+  .string  "typedef"
+.LiteralString33:
+  .string  "inline"
+.LiteralString34:
+  .string  "if"
+.LiteralString35:
+  .string  "else-if"
+.LiteralString36:
+  .string  "else"
+.LiteralString37:
+  .string  "switch"
+.LiteralString38:
+  .string  "case"
+.LiteralString39:
+  .string  "default"
+.LiteralString40:
+  .string  "for"
+.LiteralString41:
+  .string  "while"
+.LiteralString42:
+  .string  "do"
+.LiteralString43:
+  .string  "break"
+.LiteralString44:
+  .string  "continue"
+.LiteralString45:
+  .string  "return"
+.LiteralString46:
+  .string  "sizeof"
+.LiteralString47:
+  .string  "STRING  : %s\n"
+.LiteralString48:
+  .string  "struct"
+.LiteralString49:
+  .string  "union"
+.LiteralString50:
+  .string  "enum"
+.LiteralString51:
+  .string  "===START OF FILE==="
+.LiteralString52:
+  .string  "===END OF FILE==="
+.LiteralString53:
+  .string  "/*"
+.LiteralString54:
+  .string  "Unterminated comment"
+.LiteralString55:
+  .string  "//"
+.LiteralString56:
+  .string  "if"
+.LiteralString57:
+  .string  "<<="
+.LiteralString58:
+  .string  ">>="
+.LiteralString59:
+  .string  "..."
+.LiteralString60:
+  .string  "=="
+.LiteralString61:
+  .string  "!="
+.LiteralString62:
+  .string  ">="
+.LiteralString63:
+  .string  "<="
+.LiteralString64:
+  .string  "+="
+.LiteralString65:
+  .string  "-="
+.LiteralString66:
+  .string  "*="
+.LiteralString67:
+  .string  "/="
+.LiteralString68:
+  .string  "&="
+.LiteralString69:
+  .string  "|="
+.LiteralString70:
+  .string  "^="
+.LiteralString71:
+  .string  "++"
+.LiteralString72:
+  .string  "--"
+.LiteralString73:
+  .string  "&&"
+.LiteralString74:
+  .string  "||"
+.LiteralString75:
+  .string  "<<"
+.LiteralString76:
+  .string  ">>"
+.LiteralString77:
+  .string  "->"
+.LiteralString78:
+  .string  "!+-*/%()=;[]<>{},&^|.?:#"
+.LiteralString79:
+  .string  "Invalid hex number token."
+.LiteralString80:
+  .string  "Character literal is not terminated."
+.LiteralString81:
+  .string  "Empty character literal."
+.LiteralString82:
+  .string  "Invalid escape character."
+.LiteralString83:
+  .string  "Character literal is too long."
+.LiteralString84:
+  .string  "Invalid escape character."
+.LiteralString85:
+  .string  "String is not terminated."
+.LiteralString86:
+  .string  "String is not terminated."
+.LiteralString87:
+  .string  "Cannot tokenize"
+.LiteralString88:
+  .string  "%s:%d: Internal error: unreachable"
+.LiteralString89:
+  .string  "%d:%d: Internal error: assert: %s"
+.LiteralString90:
+  .string  "tokenizer.c"
+nextSourceBase:
+  .long 0
+lastSource:
+  .quad 0
+.StaticVar5:
+  .long 0
+.StaticVar4:
+  .long 4096
+.StaticVar3:
+  .quad 0
+.StaticVar2:
+  .zero 4
+.StaticVar1:
+  .zero 65536
+.StaticVar0:
+  .byte 39
+  .byte 39
+  .byte 34
+  .byte 34
+  .byte 92
+  .byte 92
+  .byte 63
+  .byte 63
+  .byte 97
+  .byte 7
+  .byte 98
+  .byte 8
+  .byte 102
+  .byte 12
+  .byte 110
+  .byte 10
+  .byte 114
+  .byte 13
+  .byte 116
+  .byte 9
+  .byte 118
+  .byte 11
+  .byte 48
+  .byte 0
@@ -226,6 +226,32 @@ void test_struct_assign_to_member_from_ptr(void) {
     ASSERT(13, b.a.m);
 }
 
+void test_struct_assign_large(void) {
+    struct Medium {
+        int n[9];
+        char c;
+    } m1, m2;
+    struct Large {
+        char s[300];
+        int tail;
+    } l1, l2;
+    for (int i = 0; i < 9; ++i)
+        m1.n[i] = i * 3;
+    m1.c = 'm';
+    for (int i = 0; i < 300; ++i)
+        l1.s[i] = i % 100;
+    l1.tail = 4242;
+    m2 = m1;
+    l2 = l1;
+    ASSERT(0, m2.n[0]);
+    ASSERT(24, m2.n[8]);
+    ASSERT('m', m2.c);
+    ASSERT(0, l2.s[0]);
+    ASSERT(99, l2.s[299]);
+    ASSERT(55, l2.s[155]);
+    ASSERT(4242, l2.tail);
+}
+
 int main(void) {
     test_decl_global_struct_var();
     test_decl_local_struct_var();
@@ -237,5 +263,6 @@ int main(void) {
     test_compare_struct_pointers();
     testUseStructImmediately();
     test_struct_assign_to_member_from_ptr();
+    test_struct_assign_large();
     return 0;
 }
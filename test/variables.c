@@ -453,6 +453,53 @@ void testSubBetweenPointers(void) {
     }
 }
 
+void testIndexedAccess(void) {
+    typedef struct {
+        int a, b, c;
+    } S;
+    char c[4] = {1, 2, 3, 4};
+    int n[4] = {10, 20, 30, 40};
+    int m[2][3] = {{1, 2, 3}, {4, 5, 6}};
+    int *p = &n[2];
+    int *ps[2];
+    S s[2];
+    int i = 1;
+
+    ASSERT(2, c[i]);
+    ASSERT(20, n[i]);
+    ASSERT(20, *(i + n));
+    ASSERT(40, n[i + 2]);
+    ASSERT(20, p[-i]);
+    ASSERT(40, *(p + i));
+    ASSERT(6, m[i][i + 1]);
+    ps[i] = p;
+    ASSERT(30, *ps[i]);
+    ASSERT(40, ps[i][i]);
+    c[i] = 100;
+    n[i + 1] = 33;
+    p[-2 * i] = 11;
+    ASSERT(100, c[1]);
+    ASSERT(33, n[2]);
+    ASSERT(11, n[0]);
+    s[i].b = 7;
+    ASSERT(7, s[1].b);
+    ASSERT(12, (char *)&s[i] - (char *)&s[0]);
+}
+
+void testLongTokens(void) {
+    int a_rather_long_variable_name_0 = 1;
+    int a_rather_long_variable_name_1 = 2;
+    char s[] = "0123456789abcdef\"0123456789\\abcdef*/";
+
+    /* A comment which is long enough to span more than one chunk ** / * */
+    ASSERT(1, a_rather_long_variable_name_0);
+    ASSERT(2, a_rather_long_variable_name_1); // Another long comment here.
+    ASSERT(37, sizeof(s));
+    ASSERT('"', s[16]);
+    ASSERT('\\', s[27]);
+    ASSERT('/', s[35]);
+}
+
 int main(void) {
     test_local_variables();
     test_increment_or_decrement_array_element();
@@ -463,5 +510,7 @@ int main(void) {
     test_extern_variable();
     testDeclArray();
     testSubBetweenPointers();
+    testIndexedAccess();
+    testLongTokens();
     return 0;
 }
@@ -2,6 +2,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+// Fast paths of the tokenizer scan 16 bytes at once with SSE2.  They are only
+// built when the host compiler provides SSE2 intrinsics, and may read up to
+// 16 bytes past the terminating NUL of the source; readFile() pads buffers
+// for this.  They are off unless "-ffast-lex" is given: most tokens are
+// shorter than 16 bytes, and with the -O0 build of mimicc the setup of each
+// scan costs more than the scalar loops.
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 int isSpace(char c) { return c == ' ' || c == '\n' || c == '\t'; }
 
 static int isDigit(char c) {
@@ -28,6 +38,79 @@ static int isToken(char *p, char *op) {
     return hasPrefix(p, op) && !isAlnum(p[strlen(op)]);
 }
 
+#ifdef __SSE2__
+// Return mask of bytes in `v` which are in range [lo, hi].  Both must be
+// ASCII characters.
+static __m128i matchRange(__m128i v, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+            _mm_cmplt_epi8(v, _mm_set1_epi8(hi + 1)));
+}
+
+static int load16Mask(const char *p, char c1, char c2, char c3) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    __m128i m = _mm_cmpeq_epi8(v, _mm_set1_epi8(c1));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(c2)));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(c3)));
+    return _mm_movemask_epi8(m);
+}
+
+static int identMask(const char *p) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    __m128i m = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    m = _mm_or_si128(m, matchRange(v, 'a', 'z'));
+    m = _mm_or_si128(m, matchRange(v, 'A', 'Z'));
+    m = _mm_or_si128(m, matchRange(v, '0', '9'));
+    return _mm_movemask_epi8(m);
+}
+#endif
+
+// Return the number of spaces and tabs at the head of `p`.
+static int spanBlanks(const char *p) {
+    const char *q = p;
+#ifdef __SSE2__
+    if (globals.fastLexing) {
+        int mask;
+        while ((mask = load16Mask(q, ' ', '\t', ' ')) == 0xffff)
+            q += 16;
+        return q - p + __builtin_ctz(mask ^ 0xffff);
+    }
+#endif
+    while (*q == ' ' || *q == '\t')
+        ++q;
+    return q - p;
+}
+
+// Return the number of identifier characters at the head of `p`.
+static int spanIdent(const char *p) {
+    const char *q = p;
+#ifdef __SSE2__
+    if (globals.fastLexing) {
+        int mask;
+        while ((mask = identMask(q)) == 0xffff)
+            q += 16;
+        return q - p + __builtin_ctz(mask ^ 0xffff);
+    }
+#endif
+    while (isAlnum(*q))
+        ++q;
+    return q - p;
+}
+
+// Return the pointer to the first one of `c1`, `c2`, `c3` or NUL in `p`.
+static char *findChars(char *p, char c1, char c2, char c3) {
+#ifdef __SSE2__
+    if (globals.fastLexing) {
+        int mask;
+        while ((mask = load16Mask(p, c1, c2, c3) | load16Mask(p, '\0', '\0', '\0')) == 0)
+            p += 16;
+        return p + __builtin_ctz(mask);
+    }
+#endif
+    while (*p && *p != c1 && *p != c2 && *p != c3)
+        ++p;
+    return p;
+}
+
 // Check character after backslash builds an escape character.
 // If so, set the escape character to *decoded and returns TRUE.
 int checkEscapeChar(char c, char *decoded) {
@@ -55,6 +138,182 @@ int checkEscapeChar(char c, char *decoded) {
     return 0;
 }
 
+#define ATOM_TABLE_SIZE (8192)
+
+// Return the atom spelled as [str, str+len), creating it when the spelling is
+// seen for the first time.
+Atom *internAtom(const char *str, int len) {
+    static Atom *atomTable[ATOM_TABLE_SIZE];
+    static int atomCount;
+    int hash = 0;
+    Atom *atom = NULL;
+
+    for (int i = 0; i < len; ++i)
+        hash = (hash * 31 + str[i]) & (ATOM_TABLE_SIZE - 1);
+
+    for (atom = atomTable[hash]; atom; atom = atom->next) {
+        if (atom->len == len && memcmp(atom->str, str, len) == 0)
+            return atom;
+    }
+
+    atom = (Atom *)safeAlloc(sizeof(Atom));
+    atom->str = str;
+    atom->len = len;
+    atom->id = atomCount++;
+    atom->keyword = TokenIdent;
+    atom->next = atomTable[hash];
+    atomTable[hash] = atom;
+    return atom;
+}
+
+static void registerKeyword(const char *name, TokenType type, TypeKind varType) {
+    Atom *atom = internAtom(name, strlen(name));
+    atom->keyword = type;
+    atom->varType = varType;
+}
+
+// Register keywords to the atom table so that tokenize() can classify a word
+// by interning it once.
+static void registerKeywords(void) {
+    registerKeyword("void", TokenTypeName, TypeVoid);
+    registerKeyword("int", TokenTypeName, TypeInt);
+    registerKeyword("char", TokenTypeName, TypeChar);
+    registerKeyword("struct", TokenStruct, TypeNone);
+    registerKeyword("union", TokenUnion, TypeNone);
+    registerKeyword("enum", TokenEnum, TypeNone);
+    registerKeyword("static", TokenStatic, TypeNone);
+    registerKeyword("extern", TokenExtern, TypeNone);
+    registerKeyword("typedef", TokenTypedef, TypeNone);
+    registerKeyword("inline", TokenInline, TypeNone);
+    registerKeyword("if", TokenIf, TypeNone);
+    registerKeyword("else", TokenElse, TypeNone);
+    registerKeyword("switch", TokenSwitch, TypeNone);
+    registerKeyword("case", TokenCase, TypeNone);
+    registerKeyword("default", TokenDefault, TypeNone);
+    registerKeyword("for", TokenFor, TypeNone);
+    registerKeyword("while", TokenWhile, TypeNone);
+    registerKeyword("do", TokenDo, TypeNone);
+    registerKeyword("break", TokenBreak, TypeNone);
+    registerKeyword("continue", TokenContinue, TypeNone);
+    registerKeyword("return", TokenReturn, TypeNone);
+    registerKeyword("sizeof", TokenSizeof, TypeNone);
+
+    // Just ignore them now.
+    // TODO: Create new token for "const"; Take into account when parsing.
+    internAtom("_Noreturn", 9)->isIgnored = 1;
+    internAtom("const", 5)->isIgnored = 1;
+}
+
+#define TOKEN_CHUNK_SIZE (4096)
+
+// Return a new token cleared with zeros.  Tokens are carved out of large
+// chunks instead of being allocated one by one, so tokens made in a row lie
+// next to each other in memory.  Tokens are never freed.
+Token *newToken(void) {
+    static Token *chunk = NULL;
+    static int chunkUsed = TOKEN_CHUNK_SIZE;
+
+    if (chunkUsed == TOKEN_CHUNK_SIZE) {
+        chunk = (Token *)safeAlloc(sizeof(Token) * TOKEN_CHUNK_SIZE);
+        chunkUsed = 0;
+    }
+    return &chunk[chunkUsed++];
+}
+
+// Return the atom of "token", or NULL if "token" is not an identifier nor a
+// keyword.
+Atom *tokenAtom(const Token *token) {
+    if (token->type == TokenNumber || token->type == TokenLiteralString)
+        return NULL;
+    return token->data.atom;
+}
+
+// Offsets of tokens are counted through all the sources as if they were one
+// text, in order of tokenization.  Files are chained from the last one, so the
+// file of a token is found from its offset.
+static FilePath *lastSource = NULL;
+static int nextSourceBase = 0;
+
+// Return the file "token" is made from.
+FilePath *tokenFile(const Token *token) {
+    FilePath *file = lastSource;
+    while (file->base > token->offset && file->prevSource)
+        file = file->prevSource;
+    return file;
+}
+
+// Build the table of offsets where each line of "file" begins.
+static void buildLineIndex(FilePath *file) {
+    int count = 1;
+
+    for (char *p = file->source; *p; ++p) {
+        if (*p == '\n')
+            count++;
+    }
+
+    file->lineHeads = (int *)safeAlloc(sizeof(int) * count);
+    file->lineHeads[0] = 0;
+    file->lineCount = 1;
+    for (char *p = file->source; *p; ++p) {
+        if (*p == '\n')
+            file->lineHeads[file->lineCount++] = p - file->source + 1;
+    }
+}
+
+// Return the index of the line where "token" is, counting from 0.
+static int findLineIndex(const Token *token) {
+    FilePath *file = tokenFile(token);
+    int offset = token->offset - file->base;
+    int lo = 0;
+    int hi = 0;
+
+    if (!file->lineHeads)
+        buildLineIndex(file);
+
+    hi = file->lineCount - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (file->lineHeads[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+// Return the line number of "token", counting from 1.
+int tokenLine(const Token *token) {
+    return findLineIndex(token) + 1;
+}
+
+// Return the column number of "token", counting from 0.
+int tokenColumn(const Token *token) {
+    int index = findLineIndex(token);
+    FilePath *file = tokenFile(token);
+    return token->offset - file->base - file->lineHeads[index];
+}
+
+// Return TRUE if `token` may continue after a line continuation which follows
+// it immediately.  String literals handle continuations inside by themselves,
+// and the start of file is not a token of the language.
+static int isSplittable(Token *token) {
+    return !(token->type == TokenSOF || token->type == TokenLiteralString);
+}
+
+// Skip line continuations at "p" inside a literal beginning at "*head".  The
+// literal read so far is moved onto them so that the token stays contiguous.
+static char *skipContinuations(char **head, char *p) {
+    while (p[0] == '\\' && p[1] == '\n') {
+        char *q = *head;
+        memmove(q + 2, q, p - q);
+        q[0] = '\\';
+        q[1] = '\n';
+        *head = q + 2;
+        p += 2;
+    }
+    return p;
+}
+
 // Remove tokens from "token" by range [begin, end].
 void popTokenRange(Token *begin, Token *end) {
     Token *prev = begin->prev;
@@ -67,20 +326,6 @@ void popTokenRange(Token *begin, Token *end) {
     next->prev = prev;
 }
 
-// Remove all tokens whose type is TokenNewLine from "token".
-void removeAllNewLineToken(Token *token) {
-    Token *cur = token;
-    while (cur->type != TokenEOF) {
-        if (cur->type == TokenNewLine) {
-            Token *next = cur->next;
-            popTokenRange(cur, cur);
-            cur = next;
-        } else {
-            cur = cur->next;
-        }
-    }
-}
-
 void printToken(Token *token) {
     if (!token) {
         puts("(NULL)");
@@ -98,7 +343,7 @@ void printToken(Token *token) {
         printf("IDENT   : %.*s\n", token->len, token->str);
         break;
     case TokenNumber:
-        printf("NUMBER  : %d\n", token->val);
+        printf("NUMBER  : %d\n", token->data.val);
         break;
     case TokenStatic:
         puts("static");
@@ -109,6 +354,9 @@ void printToken(Token *token) {
     case TokenTypedef:
         puts("typedef");
         break;
+    case TokenInline:
+        puts("inline");
+        break;
     case TokenIf:
         puts("if");
         break;
@@ -149,7 +397,7 @@ void printToken(Token *token) {
         puts("sizeof");
         break;
     case TokenLiteralString:
-        printf("STRING  : %s\n", token->literalStr->string);
+        printf("STRING  : %s\n", token->data.literalStr->string);
         break;
     case TokenStruct:
         puts("struct");
@@ -160,9 +408,6 @@ void printToken(Token *token) {
     case TokenEnum:
         puts("enum");
         break;
-    case TokenNewLine:
-        puts("NEWLINE");
-        break;
     case TokenSOF:
         puts("===START OF FILE===");
         break;
@@ -179,15 +424,15 @@ void printTokenList(Token *token) {
 
 #define appendNewToken(tokenType, string, length)                                        \
     do {                                                                                 \
-        current->next = (Token *)safeAlloc(sizeof(Token));                               \
+        current->next = newToken();                                                      \
         current->next->prev = current;                                                   \
         current = current->next;                                                         \
         current->type = tokenType;                                                       \
         current->str = string;                                                           \
         current->len = length;                                                           \
-        current->line = line;                                                            \
-        current->column = ((string) - lineHead);                                         \
-        current->file = file;                                                            \
+        current->offset = file->base + ((string) - source);                              \
+        current->atLineStart = atLineStart;                                              \
+        atLineStart = 0;                                                                 \
     } while (0)
 #define errorAtChar(pos, msg)                                                            \
     do {                                                                                 \
@@ -195,224 +440,121 @@ void printTokenList(Token *token) {
         errorAt(current, msg);                                                           \
     } while (0)
 Token *tokenize(char *source, FilePath *file) {
-    typedef struct List List;
-    struct List {
-        List *next;
-        char *p;
-    };
-
     char *p = source;
     Token head = {};
     Token *current = &head;
-    int line = 1;
-    char *lineHead = p;
-    List *erasedNewLine = NULL;
-
-    { // Remove line continuation ('\\' + '\n')
-        List erasedNewLineHead = {};
-        char *r, *w;
-
-        r = w = source;
-        erasedNewLine = &erasedNewLineHead;
-        while (*r != '\0') {
-            if (r[0] == '\\' && r[1] == '\n') {
-                r += 2;
-                erasedNewLine->next = (List *)safeAlloc(sizeof(List));
-                erasedNewLine = erasedNewLine->next;
-                erasedNewLine->p = r;
-            } else {
-                *w++ = *r++;
-            }
-        }
-        *w = '\0';
-        erasedNewLine = erasedNewLineHead.next;
+    Token *joinedBase = NULL; // Token before the one being joined.
+    int joinedOffset = 0;     // Offset of the token being joined.
+    int atLineStart = 0;      // TRUE until the first token of a line is made.
+    static int keywordsRegistered = 0;
+
+    if (!keywordsRegistered) {
+        registerKeywords();
+        keywordsRegistered = 1;
     }
 
+    file->source = source;
+    file->lineHeads = NULL;
+    file->base = nextSourceBase;
+    if (file != lastSource)
+        file->prevSource = lastSource;
+    lastSource = file;
+
     appendNewToken(TokenSOF, p, 0);
+    atLineStart = 1;
 
     while (*p) {
-        if (erasedNewLine && p >= erasedNewLine->p) {
-            List *tofree = erasedNewLine;
-            line++;
-            erasedNewLine = erasedNewLine->next;
-            safeFree(tofree);
+        if (joinedBase && current != joinedBase) {
+            // The token joined over line continuations is lexed again.  Give
+            // it the position where it began.
+            current->offset = joinedOffset;
+            joinedBase = NULL;
+        }
+
+        if (p[0] == '\\' && p[1] == '\n') {
+            // Line continuation.  When it splits the last token, move the head
+            // of the token onto the continuation so that it's contiguous with
+            // the rest, and lex the token again.
+            char *next = p + 2;
+            if (current->str + current->len == p && isSplittable(current)) {
+                char *q = current->str;
+                if (!joinedBase)
+                    joinedOffset = current->offset;
+                memmove(q + 2, q, p - q);
+                // Leave the line break in the source for line numbers.
+                q[0] = '\\';
+                q[1] = '\n';
+                next = q + 2;
+                atLineStart = current->atLineStart;
+                current = current->prev;
+                current->next = NULL;
+                joinedBase = current;
+            }
+            p = next;
+            continue;
         }
 
         if (*p == '\n') {
-            appendNewToken(TokenNewLine, p, 1);
             ++p;
-            ++line;
-            lineHead = p;
+            atLineStart = 1;
             continue;
         }
 
         if (isSpace(*p)) {
-            ++p;
+            p += spanBlanks(p);
             continue;
         }
 
         if (hasPrefix(p, "/*")) {
-            char *q = strstr(p + 2, "*/");
-            if (q == NULL)
-                errorAtChar(p, "Unterminated comment");
+            char *q = p + 2;
+            // What was joined over line continuations may be a comment; no
+            // token takes its position then.
+            joinedBase = NULL;
+            for (;;) {
+                q = findChars(q, '*', '*', '*');
+                if (*q == '\0') {
+                    errorAtChar(p, "Unterminated comment");
+                } else if (q[1] == '/') {
+                    break;
+                } else {
+                    ++q;
+                }
+            }
             p = q + 2;
             continue;
         }
 
         if (hasPrefix(p, "//")) {
-            p += 2;
-            while (*p != '\n' && *p != '\0')
-                ++p;
-            continue;
-        }
-
-        if (isToken(p, "_Noreturn")) {
-            // Just ignore it now.
-            p += 9;
-            continue;
-        }
-
-        if (isToken(p, "void")) {
-            appendNewToken(TokenTypeName, p, 4);
-            current->varType = TypeVoid;
-            p += 4;
-            continue;
-        }
-
-        if (isToken(p, "int")) {
-            appendNewToken(TokenTypeName, p, 3);
-            current->varType = TypeInt;
-            p += 3;
-            continue;
-        }
-
-        if (isToken(p, "char")) {
-            appendNewToken(TokenTypeName, p, 4);
-            current->varType = TypeChar;
-            p += 4;
-            continue;
-        }
-
-        if (isToken(p, "struct")) {
-            appendNewToken(TokenStruct, p, 6);
-            p += 6;
-            continue;
-        }
-
-        if (isToken(p, "union")) {
-            appendNewToken(TokenUnion, p, 5);
-            p += 5;
-            continue;
-        }
-
-        if (isToken(p, "enum")) {
-            appendNewToken(TokenEnum, p, 4);
-            p += 4;
-            continue;
-        }
-
-        if (isToken(p, "const")) {
-            // TODO: Create new token; Take into account when parsing.
-            p += 5;
+            joinedBase = NULL;
+            p = findChars(p + 2, '\n', '\n', '\n');
+            // Line continuation extends the comment to the next line.
+            while (*p == '\n' && p[-1] == '\\')
+                p = findChars(p + 1, '\n', '\n', '\n');
             continue;
         }
 
-        if (isToken(p, "static")) {
-            appendNewToken(TokenStatic, p, 6);
-            p += 6;
-            continue;
-        }
-
-        if (isToken(p, "extern")) {
-            appendNewToken(TokenExtern, p, 6);
-            p += 6;
-            continue;
-        }
-
-        if (isToken(p, "typedef")) {
-            appendNewToken(TokenTypedef, p, 7);
-            p += 7;
-            continue;
-        }
-
-        if (isToken(p, "if")) {
-            appendNewToken(TokenIf, p, 2);
-            p += 2;
-            continue;
-        }
-
-        if (isToken(p, "else")) {
-            char *q = p + 5;
-            while (*q && isSpace(*q))
-                ++q;
-            if (isToken(q, "if")) {
-                q += 2;
-                appendNewToken(TokenElseif, p, q - p);
-                p = q;
-            } else {
-                appendNewToken(TokenElse, p, 4);
-                p += 4;
+        if ('a' <= *p && *p <= 'z' || 'A' <= *p && *p <= 'Z' || *p == '_') {
+            char *q = p;
+            Atom *atom = NULL;
+            p += spanIdent(p);
+
+            atom = internAtom(q, p - q);
+            if (atom->isIgnored)
+                continue;
+
+            if (atom->keyword == TokenElse) {
+                char *r = p;
+                while (*r && isSpace(*r))
+                    ++r;
+                if (isToken(r, "if")) {
+                    p = r + 2;
+                    appendNewToken(TokenElseif, q, p - q);
+                    continue;
+                }
             }
-            continue;
-        }
 
-        if (isToken(p, "switch")) {
-            appendNewToken(TokenSwitch, p, 6);
-            p += 6;
-            continue;
-        }
-
-        if (isToken(p, "case")) {
-            appendNewToken(TokenCase, p, 4);
-            p += 4;
-            continue;
-        }
-
-        if (isToken(p, "default")) {
-            appendNewToken(TokenDefault, p, 7);
-            p += 7;
-            continue;
-        }
-
-        if (isToken(p, "for")) {
-            appendNewToken(TokenFor, p, 3);
-            p += 3;
-            continue;
-        }
-
-        if (isToken(p, "while")) {
-            appendNewToken(TokenWhile, p, 5);
-            p += 5;
-            continue;
-        }
-
-        if (isToken(p, "do")) {
-            appendNewToken(TokenDo, p, 2);
-            p += 2;
-            continue;
-        }
-
-        if (isToken(p, "break")) {
-            appendNewToken(TokenBreak, p, 5);
-            p += 5;
-            continue;
-        }
-
-        if (isToken(p, "continue")) {
-            appendNewToken(TokenContinue, p, 8);
-            p += 8;
-            continue;
-        }
-
-        if (isToken(p, "return")) {
-            appendNewToken(TokenReturn, p, 6);
-            p += 6;
-            continue;
-        }
-
-        if (isToken(p, "sizeof")) {
-            appendNewToken(TokenSizeof, p, 6);
-            p += 6;
+            appendNewToken(atom->keyword, q, p - q);
+            current->data.atom = atom;
             continue;
         }
 
@@ -457,7 +599,7 @@ Token *tokenize(char *source, FilePath *file) {
                 }
                 if (p - q <= 2)
                     errorAtChar(p, "Invalid hex number token.");
-                current->val = val;
+                current->data.val = val;
                 current->len = p - q;
             } else if (*p == '0') {
                 // Octal number or zero
@@ -469,12 +611,12 @@ Token *tokenize(char *source, FilePath *file) {
                     val = (val << 3) | (int)(*p - '0');
                     p++;
                 }
-                current->val = val;
+                current->data.val = val;
                 current->len = p - q;
             } else {
                 // Decimal number
                 char *q = p;
-                current->val = strtol(p, &p, 10);
+                current->data.val = strtol(p, &p, 10);
                 current->len = p - q;
             }
             continue;
@@ -482,25 +624,29 @@ Token *tokenize(char *source, FilePath *file) {
 
         if (*p == '\'') {
             char *q = p;
+            int startOffset = file->base + (p - source);
             char c;
-            ++p;
+            p = skipContinuations(&q, p + 1);
             if (*p == '\0') {
                 errorAtChar(p, "Character literal is not terminated.");
             } else if (*p == '\'') {
                 errorAtChar(q, "Empty character literal.");
             } else if (*p == '\\') {
-                if (!checkEscapeChar(*(++p), &c)) {
+                p = skipContinuations(&q, p + 1);
+                if (!checkEscapeChar(*p, &c)) {
                     errorAtChar(p - 1, "Invalid escape character.");
                 }
             } else {
                 c = *p;
             }
 
-            if (*(++p) != '\'') {
+            p = skipContinuations(&q, p + 1);
+            if (*p != '\'') {
                 errorAtChar(p, "Character literal is too long.");
             }
             appendNewToken(TokenNumber, q, p - q + 1);
-            current->val = c;
+            current->data.val = c;
+            current->offset = startOffset;
             p++;
             continue;
         }
@@ -509,13 +655,30 @@ Token *tokenize(char *source, FilePath *file) {
             char *q = p;
             int literalLen = 0; // String length on text editor.
             int len = 0;        // String length in program.
+            int startOffset = file->base + (p - source);
             LiteralString *str = NULL;
 
             while (*(++p) != '\0') {
+                char *plain = findChars(p, '"', '\\', '\n');
+                len += plain - p;
+                literalLen += plain - p;
+                p = plain;
+                if (*p == '\0' || *p == '\n')
+                    break;
+
                 ++len;
                 ++literalLen;
                 if (*p == '"') {
                     break;
+                } else if (p[0] == '\\' && p[1] == '\n') {
+                    // Line continuation.  Move the string read so far onto it.
+                    memmove(q + 2, q, p - q);
+                    q[0] = '\\';
+                    q[1] = '\n';
+                    q += 2;
+                    ++p;
+                    --len;
+                    --literalLen;
                 } else if (*p == '\\') {
                     char c;
                     ++p;
@@ -529,7 +692,9 @@ Token *tokenize(char *source, FilePath *file) {
                 }
             }
 
-            if (*p == '\0')
+            if (*p == '\n')
+                errorAtChar(p, "String is not terminated.");
+            else if (*p == '\0')
                 errorAtChar(p - 1, "String is not terminated.");
 
             str = (LiteralString *)safeAlloc(sizeof(LiteralString));
@@ -542,24 +707,18 @@ Token *tokenize(char *source, FilePath *file) {
             globals.strings = str;
 
             appendNewToken(TokenLiteralString, q, p - q + 1);
-            current->literalStr = str;
+            current->data.literalStr = str;
+            current->offset = startOffset;
 
             p++; // Skip closing double quote.
             continue;
         }
 
-        if ('a' <= *p && *p <= 'z' || 'A' <= *p && *p <= 'Z' || *p == '_') {
-            char *q = p;
-            while (isAlnum(*p))
-                ++p;
-            appendNewToken(TokenIdent, q, p - q);
-            continue;
-        }
-
         errorAtChar(p, "Cannot tokenize");
     }
 
     appendNewToken(TokenEOF, p, 0);
+    nextSourceBase = file->base + (p - source) + 1;
 
     return head.next;
 }
@@ -333,7 +333,7 @@ static void verityTypeInitVar(Node *var, Node *initializer, Token *token) {
                 verityTypeInitVar(&elem, init, token);
             }
         } else if (initializer->kind == NodeLiteralString) {
-            LiteralString *string = initializer->token->literalStr;
+            LiteralString *string = initializer->token->data.literalStr;
             if (!string)
                 errorUnreachable();
 